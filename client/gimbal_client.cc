@@ -0,0 +1,555 @@
+#include "gimbal_client.h"
+
+#include <algorithm>
+#include <atomic>
+#include <unistd.h>
+
+namespace {
+
+uint64_t steady_ns(std::chrono::steady_clock::time_point time) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            time.time_since_epoch()).count());
+}
+
+// Tells this client apart from other local processes and clients on the
+// server's unix socket, where the server cannot see who is calling.
+std::string new_client_id() {
+    static std::atomic<unsigned> instances{0};
+    return std::to_string(getpid()) + "." + std::to_string(instances++);
+}
+
+}
+
+template<typename Request, typename Response>
+class GimbalClient::UnaryCall final : public grpc::ClientUnaryReactor {
+
+public:
+
+    using Done = std::function<void(const grpc::Status &, const Response &)>;
+
+    UnaryCall(GimbalClient &client, Request request, Done done)
+            : client{client}, request{std::move(request)}, done{std::move(done)},
+              started{std::chrono::steady_clock::now()} {
+        context.AddMetadata("x-client-id", client.client_id);
+    }
+
+    void OnDone(const grpc::Status &status) override {
+        if (done) {
+            done(status, response);
+        }
+        client.on_call_done(started, status);
+        delete this;
+    }
+
+    GimbalClient &client;
+    grpc::ClientContext context;
+    Request request;
+    Response response;
+    Done done;
+    std::chrono::steady_clock::time_point started;
+
+};
+
+struct GimbalClient::ClockSync {
+    int remaining;
+    bool sampled;
+    ClockOffset best;
+    ClockCallback done;
+};
+
+class GimbalClient::SetpointStream final
+        : public grpc::ClientBidiReactor<mavsdk::rpc::gimbal::Setpoint, mavsdk::rpc::gimbal::SetpointAck> {
+
+public:
+
+    explicit SetpointStream(GimbalClient &client) : client{client} {
+        context.set_wait_for_ready(true);
+        context.AddMetadata("x-client-id", client.client_id);
+    }
+
+    void start() {
+        client.stub->async()->StreamSetpoints(&context, this);
+        // Keeps the reactor alive while the client may still start a write,
+        // see OnReadDone().
+        AddHold();
+        StartRead(&ack);
+        StartCall();
+    }
+
+    void OnReadDone(bool ok) override {
+        if (ok) {
+            client.on_setpoint_ack(ack);
+            StartRead(&ack);
+            return;
+        }
+
+        bool release;
+        {
+            std::lock_guard<std::mutex> lock(client.mutex);
+            closing = true;
+            release = !client.writing;
+        }
+        if (release) {
+            RemoveHold();
+        }
+    }
+
+    void OnWriteDone(bool ok) override {
+        bool release;
+        {
+            std::lock_guard<std::mutex> lock(client.mutex);
+            client.writing = false;
+            release = closing;
+        }
+        if (release) {
+            RemoveHold();
+        } else if (ok) {
+            client.pump_setpoints();
+        }
+    }
+
+    void OnDone(const grpc::Status &) override {
+        client.on_setpoint_stream_done(this);
+        delete this;
+    }
+
+    GimbalClient &client;
+    grpc::ClientContext context;
+    mavsdk::rpc::gimbal::Setpoint outgoing;
+    mavsdk::rpc::gimbal::SetpointAck ack;
+    bool started{false}; // Guarded by the client's mutex
+    bool closing{false}; // Guarded by the client's mutex
+
+};
+
+class GimbalClient::AttitudeStream final : public grpc::ClientReadReactor<mavsdk::rpc::gimbal::AttitudeBatch> {
+
+public:
+
+    AttitudeStream(GimbalClient &client, std::chrono::milliseconds window) : client{client} {
+        context.set_wait_for_ready(true);
+        context.AddMetadata("x-client-id", client.client_id);
+        request.set_batch_window_ms(static_cast<uint32_t>(window.count()));
+    }
+
+    void start() {
+        client.stub->async()->SubscribeAttitudeBatch(&context, &request, this);
+        StartRead(&batch);
+        StartCall();
+    }
+
+    void OnReadDone(bool ok) override {
+        if (ok) {
+            client.on_attitude_batch(batch);
+            StartRead(&batch);
+        }
+    }
+
+    void OnDone(const grpc::Status &) override {
+        client.on_attitude_stream_done(this);
+        delete this;
+    }
+
+    GimbalClient &client;
+    grpc::ClientContext context;
+    mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest request;
+    mavsdk::rpc::gimbal::AttitudeBatch batch;
+
+};
+
+GimbalClient::GimbalClient(Config config)
+        : config{std::move(config)}, client_id{new_client_id()},
+          channel{grpc::CreateChannel(this->config.target, grpc::InsecureChannelCredentials())},
+          stub{mavsdk::rpc::gimbal::GimbalService::NewStub(channel)} {
+
+    setpoint_reconnect.backoff = this->config.reconnect_min;
+    attitude_reconnect.backoff = this->config.reconnect_min;
+    worker = std::thread(&GimbalClient::run, this);
+
+}
+
+GimbalClient::~GimbalClient() {
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        stopping = true;
+        if (setpoint_stream) {
+            setpoint_stream->context.TryCancel();
+        }
+        if (attitude_stream) {
+            attitude_stream->context.TryCancel();
+        }
+        changed.notify_all();
+        changed.wait(lock, [this] {
+            return !setpoint_stream && !attitude_stream && calls_in_progress == 0;
+        });
+    }
+    worker.join();
+
+}
+
+void GimbalClient::set_pitch_and_yaw(float pitch_deg, float yaw_deg, ResultCallback done) {
+    mavsdk::rpc::gimbal::SetPitchAndYawRequest request;
+    request.set_pitch_deg(pitch_deg);
+    request.set_yaw_deg(yaw_deg);
+    call<mavsdk::rpc::gimbal::SetPitchAndYawResponse>(std::move(request), [this](auto *context, auto *req, auto *resp, auto *reactor) {
+        stub->async()->SetPitchAndYaw(context, req, resp, reactor);
+    }, std::move(done));
+}
+
+void GimbalClient::set_pitch_rate_and_yaw_rate(float pitch_rate_deg_s, float yaw_rate_deg_s, ResultCallback done) {
+    mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest request;
+    request.set_pitch_rate_deg_s(pitch_rate_deg_s);
+    request.set_yaw_rate_deg_s(yaw_rate_deg_s);
+    call<mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse>(std::move(request), [this](auto *context, auto *req, auto *resp, auto *reactor) {
+        stub->async()->SetPitchRateAndYawRate(context, req, resp, reactor);
+    }, std::move(done));
+}
+
+void GimbalClient::set_mode(mavsdk::rpc::gimbal::GimbalMode mode, ResultCallback done) {
+    mavsdk::rpc::gimbal::SetModeRequest request;
+    request.set_gimbal_mode(mode);
+    call<mavsdk::rpc::gimbal::SetModeResponse>(std::move(request), [this](auto *context, auto *req, auto *resp, auto *reactor) {
+        stub->async()->SetMode(context, req, resp, reactor);
+    }, std::move(done));
+}
+
+void GimbalClient::take_control(ResultCallback done) {
+    mavsdk::rpc::gimbal::TakeControlRequest request;
+    request.set_control_mode(mavsdk::rpc::gimbal::CONTROL_MODE_PRIMARY);
+    call<mavsdk::rpc::gimbal::TakeControlResponse>(std::move(request), [this](auto *context, auto *req, auto *resp, auto *reactor) {
+        stub->async()->TakeControl(context, req, resp, reactor);
+    }, std::move(done));
+}
+
+void GimbalClient::release_control(ResultCallback done) {
+    call<mavsdk::rpc::gimbal::ReleaseControlResponse>(mavsdk::rpc::gimbal::ReleaseControlRequest{}, [this](auto *context, auto *req, auto *resp, auto *reactor) {
+        stub->async()->ReleaseControl(context, req, resp, reactor);
+    }, std::move(done));
+}
+
+void GimbalClient::sync_clock(int rounds, ClockCallback done) {
+    sync_clock_round(std::make_shared<ClockSync>(ClockSync{std::max(rounds, 1), false, {}, std::move(done)}));
+}
+
+void GimbalClient::sync_clock_round(std::shared_ptr<ClockSync> sync) {
+
+    mavsdk::rpc::gimbal::SyncClockRequest request;
+    request.set_client_send_time_ns(steady_ns(std::chrono::steady_clock::now()));
+
+    call_with_response<mavsdk::rpc::gimbal::SyncClockResponse>(std::move(request), [this](auto *context, auto *req, auto *resp, auto *reactor) {
+        stub->async()->SyncClock(context, req, resp, reactor);
+    }, [this, sync](const grpc::Status &status, const mavsdk::rpc::gimbal::SyncClockResponse &response) {
+        if (status.ok()) {
+            auto t1 = static_cast<int64_t>(response.client_send_time_ns());
+            auto t2 = static_cast<int64_t>(response.server_receive_time_ns());
+            auto t3 = static_cast<int64_t>(response.server_send_time_ns());
+            auto t4 = static_cast<int64_t>(steady_ns(std::chrono::steady_clock::now()));
+            auto round_trip = static_cast<uint64_t>(std::max<int64_t>((t4 - t1) - (t3 - t2), 0));
+            if (!sync->sampled || round_trip < sync->best.round_trip_ns) {
+                sync->best = {((t2 - t1) + (t3 - t4)) / 2, round_trip};
+                sync->sampled = true;
+            }
+        }
+
+        if (status.ok() && --sync->remaining > 0) {
+            sync_clock_round(sync);
+            return;
+        }
+
+        if (sync->sampled) {
+            std::lock_guard<std::mutex> lock(mutex);
+            clock_offset_ns = sync->best.offset_ns;
+        }
+        if (sync->done) {
+            sync->done(status, sync->best);
+        }
+    });
+
+}
+
+void GimbalClient::stream_pitch_and_yaw(float pitch_deg, float yaw_deg,
+                                        std::chrono::steady_clock::time_point apply_at) {
+    mavsdk::rpc::gimbal::Setpoint setpoint;
+    setpoint.set_mode(mavsdk::rpc::gimbal::SETPOINT_MODE_ANGLE);
+    setpoint.set_pitch_deg(pitch_deg);
+    setpoint.set_yaw_deg(yaw_deg);
+    stream_setpoint(std::move(setpoint), apply_at);
+}
+
+void GimbalClient::stream_pitch_rate_and_yaw_rate(float pitch_rate_deg_s, float yaw_rate_deg_s,
+                                                  std::chrono::steady_clock::time_point apply_at) {
+    mavsdk::rpc::gimbal::Setpoint setpoint;
+    setpoint.set_mode(mavsdk::rpc::gimbal::SETPOINT_MODE_RATE);
+    setpoint.set_pitch_rate_deg_s(pitch_rate_deg_s);
+    setpoint.set_yaw_rate_deg_s(yaw_rate_deg_s);
+    stream_setpoint(std::move(setpoint), apply_at);
+}
+
+void GimbalClient::subscribe_attitude(std::chrono::milliseconds batch_window, AttitudeCallback callback) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    attitude_window = batch_window;
+    attitude_callback = std::make_shared<AttitudeCallback>(std::move(callback));
+    attitude_reconnect.wanted = true;
+    attitude_reconnect.at = {};
+
+    // A running subscription is restarted with the new window when it ends.
+    if (attitude_stream) {
+        attitude_stream->context.TryCancel();
+    }
+    changed.notify_all();
+
+}
+
+GimbalClient::Metrics GimbalClient::metrics() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    Metrics snapshot = counters;
+    snapshot.call_latency_avg_us = counters.calls > 0 ? call_latency_total_us / counters.calls : 0;
+    return snapshot;
+}
+
+template<typename Response, typename Request, typename Method>
+void GimbalClient::call(Request request, Method method, ResultCallback done) {
+    call_with_response<Response>(std::move(request), method, [done](const grpc::Status &status, const Response &response) {
+        if (done) {
+            done(status, response.gimbal_result());
+        }
+    });
+}
+
+template<typename Response, typename Request, typename Method, typename Done>
+void GimbalClient::call_with_response(Request request, Method method, Done done) {
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        calls_in_progress++;
+    }
+
+    auto *unary = new UnaryCall<Request, Response>(*this, std::move(request), std::move(done));
+    unary->context.set_deadline(std::chrono::system_clock::now() + config.call_timeout);
+    method(&unary->context, &unary->request, &unary->response, unary);
+    unary->StartCall();
+
+}
+
+void GimbalClient::on_call_done(std::chrono::steady_clock::time_point started, const grpc::Status &status) {
+
+    auto latency = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - started).count());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    counters.calls++;
+    if (!status.ok()) {
+        counters.failed_calls++;
+    }
+    counters.call_latency_last_us = latency;
+    counters.call_latency_max_us = std::max(counters.call_latency_max_us, latency);
+    call_latency_total_us += static_cast<double>(latency);
+
+    if (--calls_in_progress == 0) {
+        changed.notify_all();
+    }
+
+}
+
+void GimbalClient::stream_setpoint(mavsdk::rpc::gimbal::Setpoint setpoint,
+                                   std::chrono::steady_clock::time_point apply_at) {
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (apply_at != std::chrono::steady_clock::time_point{}) {
+            setpoint.set_apply_time_ns(static_cast<uint64_t>(
+                    std::max<int64_t>(static_cast<int64_t>(steady_ns(apply_at)) + clock_offset_ns, 1)));
+            timed_setpoints.push_back(std::move(setpoint));
+        } else {
+            setpoint.set_jitter_buffered(config.jitter_buffered);
+            setpoint.set_sample_time_us(steady_ns(std::chrono::steady_clock::now()) / 1000);
+            if (setpoint_dirty) {
+                counters.setpoints_coalesced++;
+            }
+            latest_setpoint = std::move(setpoint);
+            setpoint_dirty = true;
+        }
+        if (!setpoint_reconnect.wanted) {
+            setpoint_reconnect.wanted = true;
+            changed.notify_all();
+        }
+    }
+
+    pump_setpoints();
+
+}
+
+void GimbalClient::pump_setpoints() {
+
+    SetpointStream *stream;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        stream = setpoint_stream;
+        if (!stream || !stream->started || stream->closing || writing) {
+            return;
+        }
+
+        // Timed setpoints wait on the server, so they do not count against
+        // the unacked window.
+        if (!timed_setpoints.empty()) {
+            stream->outgoing = std::move(timed_setpoints.front());
+            timed_setpoints.pop_front();
+            stream->outgoing.set_sequence(next_sequence++);
+        } else if (setpoint_dirty && unacked.size() < config.max_unacked_setpoints) {
+            latest_setpoint.set_sequence(next_sequence++);
+            stream->outgoing = latest_setpoint;
+            setpoint_dirty = false;
+            unacked.emplace_back(latest_setpoint.sequence(), std::chrono::steady_clock::now());
+        } else {
+            return;
+        }
+        writing = true;
+        counters.setpoints_sent++;
+    }
+
+    // The stream holds off OnDone() while writing is set, so it is still alive.
+    stream->StartWrite(&stream->outgoing);
+
+}
+
+void GimbalClient::on_setpoint_ack(const mavsdk::rpc::gimbal::SetpointAck &ack) {
+
+    auto now = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(mutex);
+
+    // Acks of untimed setpoints arrive in order; setpoints superseded on the
+    // server are never acked, so older entries are dropped with the match.
+    auto acked = std::find_if(unacked.begin(), unacked.end(), [&ack](const auto &entry) {
+        return entry.first == ack.sequence();
+    });
+    if (acked != unacked.end()) {
+        auto rtt = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                now - acked->second).count());
+        counters.setpoint_rtt_last_us = rtt;
+        counters.setpoint_rtt_max_us = std::max(counters.setpoint_rtt_max_us, rtt);
+        unacked.erase(unacked.begin(), acked + 1);
+    }
+    counters.setpoints_acked++;
+    setpoint_reconnect.backoff = config.reconnect_min;
+    lock.unlock();
+
+    pump_setpoints();
+
+}
+
+void GimbalClient::on_setpoint_stream_done(SetpointStream *stream) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (setpoint_stream == stream) {
+        setpoint_stream = nullptr;
+    }
+    writing = false;
+
+    // Resume with the newest setpoint if the server may not have applied it.
+    if (!unacked.empty()) {
+        setpoint_dirty = true;
+        unacked.clear();
+    }
+
+    schedule_reconnect(setpoint_reconnect);
+    changed.notify_all();
+
+}
+
+void GimbalClient::on_attitude_batch(const mavsdk::rpc::gimbal::AttitudeBatch &batch) {
+
+    std::shared_ptr<AttitudeCallback> callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        callback = attitude_callback;
+        attitude_reconnect.backoff = config.reconnect_min;
+    }
+    if (!callback) {
+        return;
+    }
+
+    uint64_t timestamp_ms = batch.base_timestamp_ms();
+    for (int i = 0; i < batch.time_delta_ms_size(); i++) {
+        timestamp_ms += batch.time_delta_ms(i);
+        (*callback)({timestamp_ms,
+                     static_cast<float>(batch.roll_cdeg(i)) / 100.0f,
+                     static_cast<float>(batch.pitch_cdeg(i)) / 100.0f,
+                     static_cast<float>(batch.yaw_cdeg(i)) / 100.0f});
+    }
+
+}
+
+void GimbalClient::on_attitude_stream_done(AttitudeStream *stream) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (attitude_stream == stream) {
+        attitude_stream = nullptr;
+    }
+    schedule_reconnect(attitude_reconnect);
+    changed.notify_all();
+
+}
+
+void GimbalClient::schedule_reconnect(Reconnect &reconnect) {
+    if (stopping || !reconnect.wanted) {
+        return;
+    }
+    counters.reconnects++;
+    reconnect.at = std::chrono::steady_clock::now() + reconnect.backoff;
+    reconnect.backoff = std::min(reconnect.backoff * 2, config.reconnect_max);
+}
+
+void GimbalClient::run() {
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (!stopping) {
+        auto now = std::chrono::steady_clock::now();
+
+        // Streams are started outside the lock: gRPC may run reactions on
+        // the calling thread.
+        if (setpoint_reconnect.wanted && !setpoint_stream && now >= setpoint_reconnect.at) {
+            auto *stream = new SetpointStream(*this);
+            setpoint_stream = stream;
+            lock.unlock();
+            stream->start();
+            lock.lock();
+            // The stream may already have ended, e.g. when cancelled.
+            if (setpoint_stream == stream) {
+                stream->started = true;
+            }
+            lock.unlock();
+            pump_setpoints();
+            lock.lock();
+            continue;
+        }
+        if (attitude_reconnect.wanted && !attitude_stream && now >= attitude_reconnect.at) {
+            auto *stream = new AttitudeStream(*this, attitude_window);
+            attitude_stream = stream;
+            lock.unlock();
+            stream->start();
+            lock.lock();
+            continue;
+        }
+
+        auto next = std::chrono::steady_clock::time_point::max();
+        if (setpoint_reconnect.wanted && !setpoint_stream) {
+            next = std::min(next, setpoint_reconnect.at);
+        }
+        if (attitude_reconnect.wanted && !attitude_stream) {
+            next = std::min(next, attitude_reconnect.at);
+        }
+        if (next == std::chrono::steady_clock::time_point::max()) {
+            changed.wait(lock);
+        } else {
+            changed.wait_until(lock, next);
+        }
+    }
+
+}
@@ -0,0 +1,171 @@
+#ifndef GIMBAL_MAVSDK_GIMBAL_CLIENT_H
+#define GIMBAL_MAVSDK_GIMBAL_CLIENT_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <grpcpp/grpcpp.h>
+#include "gimbal.grpc.pb.h"
+
+// Asynchronous client for the gimbal service.
+//
+// Calls return immediately and deliver their result to a callback, which
+// runs on a gRPC thread and must not block.
+//
+// sync_clock() estimates the offset to the server's monotonic clock, so that
+// streamed setpoints can be given an apply time on the client's clock.
+//
+// Setpoints can also be streamed over one long-lived call. Only a few
+// setpoints are allowed on the wire unacknowledged, and only the newest one
+// is kept while waiting, so a stalled network costs latency for one setpoint
+// rather than a growing backlog in transport buffers. Streams that break
+// are re-opened with exponential backoff; the newest unacknowledged setpoint
+// is re-sent and the attitude subscription is resumed.
+class GimbalClient final {
+
+public:
+
+    struct Config {
+        std::string target = "localhost:11520"; // unix:/tmp/gimbal_mavsdk.sock from the same machine
+        std::chrono::milliseconds call_timeout{2000};
+        std::chrono::milliseconds reconnect_min{100};
+        std::chrono::milliseconds reconnect_max{5000};
+        std::size_t max_unacked_setpoints = 2; // Written but not yet acknowledged
+        bool jitter_buffered = false; // Have the server smooth untimed streamed setpoints, e.g. from a joystick
+    };
+
+    struct AttitudeSample {
+        uint64_t timestamp_ms;
+        float roll_deg;
+        float pitch_deg;
+        float yaw_deg;
+    };
+
+    struct Metrics {
+        uint64_t calls;
+        uint64_t failed_calls;
+        uint64_t call_latency_last_us;
+        uint64_t call_latency_max_us;
+        double call_latency_avg_us;
+        uint64_t setpoints_sent;
+        uint64_t setpoints_acked;
+        uint64_t setpoints_coalesced;   // Replaced by a newer setpoint before they were written
+        uint64_t setpoint_rtt_last_us;  // Write to ack
+        uint64_t setpoint_rtt_max_us;
+        uint64_t reconnects;
+    };
+
+    // Estimated server clock minus client clock, from the round trip with
+    // the least delay.
+    struct ClockOffset {
+        int64_t offset_ns;
+        uint64_t round_trip_ns;
+    };
+
+    using ResultCallback = std::function<void(const grpc::Status &, const mavsdk::rpc::gimbal::GimbalResult &)>;
+    using AttitudeCallback = std::function<void(const AttitudeSample &)>;
+    using ClockCallback = std::function<void(const grpc::Status &, const ClockOffset &)>;
+
+    explicit GimbalClient(Config config);
+    ~GimbalClient();
+
+    GimbalClient(const GimbalClient &) = delete;
+    GimbalClient &operator=(const GimbalClient &) = delete;
+
+    void set_pitch_and_yaw(float pitch_deg, float yaw_deg, ResultCallback done);
+    void set_pitch_rate_and_yaw_rate(float pitch_rate_deg_s, float yaw_rate_deg_s, ResultCallback done);
+    void set_mode(mavsdk::rpc::gimbal::GimbalMode mode, ResultCallback done);
+    void take_control(ResultCallback done);
+    void release_control(ResultCallback done);
+
+    // Runs the given number of clock samples one after another and keeps the
+    // best. The result is used for the apply times of later setpoints.
+    void sync_clock(int rounds, ClockCallback done);
+
+    // Streamed setpoints, newest wins. The stream is opened on first use.
+    // With an apply time the server holds the setpoint until then; it needs
+    // a clock offset from sync_clock() to be meaningful. Timed setpoints are
+    // all sent, in order, and are never coalesced.
+    void stream_pitch_and_yaw(float pitch_deg, float yaw_deg,
+                              std::chrono::steady_clock::time_point apply_at = {});
+    void stream_pitch_rate_and_yaw_rate(float pitch_rate_deg_s, float yaw_rate_deg_s,
+                                        std::chrono::steady_clock::time_point apply_at = {});
+
+    // Batched camera attitude, delivered one sample at a time. Replaces any
+    // previous subscription.
+    void subscribe_attitude(std::chrono::milliseconds batch_window, AttitudeCallback callback);
+
+    Metrics metrics() const;
+
+private:
+
+    template<typename Request, typename Response>
+    class UnaryCall;
+    class SetpointStream;
+    class AttitudeStream;
+    struct ClockSync;
+
+    // Reconnection state of one stream.
+    struct Reconnect {
+        bool wanted{false};
+        std::chrono::steady_clock::time_point at{};
+        std::chrono::milliseconds backoff{};
+    };
+
+    template<typename Response, typename Request, typename Method>
+    void call(Request request, Method method, ResultCallback done);
+    template<typename Response, typename Request, typename Method, typename Done>
+    void call_with_response(Request request, Method method, Done done);
+    void on_call_done(std::chrono::steady_clock::time_point started, const grpc::Status &status);
+
+    void sync_clock_round(std::shared_ptr<ClockSync> sync);
+    void stream_setpoint(mavsdk::rpc::gimbal::Setpoint setpoint, std::chrono::steady_clock::time_point apply_at);
+    void pump_setpoints();
+    void on_setpoint_ack(const mavsdk::rpc::gimbal::SetpointAck &ack);
+    void on_setpoint_stream_done(SetpointStream *stream);
+    void on_attitude_batch(const mavsdk::rpc::gimbal::AttitudeBatch &batch);
+    void on_attitude_stream_done(AttitudeStream *stream);
+    void schedule_reconnect(Reconnect &reconnect);
+    void run();
+
+    const Config config;
+    const std::string client_id; // Sent as x-client-id, see ClientLimiter
+    std::shared_ptr<grpc::Channel> channel;
+    std::unique_ptr<mavsdk::rpc::gimbal::GimbalService::Stub> stub;
+
+    mutable std::mutex mutex;
+    std::condition_variable changed;
+    bool stopping{false};
+    std::size_t calls_in_progress{0};
+    Metrics counters{};
+    double call_latency_total_us{0};
+
+    int64_t clock_offset_ns{0};
+
+    SetpointStream *setpoint_stream{nullptr};
+    Reconnect setpoint_reconnect;
+    mavsdk::rpc::gimbal::Setpoint latest_setpoint;
+    bool setpoint_dirty{false}; // latest_setpoint has not been written to the current stream
+    bool writing{false};
+    uint64_t next_sequence{1};
+    std::deque<std::pair<uint64_t, std::chrono::steady_clock::time_point>> unacked;
+    std::deque<mavsdk::rpc::gimbal::Setpoint> timed_setpoints; // Not yet written
+
+    AttitudeStream *attitude_stream{nullptr};
+    Reconnect attitude_reconnect;
+    std::chrono::milliseconds attitude_window{};
+    std::shared_ptr<AttitudeCallback> attitude_callback;
+
+    std::thread worker;
+
+};
+
+#endif // GIMBAL_MAVSDK_GIMBAL_CLIENT_H
@@ -0,0 +1,177 @@
+#ifndef GIMBAL_MAVSDK_SHM_CLIENT_H
+#define GIMBAL_MAVSDK_SHM_CLIENT_H
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "shm_layout.h"
+
+// Client for the gimbal service's shared-memory channel, for processes on
+// the same machine as the service.
+//
+// Reads copy the latest published value without a system call. Setpoints are
+// queued in the ring and the service is woken only if it is asleep. One
+// process at a time can send setpoints; it becomes the producer on its first
+// send and stays one until it is destroyed or exits.
+//
+// The service creates a new segment when it restarts. A client whose alive()
+// stays false should be destroyed and created again.
+class ShmGimbalClient final {
+
+public:
+
+    struct Attitude {
+        std::chrono::steady_clock::time_point measured_at;
+        float roll_deg;
+        float pitch_deg;
+        float yaw_deg;
+    };
+
+    explicit ShmGimbalClient(const std::string &name = shm_default_name) {
+
+        auto fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            return;
+        }
+        struct stat status{};
+        if (fstat(fd, &status) == 0 && static_cast<std::size_t>(status.st_size) >= sizeof(ShmSegment)) {
+            auto mapped = mmap(nullptr, sizeof(ShmSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (mapped != MAP_FAILED) {
+                segment = static_cast<ShmSegment *>(mapped);
+            }
+        }
+        close(fd);
+
+        if (segment && (segment->magic.load(std::memory_order_acquire) != ShmSegment::magic_value
+                        || segment->version != ShmSegment::layout_version)) {
+            munmap(segment, sizeof(ShmSegment));
+            segment = nullptr;
+        }
+
+    }
+
+    ~ShmGimbalClient() {
+        if (!segment) {
+            return;
+        }
+        if (producing) {
+            auto pid = static_cast<int32_t>(getpid());
+            segment->producer_pid.compare_exchange_strong(pid, 0);
+        }
+        munmap(segment, sizeof(ShmSegment));
+    }
+
+    ShmGimbalClient(const ShmGimbalClient &) = delete;
+    ShmGimbalClient &operator=(const ShmGimbalClient &) = delete;
+
+    bool connected() const { return segment != nullptr; }
+
+    // Whether the service has updated the segment within max_age.
+    bool alive(std::chrono::milliseconds max_age = std::chrono::milliseconds(500)) const {
+        if (!segment) {
+            return false;
+        }
+        auto heartbeat = std::chrono::steady_clock::time_point{std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::nanoseconds(segment->heartbeat_ns.load(std::memory_order_relaxed)))};
+        return std::chrono::steady_clock::now() - heartbeat <= max_age;
+    }
+
+    // False until the service has published a value.
+    bool attitude(Attitude &attitude) const {
+        ShmAttitude published;
+        if (!segment || !segment->attitude.load(published)) {
+            return false;
+        }
+        attitude.measured_at = std::chrono::steady_clock::time_point{std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::nanoseconds(published.timestamp_ns))};
+        attitude.roll_deg = published.roll_deg;
+        attitude.pitch_deg = published.pitch_deg;
+        attitude.yaw_deg = published.yaw_deg;
+        return true;
+    }
+
+    bool control(ShmControl &control) const {
+        return segment && segment->control.load(control);
+    }
+
+    // Setpoints return a ticket for consumed(), or 0 if the ring is full or
+    // another process is sending setpoints. apply_at is on the monotonic
+    // clock; the default applies the setpoint at once.
+    uint64_t set_pitch_and_yaw(float pitch_deg, float yaw_deg, std::chrono::steady_clock::time_point apply_at = {}) {
+        return push({ShmSetpointKind::Angles, pitch_deg, yaw_deg, to_ns(apply_at)});
+    }
+
+    uint64_t set_pitch_rate_and_yaw_rate(float pitch_rate_deg_s, float yaw_rate_deg_s,
+                                         std::chrono::steady_clock::time_point apply_at = {}) {
+        return push({ShmSetpointKind::Rates, pitch_rate_deg_s, yaw_rate_deg_s, to_ns(apply_at)});
+    }
+
+    // Goes through the ring without moving the gimbal.
+    uint64_t ping() {
+        return push({ShmSetpointKind::Ping, 0, 0, 0});
+    }
+
+    // Whether the service has taken the setpoint off the ring and handed it
+    // to its command scheduler.
+    bool consumed(uint64_t ticket) const {
+        return segment && segment->tail.load(std::memory_order_acquire) >= ticket;
+    }
+
+private:
+
+    static uint64_t to_ns(std::chrono::steady_clock::time_point time) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count());
+    }
+
+    // Becomes the producer if there is none, or the previous one has exited.
+    bool claim() {
+        if (producing) {
+            return true;
+        }
+        auto pid = static_cast<int32_t>(getpid());
+        int32_t current = 0;
+        while (!segment->producer_pid.compare_exchange_strong(current, pid)) {
+            if (kill(current, 0) == 0 || errno != ESRCH) {
+                return false;
+            }
+        }
+        producing = true;
+        return true;
+    }
+
+    uint64_t push(const ShmSetpoint &setpoint) {
+
+        if (!segment || !claim()) {
+            return 0;
+        }
+
+        auto head = segment->head.load(std::memory_order_relaxed);
+        if (head - segment->tail.load(std::memory_order_acquire) >= ShmSegment::ring_capacity) {
+            return 0;
+        }
+        segment->setpoints[head % ShmSegment::ring_capacity] = setpoint;
+        segment->head.store(head + 1, std::memory_order_release);
+
+        // Pairs with the service setting consumer_sleeping before it checks
+        // the ring one last time: either it sees the new head, or this sees
+        // it asleep.
+        segment->doorbell.fetch_add(1, std::memory_order_seq_cst);
+        if (segment->consumer_sleeping.load(std::memory_order_seq_cst)) {
+            shm_futex_wake(segment->doorbell);
+        }
+        return head + 1;
+
+    }
+
+    ShmSegment *segment{nullptr};
+    bool producing{false};
+
+};
+
+#endif // GIMBAL_MAVSDK_SHM_CLIENT_H
@@ -0,0 +1,153 @@
+#ifndef GIMBAL_MAVSDK_SHM_LAYOUT_H
+#define GIMBAL_MAVSDK_SHM_LAYOUT_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <type_traits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Layout of the POSIX shared-memory segment the gimbal service shares with
+// processes on the same machine.
+//
+// Camera attitude and gimbal control state are published under seqlocks:
+// readers never block the service and retry while an update is under way.
+// Setpoints go the other way through a single-producer single-consumer ring.
+// The segment holds nothing but lock-free atomics and plain data, so it means
+// the same thing in every process that maps it. Times are on the monotonic
+// clock, which all processes on the machine share.
+
+constexpr char shm_default_name[] = "/gimbal_mavsdk";
+
+// A value of trivially copyable T under a sequence counter. The single
+// writer makes the counter odd, stores the value and makes it even again;
+// a reader takes the value if the counter was the same even number before
+// and after copying it.
+template<typename T>
+class ShmSeqlock final {
+
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock values are copied bytewise");
+
+public:
+
+    void store(const T &value) {
+        uint64_t words[word_count]{};
+        std::memcpy(words, &value, sizeof(T));
+
+        auto before = sequence.load(std::memory_order_relaxed);
+        sequence.store(before + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < word_count; i++) {
+            data[i].store(words[i], std::memory_order_relaxed);
+        }
+        sequence.store(before + 2, std::memory_order_release);
+    }
+
+    // False if nothing was stored yet, or the writer did not finish an
+    // update within max_attempts, e.g. because it died in the middle of one.
+    bool load(T &value, int max_attempts = 1000) const {
+        for (int attempt = 0; attempt < max_attempts; attempt++) {
+            auto before = sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                continue;
+            }
+            uint64_t words[word_count];
+            for (std::size_t i = 0; i < word_count; i++) {
+                words[i] = data[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before) {
+                if (before == 0) {
+                    return false;
+                }
+                std::memcpy(&value, words, sizeof(T));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Number of stores so far.
+    uint64_t version() const { return sequence.load(std::memory_order_acquire) / 2; }
+
+private:
+
+    static constexpr std::size_t word_count = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint64_t> sequence{0};
+    std::atomic<uint64_t> data[word_count]{};
+
+};
+
+struct ShmAttitude {
+    uint64_t timestamp_ns; // When the vehicle measured it, monotonic clock
+    float roll_deg;
+    float pitch_deg;
+    float yaw_deg;
+};
+
+struct ShmControl {
+    int32_t mode; // 0 none, 1 primary, 2 secondary, as mavsdk::Gimbal::ControlMode
+    int32_t sysid_primary;
+    int32_t compid_primary;
+    int32_t sysid_secondary;
+    int32_t compid_secondary;
+};
+
+enum class ShmSetpointKind : uint32_t {
+    Ping,   // Consumed without commanding the gimbal, to measure the channel
+    Angles,
+    Rates
+};
+
+struct ShmSetpoint {
+    ShmSetpointKind kind;
+    float pitch; // Degrees, or degrees per second for rates
+    float yaw;
+    uint64_t apply_time_ns; // Monotonic clock; 0 to apply at once
+};
+
+struct ShmSegment {
+
+    static constexpr uint32_t magic_value = 0x47424d4c;
+    static constexpr uint32_t layout_version = 1;
+    static constexpr std::size_t ring_capacity = 64;
+
+    std::atomic<uint32_t> magic;  // Stored last once the service has set up the segment
+    uint32_t version;
+    std::atomic<uint64_t> heartbeat_ns; // Updated by the service while it runs, monotonic clock
+
+    alignas(64) ShmSeqlock<ShmAttitude> attitude;
+    alignas(64) ShmSeqlock<ShmControl> control;
+
+    // Only the process holding producer_pid writes setpoints and head; only
+    // the service writes tail. The producer bumps doorbell after each push
+    // and wakes it with a futex if consumer_sleeping is set.
+    alignas(64) std::atomic<int32_t> producer_pid;
+    std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+    std::atomic<uint32_t> doorbell;
+    std::atomic<uint32_t> consumer_sleeping;
+    alignas(64) ShmSetpoint setpoints[ring_capacity];
+
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free
+              && std::atomic<int32_t>::is_always_lock_free,
+              "Atomics in shared memory must not need a lock");
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The doorbell is used as a futex word");
+
+// Shared (not process-private) futex operations on a doorbell word.
+inline void shm_futex_wait(std::atomic<uint32_t> &word, uint32_t expected, const timespec *timeout) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, expected, timeout, nullptr, 0);
+}
+
+inline void shm_futex_wake(std::atomic<uint32_t> &word) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+}
+
+#endif // GIMBAL_MAVSDK_SHM_LAYOUT_H
@@ -0,0 +1,38 @@
+#include "admission_control.h"
+
+#include <algorithm>
+
+std::chrono::milliseconds AdmissionControl::admit(CommandScheduler::Priority priority) {
+
+    if (priority == CommandScheduler::Priority::Control) {
+        admitted.fetch_add(1, std::memory_order_relaxed);
+        return std::chrono::milliseconds::zero();
+    }
+
+    auto load = scheduler.load();
+    auto drain = load.drain_interval * static_cast<int64_t>(load.backlog);
+    if (load.backlog < config.max_backlog && drain <= config.max_drain) {
+        admitted.fetch_add(1, std::memory_order_relaxed);
+        return std::chrono::milliseconds::zero();
+    }
+
+    // Long enough for the backlog to come back under both limits.
+    auto excess = load.backlog >= config.max_backlog ? static_cast<int64_t>(load.backlog + 1 - config.max_backlog) : 0;
+    auto wait = std::max(load.drain_interval * excess, drain - config.max_drain);
+    auto retry_after = std::clamp(std::chrono::ceil<std::chrono::milliseconds>(wait),
+                                  config.min_retry_after, config.max_retry_after);
+
+    shed.fetch_add(1, std::memory_order_relaxed);
+    retry_after_last_ms.store(retry_after.count(), std::memory_order_relaxed);
+    return retry_after;
+
+}
+
+void AdmissionControl::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        samples.push_back({"admission.admitted", static_cast<double>(admitted.load(std::memory_order_relaxed))});
+        samples.push_back({"admission.shed", static_cast<double>(shed.load(std::memory_order_relaxed))});
+        samples.push_back({"admission.retry_after_last_ms",
+                           static_cast<double>(retry_after_last_ms.load(std::memory_order_relaxed))});
+    });
+}
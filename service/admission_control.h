@@ -0,0 +1,56 @@
+#ifndef GIMBAL_MAVSDK_ADMISSION_CONTROL_H
+#define GIMBAL_MAVSDK_ADMISSION_CONTROL_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "command_scheduler.h"
+#include "metrics.h"
+
+// Sheds setpoint calls while the MAVLink link is behind.
+//
+// When the link cannot keep up, commands pile up in the scheduler and every
+// call behind them waits until it times out. Each unary setpoint call is
+// checked against the scheduler's backlog and the time it will take to
+// drain; past either limit the call is refused at once, with a hint of when
+// the backlog should have drained, instead of adding to it.
+//
+// Control commands are always admitted: they are dispatched ahead of queued
+// setpoints anyway, and are what a client needs to take the gimbal back.
+// Setpoint streams are not shed either, since the scheduler already
+// supersedes their older setpoints.
+class AdmissionControl final {
+
+public:
+
+    struct Config {
+        // Commands queued or on the link. A full pipeline (8 in flight) is
+        // normal under load; only shed once the scheduler's setpoint queue
+        // (4) has filled up behind it as well.
+        std::size_t max_backlog = 12;
+        std::chrono::milliseconds max_drain{250}; // Estimated time to clear the backlog
+        std::chrono::milliseconds min_retry_after{10};
+        std::chrono::milliseconds max_retry_after{2000};
+    };
+
+    AdmissionControl(const CommandScheduler &scheduler, Config config) : scheduler{scheduler}, config{config} {}
+
+    // How long to wait before retrying if the command is shed, zero if it is
+    // admitted.
+    std::chrono::milliseconds admit(CommandScheduler::Priority priority);
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+private:
+
+    const CommandScheduler &scheduler;
+    const Config config;
+
+    std::atomic<uint64_t> admitted{0};
+    std::atomic<uint64_t> shed{0};
+    std::atomic<int64_t> retry_after_last_ms{0};
+
+};
+
+#endif // GIMBAL_MAVSDK_ADMISSION_CONTROL_H
@@ -0,0 +1,74 @@
+#include "attitude_batcher.h"
+
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+int32_t to_centidegrees(float degrees) {
+    return static_cast<int32_t>(std::lround(degrees * 100.0f));
+}
+
+}
+
+AttitudeBatcher::AttitudeBatcher(mavsdk::Telemetry &telemetry, const VehicleClock &clock) : telemetry{telemetry} {
+    handle = telemetry.subscribe_camera_attitude_euler([this, &clock](mavsdk::Telemetry::EulerAngle angle) {
+        auto measured = clock.measured_at(angle.timestamp_us, std::chrono::steady_clock::now());
+        angle.timestamp_us = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(measured.time_since_epoch()).count());
+        std::lock_guard<std::mutex> lock(mutex);
+        if (samples.size() < max_samples) {
+            samples.push_back(angle);
+        }
+    });
+}
+
+AttitudeBatcher::~AttitudeBatcher() {
+    telemetry.unsubscribe_camera_attitude_euler(handle);
+}
+
+std::size_t AttitudeBatcher::take(mavsdk::rpc::gimbal::AttitudeBatch &batch) {
+
+    taken.clear();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        samples.swap(taken);
+    }
+
+    encode(taken, batch);
+    return taken.size();
+
+}
+
+void AttitudeBatcher::encode(const std::vector<mavsdk::Telemetry::EulerAngle> &samples,
+                             mavsdk::rpc::gimbal::AttitudeBatch &batch) {
+
+    batch.Clear();
+    if (samples.empty()) {
+        return;
+    }
+
+    auto count = static_cast<int>(samples.size());
+    batch.mutable_time_delta_ms()->Reserve(count);
+    batch.mutable_roll_cdeg()->Reserve(count);
+    batch.mutable_pitch_cdeg()->Reserve(count);
+    batch.mutable_yaw_cdeg()->Reserve(count);
+
+    // Deltas are taken between whole milliseconds so rounding does not
+    // accumulate over the batch.
+    uint64_t previous_ms = samples.front().timestamp_us / 1000;
+    batch.set_base_timestamp_ms(previous_ms);
+    std::chrono::steady_clock::time_point base{std::chrono::microseconds(samples.front().timestamp_us)};
+    batch.set_base_wall_time_ms(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            VehicleClock::to_wall(base).time_since_epoch()).count()));
+
+    for (const auto &sample : samples) {
+        uint64_t timestamp_ms = sample.timestamp_us / 1000;
+        batch.add_time_delta_ms(static_cast<int32_t>(static_cast<int64_t>(timestamp_ms - previous_ms)));
+        batch.add_roll_cdeg(to_centidegrees(sample.roll_deg));
+        batch.add_pitch_cdeg(to_centidegrees(sample.pitch_deg));
+        batch.add_yaw_cdeg(to_centidegrees(sample.yaw_deg));
+        previous_ms = timestamp_ms;
+    }
+
+}
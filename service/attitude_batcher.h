@@ -0,0 +1,53 @@
+#ifndef GIMBAL_MAVSDK_ATTITUDE_BATCHER_H
+#define GIMBAL_MAVSDK_ATTITUDE_BATCHER_H
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include <mavsdk/plugins/telemetry/telemetry.h>
+#include "gimbal.pb.h"
+#include "vehicle_clock.h"
+
+// Collects camera attitude samples for one subscriber and packs them into
+// AttitudeBatch messages.
+//
+// With quantized angles and millisecond deltas a sample costs around 10 bytes
+// on the wire, against roughly 50 for one EulerAngle message per sample once
+// gRPC and HTTP/2 framing are counted.
+//
+// Samples are restamped with the time the vehicle measured them, in
+// microseconds on the server's monotonic clock. Each batch also carries the
+// wall clock time of its first sample.
+class AttitudeBatcher final {
+
+public:
+
+    // Samples beyond this are dropped until the next take(), so a stalled
+    // client cannot grow the buffer without bound.
+    static constexpr std::size_t max_samples = 4096;
+
+    AttitudeBatcher(mavsdk::Telemetry &telemetry, const VehicleClock &clock);
+    ~AttitudeBatcher();
+
+    AttitudeBatcher(const AttitudeBatcher &) = delete;
+    AttitudeBatcher &operator=(const AttitudeBatcher &) = delete;
+
+    // Replaces the contents of batch with the samples collected since the
+    // previous call. Returns the number of samples.
+    std::size_t take(mavsdk::rpc::gimbal::AttitudeBatch &batch);
+
+    static void encode(const std::vector<mavsdk::Telemetry::EulerAngle> &samples,
+                       mavsdk::rpc::gimbal::AttitudeBatch &batch);
+
+private:
+
+    mavsdk::Telemetry &telemetry;
+    mavsdk::Telemetry::CameraAttitudeEulerHandle handle;
+
+    std::mutex mutex;
+    std::vector<mavsdk::Telemetry::EulerAngle> samples;
+    std::vector<mavsdk::Telemetry::EulerAngle> taken;
+
+};
+
+#endif // GIMBAL_MAVSDK_ATTITUDE_BATCHER_H
@@ -0,0 +1,185 @@
+#include "attitude_estimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Into [-180, 180).
+float wrap_degrees(double degrees) {
+    auto wrapped = std::fmod(degrees + 180.0, 360.0);
+    if (wrapped < 0) {
+        wrapped += 360.0;
+    }
+    return static_cast<float>(wrapped - 180.0);
+}
+
+double seconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double>(duration).count();
+}
+
+}
+
+AttitudeEstimator::AttitudeEstimator(mavsdk::Telemetry &telemetry, const VehicleClock &clock, Config config)
+        : telemetry{telemetry}, clock{clock}, config{config} {
+    handle = telemetry.subscribe_camera_attitude_euler([this](mavsdk::Telemetry::EulerAngle angle) {
+        on_sample(angle, std::chrono::steady_clock::now());
+    });
+}
+
+AttitudeEstimator::~AttitudeEstimator() {
+    telemetry.unsubscribe_camera_attitude_euler(handle);
+}
+
+void AttitudeEstimator::command_angles(float pitch_deg, float yaw_deg) {
+    std::lock_guard<std::mutex> lock(mutex);
+    command = Command::Angles;
+    commanded_pitch = pitch_deg;
+    commanded_yaw = yaw_deg;
+    commanded_at = std::chrono::steady_clock::now();
+    confirming = Tracer::enabled() ? Tracer::current() : Tracer::Context{};
+}
+
+void AttitudeEstimator::command_rates(float pitch_rate_deg_s, float yaw_rate_deg_s) {
+    std::lock_guard<std::mutex> lock(mutex);
+    command = Command::Rates;
+    commanded_pitch = pitch_rate_deg_s;
+    commanded_yaw = yaw_rate_deg_s;
+    commanded_at = std::chrono::steady_clock::now();
+    confirming = {};
+}
+
+void AttitudeEstimator::command_none() {
+    std::lock_guard<std::mutex> lock(mutex);
+    command = Command::None;
+    confirming = {};
+}
+
+bool AttitudeEstimator::commanded_angles(float &pitch_deg, float &yaw_deg) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (command != Command::Angles) {
+        return false;
+    }
+    pitch_deg = commanded_pitch;
+    yaw_deg = commanded_yaw;
+    return true;
+}
+
+bool AttitudeEstimator::predict(std::chrono::steady_clock::time_point at, mavsdk::Telemetry::EulerAngle &angle) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!sampled) {
+        return false;
+    }
+    counters.predictions++;
+    angle = extrapolate(at);
+    return true;
+
+}
+
+AttitudeEstimator::Stats AttitudeEstimator::stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    Stats snapshot = counters;
+    snapshot.error_avg_deg = counters.checked > 0 ? error_total_deg / static_cast<double>(counters.checked) : 0;
+    return snapshot;
+}
+
+void AttitudeEstimator::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        auto s = stats();
+        samples.push_back({"estimator.samples", static_cast<double>(s.samples)});
+        samples.push_back({"estimator.predictions", static_cast<double>(s.predictions)});
+        samples.push_back({"estimator.checked", static_cast<double>(s.checked)});
+        samples.push_back({"estimator.error_last_deg", s.error_last_deg});
+        samples.push_back({"estimator.error_avg_deg", s.error_avg_deg});
+        samples.push_back({"estimator.error_max_deg", s.error_max_deg});
+    });
+}
+
+void AttitudeEstimator::on_sample(const mavsdk::Telemetry::EulerAngle &angle,
+                                  std::chrono::steady_clock::time_point arrival) {
+
+    auto measured = clock.measured_at(angle.timestamp_us, arrival);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    counters.samples++;
+
+    if (sampled) {
+        if (measured - latest_at <= config.max_prediction) {
+            auto predicted = extrapolate(measured);
+            auto error = std::max({std::abs(predicted.roll_deg - angle.roll_deg),
+                                   std::abs(predicted.pitch_deg - angle.pitch_deg),
+                                   std::abs(wrap_degrees(predicted.yaw_deg - angle.yaw_deg))});
+            counters.checked++;
+            counters.error_last_deg = error;
+            counters.error_max_deg = std::max(counters.error_max_deg, counters.error_last_deg);
+            error_total_deg += error;
+        }
+
+        // Rates are measured on the vehicle's timestamps, which do not carry
+        // the link's jitter. After a long gap they start over.
+        auto dt = static_cast<double>(static_cast<int64_t>(angle.timestamp_us - latest.timestamp_us)) / 1e6;
+        if (dt > 0 && dt < 1.0) {
+            auto smooth = [this](float &rate, double measured) {
+                rate = static_cast<float>(rate + config.rate_smoothing * (measured - rate));
+            };
+            smooth(roll_rate, (angle.roll_deg - latest.roll_deg) / dt);
+            smooth(pitch_rate, (angle.pitch_deg - latest.pitch_deg) / dt);
+            smooth(yaw_rate, wrap_degrees(angle.yaw_deg - latest.yaw_deg) / dt);
+        } else if (dt >= 1.0) {
+            roll_rate = pitch_rate = yaw_rate = 0;
+        }
+    }
+
+    if (confirming.trace != 0 && std::abs(angle.pitch_deg - commanded_pitch) <= config.confirm_tolerance_deg
+        && std::abs(wrap_degrees(angle.yaw_deg - commanded_yaw)) <= config.confirm_tolerance_deg) {
+        Tracer::record("telemetry.confirm", {confirming.trace, Tracer::new_track()}, commanded_at, arrival);
+        confirming = {};
+    }
+
+    latest = angle;
+    latest_at = measured;
+    sampled = true;
+
+}
+
+mavsdk::Telemetry::EulerAngle AttitudeEstimator::extrapolate(std::chrono::steady_clock::time_point at) const {
+
+    auto dt = std::clamp(seconds(at - latest_at),
+                         -seconds(config.max_prediction), seconds(config.max_prediction));
+
+    auto angle = latest;
+    angle.timestamp_us = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(at.time_since_epoch()).count());
+    angle.roll_deg = static_cast<float>(latest.roll_deg + roll_rate * dt);
+
+    if (command == Command::None || dt <= 0) {
+        angle.pitch_deg = static_cast<float>(latest.pitch_deg + pitch_rate * dt);
+        angle.yaw_deg = wrap_degrees(latest.yaw_deg + yaw_rate * dt);
+        return angle;
+    }
+
+    // The measured rate holds until the command went out, the command's
+    // model after that.
+    auto to_command = std::clamp(seconds(commanded_at - latest_at), 0.0, dt);
+    angle.pitch_deg = follow_command(latest.pitch_deg, pitch_rate, commanded_pitch, to_command, dt - to_command);
+    angle.yaw_deg = wrap_degrees(follow_command(latest.yaw_deg, yaw_rate, commanded_yaw, to_command, dt - to_command));
+    return angle;
+
+}
+
+float AttitudeEstimator::follow_command(float angle, float measured_rate, float commanded,
+                                        double seconds_to_command, double seconds_after_command) const {
+
+    auto at_command = angle + measured_rate * seconds_to_command;
+
+    if (command == Command::Rates) {
+        return static_cast<float>(at_command + commanded * seconds_after_command);
+    }
+
+    auto remaining = wrap_degrees(commanded - at_command);
+    auto settled = 1.0 - std::exp(-seconds_after_command / config.target_time_constant_s);
+    return static_cast<float>(at_command + remaining * settled);
+
+}
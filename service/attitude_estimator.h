@@ -0,0 +1,107 @@
+#ifndef GIMBAL_MAVSDK_ATTITUDE_ESTIMATOR_H
+#define GIMBAL_MAVSDK_ATTITUDE_ESTIMATOR_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <mavsdk/plugins/telemetry/telemetry.h>
+#include "metrics.h"
+#include "tracer.h"
+#include "vehicle_clock.h"
+
+// Predicts camera attitude between and beyond telemetry samples.
+//
+// Each axis is extrapolated from the latest sample. Pitch and yaw follow the
+// last command sent to the gimbal once it is on the link: a rate command at
+// the commanded rate, an angle command as a first-order approach to the
+// target. Otherwise, such as after an ROI command whose angles only the
+// gimbal knows, and for roll, the rate measured between samples is used.
+// Each new sample is checked against what was predicted for it.
+// Samples are placed at the time the vehicle measured them, not when they
+// arrived, so link latency does not show up as prediction error.
+//
+// While tracing, a traced angle command's span ends with the first sample
+// that reaches its target.
+class AttitudeEstimator final {
+
+public:
+
+    struct Config {
+        std::chrono::milliseconds max_prediction{250}; // Predictions do not run further past the latest sample
+        double target_time_constant_s = 0.2;          // How quickly the gimbal settles on an angle command
+        double rate_smoothing = 0.5;                  // Weight of the newest measured rate
+        double confirm_tolerance_deg = 1.0;           // A traced angle command is confirmed by a sample this close
+    };
+
+    struct Stats {
+        uint64_t samples;
+        uint64_t predictions;
+        uint64_t checked;          // Samples compared against a prediction
+        double error_last_deg;     // Largest axis error of the latest check
+        double error_avg_deg;
+        double error_max_deg;
+    };
+
+    AttitudeEstimator(mavsdk::Telemetry &telemetry, const VehicleClock &clock, Config config);
+    ~AttitudeEstimator();
+
+    AttitudeEstimator(const AttitudeEstimator &) = delete;
+    AttitudeEstimator &operator=(const AttitudeEstimator &) = delete;
+
+    // Called when a command goes out on the link.
+    void command_angles(float pitch_deg, float yaw_deg);
+    void command_rates(float pitch_rate_deg_s, float yaw_rate_deg_s);
+    // For commands the angles of which are not known, e.g. an ROI.
+    void command_none();
+
+    // The latest angle command, false if there was none or another command
+    // was sent since.
+    bool commanded_angles(float &pitch_deg, float &yaw_deg) const;
+
+    // Attitude at the given time, stamped with that time in microseconds on
+    // the server's monotonic clock. Returns false until the first sample has
+    // arrived.
+    bool predict(std::chrono::steady_clock::time_point at, mavsdk::Telemetry::EulerAngle &angle);
+
+    Stats stats() const;
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+private:
+
+    enum class Command {
+        None,
+        Rates,
+        Angles
+    };
+
+    void on_sample(const mavsdk::Telemetry::EulerAngle &angle, std::chrono::steady_clock::time_point arrival);
+    mavsdk::Telemetry::EulerAngle extrapolate(std::chrono::steady_clock::time_point at) const;
+    float follow_command(float angle, float measured_rate, float commanded, double seconds_to_command,
+                         double seconds_after_command) const;
+
+    mavsdk::Telemetry &telemetry;
+    const VehicleClock &clock;
+    const Config config;
+    mavsdk::Telemetry::CameraAttitudeEulerHandle handle;
+
+    mutable std::mutex mutex;
+    bool sampled{false};
+    mavsdk::Telemetry::EulerAngle latest{};
+    std::chrono::steady_clock::time_point latest_at{}; // When the latest sample was measured
+    float roll_rate{0};
+    float pitch_rate{0};
+    float yaw_rate{0};
+
+    Command command{Command::None};
+    float commanded_pitch{0}; // Angle or rate, depending on command
+    float commanded_yaw{0};
+    std::chrono::steady_clock::time_point commanded_at{};
+    Tracer::Context confirming{}; // The latest angle command's, until a sample confirms it
+
+    Stats counters{};
+    double error_total_deg{0};
+
+};
+
+#endif // GIMBAL_MAVSDK_ATTITUDE_ESTIMATOR_H
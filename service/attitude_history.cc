@@ -0,0 +1,199 @@
+#include "attitude_history.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+std::size_t round_up_to_power_of_two(std::size_t value) {
+    std::size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+}
+
+AttitudeHistory::AttitudeHistory(mavsdk::Telemetry &telemetry, const VehicleClock &clock, Config config)
+        : AttitudeHistory(config) {
+
+    this->telemetry = &telemetry;
+    handle = telemetry.subscribe_camera_attitude_quaternion([this, &clock](mavsdk::Telemetry::Quaternion attitude) {
+        auto measured = clock.measured_at(attitude.timestamp_us, std::chrono::steady_clock::now());
+        add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                measured.time_since_epoch()).count()), attitude);
+    });
+
+}
+
+AttitudeHistory::AttitudeHistory(Config config)
+        : max_gap_ns{static_cast<uint64_t>(std::chrono::nanoseconds(config.max_gap).count())} {
+
+    auto capacity = round_up_to_power_of_two(std::max<std::size_t>(config.capacity, 2));
+    mask = capacity - 1;
+    times_ns.resize(capacity);
+    ws.resize(capacity);
+    xs.resize(capacity);
+    ys.resize(capacity);
+    zs.resize(capacity);
+
+}
+
+AttitudeHistory::~AttitudeHistory() {
+    if (telemetry) {
+        telemetry->unsubscribe_camera_attitude_quaternion(handle);
+    }
+}
+
+void AttitudeHistory::add(uint64_t time_ns, const mavsdk::Telemetry::Quaternion &attitude) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (size > 0 && time_ns <= time_at(size - 1)) {
+        return;
+    }
+
+    std::size_t slot;
+    if (size <= mask) {
+        slot = (first + size) & mask;
+        size++;
+    } else {
+        slot = first;
+        first = (first + 1) & mask;
+    }
+    times_ns[slot] = time_ns;
+    ws[slot] = attitude.w;
+    xs[slot] = attitude.x;
+    ys[slot] = attitude.y;
+    zs[slot] = attitude.z;
+
+}
+
+bool AttitudeHistory::lookup(uint64_t time_ns, mavsdk::Telemetry::Quaternion &attitude) const {
+
+    bool found = false;
+    lookup(&time_ns, 1, {&found, &attitude.w, &attitude.x, &attitude.y, &attitude.z});
+    return found;
+
+}
+
+std::size_t AttitudeHistory::lookup(const uint64_t *times, std::size_t count, const Columns &out) const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::size_t found = 0;
+    std::size_t from = 0;
+    for (std::size_t i = 0; i < count; i++) {
+        out.found[i] = find(times[i], from, out.w[i], out.x[i], out.y[i], out.z[i]);
+        if (out.found[i]) {
+            found++;
+        } else {
+            out.w[i] = out.x[i] = out.y[i] = out.z[i] = 0;
+        }
+    }
+
+    lookups += count;
+    misses += count - found;
+    return found;
+
+}
+
+mavsdk::Telemetry::EulerAngle AttitudeHistory::to_euler(const mavsdk::Telemetry::Quaternion &q) {
+
+    // Same convention as MAVSDK's own conversion: Z-Y-X, in degrees.
+    constexpr double to_degrees = 180.0 / M_PI;
+    mavsdk::Telemetry::EulerAngle angle;
+    angle.roll_deg = static_cast<float>(to_degrees * std::atan2(2.0 * (q.w * q.x + q.y * q.z),
+                                                                1.0 - 2.0 * (q.x * q.x + q.y * q.y)));
+    angle.pitch_deg = static_cast<float>(to_degrees * std::asin(std::clamp(2.0 * (q.w * q.y - q.z * q.x), -1.0, 1.0)));
+    angle.yaw_deg = static_cast<float>(to_degrees * std::atan2(2.0 * (q.w * q.z + q.x * q.y),
+                                                               1.0 - 2.0 * (q.y * q.y + q.z * q.z)));
+    angle.timestamp_us = q.timestamp_us;
+    return angle;
+
+}
+
+void AttitudeHistory::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto span_ns = size > 1 ? time_at(size - 1) - time_at(0) : 0;
+        samples.push_back({"history.samples", static_cast<double>(size)});
+        samples.push_back({"history.span_s", static_cast<double>(span_ns) / 1e9});
+        samples.push_back({"history.lookups", static_cast<double>(lookups)});
+        samples.push_back({"history.misses", static_cast<double>(misses)});
+    });
+}
+
+bool AttitudeHistory::find(uint64_t time_ns, std::size_t &from, float &w, float &x, float &y, float &z) const {
+
+    if (size == 0 || time_ns < time_at(0) || time_ns > time_at(size - 1)) {
+        return false;
+    }
+    if (from >= size || time_ns < time_at(from)) {
+        from = 0;
+    }
+
+    // Last sample at or before time_ns.
+    auto low = from;
+    auto high = size;
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (time_at(middle) <= time_ns) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    auto index = low - 1;
+    from = index;
+
+    auto a = (first + index) & mask;
+    if (times_ns[a] == time_ns) {
+        w = ws[a];
+        x = xs[a];
+        y = ys[a];
+        z = zs[a];
+        return true;
+    }
+
+    auto b = (first + index + 1) & mask;
+    auto gap = times_ns[b] - times_ns[a];
+    if (gap > max_gap_ns) {
+        return false;
+    }
+    auto t = static_cast<double>(time_ns - times_ns[a]) / static_cast<double>(gap);
+
+    // Slerp along the shorter arc; nearly parallel quaternions are blended
+    // linearly to avoid dividing by a vanishing sine.
+    double bw = ws[b], bx = xs[b], by = ys[b], bz = zs[b];
+    double dot = ws[a] * bw + xs[a] * bx + ys[a] * by + zs[a] * bz;
+    if (dot < 0) {
+        dot = -dot;
+        bw = -bw;
+        bx = -bx;
+        by = -by;
+        bz = -bz;
+    }
+    double ka, kb;
+    if (dot > 0.9995) {
+        ka = 1.0 - t;
+        kb = t;
+    } else {
+        auto theta = std::acos(dot);
+        auto sin_theta = std::sin(theta);
+        ka = std::sin((1.0 - t) * theta) / sin_theta;
+        kb = std::sin(t * theta) / sin_theta;
+    }
+    double rw = ka * ws[a] + kb * bw;
+    double rx = ka * xs[a] + kb * bx;
+    double ry = ka * ys[a] + kb * by;
+    double rz = ka * zs[a] + kb * bz;
+    auto norm = std::sqrt(rw * rw + rx * rx + ry * ry + rz * rz);
+    w = static_cast<float>(rw / norm);
+    x = static_cast<float>(rx / norm);
+    y = static_cast<float>(ry / norm);
+    z = static_cast<float>(rz / norm);
+    return true;
+
+}
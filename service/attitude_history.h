@@ -0,0 +1,90 @@
+#ifndef GIMBAL_MAVSDK_ATTITUDE_HISTORY_H
+#define GIMBAL_MAVSDK_ATTITUDE_HISTORY_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <mavsdk/plugins/telemetry/telemetry.h>
+#include "metrics.h"
+#include "vehicle_clock.h"
+
+// Recent camera attitude by time, for looking up where the camera pointed
+// when an image was taken.
+//
+// Samples live in a fixed ring with one array per field, so a lookup's
+// binary search only touches the timestamps. Attitude between two samples
+// is interpolated with slerp. Lookups never allocate. Samples are stored at
+// the time the vehicle measured them.
+class AttitudeHistory final {
+
+public:
+
+    struct Config {
+        std::size_t capacity = 8192; // Rounded up to a power of two
+        std::chrono::milliseconds max_gap{500}; // Times inside a longer gap between samples are not found
+    };
+
+    // Caller-owned output columns for lookup(), one entry per time.
+    struct Columns {
+        bool *found;
+        float *w;
+        float *x;
+        float *y;
+        float *z;
+    };
+
+    AttitudeHistory(mavsdk::Telemetry &telemetry, const VehicleClock &clock, Config config);
+
+    // A history fed only through add().
+    explicit AttitudeHistory(Config config);
+
+    ~AttitudeHistory();
+
+    AttitudeHistory(const AttitudeHistory &) = delete;
+    AttitudeHistory &operator=(const AttitudeHistory &) = delete;
+
+    // Times are on the server's monotonic clock in nanoseconds. Samples that
+    // are not newer than the latest one are ignored.
+    void add(uint64_t time_ns, const mavsdk::Telemetry::Quaternion &attitude);
+
+    bool lookup(uint64_t time_ns, mavsdk::Telemetry::Quaternion &attitude) const;
+
+    // Looks up count times at once under one lock. Ascending times are
+    // fastest, since each search starts where the previous one ended.
+    // Returns the number found.
+    std::size_t lookup(const uint64_t *times_ns, std::size_t count, const Columns &out) const;
+
+    static mavsdk::Telemetry::EulerAngle to_euler(const mavsdk::Telemetry::Quaternion &attitude);
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+private:
+
+    // Interpolates at time_ns. The search starts at logical index from if
+    // time_ns is not before it, and from is left at the sample found.
+    bool find(uint64_t time_ns, std::size_t &from, float &w, float &x, float &y, float &z) const;
+
+    uint64_t time_at(std::size_t index) const { return times_ns[(first + index) & mask]; }
+
+    mavsdk::Telemetry *telemetry{nullptr};
+    const uint64_t max_gap_ns;
+    mavsdk::Telemetry::CameraAttitudeQuaternionHandle handle;
+
+    mutable std::mutex mutex;
+    std::size_t mask;
+    std::size_t first{0}; // Physical index of the oldest sample
+    std::size_t size{0};
+    std::vector<uint64_t> times_ns;
+    std::vector<float> ws;
+    std::vector<float> xs;
+    std::vector<float> ys;
+    std::vector<float> zs;
+
+    mutable uint64_t lookups{0};
+    mutable uint64_t misses{0};
+
+};
+
+#endif // GIMBAL_MAVSDK_ATTITUDE_HISTORY_H
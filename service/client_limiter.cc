@@ -0,0 +1,111 @@
+#include "client_limiter.h"
+
+#include <algorithm>
+
+namespace {
+
+// Ids longer than this are cut, so a client cannot grow the table's keys.
+constexpr std::size_t max_client_id_length = 64;
+
+std::size_t index_of(ClientLimiter::Kind kind) {
+    return static_cast<std::size_t>(kind);
+}
+
+}
+
+ClientLimiter::Slot::Slot(Slot &&other) noexcept
+        : limiter{other.limiter}, client{std::move(other.client)}, kind{other.kind} {
+    other.limiter = nullptr;
+}
+
+ClientLimiter::Slot &ClientLimiter::Slot::operator=(Slot &&other) noexcept {
+    if (this != &other) {
+        if (limiter) {
+            limiter->release(client, kind);
+        }
+        limiter = other.limiter;
+        client = std::move(other.client);
+        kind = other.kind;
+        other.limiter = nullptr;
+    }
+    return *this;
+}
+
+ClientLimiter::Slot::~Slot() {
+    if (limiter) {
+        limiter->release(client, kind);
+    }
+}
+
+ClientLimiter::Slot ClientLimiter::acquire(const grpc::ServerContext &context, Kind kind) {
+
+    std::string client_id;
+    auto metadata = context.client_metadata();
+    auto id = metadata.find("x-client-id");
+    if (id != metadata.end()) {
+        client_id.assign(id->second.data(), std::min(id->second.size(), max_client_id_length));
+    }
+    auto client = client_of(context.peer(), client_id);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto index = index_of(kind);
+    auto &counts = active[client];
+    if (counts[index] >= limits[index]) {
+        if (counts == Counts{}) {
+            active.erase(client);
+        }
+        rejected[index]++;
+        return {};
+    }
+
+    counts[index]++;
+    active_total[index]++;
+    return {this, std::move(client), kind};
+
+}
+
+void ClientLimiter::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        std::lock_guard<std::mutex> lock(mutex);
+        samples.push_back({"limits.clients", static_cast<double>(active.size())});
+        samples.push_back({"limits.active_calls", static_cast<double>(active_total[index_of(Kind::Call)])});
+        samples.push_back({"limits.rejected_calls", static_cast<double>(rejected[index_of(Kind::Call)])});
+        samples.push_back({"limits.active_streams", static_cast<double>(active_total[index_of(Kind::Stream)])});
+        samples.push_back({"limits.rejected_streams", static_cast<double>(rejected[index_of(Kind::Stream)])});
+        samples.push_back({"limits.held_setpoints", static_cast<double>(active_total[index_of(Kind::Held)])});
+        samples.push_back({"limits.rejected_held_setpoints", static_cast<double>(rejected[index_of(Kind::Held)])});
+    });
+}
+
+std::string ClientLimiter::client_of(const std::string &peer, const std::string &client_id) {
+
+    // Unix socket peers carry no address at all.
+    if (peer.rfind("unix:", 0) == 0) {
+        return client_id.empty() ? "unix" : "unix:" + client_id;
+    }
+
+    auto port = peer.rfind(':');
+    if (port == std::string::npos || port < peer.find(':') + 1) {
+        return peer;
+    }
+    return peer.substr(0, port);
+
+}
+
+void ClientLimiter::release(const std::string &client, Kind kind) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = active.find(client);
+    if (it == active.end()) {
+        return;
+    }
+    auto index = index_of(kind);
+    it->second[index]--;
+    active_total[index]--;
+    if (it->second == Counts{}) {
+        active.erase(it);
+    }
+
+}
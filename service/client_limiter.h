@@ -0,0 +1,91 @@
+#ifndef GIMBAL_MAVSDK_CLIENT_LIMITER_H
+#define GIMBAL_MAVSDK_CLIENT_LIMITER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <grpcpp/server_context.h>
+#include "metrics.h"
+
+// Limits the number of calls a single client can have in progress, so one
+// misbehaving client cannot take every server thread.
+//
+// Remote clients are told apart by host. Every unix socket peer looks the
+// same to gRPC, so local clients are told apart by the x-client-id they
+// send, which GimbalClient sets per instance; a remote client could send
+// any id it likes, so it is ignored there.
+//
+// Long-lived streams are counted against a limit of their own, so a client's
+// standing subscriptions do not use up the places for its unary calls.
+// Setpoints held in the scheduler for a later apply time are counted too,
+// so one client cannot take every held place.
+class ClientLimiter final {
+
+public:
+
+    enum class Kind {
+        Call,
+        Stream,
+        Held
+    };
+
+    // A call in progress, or a setpoint held. Releases its place when
+    // destroyed; an empty slot means the client was over its limit.
+    class Slot final {
+
+    public:
+
+        Slot() = default;
+        Slot(Slot &&other) noexcept;
+        Slot &operator=(Slot &&other) noexcept;
+        ~Slot();
+
+        explicit operator bool() const { return limiter != nullptr; }
+
+    private:
+
+        friend class ClientLimiter;
+
+        Slot(ClientLimiter *limiter, std::string client, Kind kind)
+                : limiter{limiter}, client{std::move(client)}, kind{kind} {}
+
+        ClientLimiter *limiter{nullptr};
+        std::string client;
+        Kind kind{Kind::Call};
+
+    };
+
+    ClientLimiter(std::size_t max_calls_per_client, std::size_t max_streams_per_client, std::size_t max_held_per_client)
+            : limits{max_calls_per_client, max_streams_per_client, max_held_per_client} {}
+
+    Slot acquire(const grpc::ServerContext &context, Kind kind = Kind::Call);
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+    // The host part of a gRPC peer string, e.g. "ipv4:10.0.0.2" for
+    // "ipv4:10.0.0.2:51234"; for unix socket peers, "unix:" and client_id.
+    static std::string client_of(const std::string &peer, const std::string &client_id);
+
+private:
+
+    static constexpr std::size_t kinds = 3;
+
+    // Indexed by Kind.
+    using Counts = std::array<std::size_t, kinds>;
+
+    void release(const std::string &client, Kind kind);
+
+    const Counts limits;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Counts> active;
+    Counts active_total{};
+    std::array<uint64_t, kinds> rejected{};
+
+};
+
+#endif // GIMBAL_MAVSDK_CLIENT_LIMITER_H
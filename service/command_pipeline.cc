@@ -0,0 +1,245 @@
+#include "command_pipeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+mavsdk::Gimbal::Result to_gimbal_result(uint8_t result) {
+    switch (result) {
+        case MAV_RESULT_ACCEPTED:
+            return mavsdk::Gimbal::Result::Success;
+        case MAV_RESULT_UNSUPPORTED:
+            return mavsdk::Gimbal::Result::Unsupported;
+        default:
+            return mavsdk::Gimbal::Result::Error;
+    }
+}
+
+}
+
+CommandPipeline::CommandPipeline(mavsdk::MavlinkPassthrough &passthrough, LinkMonitor &monitor, Config config)
+        : passthrough{passthrough}, monitor{monitor}, config{config},
+          rate_window_start{std::chrono::steady_clock::now()} {
+
+    listener = monitor.add_listener([this](LinkMonitor::Direction direction, const mavlink_message_t &message) {
+        if (direction == LinkMonitor::Direction::Incoming && message.msgid == MAVLINK_MSG_ID_COMMAND_ACK) {
+            on_ack(message);
+        }
+    });
+    worker = std::thread(&CommandPipeline::run, this);
+
+}
+
+CommandPipeline::~CommandPipeline() {
+
+    monitor.remove_listener(listener);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    timer.notify_all();
+    worker.join();
+
+    for (auto &command : in_flight) {
+        command.done(mavsdk::Gimbal::Result::Unknown);
+    }
+
+}
+
+void CommandPipeline::send(uint16_t command, const std::array<float, 7> &params, Callback done) {
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (stopping || in_flight.size() >= config.max_in_flight) {
+            if (!stopping) {
+                counters.refused++;
+            }
+            lock.unlock();
+            done(mavsdk::Gimbal::Result::Unknown);
+            return;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        bool was_idle = in_flight.empty();
+        auto traced = Tracer::enabled() ? Tracer::current() : Tracer::Context{};
+        in_flight.push_back({command, params, std::move(done), 1, now, now + timeout_for(1), traced});
+        counters.sent++;
+        counters.in_flight_max = std::max(counters.in_flight_max, in_flight.size());
+        if (was_idle) {
+            timer.notify_one();
+        }
+    }
+
+    // Never send with the lock held: the link monitor calls back into
+    // on_ack() from the receive thread with its own lock held.
+    Tracer::Span sending{"mavlink.send"};
+    transmit(command, params, 1);
+
+}
+
+bool CommandPipeline::has_room() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return !stopping && in_flight.size() < config.max_in_flight;
+}
+
+void CommandPipeline::on_room(RoomCallback callback) {
+    room = std::move(callback);
+}
+
+CommandPipeline::Stats CommandPipeline::stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    Stats snapshot = counters;
+    snapshot.in_flight = in_flight.size();
+    return snapshot;
+}
+
+void CommandPipeline::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        auto s = stats();
+
+        auto now = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double>(now - rate_window_start).count();
+        double acks_per_s = elapsed > 0 ? static_cast<double>(s.acked - rate_window_acked) / elapsed : 0;
+        rate_window_start = now;
+        rate_window_acked = s.acked;
+
+        samples.push_back({"pipeline.sent", static_cast<double>(s.sent)});
+        samples.push_back({"pipeline.retries", static_cast<double>(s.retries)});
+        samples.push_back({"pipeline.acked", static_cast<double>(s.acked)});
+        samples.push_back({"pipeline.rejected", static_cast<double>(s.rejected)});
+        samples.push_back({"pipeline.timeouts", static_cast<double>(s.timeouts)});
+        samples.push_back({"pipeline.refused", static_cast<double>(s.refused)});
+        samples.push_back({"pipeline.acks_per_s", acks_per_s});
+        samples.push_back({"pipeline.in_flight", static_cast<double>(s.in_flight)});
+        samples.push_back({"pipeline.in_flight_max", static_cast<double>(s.in_flight_max)});
+        samples.push_back({"pipeline.ack_rtt_last_us", static_cast<double>(s.ack_rtt_last_us)});
+        samples.push_back({"pipeline.ack_rtt_max_us", static_cast<double>(s.ack_rtt_max_us)});
+    });
+}
+
+void CommandPipeline::run() {
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (!stopping) {
+        if (in_flight.empty()) {
+            timer.wait(lock);
+            continue;
+        }
+
+        auto earliest = std::min_element(in_flight.begin(), in_flight.end(), [](const auto &a, const auto &b) {
+            return a.deadline < b.deadline;
+        })->deadline;
+        if (timer.wait_until(lock, earliest) == std::cv_status::no_timeout) {
+            continue;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        std::vector<InFlight> resend;
+        std::vector<InFlight> expired;
+
+        for (auto it = in_flight.begin(); it != in_flight.end();) {
+            if (it->deadline > now) {
+                ++it;
+                continue;
+            }
+            if (it->attempts > config.max_retries) {
+                expired.push_back(std::move(*it));
+                it = in_flight.erase(it);
+                counters.timeouts++;
+                continue;
+            }
+            it->attempts++;
+            it->deadline = now + timeout_for(it->attempts);
+            counters.retries++;
+            resend.push_back({it->command, it->params, {}, it->attempts, {}, {}, it->traced});
+            ++it;
+        }
+
+        lock.unlock();
+        for (auto &command : expired) {
+            if (command.traced.trace != 0) {
+                Tracer::record("mavlink.timeout", command.traced, command.first_sent, now);
+            }
+            command.done(mavsdk::Gimbal::Result::Timeout);
+        }
+        if (!expired.empty() && room) {
+            room();
+        }
+        for (const auto &command : resend) {
+            Tracer::Scope retrying{"mavlink.retry", command.traced};
+            transmit(command.command, command.params, command.attempts);
+        }
+        lock.lock();
+    }
+
+}
+
+void CommandPipeline::on_ack(const mavlink_message_t &message) {
+
+    mavlink_command_ack_t ack;
+    mavlink_msg_command_ack_decode(&message, &ack);
+
+    // Acks addressed to other components, or in-progress updates.
+    if ((ack.target_system != 0 && ack.target_system != passthrough.get_our_sysid())
+        || (ack.target_component != 0 && ack.target_component != passthrough.get_our_compid())
+        || ack.result == MAV_RESULT_IN_PROGRESS) {
+        return;
+    }
+
+    Callback done;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto it = std::find_if(in_flight.begin(), in_flight.end(), [&ack](const InFlight &command) {
+            return command.command == ack.command;
+        });
+        if (it == in_flight.end()) {
+            // Sent by MAVSDK itself, or a late ack for a command that timed out.
+            return;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        auto rtt = std::chrono::duration_cast<std::chrono::microseconds>(now - it->first_sent).count();
+        counters.ack_rtt_last_us = static_cast<uint64_t>(rtt);
+        counters.ack_rtt_max_us = std::max(counters.ack_rtt_max_us, counters.ack_rtt_last_us);
+        counters.acked++;
+        if (ack.result != MAV_RESULT_ACCEPTED) {
+            counters.rejected++;
+        }
+
+        if (it->traced.trace != 0) {
+            Tracer::record("mavlink.ack", it->traced, it->first_sent, now);
+        }
+        done = std::move(it->done);
+        in_flight.erase(it);
+    }
+
+    done(to_gimbal_result(ack.result));
+    if (room) {
+        room();
+    }
+
+}
+
+void CommandPipeline::transmit(uint16_t command, const std::array<float, 7> &params, unsigned attempt) {
+
+    mavlink_message_t message;
+    mavlink_msg_command_long_pack(passthrough.get_our_sysid(), passthrough.get_our_compid(), &message,
+                                  passthrough.get_target_sysid(), passthrough.get_target_compid(), command,
+                                  static_cast<uint8_t>(std::min(attempt - 1, 255u)),
+                                  params[0], params[1], params[2], params[3], params[4], params[5], params[6]);
+
+    // A failed send is not treated specially: the command times out and is
+    // retried like a lost frame.
+    passthrough.send_message(message);
+
+}
+
+std::chrono::steady_clock::duration CommandPipeline::timeout_for(unsigned attempt) const {
+    auto timeout = std::chrono::duration<double, std::milli>(config.ack_timeout) * std::pow(config.backoff, attempt - 1);
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::min(timeout, std::chrono::duration<double, std::milli>(config.max_ack_timeout)));
+}
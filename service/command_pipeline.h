@@ -0,0 +1,117 @@
+#ifndef GIMBAL_MAVSDK_COMMAND_PIPELINE_H
+#define GIMBAL_MAVSDK_COMMAND_PIPELINE_H
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <mavsdk/plugins/gimbal/gimbal.h>
+#include <mavsdk/plugins/mavlink_passthrough/mavlink_passthrough.h>
+#include "link_monitor.h"
+#include "metrics.h"
+#include "tracer.h"
+
+// Keeps several MAVLink commands in flight on the link.
+//
+// A synchronous command costs a full ack round-trip before the next one can
+// go out, which over a slow UART caps throughput at 1/RTT. The pipeline sends
+// COMMAND_LONGs without waiting and completes each one when its COMMAND_ACK
+// arrives, retrying with exponential backoff when it does not.
+//
+// COMMAND_ACK only carries the command id, so an ack is matched to the oldest
+// outstanding command with that id; MAVLink components answer in order.
+class CommandPipeline final {
+
+public:
+
+    struct Config {
+        std::size_t max_in_flight = 8;
+        std::chrono::milliseconds ack_timeout{300};      // Before the first retry
+        double backoff = 2.0;                             // Timeout multiplier for each further retry
+        std::chrono::milliseconds max_ack_timeout{2000};
+        unsigned max_retries = 3;
+    };
+
+    // Called once from the link's receive thread or the pipeline's timer
+    // thread, must not block.
+    using Callback = std::function<void(mavsdk::Gimbal::Result)>;
+    using RoomCallback = std::function<void()>;
+
+    struct Stats {
+        uint64_t sent;         // Commands, not counting retries
+        uint64_t retries;
+        uint64_t acked;
+        uint64_t rejected;     // Acked with a result other than accepted
+        uint64_t timeouts;     // Gave up after the last retry
+        uint64_t refused;      // Sent while max_in_flight were outstanding
+        std::size_t in_flight;
+        std::size_t in_flight_max;
+        uint64_t ack_rtt_last_us; // First send to ack, retries included
+        uint64_t ack_rtt_max_us;
+    };
+
+    CommandPipeline(mavsdk::MavlinkPassthrough &passthrough, LinkMonitor &monitor, Config config);
+    ~CommandPipeline();
+
+    CommandPipeline(const CommandPipeline &) = delete;
+    CommandPipeline &operator=(const CommandPipeline &) = delete;
+
+    // Sends a COMMAND_LONG to the target component. Never blocks: while
+    // max_in_flight commands are outstanding, done is called at once with
+    // Result::Unknown, so check has_room() first.
+    void send(uint16_t command, const std::array<float, 7> &params, Callback done);
+
+    bool has_room() const;
+
+    // Called, from the same threads as a Callback, whenever a command leaves
+    // the pipeline. Set once, before the first send().
+    void on_room(RoomCallback callback);
+
+    Stats stats() const;
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+private:
+
+    struct InFlight {
+        uint16_t command;
+        std::array<float, 7> params;
+        Callback done;
+        unsigned attempts;
+        std::chrono::steady_clock::time_point first_sent;
+        std::chrono::steady_clock::time_point deadline;
+        Tracer::Context traced;  // The sender's, for the ack and any retries
+    };
+
+    void run();
+    void on_ack(const mavlink_message_t &message);
+    void transmit(uint16_t command, const std::array<float, 7> &params, unsigned attempt);
+    std::chrono::steady_clock::duration timeout_for(unsigned attempt) const;
+
+    mavsdk::MavlinkPassthrough &passthrough;
+    LinkMonitor &monitor;
+    const Config config;
+    LinkMonitor::ListenerId listener;
+
+    RoomCallback room;
+
+    mutable std::mutex mutex;
+    std::condition_variable timer;
+    std::deque<InFlight> in_flight;
+    bool stopping{false};
+    Stats counters{};
+
+    // For the throughput gauge.
+    mutable std::chrono::steady_clock::time_point rate_window_start;
+    mutable uint64_t rate_window_acked{0};
+
+    std::thread worker;
+
+};
+
+#endif // GIMBAL_MAVSDK_COMMAND_PIPELINE_H
@@ -0,0 +1,395 @@
+#include "command_scheduler.h"
+
+#include <algorithm>
+#include <memory>
+
+CommandScheduler::CommandScheduler(std::size_t setpoint_capacity, std::size_t held_capacity,
+                                   std::function<bool()> setpoint_ready)
+        : setpoint_capacity{std::max<std::size_t>(setpoint_capacity, 1)},
+          held_capacity{std::max<std::size_t>(held_capacity, 1)},
+          setpoint_ready{std::move(setpoint_ready)} {
+    dispatcher = std::thread(&CommandScheduler::run, this);
+}
+
+CommandScheduler::~CommandScheduler() {
+
+    stopping = true;
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+    }
+    wakeup.notify_all();
+    dispatcher.join();
+
+    // A submit that passed its stopping check before the dispatcher's last
+    // look at the queue pushes after it; wait for those and fail them here
+    // rather than leave their promises unfulfilled.
+    while (enqueuing.load() != 0) {
+        std::this_thread::yield();
+    }
+    Entry entry;
+    while (submitted.pop(entry)) {
+        complete(*backlog, entry, {Outcome::Shutdown, mavsdk::Gimbal::Result::Unknown});
+    }
+
+}
+
+namespace {
+
+// Keeps the held heap ordered with the earliest apply time at the front.
+template<typename Entry>
+bool applies_later(const Entry &a, const Entry &b) {
+    return a.apply_at > b.apply_at;
+}
+
+}
+
+std::future<CommandScheduler::Completion> CommandScheduler::submit(Priority priority, Command command,
+                                                                   std::chrono::steady_clock::time_point apply_at) {
+    Entry entry{priority, 0, std::chrono::steady_clock::now(), apply_at, std::move(command), {}, {}, {}};
+    auto future = entry.promise.get_future();
+    enqueue(std::move(entry));
+    return future;
+}
+
+std::future<CommandScheduler::Completion> CommandScheduler::submit_async(Priority priority, AsyncCommand command,
+                                                                         std::chrono::steady_clock::time_point apply_at) {
+    Entry entry{priority, 0, std::chrono::steady_clock::now(), apply_at, {}, std::move(command), {}, {}};
+    auto future = entry.promise.get_future();
+    enqueue(std::move(entry));
+    return future;
+}
+
+void CommandScheduler::submit(Priority priority, Command command, Callback done,
+                              std::chrono::steady_clock::time_point apply_at) {
+    enqueue({priority, 0, std::chrono::steady_clock::now(), apply_at, std::move(command), {}, std::move(done), {}});
+}
+
+void CommandScheduler::submit_async(Priority priority, AsyncCommand command, Callback done,
+                                    std::chrono::steady_clock::time_point apply_at) {
+    enqueue({priority, 0, std::chrono::steady_clock::now(), apply_at, {}, std::move(command), std::move(done), {}});
+}
+
+void CommandScheduler::complete(Backlog &backlog, Entry &entry, const Completion &completion) {
+    if (entry.backlogged) {
+        backlog.commands.fetch_sub(1, std::memory_order_relaxed);
+        if (completion.outcome == Outcome::Completed) {
+            backlog.drained(entry.dispatched);
+        }
+    }
+    if (entry.done) {
+        entry.done(completion);
+    } else {
+        entry.promise.set_value(completion);
+    }
+}
+
+// Once the link is the bottleneck, commands complete one drain interval
+// apart. After an idle spell the gap since the last completion says nothing
+// about the link, so a command's own time since dispatch bounds each sample.
+void CommandScheduler::Backlog::drained(std::chrono::steady_clock::time_point dispatched) {
+
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex);
+    auto sample = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::min(now - last_drained, now - dispatched)).count();
+    last_drained = now;
+
+    auto interval = drain_interval_ns.load(std::memory_order_relaxed);
+    interval = interval == 0 ? sample : interval + (sample - interval) / 8;
+    drain_interval_ns.store(std::max<int64_t>(interval, 1), std::memory_order_relaxed);
+
+}
+
+void CommandScheduler::enqueue(Entry entry) {
+
+    // Counted before stopping is read, so that either this sees the
+    // destructor's store or the destructor sees the count.
+    enqueuing++;
+    if (stopping) {
+        complete(*backlog, entry, {Outcome::Shutdown, mavsdk::Gimbal::Result::Unknown});
+        enqueuing--;
+        return;
+    }
+    // Setpoints held for later join the backlog when they are released.
+    if (entry.priority == Priority::Control || entry.apply_at <= entry.enqueued) {
+        entry.backlogged = true;
+        backlog->commands.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (Tracer::enabled()) {
+        entry.traced = Tracer::current();
+    }
+
+    submitted.push(std::move(entry));
+
+    // Pairs with the dispatcher setting sleeping before it checks the queue
+    // one last time: either it sees the entry, or this sees it asleep.
+    if (sleeping.load(std::memory_order_seq_cst)) {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+        }
+        wakeup.notify_one();
+    }
+    enqueuing--;
+
+}
+
+void CommandScheduler::take_submitted() {
+
+    Entry entry;
+    while (submitted.pop(entry)) {
+        entry.sequence = next_sequence++;
+
+        if (entry.priority == Priority::Control) {
+            control_queue.push_back(std::move(entry));
+        } else if (entry.apply_at == std::chrono::steady_clock::time_point{}) {
+            push_setpoint(std::move(entry));
+        } else if (entry.apply_at <= entry.enqueued) {
+            {
+                std::lock_guard<std::mutex> lock(stats_mutex);
+                counters.setpoints_late++;
+            }
+            push_setpoint(std::move(entry));
+        } else if (held.size() >= held_capacity) {
+            {
+                std::lock_guard<std::mutex> lock(stats_mutex);
+                counters.setpoints_rejected++;
+            }
+            complete(*backlog, entry, {Outcome::Rejected, mavsdk::Gimbal::Result::Unknown});
+        } else {
+            held.push_back(std::move(entry));
+            std::push_heap(held.begin(), held.end(), applies_later<Entry>);
+            std::lock_guard<std::mutex> lock(stats_mutex);
+            counters.setpoints_held++;
+        }
+    }
+
+}
+
+void CommandScheduler::push_setpoint(Entry entry) {
+    if (setpoint_queue.size() >= setpoint_capacity) {
+        complete(*backlog, setpoint_queue.front(), {Outcome::Superseded, mavsdk::Gimbal::Result::Unknown});
+        setpoint_queue.pop_front();
+        std::lock_guard<std::mutex> lock(stats_mutex);
+        counters.setpoints_superseded++;
+    }
+    setpoint_queue.push_back(std::move(entry));
+}
+
+void CommandScheduler::release_held(std::chrono::steady_clock::time_point now) {
+    while (!held.empty() && held.front().apply_at <= now) {
+        std::pop_heap(held.begin(), held.end(), applies_later<Entry>);
+        held.back().backlogged = true;
+        backlog->commands.fetch_add(1, std::memory_order_relaxed);
+        push_setpoint(std::move(held.back()));
+        held.pop_back();
+    }
+}
+
+void CommandScheduler::set_setpoint_rate_limit(double rate_hz) {
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex);
+        counters.setpoint_rate_limit_hz = rate_hz > 0 ? rate_hz : 0;
+    }
+    setpoint_interval_ns = rate_hz > 0 ? static_cast<int64_t>(1e9 / rate_hz) : 0;
+
+    // The dispatcher may be sleeping until the previous interval is up.
+    wake();
+}
+
+void CommandScheduler::wake() {
+    // Set before taking the lock, so a dispatcher about to sleep sees it.
+    woken.store(true, std::memory_order_seq_cst);
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+    }
+    wakeup.notify_one();
+}
+
+CommandScheduler::Stats CommandScheduler::stats() const {
+    std::lock_guard<std::mutex> lock(stats_mutex);
+    auto s = counters;
+    auto current = load();
+    s.backlog = current.backlog;
+    s.drain_interval_us = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(current.drain_interval).count());
+    return s;
+}
+
+CommandScheduler::Load CommandScheduler::load() const {
+    return {backlog->commands.load(std::memory_order_relaxed),
+            std::chrono::nanoseconds(backlog->drain_interval_ns.load(std::memory_order_relaxed))};
+}
+
+void CommandScheduler::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        auto s = stats();
+        samples.push_back({"scheduler.control_dispatched", static_cast<double>(s.control_dispatched)});
+        samples.push_back({"scheduler.setpoints_dispatched", static_cast<double>(s.setpoints_dispatched)});
+        samples.push_back({"scheduler.setpoints_superseded", static_cast<double>(s.setpoints_superseded)});
+        samples.push_back({"scheduler.preemptions", static_cast<double>(s.preemptions)});
+        samples.push_back({"scheduler.control_wait_max_us", static_cast<double>(s.control_wait_max_us)});
+        samples.push_back({"scheduler.control_wait_last_us", static_cast<double>(s.control_wait_last_us)});
+        samples.push_back({"scheduler.setpoint_rate_limit_hz", s.setpoint_rate_limit_hz});
+        samples.push_back({"scheduler.control_depth", static_cast<double>(s.control_depth)});
+        samples.push_back({"scheduler.setpoint_depth", static_cast<double>(s.setpoint_depth)});
+        samples.push_back({"scheduler.setpoints_held", static_cast<double>(s.setpoints_held)});
+        samples.push_back({"scheduler.setpoints_late", static_cast<double>(s.setpoints_late)});
+        samples.push_back({"scheduler.setpoints_rejected", static_cast<double>(s.setpoints_rejected)});
+        samples.push_back({"scheduler.release_late_last_us", static_cast<double>(s.release_late_last_us)});
+        samples.push_back({"scheduler.release_late_max_us", static_cast<double>(s.release_late_max_us)});
+        samples.push_back({"scheduler.held_depth", static_cast<double>(s.held_depth)});
+        samples.push_back({"scheduler.setpoint_waits", static_cast<double>(s.setpoint_waits)});
+        samples.push_back({"scheduler.backlog", static_cast<double>(s.backlog)});
+        samples.push_back({"scheduler.drain_interval_us", static_cast<double>(s.drain_interval_us)});
+    });
+}
+
+void CommandScheduler::sleep_until(std::chrono::steady_clock::time_point wake) {
+
+    std::unique_lock<std::mutex> lock(sleep_mutex);
+    sleeping.store(true, std::memory_order_seq_cst);
+    if (submitted.empty() && !stopping && !woken.exchange(false)) {
+        if (wake == std::chrono::steady_clock::time_point::max()) {
+            wakeup.wait(lock);
+        } else {
+            wakeup.wait_until(lock, wake);
+        }
+    }
+    sleeping.store(false, std::memory_order_relaxed);
+
+}
+
+void CommandScheduler::publish_depths() {
+    std::lock_guard<std::mutex> lock(stats_mutex);
+    counters.control_depth = control_queue.size();
+    counters.setpoint_depth = setpoint_queue.size();
+    counters.held_depth = held.size();
+}
+
+void CommandScheduler::run() {
+
+    while (!stopping) {
+        take_submitted();
+
+        auto now = std::chrono::steady_clock::now();
+        release_held(now);
+
+        // Sleeping is too coarse for the last stretch before a release.
+        if (!held.empty() && held.front().apply_at - now <= release_spin) {
+            auto apply_at = held.front().apply_at;
+            while (std::chrono::steady_clock::now() < apply_at) {
+                std::this_thread::yield();
+            }
+            continue;
+        }
+
+        auto setpoint_interval = std::chrono::nanoseconds(setpoint_interval_ns.load(std::memory_order_relaxed));
+        if (setpoint_interval == std::chrono::nanoseconds::zero()) {
+            next_setpoint_at = {};
+        }
+        bool setpoint_due = !setpoint_queue.empty() && now >= next_setpoint_at;
+        bool link_ready = true;
+        if (setpoint_due && control_queue.empty() && setpoint_ready) {
+            link_ready = setpoint_ready();
+            if (!link_ready && !setpoints_waiting) {
+                setpoints_waiting = true;
+                std::lock_guard<std::mutex> lock(stats_mutex);
+                counters.setpoint_waits++;
+            }
+        }
+
+        if (control_queue.empty() && !(setpoint_due && link_ready)) {
+            // Held back by setpoint_ready, the dispatcher waits for wake().
+            auto wake = std::chrono::steady_clock::time_point::max();
+            if (!setpoint_queue.empty() && link_ready) {
+                wake = next_setpoint_at;
+            }
+            if (!held.empty()) {
+                wake = std::min(wake, held.front().apply_at - release_spin);
+            }
+            publish_depths();
+            sleep_until(wake);
+            continue;
+        }
+
+        Entry entry;
+        if (!control_queue.empty()) {
+            entry = std::move(control_queue.front());
+            control_queue.pop_front();
+
+            auto waited = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - entry.enqueued).count();
+            std::lock_guard<std::mutex> lock(stats_mutex);
+            if (!setpoint_queue.empty() && setpoint_queue.front().sequence < entry.sequence) {
+                counters.preemptions++;
+            }
+            counters.control_wait_last_us = static_cast<uint64_t>(waited);
+            counters.control_wait_max_us = std::max(counters.control_wait_max_us, counters.control_wait_last_us);
+            counters.control_dispatched++;
+            counters.control_depth = control_queue.size();
+        } else {
+            // Setpoints that waited for the rate limit or for the link are
+            // stale by the time they go; only the newest is sent.
+            uint64_t superseded = 0;
+            if (setpoint_interval != std::chrono::nanoseconds::zero() || setpoints_waiting) {
+                while (setpoint_queue.size() > 1) {
+                    complete(*backlog, setpoint_queue.front(), {Outcome::Superseded, mavsdk::Gimbal::Result::Unknown});
+                    setpoint_queue.pop_front();
+                    superseded++;
+                }
+            }
+            setpoints_waiting = false;
+            if (setpoint_interval != std::chrono::nanoseconds::zero()) {
+                next_setpoint_at = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(setpoint_interval);
+            }
+            entry = std::move(setpoint_queue.front());
+            setpoint_queue.pop_front();
+
+            std::lock_guard<std::mutex> lock(stats_mutex);
+            counters.setpoints_superseded += superseded;
+            counters.setpoints_dispatched++;
+            counters.setpoint_depth = setpoint_queue.size();
+            if (entry.apply_at > entry.enqueued) {
+                auto late = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - entry.apply_at).count();
+                counters.release_late_last_us = static_cast<uint64_t>(std::max<int64_t>(late, 0));
+                counters.release_late_max_us = std::max(counters.release_late_max_us, counters.release_late_last_us);
+            }
+        }
+
+        entry.dispatched = std::chrono::steady_clock::now();
+        Tracer::Context traced{};
+        if (Tracer::enabled() && entry.traced.trace != 0) {
+            traced = {entry.traced.trace, Tracer::new_track()};
+            Tracer::record("scheduler.queue", traced, entry.enqueued, entry.dispatched);
+        }
+        Tracer::Scope dispatching{"scheduler.dispatch", traced};
+
+        if (entry.async_command) {
+            auto finished = std::make_shared<Entry>(std::move(entry));
+            finished->async_command([backlog = backlog, finished, traced](mavsdk::Gimbal::Result result) {
+                if (traced.trace != 0) {
+                    Tracer::record("command.complete", traced, finished->dispatched, std::chrono::steady_clock::now());
+                }
+                complete(*backlog, *finished, {Outcome::Completed, result});
+            });
+        } else {
+            auto result = entry.command();
+            complete(*backlog, entry, {Outcome::Completed, result});
+        }
+    }
+
+    take_submitted();
+    for (auto *queue : {&control_queue, &setpoint_queue}) {
+        for (auto &pending : *queue) {
+            complete(*backlog, pending, {Outcome::Shutdown, mavsdk::Gimbal::Result::Unknown});
+        }
+        queue->clear();
+    }
+    for (auto &pending : held) {
+        complete(*backlog, pending, {Outcome::Shutdown, mavsdk::Gimbal::Result::Unknown});
+    }
+    held.clear();
+    publish_depths();
+
+}
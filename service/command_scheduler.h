@@ -0,0 +1,216 @@
+#ifndef GIMBAL_MAVSDK_COMMAND_SCHEDULER_H
+#define GIMBAL_MAVSDK_COMMAND_SCHEDULER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <mavsdk/plugins/gimbal/gimbal.h>
+#include "metrics.h"
+#include "mpsc_queue.h"
+#include "tracer.h"
+
+// Single dispatcher in front of the MAVLink link.
+//
+// The dispatcher thread is the only one that runs commands, so nothing else
+// calls into the gimbal plugin and no lock is held while it does. Submitting
+// pushes onto a lock-free queue and wakes the dispatcher only if it sleeps;
+// every queue behind it belongs to the dispatcher thread alone.
+//
+// Control-plane commands (take/release control, mode changes) are always
+// dispatched before any queued setpoint. Setpoints go into a bounded queue;
+// when it is full the oldest queued setpoint is superseded by the new one.
+// Since only one synchronous command is on the link at a time, a control
+// command waits for at most the setpoint currently being sent.
+//
+// Asynchronous commands return to the dispatcher as soon as they are sent
+// and complete later, which lets a pipelined sender keep several commands in
+// flight while they are still dispatched in priority order. When such a
+// sender is full, setpoint_ready holds setpoints back in their queue, where
+// newer ones supersede them, and only the newest is sent once there is room;
+// control commands are not held.
+//
+// The backlog, the commands queued or on the link, is counted as they come
+// and go, along with how often one completes, so callers can tell how far
+// behind the link is without asking the dispatcher.
+//
+// While tracing, each traced command gets a track of its own with its time
+// in the queue and, for asynchronous commands, the wait for completion, and
+// runs with its trace current so what it sends is traced too.
+//
+// A setpoint can carry an apply time. It is held until then and queued like
+// any other setpoint on release; the dispatcher spins for the last stretch
+// before a release since sleeping is not precise enough.
+class CommandScheduler final {
+
+public:
+
+    enum class Priority {
+        Control,
+        Setpoint
+    };
+
+    enum class Outcome {
+        Completed,  // The command ran, see result
+        Superseded, // A newer setpoint replaced it before it was sent
+        Rejected,   // Too many setpoints were already held for later
+        Shutdown    // The scheduler stopped before the command ran
+    };
+
+    struct Completion {
+        Outcome outcome;
+        mavsdk::Gimbal::Result result;
+    };
+
+    using Command = std::function<mavsdk::Gimbal::Result()>;
+
+    // Called once when the command has completed or will not run, from the
+    // dispatcher or the thread completing an asynchronous command; it must
+    // not block.
+    using Callback = std::function<void(const Completion &)>;
+
+    // Called once with the command's result, from any thread.
+    using Done = std::function<void(mavsdk::Gimbal::Result)>;
+    using AsyncCommand = std::function<void(Done)>;
+
+    struct Stats {
+        uint64_t control_dispatched;
+        uint64_t setpoints_dispatched;
+        uint64_t setpoints_superseded;
+        uint64_t preemptions;       // Control commands sent ahead of older queued setpoints
+        uint64_t control_wait_max_us;
+        uint64_t control_wait_last_us;
+        double setpoint_rate_limit_hz; // 0 when unlimited
+        uint64_t setpoints_held;      // Held for their apply time
+        uint64_t setpoints_late;      // Apply time had passed on arrival
+        uint64_t setpoints_rejected;
+        uint64_t release_late_last_us; // Dispatch time behind apply time
+        uint64_t release_late_max_us;
+        uint64_t setpoint_waits;    // Times setpoints were held back by setpoint_ready
+        std::size_t control_depth;
+        std::size_t setpoint_depth;
+        std::size_t held_depth;
+        std::size_t backlog;
+        uint64_t drain_interval_us;
+    };
+
+    // What is waiting on the link: commands queued or running, not those
+    // held for a later apply time.
+    struct Load {
+        std::size_t backlog;
+        std::chrono::nanoseconds drain_interval; // Between completions, zero until one has completed
+    };
+
+    // setpoint_ready is asked, on the dispatcher thread, whether a setpoint
+    // can be sent now; call wake() once it may have turned true.
+    explicit CommandScheduler(std::size_t setpoint_capacity = 4, std::size_t held_capacity = 256,
+                              std::function<bool()> setpoint_ready = {});
+    ~CommandScheduler();
+
+    CommandScheduler(const CommandScheduler &) = delete;
+    CommandScheduler &operator=(const CommandScheduler &) = delete;
+
+    // apply_at only applies to setpoints; the default sends them right away.
+    std::future<Completion> submit(Priority priority, Command command,
+                                   std::chrono::steady_clock::time_point apply_at = {});
+    std::future<Completion> submit_async(Priority priority, AsyncCommand command,
+                                         std::chrono::steady_clock::time_point apply_at = {});
+
+    // Same, reporting to a callback instead of a future.
+    void submit(Priority priority, Command command, Callback done,
+                std::chrono::steady_clock::time_point apply_at = {});
+    void submit_async(Priority priority, AsyncCommand command, Callback done,
+                      std::chrono::steady_clock::time_point apply_at = {});
+
+    // Caps how often setpoints are put on the link, 0 removes the cap. While
+    // capped, only the newest queued setpoint is sent and older ones are
+    // superseded.
+    void set_setpoint_rate_limit(double rate_hz);
+
+    // Has the dispatcher look at its queues again. Any thread.
+    void wake();
+
+    Stats stats() const;
+
+    // Lock-free, for checking every call against.
+    Load load() const;
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+private:
+
+    struct Entry {
+        Priority priority;
+        uint64_t sequence;
+        std::chrono::steady_clock::time_point enqueued;
+        std::chrono::steady_clock::time_point apply_at;
+        Command command;
+        AsyncCommand async_command;
+        Callback done;                    // Either this or the promise
+        std::promise<Completion> promise;
+        Tracer::Context traced{};         // The submitting thread's, while tracing
+        bool backlogged{false};           // Counted in the backlog
+        std::chrono::steady_clock::time_point dispatched{};
+    };
+
+    // Shared with the completions of asynchronous commands, which can come
+    // after the scheduler is gone.
+    struct Backlog {
+        std::atomic<std::size_t> commands{0};
+        std::atomic<int64_t> drain_interval_ns{0};
+        std::mutex mutex;
+        std::chrono::steady_clock::time_point last_drained{};
+
+        void drained(std::chrono::steady_clock::time_point dispatched);
+    };
+
+    static void complete(Backlog &backlog, Entry &entry, const Completion &completion);
+
+    void enqueue(Entry entry);
+    void take_submitted();
+    void push_setpoint(Entry entry);
+    void release_held(std::chrono::steady_clock::time_point now);
+    void sleep_until(std::chrono::steady_clock::time_point wake);
+    void publish_depths();
+    void run();
+
+    // How long before an apply time the dispatcher stops sleeping.
+    static constexpr std::chrono::microseconds release_spin{200};
+
+    const std::size_t setpoint_capacity;
+    const std::size_t held_capacity;
+    const std::function<bool()> setpoint_ready;
+
+    MpscQueue<Entry> submitted;
+    std::atomic<bool> stopping{false};
+    std::atomic<unsigned> enqueuing{0}; // Callers inside enqueue(), waited out on shutdown
+    std::atomic<bool> sleeping{false};
+    std::atomic<bool> woken{false};
+    std::mutex sleep_mutex; // Only taken around the dispatcher going to sleep
+    std::condition_variable wakeup;
+    std::atomic<int64_t> setpoint_interval_ns{0};
+    const std::shared_ptr<Backlog> backlog{std::make_shared<Backlog>()};
+
+    // Dispatcher thread only.
+    std::deque<Entry> control_queue;
+    std::deque<Entry> setpoint_queue;
+    std::vector<Entry> held; // Min-heap on apply_at
+    uint64_t next_sequence{0};
+    std::chrono::steady_clock::time_point next_setpoint_at{};
+    bool setpoints_waiting{false}; // Held back by setpoint_ready since the last setpoint was sent
+
+    mutable std::mutex stats_mutex;
+    Stats counters{};
+
+    std::thread dispatcher;
+
+};
+
+#endif // GIMBAL_MAVSDK_COMMAND_SCHEDULER_H
@@ -0,0 +1,69 @@
+#include "control_state.h"
+
+ControlState::ControlState(mavsdk::Gimbal &gimbal, Config config) : gimbal{gimbal}, config{config} {
+    handle = gimbal.subscribe_control([this](mavsdk::Gimbal::ControlStatus status) {
+        on_status(status);
+    });
+}
+
+ControlState::~ControlState() {
+    gimbal.unsubscribe_control(handle);
+}
+
+bool ControlState::holds(mavsdk::Gimbal::ControlMode wanted, bool force) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (force) {
+        counters.forced++;
+        return false;
+    }
+    if (known && changing == 0 && mode == wanted
+        && std::chrono::steady_clock::now() - reported_at <= config.max_age) {
+        counters.hits++;
+        return true;
+    }
+    counters.misses++;
+    return false;
+
+}
+
+void ControlState::begin_change() {
+    std::lock_guard<std::mutex> lock(mutex);
+    changing++;
+    known = false;
+}
+
+void ControlState::end_change() {
+    std::lock_guard<std::mutex> lock(mutex);
+    changing--;
+}
+
+ControlState::Stats ControlState::stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return counters;
+}
+
+void ControlState::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        auto s = stats();
+        auto requests = s.hits + s.misses;
+        samples.push_back({"control.updates", static_cast<double>(s.updates)});
+        samples.push_back({"control.cache_hits", static_cast<double>(s.hits)});
+        samples.push_back({"control.cache_misses", static_cast<double>(s.misses)});
+        samples.push_back({"control.cache_forced", static_cast<double>(s.forced)});
+        samples.push_back({"control.cache_hit_rate", requests > 0 ? static_cast<double>(s.hits) / requests : 0.0});
+    });
+}
+
+void ControlState::on_status(const mavsdk::Gimbal::ControlStatus &status) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    counters.updates++;
+    if (changing > 0) {
+        return;
+    }
+    known = true;
+    mode = status.control_mode;
+    reported_at = std::chrono::steady_clock::now();
+
+}
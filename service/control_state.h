@@ -0,0 +1,67 @@
+#ifndef GIMBAL_MAVSDK_CONTROL_STATE_H
+#define GIMBAL_MAVSDK_CONTROL_STATE_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <mavsdk/plugins/gimbal/gimbal.h>
+#include "metrics.h"
+
+// Which control of the gimbal we hold, as the gimbal manager last reported
+// it, so a TakeControl or ReleaseControl for what we already have can be
+// answered without a round trip on the link.
+//
+// Only the manager's control status is trusted. While a control command is
+// in flight statuses are ignored, and once it has completed the cache has no
+// answer until the next status, which the link delivers after the command's
+// ack. A status older than max_age is no answer either.
+class ControlState final {
+
+public:
+
+    struct Config {
+        std::chrono::milliseconds max_age{3000}; // Statuses normally arrive every second
+    };
+
+    struct Stats {
+        uint64_t updates; // Statuses received
+        uint64_t hits;    // Requests answered from the cache
+        uint64_t misses;  // Requests sent on to the gimbal
+        uint64_t forced;  // Requests that skipped the cache
+    };
+
+    ControlState(mavsdk::Gimbal &gimbal, Config config);
+    ~ControlState();
+
+    ControlState(const ControlState &) = delete;
+    ControlState &operator=(const ControlState &) = delete;
+
+    // Whether we are known to hold mode already. Counts the request.
+    bool holds(mavsdk::Gimbal::ControlMode mode, bool force);
+
+    // Around every control command sent.
+    void begin_change();
+    void end_change();
+
+    Stats stats() const;
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+private:
+
+    void on_status(const mavsdk::Gimbal::ControlStatus &status);
+
+    mavsdk::Gimbal &gimbal;
+    const Config config;
+    mavsdk::Gimbal::ControlHandle handle;
+
+    mutable std::mutex mutex;
+    bool known{false};
+    mavsdk::Gimbal::ControlMode mode{mavsdk::Gimbal::ControlMode::None};
+    std::chrono::steady_clock::time_point reported_at{};
+    unsigned changing{0}; // Control commands in flight
+    Stats counters{};
+
+};
+
+#endif // GIMBAL_MAVSDK_CONTROL_STATE_H
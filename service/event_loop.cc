@@ -0,0 +1,83 @@
+#include "event_loop.h"
+
+#include <chrono>
+
+EventLoop::EventLoop(grpc::ServerBuilder &builder) : completion_queue{builder.AddCompletionQueue()} {
+}
+
+EventLoop::~EventLoop() {
+    stop();
+}
+
+void EventLoop::start() {
+    thread = std::thread(&EventLoop::run, this);
+}
+
+void EventLoop::stop() {
+    if (stopped) {
+        return;
+    }
+    stopped = true;
+    completion_queue->Shutdown();
+    if (thread.joinable()) {
+        thread.join();
+    } else {
+        // Never started: the queue must still be drained before it goes.
+        void *tag;
+        bool ok;
+        while (completion_queue->Next(&tag, &ok)) {
+        }
+    }
+}
+
+void EventLoop::post(std::function<void()> task) {
+
+    tasks.push(std::move(task));
+    posted++;
+
+    // One wakeup in flight is enough: the loop clears the flag before it
+    // runs what was posted, so a task either is seen by that run or sets
+    // off another wakeup.
+    if (!wakeup_pending.exchange(true)) {
+        wakeup_alarm.Set(completion_queue.get(), gpr_time_0(GPR_CLOCK_MONOTONIC), static_cast<Operation *>(&wakeup));
+    }
+
+}
+
+void EventLoop::Wakeup::proceed(bool) {
+    loop.wakeups++;
+    loop.wakeup_pending = false;
+    std::function<void()> task;
+    while (!loop.tasks.empty()) {
+        loop.tasks.pop(task);
+        task();
+    }
+}
+
+EventLoop::Stats EventLoop::stats() const {
+    return {events.load(), posted.load(), wakeups.load(), busy_ns.load() / 1000};
+}
+
+void EventLoop::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        auto s = stats();
+        samples.push_back({"loop.events", static_cast<double>(s.events)});
+        samples.push_back({"loop.posted", static_cast<double>(s.posted)});
+        samples.push_back({"loop.wakeups", static_cast<double>(s.wakeups)});
+        samples.push_back({"loop.busy_us", static_cast<double>(s.busy_us)});
+    });
+}
+
+void EventLoop::run() {
+
+    void *tag;
+    bool ok;
+    while (completion_queue->Next(&tag, &ok)) {
+        auto started = std::chrono::steady_clock::now();
+        static_cast<Operation *>(tag)->proceed(ok);
+        events++;
+        busy_ns += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - started).count());
+    }
+
+}
@@ -0,0 +1,197 @@
+#ifndef GIMBAL_MAVSDK_EVENT_LOOP_H
+#define GIMBAL_MAVSDK_EVENT_LOOP_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <grpcpp/alarm.h>
+#include <grpcpp/grpcpp.h>
+#include "metrics.h"
+#include "mpsc_queue.h"
+
+// One thread serving gRPC calls from a completion queue, for boards with
+// too few cores for a thread per call.
+//
+// Everything the loop waits for is an Operation whose proceed() it calls
+// when the queue hands it back: a call arriving, a response sent, a timer
+// expiring. Work finishing on other threads, such as a command's ack, is
+// posted back to the loop, so call state is only touched on its thread.
+// gRPC polls its sockets with epoll from inside the queue, so an idle loop
+// sleeps in a single epoll_wait().
+class EventLoop final {
+
+public:
+
+    class Operation {
+
+    public:
+
+        virtual ~Operation() = default;
+
+        // On the loop thread; ok is false when the operation was cut short,
+        // e.g. by shutdown.
+        virtual void proceed(bool ok) = 0;
+
+    };
+
+    // Serves one unary method: each call is handed to the handler on the loop
+    // thread, which answers it with finish(), possibly later.
+    template<typename Request, typename Response>
+    class UnaryCall;
+
+    struct Stats {
+        uint64_t events;   // Operations proceeded
+        uint64_t posted;   // Tasks posted from other threads
+        uint64_t wakeups;  // Times the loop was woken for posted tasks
+        uint64_t busy_us;  // Time spent outside the completion queue
+    };
+
+    // Adds the loop's completion queue; the loop is started once the server is.
+    explicit EventLoop(grpc::ServerBuilder &builder);
+    ~EventLoop();
+
+    EventLoop(const EventLoop &) = delete;
+    EventLoop &operator=(const EventLoop &) = delete;
+
+    grpc::ServerCompletionQueue *queue() const { return completion_queue.get(); }
+
+    void start();
+
+    // Call after the server has shut down; waits for the loop to drain.
+    void stop();
+
+    // Runs task on the loop thread. Any thread.
+    void post(std::function<void()> task);
+
+    Stats stats() const;
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+private:
+
+    class Wakeup final : public Operation {
+
+    public:
+
+        explicit Wakeup(EventLoop &loop) : loop{loop} {}
+
+        void proceed(bool ok) override;
+
+    private:
+
+        EventLoop &loop;
+
+    };
+
+    void run();
+
+    std::unique_ptr<grpc::ServerCompletionQueue> completion_queue;
+    MpscQueue<std::function<void()>> tasks;
+    std::atomic<bool> wakeup_pending{false};
+    grpc::Alarm wakeup_alarm;
+    Wakeup wakeup{*this};
+    bool stopped{false};
+
+    std::atomic<uint64_t> events{0};
+    std::atomic<uint64_t> posted{0};
+    std::atomic<uint64_t> wakeups{0};
+    std::atomic<uint64_t> busy_ns{0};
+
+    std::thread thread;
+
+};
+
+template<typename Request, typename Response>
+class EventLoop::UnaryCall final : public Operation {
+
+public:
+
+    // Asks the server for the next call of the method, with this as tag.
+    using Requester = std::function<void(grpc::ServerContext *context, Request *request,
+                                         grpc::ServerAsyncResponseWriter<Response> *responder, void *tag)>;
+    using Handler = std::function<void(UnaryCall *call)>;
+
+    // Keeps one call of the method requested at all times.
+    static void listen(EventLoop &loop, Requester requester, Handler handler) {
+        auto call = new UnaryCall(loop, std::move(requester), std::move(handler));
+        call->context.AsyncNotifyWhenDone(static_cast<Operation *>(&call->done));
+        call->requester(&call->context, &call->request, &call->responder, static_cast<Operation *>(call));
+    }
+
+    EventLoop &loop;
+    grpc::ServerContext context;
+    Request request;
+    Response response;
+
+    // Loop thread only. Whether the client has gone away before the call
+    // was finished.
+    bool cancelled() const { return done.arrived && context.IsCancelled(); }
+
+    // Loop thread only, once.
+    void finish(const grpc::Status &status) {
+        responder.Finish(response, status, static_cast<Operation *>(this));
+    }
+
+private:
+
+    // Delivered once the call is over, finished or not; only then can
+    // cancellation be read.
+    class Done final : public Operation {
+
+    public:
+
+        explicit Done(UnaryCall &call) : call{call} {}
+
+        void proceed(bool) override {
+            arrived = true;
+            call.release();
+        }
+
+        bool arrived{false};
+
+    private:
+
+        UnaryCall &call;
+
+    };
+
+    UnaryCall(EventLoop &loop, Requester requester, Handler handler)
+            : loop{loop}, requester{std::move(requester)}, handler{std::move(handler)} {}
+
+    void proceed(bool ok) override {
+
+        if (!started) {
+            // Without a call, e.g. at shutdown, the done tag never comes.
+            if (!ok) {
+                delete this;
+                return;
+            }
+            started = true;
+            listen(loop, requester, handler);
+            handler(this);
+            return;
+        }
+
+        finished = true;
+        release();
+
+    }
+
+    void release() {
+        if (finished && done.arrived) {
+            delete this;
+        }
+    }
+
+    const Requester requester;
+    const Handler handler;
+    grpc::ServerAsyncResponseWriter<Response> responder{&context};
+    Done done{*this};
+    bool started{false};
+    bool finished{false};
+
+};
+
+#endif // GIMBAL_MAVSDK_EVENT_LOOP_H
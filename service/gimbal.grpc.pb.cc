@@ -31,6 +31,19 @@ static const char* GimbalService_method_names[] = {
   "/mavsdk.rpc.gimbal.GimbalService/TakeControl",
   "/mavsdk.rpc.gimbal.GimbalService/ReleaseControl",
   "/mavsdk.rpc.gimbal.GimbalService/SubscribeControl",
+  "/mavsdk.rpc.gimbal.GimbalService/GetMetrics",
+  "/mavsdk.rpc.gimbal.GimbalService/SetTelemetryRates",
+  "/mavsdk.rpc.gimbal.GimbalService/MavlinkTunnel",
+  "/mavsdk.rpc.gimbal.GimbalService/SubscribeAttitudeBatch",
+  "/mavsdk.rpc.gimbal.GimbalService/StreamSetpoints",
+  "/mavsdk.rpc.gimbal.GimbalService/SyncClock",
+  "/mavsdk.rpc.gimbal.GimbalService/PredictAttitude",
+  "/mavsdk.rpc.gimbal.GimbalService/GetAttitudeAt",
+  "/mavsdk.rpc.gimbal.GimbalService/GetAttitudesAt",
+  "/mavsdk.rpc.gimbal.GimbalService/VisualServo",
+  "/mavsdk.rpc.gimbal.GimbalService/ApplyGimbalState",
+  "/mavsdk.rpc.gimbal.GimbalService/SetTracing",
+  "/mavsdk.rpc.gimbal.GimbalService/GetTrace",
 };
 
 std::unique_ptr< GimbalService::Stub> GimbalService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -47,6 +60,19 @@ GimbalService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   , rpcmethod_TakeControl_(GimbalService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_ReleaseControl_(GimbalService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_SubscribeControl_(GimbalService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_GetMetrics_(GimbalService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetTelemetryRates_(GimbalService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_MavlinkTunnel_(GimbalService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_SubscribeAttitudeBatch_(GimbalService_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_StreamSetpoints_(GimbalService_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_SyncClock_(GimbalService_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_PredictAttitude_(GimbalService_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetAttitudeAt_(GimbalService_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetAttitudesAt_(GimbalService_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_VisualServo_(GimbalService_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_ApplyGimbalState_(GimbalService_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetTracing_(GimbalService_method_names[18], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetTrace_(GimbalService_method_names[19], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status GimbalService::Stub::SetPitchAndYaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest& request, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* response) {
@@ -203,6 +229,277 @@ void GimbalService::Stub::async::SubscribeControl(::grpc::ClientContext* context
   return ::grpc::internal::ClientAsyncReaderFactory< ::mavsdk::rpc::gimbal::ControlResponse>::Create(channel_.get(), cq, rpcmethod_SubscribeControl_, context, request, false, nullptr);
 }
 
+::grpc::Status GimbalService::Stub::GetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavsdk::rpc::gimbal::GetMetricsRequest, ::mavsdk::rpc::gimbal::GetMetricsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetMetrics_, context, request, response);
+}
+
+void GimbalService::Stub::async::GetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest* request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavsdk::rpc::gimbal::GetMetricsRequest, ::mavsdk::rpc::gimbal::GetMetricsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetMetrics_, context, request, response, std::move(f));
+}
+
+void GimbalService::Stub::async::GetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest* request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetMetrics_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetMetricsResponse>* GimbalService::Stub::PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavsdk::rpc::gimbal::GetMetricsResponse, ::mavsdk::rpc::gimbal::GetMetricsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetMetrics_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetMetricsResponse>* GimbalService::Stub::AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetMetricsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status GimbalService::Stub::SetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetTelemetryRates_, context, request, response);
+}
+
+void GimbalService::Stub::async::SetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetTelemetryRates_, context, request, response, std::move(f));
+}
+
+void GimbalService::Stub::async::SetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetTelemetryRates_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>* GimbalService::Stub::PrepareAsyncSetTelemetryRatesRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse, ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetTelemetryRates_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>* GimbalService::Stub::AsyncSetTelemetryRatesRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetTelemetryRatesRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* GimbalService::Stub::MavlinkTunnelRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>::Create(channel_.get(), rpcmethod_MavlinkTunnel_, context);
+}
+
+void GimbalService::Stub::async::MavlinkTunnel(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest,::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest,::mavsdk::rpc::gimbal::MavlinkTunnelResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_MavlinkTunnel_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* GimbalService::Stub::AsyncMavlinkTunnelRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>::Create(channel_.get(), cq, rpcmethod_MavlinkTunnel_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* GimbalService::Stub::PrepareAsyncMavlinkTunnelRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>::Create(channel_.get(), cq, rpcmethod_MavlinkTunnel_, context, false, nullptr);
+}
+
+::grpc::ClientReader< ::mavsdk::rpc::gimbal::AttitudeBatch>* GimbalService::Stub::SubscribeAttitudeBatchRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::mavsdk::rpc::gimbal::AttitudeBatch>::Create(channel_.get(), rpcmethod_SubscribeAttitudeBatch_, context, request);
+}
+
+void GimbalService::Stub::async::SubscribeAttitudeBatch(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* request, ::grpc::ClientReadReactor< ::mavsdk::rpc::gimbal::AttitudeBatch>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::mavsdk::rpc::gimbal::AttitudeBatch>::Create(stub_->channel_.get(), stub_->rpcmethod_SubscribeAttitudeBatch_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::AttitudeBatch>* GimbalService::Stub::AsyncSubscribeAttitudeBatchRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::mavsdk::rpc::gimbal::AttitudeBatch>::Create(channel_.get(), cq, rpcmethod_SubscribeAttitudeBatch_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::AttitudeBatch>* GimbalService::Stub::PrepareAsyncSubscribeAttitudeBatchRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::mavsdk::rpc::gimbal::AttitudeBatch>::Create(channel_.get(), cq, rpcmethod_SubscribeAttitudeBatch_, context, request, false, nullptr);
+}
+
+::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>* GimbalService::Stub::StreamSetpointsRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>::Create(channel_.get(), rpcmethod_StreamSetpoints_, context);
+}
+
+void GimbalService::Stub::async::StreamSetpoints(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::mavsdk::rpc::gimbal::Setpoint,::mavsdk::rpc::gimbal::SetpointAck>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::mavsdk::rpc::gimbal::Setpoint,::mavsdk::rpc::gimbal::SetpointAck>::Create(stub_->channel_.get(), stub_->rpcmethod_StreamSetpoints_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>* GimbalService::Stub::AsyncStreamSetpointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>::Create(channel_.get(), cq, rpcmethod_StreamSetpoints_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>* GimbalService::Stub::PrepareAsyncStreamSetpointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>::Create(channel_.get(), cq, rpcmethod_StreamSetpoints_, context, false, nullptr);
+}
+
+::grpc::Status GimbalService::Stub::SyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::mavsdk::rpc::gimbal::SyncClockResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavsdk::rpc::gimbal::SyncClockRequest, ::mavsdk::rpc::gimbal::SyncClockResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SyncClock_, context, request, response);
+}
+
+void GimbalService::Stub::async::SyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest* request, ::mavsdk::rpc::gimbal::SyncClockResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavsdk::rpc::gimbal::SyncClockRequest, ::mavsdk::rpc::gimbal::SyncClockResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SyncClock_, context, request, response, std::move(f));
+}
+
+void GimbalService::Stub::async::SyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest* request, ::mavsdk::rpc::gimbal::SyncClockResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SyncClock_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SyncClockResponse>* GimbalService::Stub::PrepareAsyncSyncClockRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavsdk::rpc::gimbal::SyncClockResponse, ::mavsdk::rpc::gimbal::SyncClockRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SyncClock_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SyncClockResponse>* GimbalService::Stub::AsyncSyncClockRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSyncClockRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status GimbalService::Stub::PredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavsdk::rpc::gimbal::PredictAttitudeRequest, ::mavsdk::rpc::gimbal::PredictAttitudeResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_PredictAttitude_, context, request, response);
+}
+
+void GimbalService::Stub::async::PredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavsdk::rpc::gimbal::PredictAttitudeRequest, ::mavsdk::rpc::gimbal::PredictAttitudeResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PredictAttitude_, context, request, response, std::move(f));
+}
+
+void GimbalService::Stub::async::PredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PredictAttitude_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>* GimbalService::Stub::PrepareAsyncPredictAttitudeRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavsdk::rpc::gimbal::PredictAttitudeResponse, ::mavsdk::rpc::gimbal::PredictAttitudeRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_PredictAttitude_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>* GimbalService::Stub::AsyncPredictAttitudeRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncPredictAttitudeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status GimbalService::Stub::GetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavsdk::rpc::gimbal::GetAttitudeAtRequest, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetAttitudeAt_, context, request, response);
+}
+
+void GimbalService::Stub::async::GetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavsdk::rpc::gimbal::GetAttitudeAtRequest, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetAttitudeAt_, context, request, response, std::move(f));
+}
+
+void GimbalService::Stub::async::GetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetAttitudeAt_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>* GimbalService::Stub::PrepareAsyncGetAttitudeAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse, ::mavsdk::rpc::gimbal::GetAttitudeAtRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetAttitudeAt_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>* GimbalService::Stub::AsyncGetAttitudeAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetAttitudeAtRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status GimbalService::Stub::GetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavsdk::rpc::gimbal::GetAttitudesAtRequest, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetAttitudesAt_, context, request, response);
+}
+
+void GimbalService::Stub::async::GetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavsdk::rpc::gimbal::GetAttitudesAtRequest, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetAttitudesAt_, context, request, response, std::move(f));
+}
+
+void GimbalService::Stub::async::GetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetAttitudesAt_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>* GimbalService::Stub::PrepareAsyncGetAttitudesAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse, ::mavsdk::rpc::gimbal::GetAttitudesAtRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetAttitudesAt_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>* GimbalService::Stub::AsyncGetAttitudesAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetAttitudesAtRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>* GimbalService::Stub::VisualServoRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>::Create(channel_.get(), rpcmethod_VisualServo_, context);
+}
+
+void GimbalService::Stub::async::VisualServo(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::mavsdk::rpc::gimbal::VisualServoRequest,::mavsdk::rpc::gimbal::VisualServoStatus>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::mavsdk::rpc::gimbal::VisualServoRequest,::mavsdk::rpc::gimbal::VisualServoStatus>::Create(stub_->channel_.get(), stub_->rpcmethod_VisualServo_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>* GimbalService::Stub::AsyncVisualServoRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>::Create(channel_.get(), cq, rpcmethod_VisualServo_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>* GimbalService::Stub::PrepareAsyncVisualServoRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>::Create(channel_.get(), cq, rpcmethod_VisualServo_, context, false, nullptr);
+}
+
+::grpc::Status GimbalService::Stub::ApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ApplyGimbalState_, context, request, response);
+}
+
+void GimbalService::Stub::async::ApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ApplyGimbalState_, context, request, response, std::move(f));
+}
+
+void GimbalService::Stub::async::ApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ApplyGimbalState_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>* GimbalService::Stub::PrepareAsyncApplyGimbalStateRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse, ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ApplyGimbalState_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>* GimbalService::Stub::AsyncApplyGimbalStateRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncApplyGimbalStateRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status GimbalService::Stub::SetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::mavsdk::rpc::gimbal::SetTracingResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavsdk::rpc::gimbal::SetTracingRequest, ::mavsdk::rpc::gimbal::SetTracingResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SetTracing_, context, request, response);
+}
+
+void GimbalService::Stub::async::SetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest* request, ::mavsdk::rpc::gimbal::SetTracingResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavsdk::rpc::gimbal::SetTracingRequest, ::mavsdk::rpc::gimbal::SetTracingResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetTracing_, context, request, response, std::move(f));
+}
+
+void GimbalService::Stub::async::SetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest* request, ::mavsdk::rpc::gimbal::SetTracingResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SetTracing_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTracingResponse>* GimbalService::Stub::PrepareAsyncSetTracingRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavsdk::rpc::gimbal::SetTracingResponse, ::mavsdk::rpc::gimbal::SetTracingRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SetTracing_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTracingResponse>* GimbalService::Stub::AsyncSetTracingRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSetTracingRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status GimbalService::Stub::GetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::mavsdk::rpc::gimbal::GetTraceResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::mavsdk::rpc::gimbal::GetTraceRequest, ::mavsdk::rpc::gimbal::GetTraceResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetTrace_, context, request, response);
+}
+
+void GimbalService::Stub::async::GetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest* request, ::mavsdk::rpc::gimbal::GetTraceResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::mavsdk::rpc::gimbal::GetTraceRequest, ::mavsdk::rpc::gimbal::GetTraceResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetTrace_, context, request, response, std::move(f));
+}
+
+void GimbalService::Stub::async::GetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest* request, ::mavsdk::rpc::gimbal::GetTraceResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetTrace_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetTraceResponse>* GimbalService::Stub::PrepareAsyncGetTraceRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::mavsdk::rpc::gimbal::GetTraceResponse, ::mavsdk::rpc::gimbal::GetTraceRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetTrace_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetTraceResponse>* GimbalService::Stub::AsyncGetTraceRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetTraceRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 GimbalService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       GimbalService_method_names[0],
@@ -274,6 +571,136 @@ GimbalService::Service::Service() {
              ::grpc::ServerWriter<::mavsdk::rpc::gimbal::ControlResponse>* writer) {
                return service->SubscribeControl(ctx, req, writer);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[7],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::GetMetricsRequest, ::mavsdk::rpc::gimbal::GetMetricsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavsdk::rpc::gimbal::GetMetricsRequest* req,
+             ::mavsdk::rpc::gimbal::GetMetricsResponse* resp) {
+               return service->GetMetrics(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[8],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* req,
+             ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* resp) {
+               return service->SetTelemetryRates(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[9],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::mavsdk::rpc::gimbal::MavlinkTunnelResponse,
+             ::mavsdk::rpc::gimbal::MavlinkTunnelRequest>* stream) {
+               return service->MavlinkTunnel(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[10],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest, ::mavsdk::rpc::gimbal::AttitudeBatch>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* req,
+             ::grpc::ServerWriter<::mavsdk::rpc::gimbal::AttitudeBatch>* writer) {
+               return service->SubscribeAttitudeBatch(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[11],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::mavsdk::rpc::gimbal::SetpointAck,
+             ::mavsdk::rpc::gimbal::Setpoint>* stream) {
+               return service->StreamSetpoints(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[12],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::SyncClockRequest, ::mavsdk::rpc::gimbal::SyncClockResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavsdk::rpc::gimbal::SyncClockRequest* req,
+             ::mavsdk::rpc::gimbal::SyncClockResponse* resp) {
+               return service->SyncClock(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[13],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::PredictAttitudeRequest, ::mavsdk::rpc::gimbal::PredictAttitudeResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* req,
+             ::mavsdk::rpc::gimbal::PredictAttitudeResponse* resp) {
+               return service->PredictAttitude(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[14],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::GetAttitudeAtRequest, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* req,
+             ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* resp) {
+               return service->GetAttitudeAt(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[15],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::GetAttitudesAtRequest, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* req,
+             ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* resp) {
+               return service->GetAttitudesAt(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[16],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::mavsdk::rpc::gimbal::VisualServoStatus,
+             ::mavsdk::rpc::gimbal::VisualServoRequest>* stream) {
+               return service->VisualServo(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[17],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* req,
+             ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* resp) {
+               return service->ApplyGimbalState(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[18],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::SetTracingRequest, ::mavsdk::rpc::gimbal::SetTracingResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavsdk::rpc::gimbal::SetTracingRequest* req,
+             ::mavsdk::rpc::gimbal::SetTracingResponse* resp) {
+               return service->SetTracing(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      GimbalService_method_names[19],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< GimbalService::Service, ::mavsdk::rpc::gimbal::GetTraceRequest, ::mavsdk::rpc::gimbal::GetTraceResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](GimbalService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::mavsdk::rpc::gimbal::GetTraceRequest* req,
+             ::mavsdk::rpc::gimbal::GetTraceResponse* resp) {
+               return service->GetTrace(ctx, req, resp);
+             }, this)));
 }
 
 GimbalService::Service::~Service() {
@@ -328,6 +755,94 @@ GimbalService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status GimbalService::Service::GetMetrics(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest* request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::SetTelemetryRates(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::MavlinkTunnel(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelResponse, ::mavsdk::rpc::gimbal::MavlinkTunnelRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::SubscribeAttitudeBatch(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* request, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::AttitudeBatch>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::StreamSetpoints(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::SetpointAck, ::mavsdk::rpc::gimbal::Setpoint>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::SyncClock(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest* request, ::mavsdk::rpc::gimbal::SyncClockResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::PredictAttitude(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::GetAttitudeAt(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::GetAttitudesAt(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::VisualServo(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::VisualServoStatus, ::mavsdk::rpc::gimbal::VisualServoRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::ApplyGimbalState(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::SetTracing(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest* request, ::mavsdk::rpc::gimbal::SetTracingResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status GimbalService::Service::GetTrace(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest* request, ::mavsdk::rpc::gimbal::GetTraceResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace mavsdk
 }  // namespace rpc
@@ -45,6 +45,18 @@ class GimbalService final {
     // This sets the desired pitch and yaw angles of a gimbal.
     // Will return when the command is accepted, however, it might
     // take the gimbal longer to actually be set to the new angles.
+    //
+    // With a motion profile, the server moves the gimbal there itself, along
+    // a straight line within the profile's limits, by sending angle
+    // setpoints at a fixed rate. The move starts from rest at the last
+    // commanded angles, or the measured attitude after rate commands, and
+    // takes the short way round in yaw. It returns when the final setpoint
+    // is accepted, or with ABORTED when another setpoint from any source
+    // interrupts it.
+    //
+    // While the command link is behind, the call is refused with
+    // RESOURCE_EXHAUSTED and a grpc-retry-pushback-ms trailer saying when
+    // to retry.
     virtual ::grpc::Status SetPitchAndYaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest& request, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetPitchAndYawResponse>> AsyncSetPitchAndYaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetPitchAndYawResponse>>(AsyncSetPitchAndYawRaw(context, request, cq));
@@ -59,6 +71,8 @@ class GimbalService final {
     // This sets the desired angular rates around pitch and yaw axes of a gimbal.
     // Will return when the command is accepted, however, it might
     // take the gimbal longer to actually reach the angular rate.
+    //
+    // Refused like SetPitchAndYaw while the command link is behind.
     virtual ::grpc::Status SetPitchRateAndYawRate(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest& request, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse>> AsyncSetPitchRateAndYawRate(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse>>(AsyncSetPitchRateAndYawRateRaw(context, request, cq));
@@ -104,6 +118,10 @@ class GimbalService final {
     //
     // Components are expected to be cooperative, which means that they can
     // override each other and should therefore do it carefully.
+    //
+    // If the gimbal has recently reported that we already hold the control,
+    // the call succeeds at once without sending anything; set force to send
+    // the command regardless.
     virtual ::grpc::Status TakeControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::TakeControlRequest& request, ::mavsdk::rpc::gimbal::TakeControlResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::TakeControlResponse>> AsyncTakeControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::TakeControlRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::TakeControlResponse>>(AsyncTakeControlRaw(context, request, cq));
@@ -115,6 +133,8 @@ class GimbalService final {
     // Release control.
     //
     // Release control, such that other components can control the gimbal.
+    // Like TakeControl, answered at once when we are known to hold none,
+    // unless forced.
     virtual ::grpc::Status ReleaseControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ReleaseControlRequest& request, ::mavsdk::rpc::gimbal::ReleaseControlResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::ReleaseControlResponse>> AsyncReleaseControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ReleaseControlRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::ReleaseControlResponse>>(AsyncReleaseControlRaw(context, request, cq));
@@ -137,6 +157,200 @@ class GimbalService final {
     std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::gimbal::ControlResponse>> PrepareAsyncSubscribeControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::gimbal::ControlResponse>>(PrepareAsyncSubscribeControlRaw(context, request, cq));
     }
+    //
+    // Get service metrics.
+    //
+    // Returns a snapshot of the service's internal counters and gauges,
+    // e.g. command scheduler queue depths and preemption counts.
+    virtual ::grpc::Status GetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetMetricsResponse>> AsyncGetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetMetricsResponse>>(AsyncGetMetricsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetMetricsResponse>> PrepareAsyncGetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetMetricsResponse>>(PrepareAsyncGetMetricsRaw(context, request, cq));
+    }
+    //
+    // Set telemetry rates.
+    //
+    // This sets the MAVLink message interval of the given telemetry streams.
+    // A rate of 0 turns a stream off, which is the cheapest way to free up
+    // a shared serial link. Streams that are not listed are left unchanged.
+    virtual ::grpc::Status SetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>> AsyncSetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>>(AsyncSetTelemetryRatesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>> PrepareAsyncSetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>>(PrepareAsyncSetTelemetryRatesRaw(context, request, cq));
+    }
+    //
+    // Tunnel raw MAVLink frames.
+    //
+    // Frames sent by the client are forwarded to the vehicle as they are, and
+    // frames received from the vehicle are streamed back. Several frames are
+    // packed into each message, so one stream can carry hundreds of frames per
+    // second. Incoming frames can be filtered by message id.
+    //
+    // Frames sent must carry the service's own system and component id; others
+    // are rejected. Only served on the unix socket.
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>> MavlinkTunnel(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>>(MavlinkTunnelRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>> AsyncMavlinkTunnel(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>>(AsyncMavlinkTunnelRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>> PrepareAsyncMavlinkTunnel(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>>(PrepareAsyncMavlinkTunnelRaw(context, cq));
+    }
+    //
+    // Subscribe to batched camera attitude.
+    //
+    // Samples are collected for the requested batch window and sent together
+    // in a compact encoding, for clients on metered or low-bandwidth links.
+    // With a prediction rate, samples are estimated at that rate instead of
+    // passed on as received, see PredictAttitude.
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::mavsdk::rpc::gimbal::AttitudeBatch>> SubscribeAttitudeBatch(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::mavsdk::rpc::gimbal::AttitudeBatch>>(SubscribeAttitudeBatchRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::gimbal::AttitudeBatch>> AsyncSubscribeAttitudeBatch(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::gimbal::AttitudeBatch>>(AsyncSubscribeAttitudeBatchRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::gimbal::AttitudeBatch>> PrepareAsyncSubscribeAttitudeBatch(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::gimbal::AttitudeBatch>>(PrepareAsyncSubscribeAttitudeBatchRaw(context, request, cq));
+    }
+    //
+    // Stream setpoints.
+    //
+    // Angle or rate setpoints are sent over one long-lived stream instead of
+    // one call each. Setpoints that are superseded before they reach the
+    // gimbal are not acknowledged; every other setpoint is acknowledged with
+    // its result once it has been sent. A setpoint with an apply time is held
+    // on the server and released at that time; it can be at most 5 s ahead,
+    // or the stream ends with INVALID_ARGUMENT, and setpoints beyond a
+    // client's share of the held places are acknowledged as rejected. Jitter
+    // buffered setpoints are acknowledged as soon as they are buffered.
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>> StreamSetpoints(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>>(StreamSetpointsRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>> AsyncStreamSetpoints(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>>(AsyncStreamSetpointsRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>> PrepareAsyncStreamSetpoints(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>>(PrepareAsyncStreamSetpointsRaw(context, cq));
+    }
+    //
+    // Sample the server's monotonic clock.
+    //
+    // With t1 and t4 the client's send and receive times, the offset of the
+    // server clock is ((t2 - t1) + (t3 - t4)) / 2 and the round trip is
+    // (t4 - t1) - (t3 - t2). Call it several times and keep the sample with
+    // the shortest round trip, whose offset is the least skewed by queueing.
+    virtual ::grpc::Status SyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::mavsdk::rpc::gimbal::SyncClockResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SyncClockResponse>> AsyncSyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SyncClockResponse>>(AsyncSyncClockRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SyncClockResponse>> PrepareAsyncSyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SyncClockResponse>>(PrepareAsyncSyncClockRaw(context, request, cq));
+    }
+    //
+    // Predict camera attitude.
+    //
+    // The attitude at the given time is estimated from the latest telemetry
+    // sample and the commands sent since, for uses that need attitude more
+    // often than telemetry provides it, such as video overlays.
+    virtual ::grpc::Status PredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>> AsyncPredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>>(AsyncPredictAttitudeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>> PrepareAsyncPredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>>(PrepareAsyncPredictAttitudeRaw(context, request, cq));
+    }
+    //
+    // Get camera attitude at a past time.
+    //
+    // Recent attitude is kept for several minutes and interpolated between
+    // samples, e.g. to geotag images from a separate camera process.
+    virtual ::grpc::Status GetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>> AsyncGetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>>(AsyncGetAttitudeAtRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>> PrepareAsyncGetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>>(PrepareAsyncGetAttitudeAtRaw(context, request, cq));
+    }
+    //
+    // Get camera attitude at many past times.
+    //
+    // Like GetAttitudeAt for up to 16384 times per call. Results are returned
+    // column by column, in the order of the requested times.
+    virtual ::grpc::Status GetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>> AsyncGetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>>(AsyncGetAttitudesAtRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>> PrepareAsyncGetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>>(PrepareAsyncGetAttitudesAtRaw(context, request, cq));
+    }
+    //
+    // Keep a target centered in the camera image.
+    //
+    // The client streams where the target is in the image and the server
+    // closes the loop itself: a PID controller with feed-forward runs at a
+    // fixed rate on the server and commands gimbal rates, so the loop does not
+    // wait on the network. Gains can be changed with any message. The loop's
+    // state is streamed back ten times per second. The gimbal stops when
+    // measurements stop, the target is lost or the stream ends.
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>> VisualServo(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>>(VisualServoRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>> AsyncVisualServo(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>>(AsyncVisualServoRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>> PrepareAsyncVisualServo(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>>(PrepareAsyncVisualServoRaw(context, cq));
+    }
+    //
+    // Take control, set the mode and point the gimbal in one call.
+    //
+    // Each part is optional. Control is taken first, as TakeControl does, and
+    // nothing else is sent if that fails. The mode and the target then go out
+    // back to back, without waiting for each other's ack. The call returns
+    // once every part has completed, with the result of each; it only fails
+    // when the request is refused before anything is sent.
+    virtual ::grpc::Status ApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>> AsyncApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>>(AsyncApplyGimbalStateRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>> PrepareAsyncApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>>(PrepareAsyncApplyGimbalStateRaw(context, request, cq));
+    }
+    //
+    // Turn per-call tracing on or off.
+    //
+    // While on, each call is traced under the id in its x-trace-id (hex) or
+    // W3C traceparent metadata, or under a fresh id, which is sent back in
+    // x-trace-id. Turning tracing off keeps what was recorded.
+    //
+    // Only served on the unix socket.
+    virtual ::grpc::Status SetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::mavsdk::rpc::gimbal::SetTracingResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTracingResponse>> AsyncSetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTracingResponse>>(AsyncSetTracingRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTracingResponse>> PrepareAsyncSetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTracingResponse>>(PrepareAsyncSetTracingRaw(context, request, cq));
+    }
+    //
+    // Export the trace.
+    //
+    // The spans of traced calls, from gRPC receipt and the handler through
+    // command queueing, the MAVLink send and ack to the telemetry sample that
+    // confirms an angle command. Each thread keeps its most recent spans.
+    //
+    // Only served on the unix socket.
+    virtual ::grpc::Status GetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::mavsdk::rpc::gimbal::GetTraceResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetTraceResponse>> AsyncGetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetTraceResponse>>(AsyncGetTraceRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetTraceResponse>> PrepareAsyncGetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetTraceResponse>>(PrepareAsyncGetTraceRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -147,6 +361,18 @@ class GimbalService final {
       // This sets the desired pitch and yaw angles of a gimbal.
       // Will return when the command is accepted, however, it might
       // take the gimbal longer to actually be set to the new angles.
+      //
+      // With a motion profile, the server moves the gimbal there itself, along
+      // a straight line within the profile's limits, by sending angle
+      // setpoints at a fixed rate. The move starts from rest at the last
+      // commanded angles, or the measured attitude after rate commands, and
+      // takes the short way round in yaw. It returns when the final setpoint
+      // is accepted, or with ABORTED when another setpoint from any source
+      // interrupts it.
+      //
+      // While the command link is behind, the call is refused with
+      // RESOURCE_EXHAUSTED and a grpc-retry-pushback-ms trailer saying when
+      // to retry.
       virtual void SetPitchAndYaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* request, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void SetPitchAndYaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* request, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       //
@@ -156,6 +382,8 @@ class GimbalService final {
       // This sets the desired angular rates around pitch and yaw axes of a gimbal.
       // Will return when the command is accepted, however, it might
       // take the gimbal longer to actually reach the angular rate.
+      //
+      // Refused like SetPitchAndYaw while the command link is behind.
       virtual void SetPitchRateAndYawRate(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* request, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void SetPitchRateAndYawRate(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* request, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       //
@@ -186,12 +414,18 @@ class GimbalService final {
       //
       // Components are expected to be cooperative, which means that they can
       // override each other and should therefore do it carefully.
+      //
+      // If the gimbal has recently reported that we already hold the control,
+      // the call succeeds at once without sending anything; set force to send
+      // the command regardless.
       virtual void TakeControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::TakeControlRequest* request, ::mavsdk::rpc::gimbal::TakeControlResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void TakeControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::TakeControlRequest* request, ::mavsdk::rpc::gimbal::TakeControlResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       //
       // Release control.
       //
       // Release control, such that other components can control the gimbal.
+      // Like TakeControl, answered at once when we are known to hold none,
+      // unless forced.
       virtual void ReleaseControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* request, ::mavsdk::rpc::gimbal::ReleaseControlResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void ReleaseControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* request, ::mavsdk::rpc::gimbal::ReleaseControlResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       //
@@ -201,6 +435,123 @@ class GimbalService final {
       // no control over the gimbal. Also, it gives the system and component ids
       // of the other components in control (if any).
       virtual void SubscribeControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* request, ::grpc::ClientReadReactor< ::mavsdk::rpc::gimbal::ControlResponse>* reactor) = 0;
+      //
+      // Get service metrics.
+      //
+      // Returns a snapshot of the service's internal counters and gauges,
+      // e.g. command scheduler queue depths and preemption counts.
+      virtual void GetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest* request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest* request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //
+      // Set telemetry rates.
+      //
+      // This sets the MAVLink message interval of the given telemetry streams.
+      // A rate of 0 turns a stream off, which is the cheapest way to free up
+      // a shared serial link. Streams that are not listed are left unchanged.
+      virtual void SetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //
+      // Tunnel raw MAVLink frames.
+      //
+      // Frames sent by the client are forwarded to the vehicle as they are, and
+      // frames received from the vehicle are streamed back. Several frames are
+      // packed into each message, so one stream can carry hundreds of frames per
+      // second. Incoming frames can be filtered by message id.
+      //
+      // Frames sent must carry the service's own system and component id; others
+      // are rejected. Only served on the unix socket.
+      virtual void MavlinkTunnel(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest,::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* reactor) = 0;
+      //
+      // Subscribe to batched camera attitude.
+      //
+      // Samples are collected for the requested batch window and sent together
+      // in a compact encoding, for clients on metered or low-bandwidth links.
+      // With a prediction rate, samples are estimated at that rate instead of
+      // passed on as received, see PredictAttitude.
+      virtual void SubscribeAttitudeBatch(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* request, ::grpc::ClientReadReactor< ::mavsdk::rpc::gimbal::AttitudeBatch>* reactor) = 0;
+      //
+      // Stream setpoints.
+      //
+      // Angle or rate setpoints are sent over one long-lived stream instead of
+      // one call each. Setpoints that are superseded before they reach the
+      // gimbal are not acknowledged; every other setpoint is acknowledged with
+      // its result once it has been sent. A setpoint with an apply time is held
+      // on the server and released at that time; it can be at most 5 s ahead,
+      // or the stream ends with INVALID_ARGUMENT, and setpoints beyond a
+      // client's share of the held places are acknowledged as rejected. Jitter
+      // buffered setpoints are acknowledged as soon as they are buffered.
+      virtual void StreamSetpoints(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::mavsdk::rpc::gimbal::Setpoint,::mavsdk::rpc::gimbal::SetpointAck>* reactor) = 0;
+      //
+      // Sample the server's monotonic clock.
+      //
+      // With t1 and t4 the client's send and receive times, the offset of the
+      // server clock is ((t2 - t1) + (t3 - t4)) / 2 and the round trip is
+      // (t4 - t1) - (t3 - t2). Call it several times and keep the sample with
+      // the shortest round trip, whose offset is the least skewed by queueing.
+      virtual void SyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest* request, ::mavsdk::rpc::gimbal::SyncClockResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest* request, ::mavsdk::rpc::gimbal::SyncClockResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //
+      // Predict camera attitude.
+      //
+      // The attitude at the given time is estimated from the latest telemetry
+      // sample and the commands sent since, for uses that need attitude more
+      // often than telemetry provides it, such as video overlays.
+      virtual void PredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void PredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //
+      // Get camera attitude at a past time.
+      //
+      // Recent attitude is kept for several minutes and interpolated between
+      // samples, e.g. to geotag images from a separate camera process.
+      virtual void GetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //
+      // Get camera attitude at many past times.
+      //
+      // Like GetAttitudeAt for up to 16384 times per call. Results are returned
+      // column by column, in the order of the requested times.
+      virtual void GetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //
+      // Keep a target centered in the camera image.
+      //
+      // The client streams where the target is in the image and the server
+      // closes the loop itself: a PID controller with feed-forward runs at a
+      // fixed rate on the server and commands gimbal rates, so the loop does not
+      // wait on the network. Gains can be changed with any message. The loop's
+      // state is streamed back ten times per second. The gimbal stops when
+      // measurements stop, the target is lost or the stream ends.
+      virtual void VisualServo(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::mavsdk::rpc::gimbal::VisualServoRequest,::mavsdk::rpc::gimbal::VisualServoStatus>* reactor) = 0;
+      //
+      // Take control, set the mode and point the gimbal in one call.
+      //
+      // Each part is optional. Control is taken first, as TakeControl does, and
+      // nothing else is sent if that fails. The mode and the target then go out
+      // back to back, without waiting for each other's ack. The call returns
+      // once every part has completed, with the result of each; it only fails
+      // when the request is refused before anything is sent.
+      virtual void ApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //
+      // Turn per-call tracing on or off.
+      //
+      // While on, each call is traced under the id in its x-trace-id (hex) or
+      // W3C traceparent metadata, or under a fresh id, which is sent back in
+      // x-trace-id. Turning tracing off keeps what was recorded.
+      //
+      // Only served on the unix socket.
+      virtual void SetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest* request, ::mavsdk::rpc::gimbal::SetTracingResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest* request, ::mavsdk::rpc::gimbal::SetTracingResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //
+      // Export the trace.
+      //
+      // The spans of traced calls, from gRPC receipt and the handler through
+      // command queueing, the MAVLink send and ack to the telemetry sample that
+      // confirms an angle command. Each thread keeps its most recent spans.
+      //
+      // Only served on the unix socket.
+      virtual void GetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest* request, ::mavsdk::rpc::gimbal::GetTraceResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest* request, ::mavsdk::rpc::gimbal::GetTraceResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -221,6 +572,36 @@ class GimbalService final {
     virtual ::grpc::ClientReaderInterface< ::mavsdk::rpc::gimbal::ControlResponse>* SubscribeControlRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest& request) = 0;
     virtual ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::gimbal::ControlResponse>* AsyncSubscribeControlRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
     virtual ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::gimbal::ControlResponse>* PrepareAsyncSubscribeControlRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetMetricsResponse>* AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetMetricsResponse>* PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>* AsyncSetTelemetryRatesRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>* PrepareAsyncSetTelemetryRatesRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* MavlinkTunnelRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* AsyncMavlinkTunnelRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* PrepareAsyncMavlinkTunnelRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::mavsdk::rpc::gimbal::AttitudeBatch>* SubscribeAttitudeBatchRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::gimbal::AttitudeBatch>* AsyncSubscribeAttitudeBatchRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::gimbal::AttitudeBatch>* PrepareAsyncSubscribeAttitudeBatchRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>* StreamSetpointsRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>* AsyncStreamSetpointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>* PrepareAsyncStreamSetpointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SyncClockResponse>* AsyncSyncClockRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SyncClockResponse>* PrepareAsyncSyncClockRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>* AsyncPredictAttitudeRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>* PrepareAsyncPredictAttitudeRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>* AsyncGetAttitudeAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>* PrepareAsyncGetAttitudeAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>* AsyncGetAttitudesAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>* PrepareAsyncGetAttitudesAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>* VisualServoRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>* AsyncVisualServoRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>* PrepareAsyncVisualServoRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>* AsyncApplyGimbalStateRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>* PrepareAsyncApplyGimbalStateRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTracingResponse>* AsyncSetTracingRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::SetTracingResponse>* PrepareAsyncSetTracingRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetTraceResponse>* AsyncGetTraceRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::gimbal::GetTraceResponse>* PrepareAsyncGetTraceRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -276,6 +657,105 @@ class GimbalService final {
     std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::ControlResponse>> PrepareAsyncSubscribeControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::ControlResponse>>(PrepareAsyncSubscribeControlRaw(context, request, cq));
     }
+    ::grpc::Status GetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetMetricsResponse>> AsyncGetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetMetricsResponse>>(AsyncGetMetricsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetMetricsResponse>> PrepareAsyncGetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetMetricsResponse>>(PrepareAsyncGetMetricsRaw(context, request, cq));
+    }
+    ::grpc::Status SetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>> AsyncSetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>>(AsyncSetTelemetryRatesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>> PrepareAsyncSetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>>(PrepareAsyncSetTelemetryRatesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>> MavlinkTunnel(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>>(MavlinkTunnelRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>> AsyncMavlinkTunnel(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>>(AsyncMavlinkTunnelRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>> PrepareAsyncMavlinkTunnel(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>>(PrepareAsyncMavlinkTunnelRaw(context, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::mavsdk::rpc::gimbal::AttitudeBatch>> SubscribeAttitudeBatch(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::mavsdk::rpc::gimbal::AttitudeBatch>>(SubscribeAttitudeBatchRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::AttitudeBatch>> AsyncSubscribeAttitudeBatch(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::AttitudeBatch>>(AsyncSubscribeAttitudeBatchRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::AttitudeBatch>> PrepareAsyncSubscribeAttitudeBatch(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::AttitudeBatch>>(PrepareAsyncSubscribeAttitudeBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>> StreamSetpoints(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>>(StreamSetpointsRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>> AsyncStreamSetpoints(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>>(AsyncStreamSetpointsRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>> PrepareAsyncStreamSetpoints(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>>(PrepareAsyncStreamSetpointsRaw(context, cq));
+    }
+    ::grpc::Status SyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::mavsdk::rpc::gimbal::SyncClockResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SyncClockResponse>> AsyncSyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SyncClockResponse>>(AsyncSyncClockRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SyncClockResponse>> PrepareAsyncSyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SyncClockResponse>>(PrepareAsyncSyncClockRaw(context, request, cq));
+    }
+    ::grpc::Status PredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>> AsyncPredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>>(AsyncPredictAttitudeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>> PrepareAsyncPredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>>(PrepareAsyncPredictAttitudeRaw(context, request, cq));
+    }
+    ::grpc::Status GetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>> AsyncGetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>>(AsyncGetAttitudeAtRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>> PrepareAsyncGetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>>(PrepareAsyncGetAttitudeAtRaw(context, request, cq));
+    }
+    ::grpc::Status GetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>> AsyncGetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>>(AsyncGetAttitudesAtRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>> PrepareAsyncGetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>>(PrepareAsyncGetAttitudesAtRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>> VisualServo(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>>(VisualServoRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>> AsyncVisualServo(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>>(AsyncVisualServoRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>> PrepareAsyncVisualServo(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>>(PrepareAsyncVisualServoRaw(context, cq));
+    }
+    ::grpc::Status ApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>> AsyncApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>>(AsyncApplyGimbalStateRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>> PrepareAsyncApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>>(PrepareAsyncApplyGimbalStateRaw(context, request, cq));
+    }
+    ::grpc::Status SetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::mavsdk::rpc::gimbal::SetTracingResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTracingResponse>> AsyncSetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTracingResponse>>(AsyncSetTracingRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTracingResponse>> PrepareAsyncSetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTracingResponse>>(PrepareAsyncSetTracingRaw(context, request, cq));
+    }
+    ::grpc::Status GetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::mavsdk::rpc::gimbal::GetTraceResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetTraceResponse>> AsyncGetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetTraceResponse>>(AsyncGetTraceRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetTraceResponse>> PrepareAsyncGetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetTraceResponse>>(PrepareAsyncGetTraceRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -292,6 +772,28 @@ class GimbalService final {
       void ReleaseControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* request, ::mavsdk::rpc::gimbal::ReleaseControlResponse* response, std::function<void(::grpc::Status)>) override;
       void ReleaseControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* request, ::mavsdk::rpc::gimbal::ReleaseControlResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SubscribeControl(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* request, ::grpc::ClientReadReactor< ::mavsdk::rpc::gimbal::ControlResponse>* reactor) override;
+      void GetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest* request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetMetrics(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest* request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response, std::function<void(::grpc::Status)>) override;
+      void SetTelemetryRates(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void MavlinkTunnel(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest,::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* reactor) override;
+      void SubscribeAttitudeBatch(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* request, ::grpc::ClientReadReactor< ::mavsdk::rpc::gimbal::AttitudeBatch>* reactor) override;
+      void StreamSetpoints(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::mavsdk::rpc::gimbal::Setpoint,::mavsdk::rpc::gimbal::SetpointAck>* reactor) override;
+      void SyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest* request, ::mavsdk::rpc::gimbal::SyncClockResponse* response, std::function<void(::grpc::Status)>) override;
+      void SyncClock(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest* request, ::mavsdk::rpc::gimbal::SyncClockResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void PredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response, std::function<void(::grpc::Status)>) override;
+      void PredictAttitude(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetAttitudeAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetAttitudesAt(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void VisualServo(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::mavsdk::rpc::gimbal::VisualServoRequest,::mavsdk::rpc::gimbal::VisualServoStatus>* reactor) override;
+      void ApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response, std::function<void(::grpc::Status)>) override;
+      void ApplyGimbalState(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest* request, ::mavsdk::rpc::gimbal::SetTracingResponse* response, std::function<void(::grpc::Status)>) override;
+      void SetTracing(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest* request, ::mavsdk::rpc::gimbal::SetTracingResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest* request, ::mavsdk::rpc::gimbal::GetTraceResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetTrace(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest* request, ::mavsdk::rpc::gimbal::GetTraceResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -318,6 +820,36 @@ class GimbalService final {
     ::grpc::ClientReader< ::mavsdk::rpc::gimbal::ControlResponse>* SubscribeControlRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest& request) override;
     ::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::ControlResponse>* AsyncSubscribeControlRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
     ::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::ControlResponse>* PrepareAsyncSubscribeControlRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetMetricsResponse>* AsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetMetricsResponse>* PrepareAsyncGetMetricsRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>* AsyncSetTelemetryRatesRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>* PrepareAsyncSetTelemetryRatesRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* MavlinkTunnelRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* AsyncMavlinkTunnelRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* PrepareAsyncMavlinkTunnelRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::mavsdk::rpc::gimbal::AttitudeBatch>* SubscribeAttitudeBatchRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request) override;
+    ::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::AttitudeBatch>* AsyncSubscribeAttitudeBatchRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::mavsdk::rpc::gimbal::AttitudeBatch>* PrepareAsyncSubscribeAttitudeBatchRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>* StreamSetpointsRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>* AsyncStreamSetpointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>* PrepareAsyncStreamSetpointsRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SyncClockResponse>* AsyncSyncClockRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SyncClockResponse>* PrepareAsyncSyncClockRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>* AsyncPredictAttitudeRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>* PrepareAsyncPredictAttitudeRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>* AsyncGetAttitudeAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>* PrepareAsyncGetAttitudeAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>* AsyncGetAttitudesAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>* PrepareAsyncGetAttitudesAtRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>* VisualServoRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>* AsyncVisualServoRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>* PrepareAsyncVisualServoRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>* AsyncApplyGimbalStateRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>* PrepareAsyncApplyGimbalStateRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTracingResponse>* AsyncSetTracingRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::SetTracingResponse>* PrepareAsyncSetTracingRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetTraceResponse>* AsyncGetTraceRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::gimbal::GetTraceResponse>* PrepareAsyncGetTraceRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_SetPitchAndYaw_;
     const ::grpc::internal::RpcMethod rpcmethod_SetPitchRateAndYawRate_;
     const ::grpc::internal::RpcMethod rpcmethod_SetMode_;
@@ -325,6 +857,19 @@ class GimbalService final {
     const ::grpc::internal::RpcMethod rpcmethod_TakeControl_;
     const ::grpc::internal::RpcMethod rpcmethod_ReleaseControl_;
     const ::grpc::internal::RpcMethod rpcmethod_SubscribeControl_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetMetrics_;
+    const ::grpc::internal::RpcMethod rpcmethod_SetTelemetryRates_;
+    const ::grpc::internal::RpcMethod rpcmethod_MavlinkTunnel_;
+    const ::grpc::internal::RpcMethod rpcmethod_SubscribeAttitudeBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_StreamSetpoints_;
+    const ::grpc::internal::RpcMethod rpcmethod_SyncClock_;
+    const ::grpc::internal::RpcMethod rpcmethod_PredictAttitude_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetAttitudeAt_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetAttitudesAt_;
+    const ::grpc::internal::RpcMethod rpcmethod_VisualServo_;
+    const ::grpc::internal::RpcMethod rpcmethod_ApplyGimbalState_;
+    const ::grpc::internal::RpcMethod rpcmethod_SetTracing_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetTrace_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -339,6 +884,18 @@ class GimbalService final {
     // This sets the desired pitch and yaw angles of a gimbal.
     // Will return when the command is accepted, however, it might
     // take the gimbal longer to actually be set to the new angles.
+    //
+    // With a motion profile, the server moves the gimbal there itself, along
+    // a straight line within the profile's limits, by sending angle
+    // setpoints at a fixed rate. The move starts from rest at the last
+    // commanded angles, or the measured attitude after rate commands, and
+    // takes the short way round in yaw. It returns when the final setpoint
+    // is accepted, or with ABORTED when another setpoint from any source
+    // interrupts it.
+    //
+    // While the command link is behind, the call is refused with
+    // RESOURCE_EXHAUSTED and a grpc-retry-pushback-ms trailer saying when
+    // to retry.
     virtual ::grpc::Status SetPitchAndYaw(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* request, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* response);
     //
     //
@@ -347,6 +904,8 @@ class GimbalService final {
     // This sets the desired angular rates around pitch and yaw axes of a gimbal.
     // Will return when the command is accepted, however, it might
     // take the gimbal longer to actually reach the angular rate.
+    //
+    // Refused like SetPitchAndYaw while the command link is behind.
     virtual ::grpc::Status SetPitchRateAndYawRate(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* request, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* response);
     //
     // Set gimbal mode.
@@ -374,11 +933,17 @@ class GimbalService final {
     //
     // Components are expected to be cooperative, which means that they can
     // override each other and should therefore do it carefully.
+    //
+    // If the gimbal has recently reported that we already hold the control,
+    // the call succeeds at once without sending anything; set force to send
+    // the command regardless.
     virtual ::grpc::Status TakeControl(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::TakeControlRequest* request, ::mavsdk::rpc::gimbal::TakeControlResponse* response);
     //
     // Release control.
     //
     // Release control, such that other components can control the gimbal.
+    // Like TakeControl, answered at once when we are known to hold none,
+    // unless forced.
     virtual ::grpc::Status ReleaseControl(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* request, ::mavsdk::rpc::gimbal::ReleaseControlResponse* response);
     //
     // Subscribe to control status updates.
@@ -387,6 +952,114 @@ class GimbalService final {
     // no control over the gimbal. Also, it gives the system and component ids
     // of the other components in control (if any).
     virtual ::grpc::Status SubscribeControl(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* request, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::ControlResponse>* writer);
+    //
+    // Get service metrics.
+    //
+    // Returns a snapshot of the service's internal counters and gauges,
+    // e.g. command scheduler queue depths and preemption counts.
+    virtual ::grpc::Status GetMetrics(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest* request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response);
+    //
+    // Set telemetry rates.
+    //
+    // This sets the MAVLink message interval of the given telemetry streams.
+    // A rate of 0 turns a stream off, which is the cheapest way to free up
+    // a shared serial link. Streams that are not listed are left unchanged.
+    virtual ::grpc::Status SetTelemetryRates(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response);
+    //
+    // Tunnel raw MAVLink frames.
+    //
+    // Frames sent by the client are forwarded to the vehicle as they are, and
+    // frames received from the vehicle are streamed back. Several frames are
+    // packed into each message, so one stream can carry hundreds of frames per
+    // second. Incoming frames can be filtered by message id.
+    //
+    // Frames sent must carry the service's own system and component id; others
+    // are rejected. Only served on the unix socket.
+    virtual ::grpc::Status MavlinkTunnel(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelResponse, ::mavsdk::rpc::gimbal::MavlinkTunnelRequest>* stream);
+    //
+    // Subscribe to batched camera attitude.
+    //
+    // Samples are collected for the requested batch window and sent together
+    // in a compact encoding, for clients on metered or low-bandwidth links.
+    // With a prediction rate, samples are estimated at that rate instead of
+    // passed on as received, see PredictAttitude.
+    virtual ::grpc::Status SubscribeAttitudeBatch(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* request, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::AttitudeBatch>* writer);
+    //
+    // Stream setpoints.
+    //
+    // Angle or rate setpoints are sent over one long-lived stream instead of
+    // one call each. Setpoints that are superseded before they reach the
+    // gimbal are not acknowledged; every other setpoint is acknowledged with
+    // its result once it has been sent. A setpoint with an apply time is held
+    // on the server and released at that time; it can be at most 5 s ahead,
+    // or the stream ends with INVALID_ARGUMENT, and setpoints beyond a
+    // client's share of the held places are acknowledged as rejected. Jitter
+    // buffered setpoints are acknowledged as soon as they are buffered.
+    virtual ::grpc::Status StreamSetpoints(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::SetpointAck, ::mavsdk::rpc::gimbal::Setpoint>* stream);
+    //
+    // Sample the server's monotonic clock.
+    //
+    // With t1 and t4 the client's send and receive times, the offset of the
+    // server clock is ((t2 - t1) + (t3 - t4)) / 2 and the round trip is
+    // (t4 - t1) - (t3 - t2). Call it several times and keep the sample with
+    // the shortest round trip, whose offset is the least skewed by queueing.
+    virtual ::grpc::Status SyncClock(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest* request, ::mavsdk::rpc::gimbal::SyncClockResponse* response);
+    //
+    // Predict camera attitude.
+    //
+    // The attitude at the given time is estimated from the latest telemetry
+    // sample and the commands sent since, for uses that need attitude more
+    // often than telemetry provides it, such as video overlays.
+    virtual ::grpc::Status PredictAttitude(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response);
+    //
+    // Get camera attitude at a past time.
+    //
+    // Recent attitude is kept for several minutes and interpolated between
+    // samples, e.g. to geotag images from a separate camera process.
+    virtual ::grpc::Status GetAttitudeAt(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response);
+    //
+    // Get camera attitude at many past times.
+    //
+    // Like GetAttitudeAt for up to 16384 times per call. Results are returned
+    // column by column, in the order of the requested times.
+    virtual ::grpc::Status GetAttitudesAt(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response);
+    //
+    // Keep a target centered in the camera image.
+    //
+    // The client streams where the target is in the image and the server
+    // closes the loop itself: a PID controller with feed-forward runs at a
+    // fixed rate on the server and commands gimbal rates, so the loop does not
+    // wait on the network. Gains can be changed with any message. The loop's
+    // state is streamed back ten times per second. The gimbal stops when
+    // measurements stop, the target is lost or the stream ends.
+    virtual ::grpc::Status VisualServo(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::VisualServoStatus, ::mavsdk::rpc::gimbal::VisualServoRequest>* stream);
+    //
+    // Take control, set the mode and point the gimbal in one call.
+    //
+    // Each part is optional. Control is taken first, as TakeControl does, and
+    // nothing else is sent if that fails. The mode and the target then go out
+    // back to back, without waiting for each other's ack. The call returns
+    // once every part has completed, with the result of each; it only fails
+    // when the request is refused before anything is sent.
+    virtual ::grpc::Status ApplyGimbalState(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response);
+    //
+    // Turn per-call tracing on or off.
+    //
+    // While on, each call is traced under the id in its x-trace-id (hex) or
+    // W3C traceparent metadata, or under a fresh id, which is sent back in
+    // x-trace-id. Turning tracing off keeps what was recorded.
+    //
+    // Only served on the unix socket.
+    virtual ::grpc::Status SetTracing(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest* request, ::mavsdk::rpc::gimbal::SetTracingResponse* response);
+    //
+    // Export the trace.
+    //
+    // The spans of traced calls, from gRPC receipt and the handler through
+    // command queueing, the MAVLink send and ack to the telemetry sample that
+    // confirms an angle command. Each thread keeps its most recent spans.
+    //
+    // Only served on the unix socket.
+    virtual ::grpc::Status GetTrace(::grpc::ServerContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest* request, ::mavsdk::rpc::gimbal::GetTraceResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_SetPitchAndYaw : public BaseClass {
@@ -528,202 +1201,284 @@ class GimbalService final {
       ::grpc::Service::RequestAsyncServerStreaming(6, context, request, writer, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_SetPitchAndYaw<WithAsyncMethod_SetPitchRateAndYawRate<WithAsyncMethod_SetMode<WithAsyncMethod_SetRoiLocation<WithAsyncMethod_TakeControl<WithAsyncMethod_ReleaseControl<WithAsyncMethod_SubscribeControl<Service > > > > > > > AsyncService;
   template <class BaseClass>
-  class WithCallbackMethod_SetPitchAndYaw : public BaseClass {
+  class WithAsyncMethod_GetMetrics : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SetPitchAndYaw() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetPitchAndYawRequest, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* request, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* response) { return this->SetPitchAndYaw(context, request, response); }));}
-    void SetMessageAllocatorFor_SetPitchAndYaw(
-        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::SetPitchAndYawRequest, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetPitchAndYawRequest, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodAsync(7);
     }
-    ~WithCallbackMethod_SetPitchAndYaw() override {
+    ~WithAsyncMethod_GetMetrics() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetPitchAndYaw(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* /*response*/) override {
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetMetricsRequest* /*request*/, ::mavsdk::rpc::gimbal::GetMetricsResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetPitchAndYaw(
-      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* /*response*/)  { return nullptr; }
+    void RequestGetMetrics(::grpc::ServerContext* context, ::mavsdk::rpc::gimbal::GetMetricsRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavsdk::rpc::gimbal::GetMetricsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_SetPitchRateAndYawRate : public BaseClass {
+  class WithAsyncMethod_SetTelemetryRates : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SetPitchRateAndYawRate() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* request, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* response) { return this->SetPitchRateAndYawRate(context, request, response); }));}
-    void SetMessageAllocatorFor_SetPitchRateAndYawRate(
-        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_SetTelemetryRates() {
+      ::grpc::Service::MarkMethodAsync(8);
     }
-    ~WithCallbackMethod_SetPitchRateAndYawRate() override {
+    ~WithAsyncMethod_SetTelemetryRates() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetPitchRateAndYawRate(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* /*response*/) override {
+    ::grpc::Status SetTelemetryRates(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetPitchRateAndYawRate(
-      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* /*response*/)  { return nullptr; }
+    void RequestSetTelemetryRates(::grpc::ServerContext* context, ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_SetMode : public BaseClass {
+  class WithAsyncMethod_MavlinkTunnel : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SetMode() {
-      ::grpc::Service::MarkMethodCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetModeRequest, ::mavsdk::rpc::gimbal::SetModeResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SetModeRequest* request, ::mavsdk::rpc::gimbal::SetModeResponse* response) { return this->SetMode(context, request, response); }));}
-    void SetMessageAllocatorFor_SetMode(
-        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::SetModeRequest, ::mavsdk::rpc::gimbal::SetModeResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetModeRequest, ::mavsdk::rpc::gimbal::SetModeResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_MavlinkTunnel() {
+      ::grpc::Service::MarkMethodAsync(9);
     }
-    ~WithCallbackMethod_SetMode() override {
+    ~WithAsyncMethod_MavlinkTunnel() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetMode(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetModeRequest* /*request*/, ::mavsdk::rpc::gimbal::SetModeResponse* /*response*/) override {
+    ::grpc::Status MavlinkTunnel(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelResponse, ::mavsdk::rpc::gimbal::MavlinkTunnelRequest>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetMode(
-      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetModeRequest* /*request*/, ::mavsdk::rpc::gimbal::SetModeResponse* /*response*/)  { return nullptr; }
+    void RequestMavlinkTunnel(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelResponse, ::mavsdk::rpc::gimbal::MavlinkTunnelRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(9, context, stream, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_SetRoiLocation : public BaseClass {
+  class WithAsyncMethod_SubscribeAttitudeBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SetRoiLocation() {
-      ::grpc::Service::MarkMethodCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetRoiLocationRequest, ::mavsdk::rpc::gimbal::SetRoiLocationResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SetRoiLocationRequest* request, ::mavsdk::rpc::gimbal::SetRoiLocationResponse* response) { return this->SetRoiLocation(context, request, response); }));}
-    void SetMessageAllocatorFor_SetRoiLocation(
-        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::SetRoiLocationRequest, ::mavsdk::rpc::gimbal::SetRoiLocationResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetRoiLocationRequest, ::mavsdk::rpc::gimbal::SetRoiLocationResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_SubscribeAttitudeBatch() {
+      ::grpc::Service::MarkMethodAsync(10);
     }
-    ~WithCallbackMethod_SetRoiLocation() override {
+    ~WithAsyncMethod_SubscribeAttitudeBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRoiLocation(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetRoiLocationRequest* /*request*/, ::mavsdk::rpc::gimbal::SetRoiLocationResponse* /*response*/) override {
+    ::grpc::Status SubscribeAttitudeBatch(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::AttitudeBatch>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetRoiLocation(
-      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetRoiLocationRequest* /*request*/, ::mavsdk::rpc::gimbal::SetRoiLocationResponse* /*response*/)  { return nullptr; }
+    void RequestSubscribeAttitudeBatch(::grpc::ServerContext* context, ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* request, ::grpc::ServerAsyncWriter< ::mavsdk::rpc::gimbal::AttitudeBatch>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(10, context, request, writer, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_TakeControl : public BaseClass {
+  class WithAsyncMethod_StreamSetpoints : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_TakeControl() {
-      ::grpc::Service::MarkMethodCallback(4,
-          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::TakeControlRequest, ::mavsdk::rpc::gimbal::TakeControlResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::TakeControlRequest* request, ::mavsdk::rpc::gimbal::TakeControlResponse* response) { return this->TakeControl(context, request, response); }));}
-    void SetMessageAllocatorFor_TakeControl(
-        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::TakeControlRequest, ::mavsdk::rpc::gimbal::TakeControlResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::TakeControlRequest, ::mavsdk::rpc::gimbal::TakeControlResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_StreamSetpoints() {
+      ::grpc::Service::MarkMethodAsync(11);
     }
-    ~WithCallbackMethod_TakeControl() override {
+    ~WithAsyncMethod_StreamSetpoints() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status TakeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::TakeControlRequest* /*request*/, ::mavsdk::rpc::gimbal::TakeControlResponse* /*response*/) override {
+    ::grpc::Status StreamSetpoints(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::SetpointAck, ::mavsdk::rpc::gimbal::Setpoint>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* TakeControl(
-      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::TakeControlRequest* /*request*/, ::mavsdk::rpc::gimbal::TakeControlResponse* /*response*/)  { return nullptr; }
+    void RequestStreamSetpoints(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::mavsdk::rpc::gimbal::SetpointAck, ::mavsdk::rpc::gimbal::Setpoint>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(11, context, stream, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_ReleaseControl : public BaseClass {
+  class WithAsyncMethod_SyncClock : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_ReleaseControl() {
-      ::grpc::Service::MarkMethodCallback(5,
-          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::ReleaseControlRequest, ::mavsdk::rpc::gimbal::ReleaseControlResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* request, ::mavsdk::rpc::gimbal::ReleaseControlResponse* response) { return this->ReleaseControl(context, request, response); }));}
-    void SetMessageAllocatorFor_ReleaseControl(
-        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::ReleaseControlRequest, ::mavsdk::rpc::gimbal::ReleaseControlResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::ReleaseControlRequest, ::mavsdk::rpc::gimbal::ReleaseControlResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
+    WithAsyncMethod_SyncClock() {
+      ::grpc::Service::MarkMethodAsync(12);
     }
-    ~WithCallbackMethod_ReleaseControl() override {
+    ~WithAsyncMethod_SyncClock() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReleaseControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* /*request*/, ::mavsdk::rpc::gimbal::ReleaseControlResponse* /*response*/) override {
+    ::grpc::Status SyncClock(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SyncClockRequest* /*request*/, ::mavsdk::rpc::gimbal::SyncClockResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* ReleaseControl(
-      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* /*request*/, ::mavsdk::rpc::gimbal::ReleaseControlResponse* /*response*/)  { return nullptr; }
+    void RequestSyncClock(::grpc::ServerContext* context, ::mavsdk::rpc::gimbal::SyncClockRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavsdk::rpc::gimbal::SyncClockResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
   template <class BaseClass>
-  class WithCallbackMethod_SubscribeControl : public BaseClass {
+  class WithAsyncMethod_PredictAttitude : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithCallbackMethod_SubscribeControl() {
-      ::grpc::Service::MarkMethodCallback(6,
-          new ::grpc::internal::CallbackServerStreamingHandler< ::mavsdk::rpc::gimbal::SubscribeControlRequest, ::mavsdk::rpc::gimbal::ControlResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* request) { return this->SubscribeControl(context, request); }));
+    WithAsyncMethod_PredictAttitude() {
+      ::grpc::Service::MarkMethodAsync(13);
     }
-    ~WithCallbackMethod_SubscribeControl() override {
+    ~WithAsyncMethod_PredictAttitude() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SubscribeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::ControlResponse>* /*writer*/) override {
+    ::grpc::Status PredictAttitude(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* /*request*/, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerWriteReactor< ::mavsdk::rpc::gimbal::ControlResponse>* SubscribeControl(
-      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* /*request*/)  { return nullptr; }
+    void RequestPredictAttitude(::grpc::ServerContext* context, ::mavsdk::rpc::gimbal::PredictAttitudeRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavsdk::rpc::gimbal::PredictAttitudeResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
   };
-  typedef WithCallbackMethod_SetPitchAndYaw<WithCallbackMethod_SetPitchRateAndYawRate<WithCallbackMethod_SetMode<WithCallbackMethod_SetRoiLocation<WithCallbackMethod_TakeControl<WithCallbackMethod_ReleaseControl<WithCallbackMethod_SubscribeControl<Service > > > > > > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
-  class WithGenericMethod_SetPitchAndYaw : public BaseClass {
+  class WithAsyncMethod_GetAttitudeAt : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SetPitchAndYaw() {
-      ::grpc::Service::MarkMethodGeneric(0);
+    WithAsyncMethod_GetAttitudeAt() {
+      ::grpc::Service::MarkMethodAsync(14);
     }
-    ~WithGenericMethod_SetPitchAndYaw() override {
+    ~WithAsyncMethod_GetAttitudeAt() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetAttitudeAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetAttitudeAt(::grpc::ServerContext* context, ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetAttitudesAt : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetAttitudesAt() {
+      ::grpc::Service::MarkMethodAsync(15);
+    }
+    ~WithAsyncMethod_GetAttitudesAt() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetAttitudesAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetAttitudesAt(::grpc::ServerContext* context, ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_VisualServo : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_VisualServo() {
+      ::grpc::Service::MarkMethodAsync(16);
+    }
+    ~WithAsyncMethod_VisualServo() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status VisualServo(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::VisualServoStatus, ::mavsdk::rpc::gimbal::VisualServoRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestVisualServo(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::mavsdk::rpc::gimbal::VisualServoStatus, ::mavsdk::rpc::gimbal::VisualServoRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(16, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ApplyGimbalState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ApplyGimbalState() {
+      ::grpc::Service::MarkMethodAsync(17);
+    }
+    ~WithAsyncMethod_ApplyGimbalState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ApplyGimbalState(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* /*request*/, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestApplyGimbalState(::grpc::ServerContext* context, ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SetTracing : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SetTracing() {
+      ::grpc::Service::MarkMethodAsync(18);
+    }
+    ~WithAsyncMethod_SetTracing() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTracing(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTracingRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTracingResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetTracing(::grpc::ServerContext* context, ::mavsdk::rpc::gimbal::SetTracingRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavsdk::rpc::gimbal::SetTracingResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetTrace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetTrace() {
+      ::grpc::Service::MarkMethodAsync(19);
+    }
+    ~WithAsyncMethod_GetTrace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTrace(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetTraceRequest* /*request*/, ::mavsdk::rpc::gimbal::GetTraceResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetTrace(::grpc::ServerContext* context, ::mavsdk::rpc::gimbal::GetTraceRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavsdk::rpc::gimbal::GetTraceResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_SetPitchAndYaw<WithAsyncMethod_SetPitchRateAndYawRate<WithAsyncMethod_SetMode<WithAsyncMethod_SetRoiLocation<WithAsyncMethod_TakeControl<WithAsyncMethod_ReleaseControl<WithAsyncMethod_SubscribeControl<WithAsyncMethod_GetMetrics<WithAsyncMethod_SetTelemetryRates<WithAsyncMethod_MavlinkTunnel<WithAsyncMethod_SubscribeAttitudeBatch<WithAsyncMethod_StreamSetpoints<WithAsyncMethod_SyncClock<WithAsyncMethod_PredictAttitude<WithAsyncMethod_GetAttitudeAt<WithAsyncMethod_GetAttitudesAt<WithAsyncMethod_VisualServo<WithAsyncMethod_ApplyGimbalState<WithAsyncMethod_SetTracing<WithAsyncMethod_GetTrace<Service > > > > > > > > > > > > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_SetPitchAndYaw : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SetPitchAndYaw() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetPitchAndYawRequest, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* request, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* response) { return this->SetPitchAndYaw(context, request, response); }));}
+    void SetMessageAllocatorFor_SetPitchAndYaw(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::SetPitchAndYawRequest, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetPitchAndYawRequest, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SetPitchAndYaw() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -731,16 +1486,26 @@ class GimbalService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* SetPitchAndYaw(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_SetPitchRateAndYawRate : public BaseClass {
+  class WithCallbackMethod_SetPitchRateAndYawRate : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SetPitchRateAndYawRate() {
-      ::grpc::Service::MarkMethodGeneric(1);
+    WithCallbackMethod_SetPitchRateAndYawRate() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* request, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* response) { return this->SetPitchRateAndYawRate(context, request, response); }));}
+    void SetMessageAllocatorFor_SetPitchRateAndYawRate(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_SetPitchRateAndYawRate() override {
+    ~WithCallbackMethod_SetPitchRateAndYawRate() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -748,16 +1513,26 @@ class GimbalService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* SetPitchRateAndYawRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_SetMode : public BaseClass {
+  class WithCallbackMethod_SetMode : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SetMode() {
-      ::grpc::Service::MarkMethodGeneric(2);
+    WithCallbackMethod_SetMode() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetModeRequest, ::mavsdk::rpc::gimbal::SetModeResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SetModeRequest* request, ::mavsdk::rpc::gimbal::SetModeResponse* response) { return this->SetMode(context, request, response); }));}
+    void SetMessageAllocatorFor_SetMode(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::SetModeRequest, ::mavsdk::rpc::gimbal::SetModeResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetModeRequest, ::mavsdk::rpc::gimbal::SetModeResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_SetMode() override {
+    ~WithCallbackMethod_SetMode() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -765,16 +1540,26 @@ class GimbalService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* SetMode(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetModeRequest* /*request*/, ::mavsdk::rpc::gimbal::SetModeResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_SetRoiLocation : public BaseClass {
+  class WithCallbackMethod_SetRoiLocation : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SetRoiLocation() {
-      ::grpc::Service::MarkMethodGeneric(3);
+    WithCallbackMethod_SetRoiLocation() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetRoiLocationRequest, ::mavsdk::rpc::gimbal::SetRoiLocationResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SetRoiLocationRequest* request, ::mavsdk::rpc::gimbal::SetRoiLocationResponse* response) { return this->SetRoiLocation(context, request, response); }));}
+    void SetMessageAllocatorFor_SetRoiLocation(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::SetRoiLocationRequest, ::mavsdk::rpc::gimbal::SetRoiLocationResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetRoiLocationRequest, ::mavsdk::rpc::gimbal::SetRoiLocationResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_SetRoiLocation() override {
+    ~WithCallbackMethod_SetRoiLocation() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -782,16 +1567,26 @@ class GimbalService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* SetRoiLocation(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetRoiLocationRequest* /*request*/, ::mavsdk::rpc::gimbal::SetRoiLocationResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_TakeControl : public BaseClass {
+  class WithCallbackMethod_TakeControl : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_TakeControl() {
-      ::grpc::Service::MarkMethodGeneric(4);
+    WithCallbackMethod_TakeControl() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::TakeControlRequest, ::mavsdk::rpc::gimbal::TakeControlResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::TakeControlRequest* request, ::mavsdk::rpc::gimbal::TakeControlResponse* response) { return this->TakeControl(context, request, response); }));}
+    void SetMessageAllocatorFor_TakeControl(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::TakeControlRequest, ::mavsdk::rpc::gimbal::TakeControlResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::TakeControlRequest, ::mavsdk::rpc::gimbal::TakeControlResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_TakeControl() override {
+    ~WithCallbackMethod_TakeControl() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -799,16 +1594,26 @@ class GimbalService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* TakeControl(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::TakeControlRequest* /*request*/, ::mavsdk::rpc::gimbal::TakeControlResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_ReleaseControl : public BaseClass {
+  class WithCallbackMethod_ReleaseControl : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_ReleaseControl() {
-      ::grpc::Service::MarkMethodGeneric(5);
+    WithCallbackMethod_ReleaseControl() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::ReleaseControlRequest, ::mavsdk::rpc::gimbal::ReleaseControlResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* request, ::mavsdk::rpc::gimbal::ReleaseControlResponse* response) { return this->ReleaseControl(context, request, response); }));}
+    void SetMessageAllocatorFor_ReleaseControl(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::ReleaseControlRequest, ::mavsdk::rpc::gimbal::ReleaseControlResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::ReleaseControlRequest, ::mavsdk::rpc::gimbal::ReleaseControlResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithGenericMethod_ReleaseControl() override {
+    ~WithCallbackMethod_ReleaseControl() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -816,16 +1621,21 @@ class GimbalService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerUnaryReactor* ReleaseControl(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* /*request*/, ::mavsdk::rpc::gimbal::ReleaseControlResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithGenericMethod_SubscribeControl : public BaseClass {
+  class WithCallbackMethod_SubscribeControl : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SubscribeControl() {
-      ::grpc::Service::MarkMethodGeneric(6);
+    WithCallbackMethod_SubscribeControl() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::mavsdk::rpc::gimbal::SubscribeControlRequest, ::mavsdk::rpc::gimbal::ControlResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* request) { return this->SubscribeControl(context, request); }));
     }
-    ~WithGenericMethod_SubscribeControl() override {
+    ~WithCallbackMethod_SubscribeControl() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -833,300 +1643,1527 @@ class GimbalService final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerWriteReactor< ::mavsdk::rpc::gimbal::ControlResponse>* SubscribeControl(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* /*request*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_SetPitchAndYaw : public BaseClass {
+  class WithCallbackMethod_GetMetrics : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SetPitchAndYaw() {
-      ::grpc::Service::MarkMethodRaw(0);
+    WithCallbackMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::GetMetricsRequest, ::mavsdk::rpc::gimbal::GetMetricsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::GetMetricsRequest* request, ::mavsdk::rpc::gimbal::GetMetricsResponse* response) { return this->GetMetrics(context, request, response); }));}
+    void SetMessageAllocatorFor_GetMetrics(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::GetMetricsRequest, ::mavsdk::rpc::gimbal::GetMetricsResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::GetMetricsRequest, ::mavsdk::rpc::gimbal::GetMetricsResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_SetPitchAndYaw() override {
+    ~WithCallbackMethod_GetMetrics() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetPitchAndYaw(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* /*response*/) override {
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetMetricsRequest* /*request*/, ::mavsdk::rpc::gimbal::GetMetricsResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetPitchAndYaw(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* GetMetrics(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetMetricsRequest* /*request*/, ::mavsdk::rpc::gimbal::GetMetricsResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_SetPitchRateAndYawRate : public BaseClass {
+  class WithCallbackMethod_SetTelemetryRates : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SetPitchRateAndYawRate() {
-      ::grpc::Service::MarkMethodRaw(1);
+    WithCallbackMethod_SetTelemetryRates() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* request, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* response) { return this->SetTelemetryRates(context, request, response); }));}
+    void SetMessageAllocatorFor_SetTelemetryRates(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
     }
-    ~WithRawMethod_SetPitchRateAndYawRate() override {
+    ~WithCallbackMethod_SetTelemetryRates() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetPitchRateAndYawRate(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* /*response*/) override {
+    ::grpc::Status SetTelemetryRates(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetPitchRateAndYawRate(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* SetTelemetryRates(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_SetMode : public BaseClass {
+  class WithCallbackMethod_MavlinkTunnel : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SetMode() {
-      ::grpc::Service::MarkMethodRaw(2);
+    WithCallbackMethod_MavlinkTunnel() {
+      ::grpc::Service::MarkMethodCallback(9,
+          new ::grpc::internal::CallbackBidiHandler< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->MavlinkTunnel(context); }));
     }
-    ~WithRawMethod_SetMode() override {
+    ~WithCallbackMethod_MavlinkTunnel() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetMode(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetModeRequest* /*request*/, ::mavsdk::rpc::gimbal::SetModeResponse* /*response*/) override {
+    ::grpc::Status MavlinkTunnel(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelResponse, ::mavsdk::rpc::gimbal::MavlinkTunnelRequest>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetMode(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerBidiReactor< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest, ::mavsdk::rpc::gimbal::MavlinkTunnelResponse>* MavlinkTunnel(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_SetRoiLocation : public BaseClass {
+  class WithCallbackMethod_SubscribeAttitudeBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SetRoiLocation() {
-      ::grpc::Service::MarkMethodRaw(3);
+    WithCallbackMethod_SubscribeAttitudeBatch() {
+      ::grpc::Service::MarkMethodCallback(10,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest, ::mavsdk::rpc::gimbal::AttitudeBatch>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* request) { return this->SubscribeAttitudeBatch(context, request); }));
     }
-    ~WithRawMethod_SetRoiLocation() override {
+    ~WithCallbackMethod_SubscribeAttitudeBatch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRoiLocation(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetRoiLocationRequest* /*request*/, ::mavsdk::rpc::gimbal::SetRoiLocationResponse* /*response*/) override {
+    ::grpc::Status SubscribeAttitudeBatch(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::AttitudeBatch>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSetRoiLocation(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerWriteReactor< ::mavsdk::rpc::gimbal::AttitudeBatch>* SubscribeAttitudeBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* /*request*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_TakeControl : public BaseClass {
+  class WithCallbackMethod_StreamSetpoints : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_TakeControl() {
-      ::grpc::Service::MarkMethodRaw(4);
+    WithCallbackMethod_StreamSetpoints() {
+      ::grpc::Service::MarkMethodCallback(11,
+          new ::grpc::internal::CallbackBidiHandler< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->StreamSetpoints(context); }));
     }
-    ~WithRawMethod_TakeControl() override {
+    ~WithCallbackMethod_StreamSetpoints() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status TakeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::TakeControlRequest* /*request*/, ::mavsdk::rpc::gimbal::TakeControlResponse* /*response*/) override {
+    ::grpc::Status StreamSetpoints(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::SetpointAck, ::mavsdk::rpc::gimbal::Setpoint>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestTakeControl(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    virtual ::grpc::ServerBidiReactor< ::mavsdk::rpc::gimbal::Setpoint, ::mavsdk::rpc::gimbal::SetpointAck>* StreamSetpoints(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SyncClock : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SyncClock() {
+      ::grpc::Service::MarkMethodCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SyncClockRequest, ::mavsdk::rpc::gimbal::SyncClockResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SyncClockRequest* request, ::mavsdk::rpc::gimbal::SyncClockResponse* response) { return this->SyncClock(context, request, response); }));}
+    void SetMessageAllocatorFor_SyncClock(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::SyncClockRequest, ::mavsdk::rpc::gimbal::SyncClockResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SyncClockRequest, ::mavsdk::rpc::gimbal::SyncClockResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SyncClock() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncClock(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SyncClockRequest* /*request*/, ::mavsdk::rpc::gimbal::SyncClockResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SyncClock(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SyncClockRequest* /*request*/, ::mavsdk::rpc::gimbal::SyncClockResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_PredictAttitude : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_PredictAttitude() {
+      ::grpc::Service::MarkMethodCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::PredictAttitudeRequest, ::mavsdk::rpc::gimbal::PredictAttitudeResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* request, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* response) { return this->PredictAttitude(context, request, response); }));}
+    void SetMessageAllocatorFor_PredictAttitude(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::PredictAttitudeRequest, ::mavsdk::rpc::gimbal::PredictAttitudeResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::PredictAttitudeRequest, ::mavsdk::rpc::gimbal::PredictAttitudeResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_PredictAttitude() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PredictAttitude(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* /*request*/, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* PredictAttitude(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* /*request*/, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetAttitudeAt : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetAttitudeAt() {
+      ::grpc::Service::MarkMethodCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::GetAttitudeAtRequest, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* response) { return this->GetAttitudeAt(context, request, response); }));}
+    void SetMessageAllocatorFor_GetAttitudeAt(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::GetAttitudeAtRequest, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::GetAttitudeAtRequest, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetAttitudeAt() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetAttitudeAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetAttitudeAt(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetAttitudesAt : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetAttitudesAt() {
+      ::grpc::Service::MarkMethodCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::GetAttitudesAtRequest, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* request, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* response) { return this->GetAttitudesAt(context, request, response); }));}
+    void SetMessageAllocatorFor_GetAttitudesAt(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::GetAttitudesAtRequest, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::GetAttitudesAtRequest, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetAttitudesAt() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetAttitudesAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetAttitudesAt(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_VisualServo : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_VisualServo() {
+      ::grpc::Service::MarkMethodCallback(16,
+          new ::grpc::internal::CallbackBidiHandler< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->VisualServo(context); }));
+    }
+    ~WithCallbackMethod_VisualServo() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status VisualServo(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::VisualServoStatus, ::mavsdk::rpc::gimbal::VisualServoRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::mavsdk::rpc::gimbal::VisualServoRequest, ::mavsdk::rpc::gimbal::VisualServoStatus>* VisualServo(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ApplyGimbalState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ApplyGimbalState() {
+      ::grpc::Service::MarkMethodCallback(17,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* request, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* response) { return this->ApplyGimbalState(context, request, response); }));}
+    void SetMessageAllocatorFor_ApplyGimbalState(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(17);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ApplyGimbalState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ApplyGimbalState(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* /*request*/, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ApplyGimbalState(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* /*request*/, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SetTracing : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SetTracing() {
+      ::grpc::Service::MarkMethodCallback(18,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetTracingRequest, ::mavsdk::rpc::gimbal::SetTracingResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::SetTracingRequest* request, ::mavsdk::rpc::gimbal::SetTracingResponse* response) { return this->SetTracing(context, request, response); }));}
+    void SetMessageAllocatorFor_SetTracing(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::SetTracingRequest, ::mavsdk::rpc::gimbal::SetTracingResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(18);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::SetTracingRequest, ::mavsdk::rpc::gimbal::SetTracingResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SetTracing() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTracing(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTracingRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTracingResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetTracing(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTracingRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTracingResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetTrace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetTrace() {
+      ::grpc::Service::MarkMethodCallback(19,
+          new ::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::GetTraceRequest, ::mavsdk::rpc::gimbal::GetTraceResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::mavsdk::rpc::gimbal::GetTraceRequest* request, ::mavsdk::rpc::gimbal::GetTraceResponse* response) { return this->GetTrace(context, request, response); }));}
+    void SetMessageAllocatorFor_GetTrace(
+        ::grpc::MessageAllocator< ::mavsdk::rpc::gimbal::GetTraceRequest, ::mavsdk::rpc::gimbal::GetTraceResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(19);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::mavsdk::rpc::gimbal::GetTraceRequest, ::mavsdk::rpc::gimbal::GetTraceResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetTrace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTrace(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetTraceRequest* /*request*/, ::mavsdk::rpc::gimbal::GetTraceResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetTrace(
+      ::grpc::CallbackServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetTraceRequest* /*request*/, ::mavsdk::rpc::gimbal::GetTraceResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_SetPitchAndYaw<WithCallbackMethod_SetPitchRateAndYawRate<WithCallbackMethod_SetMode<WithCallbackMethod_SetRoiLocation<WithCallbackMethod_TakeControl<WithCallbackMethod_ReleaseControl<WithCallbackMethod_SubscribeControl<WithCallbackMethod_GetMetrics<WithCallbackMethod_SetTelemetryRates<WithCallbackMethod_MavlinkTunnel<WithCallbackMethod_SubscribeAttitudeBatch<WithCallbackMethod_StreamSetpoints<WithCallbackMethod_SyncClock<WithCallbackMethod_PredictAttitude<WithCallbackMethod_GetAttitudeAt<WithCallbackMethod_GetAttitudesAt<WithCallbackMethod_VisualServo<WithCallbackMethod_ApplyGimbalState<WithCallbackMethod_SetTracing<WithCallbackMethod_GetTrace<Service > > > > > > > > > > > > > > > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithGenericMethod_SetPitchAndYaw : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetPitchAndYaw() {
+      ::grpc::Service::MarkMethodGeneric(0);
+    }
+    ~WithGenericMethod_SetPitchAndYaw() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetPitchAndYaw(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SetPitchRateAndYawRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetPitchRateAndYawRate() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_SetPitchRateAndYawRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetPitchRateAndYawRate(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SetMode : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetMode() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_SetMode() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMode(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetModeRequest* /*request*/, ::mavsdk::rpc::gimbal::SetModeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SetRoiLocation : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetRoiLocation() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_SetRoiLocation() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetRoiLocation(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetRoiLocationRequest* /*request*/, ::mavsdk::rpc::gimbal::SetRoiLocationResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_TakeControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_TakeControl() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_TakeControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status TakeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::TakeControlRequest* /*request*/, ::mavsdk::rpc::gimbal::TakeControlResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ReleaseControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ReleaseControl() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_ReleaseControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReleaseControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* /*request*/, ::mavsdk::rpc::gimbal::ReleaseControlResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SubscribeControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SubscribeControl() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_SubscribeControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::ControlResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodGeneric(7);
+    }
+    ~WithGenericMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetMetricsRequest* /*request*/, ::mavsdk::rpc::gimbal::GetMetricsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SetTelemetryRates : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetTelemetryRates() {
+      ::grpc::Service::MarkMethodGeneric(8);
+    }
+    ~WithGenericMethod_SetTelemetryRates() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTelemetryRates(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_MavlinkTunnel : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_MavlinkTunnel() {
+      ::grpc::Service::MarkMethodGeneric(9);
+    }
+    ~WithGenericMethod_MavlinkTunnel() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MavlinkTunnel(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelResponse, ::mavsdk::rpc::gimbal::MavlinkTunnelRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SubscribeAttitudeBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SubscribeAttitudeBatch() {
+      ::grpc::Service::MarkMethodGeneric(10);
+    }
+    ~WithGenericMethod_SubscribeAttitudeBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeAttitudeBatch(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::AttitudeBatch>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_StreamSetpoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StreamSetpoints() {
+      ::grpc::Service::MarkMethodGeneric(11);
+    }
+    ~WithGenericMethod_StreamSetpoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamSetpoints(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::SetpointAck, ::mavsdk::rpc::gimbal::Setpoint>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SyncClock : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SyncClock() {
+      ::grpc::Service::MarkMethodGeneric(12);
+    }
+    ~WithGenericMethod_SyncClock() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncClock(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SyncClockRequest* /*request*/, ::mavsdk::rpc::gimbal::SyncClockResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_PredictAttitude : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_PredictAttitude() {
+      ::grpc::Service::MarkMethodGeneric(13);
+    }
+    ~WithGenericMethod_PredictAttitude() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PredictAttitude(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* /*request*/, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetAttitudeAt : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetAttitudeAt() {
+      ::grpc::Service::MarkMethodGeneric(14);
+    }
+    ~WithGenericMethod_GetAttitudeAt() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetAttitudeAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetAttitudesAt : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetAttitudesAt() {
+      ::grpc::Service::MarkMethodGeneric(15);
+    }
+    ~WithGenericMethod_GetAttitudesAt() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetAttitudesAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_VisualServo : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_VisualServo() {
+      ::grpc::Service::MarkMethodGeneric(16);
+    }
+    ~WithGenericMethod_VisualServo() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status VisualServo(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::VisualServoStatus, ::mavsdk::rpc::gimbal::VisualServoRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ApplyGimbalState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ApplyGimbalState() {
+      ::grpc::Service::MarkMethodGeneric(17);
+    }
+    ~WithGenericMethod_ApplyGimbalState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ApplyGimbalState(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* /*request*/, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SetTracing : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetTracing() {
+      ::grpc::Service::MarkMethodGeneric(18);
+    }
+    ~WithGenericMethod_SetTracing() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTracing(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTracingRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTracingResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetTrace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetTrace() {
+      ::grpc::Service::MarkMethodGeneric(19);
+    }
+    ~WithGenericMethod_GetTrace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTrace(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetTraceRequest* /*request*/, ::mavsdk::rpc::gimbal::GetTraceResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetPitchAndYaw : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetPitchAndYaw() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_SetPitchAndYaw() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetPitchAndYaw(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetPitchAndYaw(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetPitchRateAndYawRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetPitchRateAndYawRate() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_SetPitchRateAndYawRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetPitchRateAndYawRate(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetPitchRateAndYawRate(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetMode : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetMode() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_SetMode() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMode(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetModeRequest* /*request*/, ::mavsdk::rpc::gimbal::SetModeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetMode(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetRoiLocation : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetRoiLocation() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_SetRoiLocation() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetRoiLocation(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetRoiLocationRequest* /*request*/, ::mavsdk::rpc::gimbal::SetRoiLocationResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetRoiLocation(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_TakeControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_TakeControl() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_TakeControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status TakeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::TakeControlRequest* /*request*/, ::mavsdk::rpc::gimbal::TakeControlResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestTakeControl(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ReleaseControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ReleaseControl() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_ReleaseControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReleaseControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* /*request*/, ::mavsdk::rpc::gimbal::ReleaseControlResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestReleaseControl(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SubscribeControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SubscribeControl() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_SubscribeControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::ControlResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribeControl(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(6, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetMetricsRequest* /*request*/, ::mavsdk::rpc::gimbal::GetMetricsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMetrics(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetTelemetryRates : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetTelemetryRates() {
+      ::grpc::Service::MarkMethodRaw(8);
+    }
+    ~WithRawMethod_SetTelemetryRates() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTelemetryRates(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetTelemetryRates(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_MavlinkTunnel : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_MavlinkTunnel() {
+      ::grpc::Service::MarkMethodRaw(9);
+    }
+    ~WithRawMethod_MavlinkTunnel() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MavlinkTunnel(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelResponse, ::mavsdk::rpc::gimbal::MavlinkTunnelRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestMavlinkTunnel(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(9, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SubscribeAttitudeBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SubscribeAttitudeBatch() {
+      ::grpc::Service::MarkMethodRaw(10);
+    }
+    ~WithRawMethod_SubscribeAttitudeBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeAttitudeBatch(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::AttitudeBatch>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribeAttitudeBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(10, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_StreamSetpoints : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StreamSetpoints() {
+      ::grpc::Service::MarkMethodRaw(11);
+    }
+    ~WithRawMethod_StreamSetpoints() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamSetpoints(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::SetpointAck, ::mavsdk::rpc::gimbal::Setpoint>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamSetpoints(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(11, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SyncClock : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SyncClock() {
+      ::grpc::Service::MarkMethodRaw(12);
+    }
+    ~WithRawMethod_SyncClock() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncClock(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SyncClockRequest* /*request*/, ::mavsdk::rpc::gimbal::SyncClockResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSyncClock(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_PredictAttitude : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_PredictAttitude() {
+      ::grpc::Service::MarkMethodRaw(13);
+    }
+    ~WithRawMethod_PredictAttitude() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status PredictAttitude(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* /*request*/, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPredictAttitude(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetAttitudeAt : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetAttitudeAt() {
+      ::grpc::Service::MarkMethodRaw(14);
+    }
+    ~WithRawMethod_GetAttitudeAt() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetAttitudeAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetAttitudeAt(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetAttitudesAt : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetAttitudesAt() {
+      ::grpc::Service::MarkMethodRaw(15);
+    }
+    ~WithRawMethod_GetAttitudesAt() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetAttitudesAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetAttitudesAt(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_VisualServo : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_VisualServo() {
+      ::grpc::Service::MarkMethodRaw(16);
+    }
+    ~WithRawMethod_VisualServo() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status VisualServo(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::VisualServoStatus, ::mavsdk::rpc::gimbal::VisualServoRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestVisualServo(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(16, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ApplyGimbalState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ApplyGimbalState() {
+      ::grpc::Service::MarkMethodRaw(17);
+    }
+    ~WithRawMethod_ApplyGimbalState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ApplyGimbalState(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* /*request*/, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestApplyGimbalState(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SetTracing : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetTracing() {
+      ::grpc::Service::MarkMethodRaw(18);
+    }
+    ~WithRawMethod_SetTracing() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTracing(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTracingRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTracingResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetTracing(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetTrace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetTrace() {
+      ::grpc::Service::MarkMethodRaw(19);
+    }
+    ~WithRawMethod_GetTrace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTrace(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetTraceRequest* /*request*/, ::mavsdk::rpc::gimbal::GetTraceResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetTrace(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetPitchAndYaw : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetPitchAndYaw() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetPitchAndYaw(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetPitchAndYaw() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetPitchAndYaw(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetPitchAndYaw(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetPitchRateAndYawRate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetPitchRateAndYawRate() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetPitchRateAndYawRate(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetPitchRateAndYawRate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetPitchRateAndYawRate(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetPitchRateAndYawRate(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetMode : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetMode() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetMode(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetMode() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMode(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetModeRequest* /*request*/, ::mavsdk::rpc::gimbal::SetModeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetMode(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetRoiLocation : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetRoiLocation() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetRoiLocation(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetRoiLocation() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetRoiLocation(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetRoiLocationRequest* /*request*/, ::mavsdk::rpc::gimbal::SetRoiLocationResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetRoiLocation(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_TakeControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_TakeControl() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->TakeControl(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_TakeControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status TakeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::TakeControlRequest* /*request*/, ::mavsdk::rpc::gimbal::TakeControlResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* TakeControl(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ReleaseControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ReleaseControl() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReleaseControl(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ReleaseControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ReleaseControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* /*request*/, ::mavsdk::rpc::gimbal::ReleaseControlResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ReleaseControl(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SubscribeControl : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SubscribeControl() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->SubscribeControl(context, request); }));
+    }
+    ~WithRawCallbackMethod_SubscribeControl() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::ControlResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* SubscribeControl(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetMetrics(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetMetricsRequest* /*request*/, ::mavsdk::rpc::gimbal::GetMetricsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetMetrics(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SetTelemetryRates : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SetTelemetryRates() {
+      ::grpc::Service::MarkMethodRawCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetTelemetryRates(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SetTelemetryRates() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetTelemetryRates(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SetTelemetryRates(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_MavlinkTunnel : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_MavlinkTunnel() {
+      ::grpc::Service::MarkMethodRawCallback(9,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->MavlinkTunnel(context); }));
+    }
+    ~WithRawCallbackMethod_MavlinkTunnel() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MavlinkTunnel(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::MavlinkTunnelResponse, ::mavsdk::rpc::gimbal::MavlinkTunnelRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* MavlinkTunnel(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SubscribeAttitudeBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SubscribeAttitudeBatch() {
+      ::grpc::Service::MarkMethodRawCallback(10,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->SubscribeAttitudeBatch(context, request); }));
+    }
+    ~WithRawCallbackMethod_SubscribeAttitudeBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeAttitudeBatch(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::AttitudeBatch>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* SubscribeAttitudeBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_ReleaseControl : public BaseClass {
+  class WithRawCallbackMethod_StreamSetpoints : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_ReleaseControl() {
-      ::grpc::Service::MarkMethodRaw(5);
+    WithRawCallbackMethod_StreamSetpoints() {
+      ::grpc::Service::MarkMethodRawCallback(11,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->StreamSetpoints(context); }));
     }
-    ~WithRawMethod_ReleaseControl() override {
+    ~WithRawCallbackMethod_StreamSetpoints() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReleaseControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* /*request*/, ::mavsdk::rpc::gimbal::ReleaseControlResponse* /*response*/) override {
+    ::grpc::Status StreamSetpoints(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::SetpointAck, ::mavsdk::rpc::gimbal::Setpoint>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestReleaseControl(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* StreamSetpoints(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawMethod_SubscribeControl : public BaseClass {
+  class WithRawCallbackMethod_SyncClock : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_SubscribeControl() {
-      ::grpc::Service::MarkMethodRaw(6);
+    WithRawCallbackMethod_SyncClock() {
+      ::grpc::Service::MarkMethodRawCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SyncClock(context, request, response); }));
     }
-    ~WithRawMethod_SubscribeControl() override {
+    ~WithRawCallbackMethod_SyncClock() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SubscribeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::ControlResponse>* /*writer*/) override {
+    ::grpc::Status SyncClock(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SyncClockRequest* /*request*/, ::mavsdk::rpc::gimbal::SyncClockResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestSubscribeControl(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncServerStreaming(6, context, request, writer, new_call_cq, notification_cq, tag);
-    }
+    virtual ::grpc::ServerUnaryReactor* SyncClock(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SetPitchAndYaw : public BaseClass {
+  class WithRawCallbackMethod_PredictAttitude : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SetPitchAndYaw() {
-      ::grpc::Service::MarkMethodRawCallback(0,
+    WithRawCallbackMethod_PredictAttitude() {
+      ::grpc::Service::MarkMethodRawCallback(13,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetPitchAndYaw(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->PredictAttitude(context, request, response); }));
     }
-    ~WithRawCallbackMethod_SetPitchAndYaw() override {
+    ~WithRawCallbackMethod_PredictAttitude() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetPitchAndYaw(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchAndYawResponse* /*response*/) override {
+    ::grpc::Status PredictAttitude(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* /*request*/, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetPitchAndYaw(
+    virtual ::grpc::ServerUnaryReactor* PredictAttitude(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SetPitchRateAndYawRate : public BaseClass {
+  class WithRawCallbackMethod_GetAttitudeAt : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SetPitchRateAndYawRate() {
-      ::grpc::Service::MarkMethodRawCallback(1,
+    WithRawCallbackMethod_GetAttitudeAt() {
+      ::grpc::Service::MarkMethodRawCallback(14,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetPitchRateAndYawRate(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetAttitudeAt(context, request, response); }));
     }
-    ~WithRawCallbackMethod_SetPitchRateAndYawRate() override {
+    ~WithRawCallbackMethod_GetAttitudeAt() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetPitchRateAndYawRate(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* /*request*/, ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* /*response*/) override {
+    ::grpc::Status GetAttitudeAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetPitchRateAndYawRate(
+    virtual ::grpc::ServerUnaryReactor* GetAttitudeAt(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SetMode : public BaseClass {
+  class WithRawCallbackMethod_GetAttitudesAt : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SetMode() {
-      ::grpc::Service::MarkMethodRawCallback(2,
+    WithRawCallbackMethod_GetAttitudesAt() {
+      ::grpc::Service::MarkMethodRawCallback(15,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetMode(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetAttitudesAt(context, request, response); }));
     }
-    ~WithRawCallbackMethod_SetMode() override {
+    ~WithRawCallbackMethod_GetAttitudesAt() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetMode(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetModeRequest* /*request*/, ::mavsdk::rpc::gimbal::SetModeResponse* /*response*/) override {
+    ::grpc::Status GetAttitudesAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetMode(
+    virtual ::grpc::ServerUnaryReactor* GetAttitudesAt(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SetRoiLocation : public BaseClass {
+  class WithRawCallbackMethod_VisualServo : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SetRoiLocation() {
-      ::grpc::Service::MarkMethodRawCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithRawCallbackMethod_VisualServo() {
+      ::grpc::Service::MarkMethodRawCallback(16,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetRoiLocation(context, request, response); }));
+                   ::grpc::CallbackServerContext* context) { return this->VisualServo(context); }));
     }
-    ~WithRawCallbackMethod_SetRoiLocation() override {
+    ~WithRawCallbackMethod_VisualServo() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SetRoiLocation(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetRoiLocationRequest* /*request*/, ::mavsdk::rpc::gimbal::SetRoiLocationResponse* /*response*/) override {
+    ::grpc::Status VisualServo(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::mavsdk::rpc::gimbal::VisualServoStatus, ::mavsdk::rpc::gimbal::VisualServoRequest>* /*stream*/)  override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* SetRoiLocation(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* VisualServo(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_TakeControl : public BaseClass {
+  class WithRawCallbackMethod_ApplyGimbalState : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_TakeControl() {
-      ::grpc::Service::MarkMethodRawCallback(4,
+    WithRawCallbackMethod_ApplyGimbalState() {
+      ::grpc::Service::MarkMethodRawCallback(17,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->TakeControl(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ApplyGimbalState(context, request, response); }));
     }
-    ~WithRawCallbackMethod_TakeControl() override {
+    ~WithRawCallbackMethod_ApplyGimbalState() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status TakeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::TakeControlRequest* /*request*/, ::mavsdk::rpc::gimbal::TakeControlResponse* /*response*/) override {
+    ::grpc::Status ApplyGimbalState(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* /*request*/, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* TakeControl(
+    virtual ::grpc::ServerUnaryReactor* ApplyGimbalState(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_ReleaseControl : public BaseClass {
+  class WithRawCallbackMethod_SetTracing : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_ReleaseControl() {
-      ::grpc::Service::MarkMethodRawCallback(5,
+    WithRawCallbackMethod_SetTracing() {
+      ::grpc::Service::MarkMethodRawCallback(18,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ReleaseControl(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetTracing(context, request, response); }));
     }
-    ~WithRawCallbackMethod_ReleaseControl() override {
+    ~WithRawCallbackMethod_SetTracing() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status ReleaseControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ReleaseControlRequest* /*request*/, ::mavsdk::rpc::gimbal::ReleaseControlResponse* /*response*/) override {
+    ::grpc::Status SetTracing(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTracingRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTracingResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerUnaryReactor* ReleaseControl(
+    virtual ::grpc::ServerUnaryReactor* SetTracing(
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class WithRawCallbackMethod_SubscribeControl : public BaseClass {
+  class WithRawCallbackMethod_GetTrace : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawCallbackMethod_SubscribeControl() {
-      ::grpc::Service::MarkMethodRawCallback(6,
-          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithRawCallbackMethod_GetTrace() {
+      ::grpc::Service::MarkMethodRawCallback(19,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->SubscribeControl(context, request); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetTrace(context, request, response); }));
     }
-    ~WithRawCallbackMethod_SubscribeControl() override {
+    ~WithRawCallbackMethod_GetTrace() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SubscribeControl(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeControlRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::ControlResponse>* /*writer*/) override {
+    ::grpc::Status GetTrace(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetTraceRequest* /*request*/, ::mavsdk::rpc::gimbal::GetTraceResponse* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* SubscribeControl(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+    virtual ::grpc::ServerUnaryReactor* GetTrace(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
   class WithStreamedUnaryMethod_SetPitchAndYaw : public BaseClass {
@@ -1290,7 +3327,250 @@ class GimbalService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedReleaseControl(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavsdk::rpc::gimbal::ReleaseControlRequest,::mavsdk::rpc::gimbal::ReleaseControlResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_SetPitchAndYaw<WithStreamedUnaryMethod_SetPitchRateAndYawRate<WithStreamedUnaryMethod_SetMode<WithStreamedUnaryMethod_SetRoiLocation<WithStreamedUnaryMethod_TakeControl<WithStreamedUnaryMethod_ReleaseControl<Service > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetMetrics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetMetrics() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavsdk::rpc::gimbal::GetMetricsRequest, ::mavsdk::rpc::gimbal::GetMetricsResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavsdk::rpc::gimbal::GetMetricsRequest, ::mavsdk::rpc::gimbal::GetMetricsResponse>* streamer) {
+                       return this->StreamedGetMetrics(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetMetrics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetMetrics(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetMetricsRequest* /*request*/, ::mavsdk::rpc::gimbal::GetMetricsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetMetrics(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavsdk::rpc::gimbal::GetMetricsRequest,::mavsdk::rpc::gimbal::GetMetricsResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SetTelemetryRates : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SetTelemetryRates() {
+      ::grpc::Service::MarkMethodStreamed(8,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>* streamer) {
+                       return this->StreamedSetTelemetryRates(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SetTelemetryRates() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SetTelemetryRates(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSetTelemetryRates(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest,::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SyncClock : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SyncClock() {
+      ::grpc::Service::MarkMethodStreamed(12,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavsdk::rpc::gimbal::SyncClockRequest, ::mavsdk::rpc::gimbal::SyncClockResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavsdk::rpc::gimbal::SyncClockRequest, ::mavsdk::rpc::gimbal::SyncClockResponse>* streamer) {
+                       return this->StreamedSyncClock(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SyncClock() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SyncClock(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SyncClockRequest* /*request*/, ::mavsdk::rpc::gimbal::SyncClockResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSyncClock(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavsdk::rpc::gimbal::SyncClockRequest,::mavsdk::rpc::gimbal::SyncClockResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_PredictAttitude : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_PredictAttitude() {
+      ::grpc::Service::MarkMethodStreamed(13,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavsdk::rpc::gimbal::PredictAttitudeRequest, ::mavsdk::rpc::gimbal::PredictAttitudeResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavsdk::rpc::gimbal::PredictAttitudeRequest, ::mavsdk::rpc::gimbal::PredictAttitudeResponse>* streamer) {
+                       return this->StreamedPredictAttitude(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_PredictAttitude() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status PredictAttitude(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest* /*request*/, ::mavsdk::rpc::gimbal::PredictAttitudeResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedPredictAttitude(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavsdk::rpc::gimbal::PredictAttitudeRequest,::mavsdk::rpc::gimbal::PredictAttitudeResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetAttitudeAt : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetAttitudeAt() {
+      ::grpc::Service::MarkMethodStreamed(14,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavsdk::rpc::gimbal::GetAttitudeAtRequest, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavsdk::rpc::gimbal::GetAttitudeAtRequest, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse>* streamer) {
+                       return this->StreamedGetAttitudeAt(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetAttitudeAt() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetAttitudeAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetAttitudeAt(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavsdk::rpc::gimbal::GetAttitudeAtRequest,::mavsdk::rpc::gimbal::GetAttitudeAtResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetAttitudesAt : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetAttitudesAt() {
+      ::grpc::Service::MarkMethodStreamed(15,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavsdk::rpc::gimbal::GetAttitudesAtRequest, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavsdk::rpc::gimbal::GetAttitudesAtRequest, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse>* streamer) {
+                       return this->StreamedGetAttitudesAt(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetAttitudesAt() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetAttitudesAt(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* /*request*/, ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetAttitudesAt(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavsdk::rpc::gimbal::GetAttitudesAtRequest,::mavsdk::rpc::gimbal::GetAttitudesAtResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ApplyGimbalState : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ApplyGimbalState() {
+      ::grpc::Service::MarkMethodStreamed(17,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>* streamer) {
+                       return this->StreamedApplyGimbalState(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ApplyGimbalState() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ApplyGimbalState(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* /*request*/, ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedApplyGimbalState(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest,::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SetTracing : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SetTracing() {
+      ::grpc::Service::MarkMethodStreamed(18,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavsdk::rpc::gimbal::SetTracingRequest, ::mavsdk::rpc::gimbal::SetTracingResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavsdk::rpc::gimbal::SetTracingRequest, ::mavsdk::rpc::gimbal::SetTracingResponse>* streamer) {
+                       return this->StreamedSetTracing(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SetTracing() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SetTracing(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SetTracingRequest* /*request*/, ::mavsdk::rpc::gimbal::SetTracingResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSetTracing(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavsdk::rpc::gimbal::SetTracingRequest,::mavsdk::rpc::gimbal::SetTracingResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetTrace : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetTrace() {
+      ::grpc::Service::MarkMethodStreamed(19,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::mavsdk::rpc::gimbal::GetTraceRequest, ::mavsdk::rpc::gimbal::GetTraceResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::mavsdk::rpc::gimbal::GetTraceRequest, ::mavsdk::rpc::gimbal::GetTraceResponse>* streamer) {
+                       return this->StreamedGetTrace(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetTrace() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetTrace(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::GetTraceRequest* /*request*/, ::mavsdk::rpc::gimbal::GetTraceResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetTrace(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavsdk::rpc::gimbal::GetTraceRequest,::mavsdk::rpc::gimbal::GetTraceResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_SetPitchAndYaw<WithStreamedUnaryMethod_SetPitchRateAndYawRate<WithStreamedUnaryMethod_SetMode<WithStreamedUnaryMethod_SetRoiLocation<WithStreamedUnaryMethod_TakeControl<WithStreamedUnaryMethod_ReleaseControl<WithStreamedUnaryMethod_GetMetrics<WithStreamedUnaryMethod_SetTelemetryRates<WithStreamedUnaryMethod_SyncClock<WithStreamedUnaryMethod_PredictAttitude<WithStreamedUnaryMethod_GetAttitudeAt<WithStreamedUnaryMethod_GetAttitudesAt<WithStreamedUnaryMethod_ApplyGimbalState<WithStreamedUnaryMethod_SetTracing<WithStreamedUnaryMethod_GetTrace<Service > > > > > > > > > > > > > > > StreamedUnaryService;
   template <class BaseClass>
   class WithSplitStreamingMethod_SubscribeControl : public BaseClass {
    private:
@@ -1318,8 +3598,35 @@ class GimbalService final {
     // replace default version of method with split streamed
     virtual ::grpc::Status StreamedSubscribeControl(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::mavsdk::rpc::gimbal::SubscribeControlRequest,::mavsdk::rpc::gimbal::ControlResponse>* server_split_streamer) = 0;
   };
-  typedef WithSplitStreamingMethod_SubscribeControl<Service > SplitStreamedService;
-  typedef WithStreamedUnaryMethod_SetPitchAndYaw<WithStreamedUnaryMethod_SetPitchRateAndYawRate<WithStreamedUnaryMethod_SetMode<WithStreamedUnaryMethod_SetRoiLocation<WithStreamedUnaryMethod_TakeControl<WithStreamedUnaryMethod_ReleaseControl<WithSplitStreamingMethod_SubscribeControl<Service > > > > > > > StreamedService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_SubscribeAttitudeBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_SubscribeAttitudeBatch() {
+      ::grpc::Service::MarkMethodStreamed(10,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest, ::mavsdk::rpc::gimbal::AttitudeBatch>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest, ::mavsdk::rpc::gimbal::AttitudeBatch>* streamer) {
+                       return this->StreamedSubscribeAttitudeBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_SubscribeAttitudeBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SubscribeAttitudeBatch(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::gimbal::AttitudeBatch>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedSubscribeAttitudeBatch(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest,::mavsdk::rpc::gimbal::AttitudeBatch>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_SubscribeControl<WithSplitStreamingMethod_SubscribeAttitudeBatch<Service > > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_SetPitchAndYaw<WithStreamedUnaryMethod_SetPitchRateAndYawRate<WithStreamedUnaryMethod_SetMode<WithStreamedUnaryMethod_SetRoiLocation<WithStreamedUnaryMethod_TakeControl<WithStreamedUnaryMethod_ReleaseControl<WithSplitStreamingMethod_SubscribeControl<WithStreamedUnaryMethod_GetMetrics<WithStreamedUnaryMethod_SetTelemetryRates<WithSplitStreamingMethod_SubscribeAttitudeBatch<WithStreamedUnaryMethod_SyncClock<WithStreamedUnaryMethod_PredictAttitude<WithStreamedUnaryMethod_GetAttitudeAt<WithStreamedUnaryMethod_GetAttitudesAt<WithStreamedUnaryMethod_ApplyGimbalState<WithStreamedUnaryMethod_SetTracing<WithStreamedUnaryMethod_GetTrace<Service > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace gimbal
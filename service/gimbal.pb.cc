@@ -25,7 +25,8 @@ namespace rpc {
 namespace gimbal {
 PROTOBUF_CONSTEXPR SetPitchAndYawRequest::SetPitchAndYawRequest(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.pitch_deg_)*/0
+    /*decltype(_impl_.profile_)*/nullptr
+  , /*decltype(_impl_.pitch_deg_)*/0
   , /*decltype(_impl_.yaw_deg_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct SetPitchAndYawRequestDefaultTypeInternal {
@@ -134,6 +135,7 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR TakeControlRequest::TakeControlRequest(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.control_mode_)*/0
+  , /*decltype(_impl_.force_)*/false
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct TakeControlRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR TakeControlRequestDefaultTypeInternal()
@@ -158,7 +160,9 @@ struct TakeControlResponseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TakeControlResponseDefaultTypeInternal _TakeControlResponse_default_instance_;
 PROTOBUF_CONSTEXPR ReleaseControlRequest::ReleaseControlRequest(
-    ::_pbi::ConstantInitialized) {}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.force_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct ReleaseControlRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR ReleaseControlRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -205,6 +209,349 @@ struct ControlResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControlResponseDefaultTypeInternal _ControlResponse_default_instance_;
+PROTOBUF_CONSTEXPR GetMetricsRequest::GetMetricsRequest(
+    ::_pbi::ConstantInitialized) {}
+struct GetMetricsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetMetricsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetMetricsRequestDefaultTypeInternal() {}
+  union {
+    GetMetricsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetMetricsRequestDefaultTypeInternal _GetMetricsRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetMetricsResponse::GetMetricsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.metrics_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetMetricsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetMetricsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetMetricsResponseDefaultTypeInternal() {}
+  union {
+    GetMetricsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetMetricsResponseDefaultTypeInternal _GetMetricsResponse_default_instance_;
+PROTOBUF_CONSTEXPR SetTelemetryRatesRequest::SetTelemetryRatesRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rates_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SetTelemetryRatesRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetTelemetryRatesRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetTelemetryRatesRequestDefaultTypeInternal() {}
+  union {
+    SetTelemetryRatesRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetTelemetryRatesRequestDefaultTypeInternal _SetTelemetryRatesRequest_default_instance_;
+PROTOBUF_CONSTEXPR SetTelemetryRatesResponse::SetTelemetryRatesResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.gimbal_result_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SetTelemetryRatesResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetTelemetryRatesResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetTelemetryRatesResponseDefaultTypeInternal() {}
+  union {
+    SetTelemetryRatesResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetTelemetryRatesResponseDefaultTypeInternal _SetTelemetryRatesResponse_default_instance_;
+PROTOBUF_CONSTEXPR MavlinkTunnelRequest::MavlinkTunnelRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frames_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.filter_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MavlinkTunnelRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MavlinkTunnelRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MavlinkTunnelRequestDefaultTypeInternal() {}
+  union {
+    MavlinkTunnelRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MavlinkTunnelRequestDefaultTypeInternal _MavlinkTunnelRequest_default_instance_;
+PROTOBUF_CONSTEXPR MavlinkTunnelResponse::MavlinkTunnelResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frames_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.dropped_frames_)*/0u
+  , /*decltype(_impl_.rejected_frames_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MavlinkTunnelResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MavlinkTunnelResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MavlinkTunnelResponseDefaultTypeInternal() {}
+  union {
+    MavlinkTunnelResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MavlinkTunnelResponseDefaultTypeInternal _MavlinkTunnelResponse_default_instance_;
+PROTOBUF_CONSTEXPR SubscribeAttitudeBatchRequest::SubscribeAttitudeBatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.batch_window_ms_)*/0u
+  , /*decltype(_impl_.prediction_rate_hz_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SubscribeAttitudeBatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubscribeAttitudeBatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubscribeAttitudeBatchRequestDefaultTypeInternal() {}
+  union {
+    SubscribeAttitudeBatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscribeAttitudeBatchRequestDefaultTypeInternal _SubscribeAttitudeBatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR SyncClockRequest::SyncClockRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.client_send_time_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncClockRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncClockRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncClockRequestDefaultTypeInternal() {}
+  union {
+    SyncClockRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncClockRequestDefaultTypeInternal _SyncClockRequest_default_instance_;
+PROTOBUF_CONSTEXPR SyncClockResponse::SyncClockResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.client_send_time_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.server_receive_time_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.server_send_time_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncClockResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncClockResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncClockResponseDefaultTypeInternal() {}
+  union {
+    SyncClockResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncClockResponseDefaultTypeInternal _SyncClockResponse_default_instance_;
+PROTOBUF_CONSTEXPR PredictAttitudeRequest::PredictAttitudeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.time_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PredictAttitudeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PredictAttitudeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PredictAttitudeRequestDefaultTypeInternal() {}
+  union {
+    PredictAttitudeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PredictAttitudeRequestDefaultTypeInternal _PredictAttitudeRequest_default_instance_;
+PROTOBUF_CONSTEXPR PredictAttitudeResponse::PredictAttitudeResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.roll_deg_)*/0
+  , /*decltype(_impl_.pitch_deg_)*/0
+  , /*decltype(_impl_.timestamp_us_)*/uint64_t{0u}
+  , /*decltype(_impl_.yaw_deg_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PredictAttitudeResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PredictAttitudeResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PredictAttitudeResponseDefaultTypeInternal() {}
+  union {
+    PredictAttitudeResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PredictAttitudeResponseDefaultTypeInternal _PredictAttitudeResponse_default_instance_;
+PROTOBUF_CONSTEXPR GetAttitudeAtRequest::GetAttitudeAtRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.time_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetAttitudeAtRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetAttitudeAtRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetAttitudeAtRequestDefaultTypeInternal() {}
+  union {
+    GetAttitudeAtRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetAttitudeAtRequestDefaultTypeInternal _GetAttitudeAtRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetAttitudeAtResponse::GetAttitudeAtResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.roll_deg_)*/0
+  , /*decltype(_impl_.pitch_deg_)*/0
+  , /*decltype(_impl_.yaw_deg_)*/0
+  , /*decltype(_impl_.q_w_)*/0
+  , /*decltype(_impl_.q_x_)*/0
+  , /*decltype(_impl_.q_y_)*/0
+  , /*decltype(_impl_.q_z_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetAttitudeAtResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetAttitudeAtResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetAttitudeAtResponseDefaultTypeInternal() {}
+  union {
+    GetAttitudeAtResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetAttitudeAtResponseDefaultTypeInternal _GetAttitudeAtResponse_default_instance_;
+PROTOBUF_CONSTEXPR GetAttitudesAtRequest::GetAttitudesAtRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.time_ns_)*/{}
+  , /*decltype(_impl_._time_ns_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetAttitudesAtRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetAttitudesAtRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetAttitudesAtRequestDefaultTypeInternal() {}
+  union {
+    GetAttitudesAtRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetAttitudesAtRequestDefaultTypeInternal _GetAttitudesAtRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetAttitudesAtResponse::GetAttitudesAtResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.found_)*/{}
+  , /*decltype(_impl_.roll_deg_)*/{}
+  , /*decltype(_impl_.pitch_deg_)*/{}
+  , /*decltype(_impl_.yaw_deg_)*/{}
+  , /*decltype(_impl_.q_w_)*/{}
+  , /*decltype(_impl_.q_x_)*/{}
+  , /*decltype(_impl_.q_y_)*/{}
+  , /*decltype(_impl_.q_z_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetAttitudesAtResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetAttitudesAtResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetAttitudesAtResponseDefaultTypeInternal() {}
+  union {
+    GetAttitudesAtResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetAttitudesAtResponseDefaultTypeInternal _GetAttitudesAtResponse_default_instance_;
+PROTOBUF_CONSTEXPR VisualServoRequest::VisualServoRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.gains_)*/nullptr
+  , /*decltype(_impl_.error_x_)*/0
+  , /*decltype(_impl_.error_y_)*/0
+  , /*decltype(_impl_.horizontal_fov_deg_)*/0
+  , /*decltype(_impl_.vertical_fov_deg_)*/0
+  , /*decltype(_impl_.capture_time_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.target_lost_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VisualServoRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VisualServoRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VisualServoRequestDefaultTypeInternal() {}
+  union {
+    VisualServoRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VisualServoRequestDefaultTypeInternal _VisualServoRequest_default_instance_;
+PROTOBUF_CONSTEXPR VisualServoStatus::VisualServoStatus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.gains_)*/nullptr
+  , /*decltype(_impl_.pitch_rate_deg_s_)*/0
+  , /*decltype(_impl_.yaw_rate_deg_s_)*/0
+  , /*decltype(_impl_.pitch_error_deg_)*/0
+  , /*decltype(_impl_.yaw_error_deg_)*/0
+  , /*decltype(_impl_.ticks_)*/uint64_t{0u}
+  , /*decltype(_impl_.overruns_)*/uint64_t{0u}
+  , /*decltype(_impl_.lateness_avg_us_)*/0
+  , /*decltype(_impl_.lateness_max_us_)*/0
+  , /*decltype(_impl_.tracking_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VisualServoStatusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VisualServoStatusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VisualServoStatusDefaultTypeInternal() {}
+  union {
+    VisualServoStatus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VisualServoStatusDefaultTypeInternal _VisualServoStatus_default_instance_;
+PROTOBUF_CONSTEXPR ApplyGimbalStateRequest::ApplyGimbalStateRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.take_control_)*/nullptr
+  , /*decltype(_impl_.set_mode_)*/nullptr
+  , /*decltype(_impl_.target_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ApplyGimbalStateRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ApplyGimbalStateRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ApplyGimbalStateRequestDefaultTypeInternal() {}
+  union {
+    ApplyGimbalStateRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ApplyGimbalStateRequestDefaultTypeInternal _ApplyGimbalStateRequest_default_instance_;
+PROTOBUF_CONSTEXPR ApplyGimbalStateResponse::ApplyGimbalStateResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.gimbal_result_)*/nullptr
+  , /*decltype(_impl_.control_result_)*/nullptr
+  , /*decltype(_impl_.mode_result_)*/nullptr
+  , /*decltype(_impl_.target_result_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ApplyGimbalStateResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ApplyGimbalStateResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ApplyGimbalStateResponseDefaultTypeInternal() {}
+  union {
+    ApplyGimbalStateResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ApplyGimbalStateResponseDefaultTypeInternal _ApplyGimbalStateResponse_default_instance_;
+PROTOBUF_CONSTEXPR SetTracingRequest::SetTracingRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.enabled_)*/false
+  , /*decltype(_impl_.clear_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SetTracingRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetTracingRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetTracingRequestDefaultTypeInternal() {}
+  union {
+    SetTracingRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetTracingRequestDefaultTypeInternal _SetTracingRequest_default_instance_;
+PROTOBUF_CONSTEXPR SetTracingResponse::SetTracingResponse(
+    ::_pbi::ConstantInitialized) {}
+struct SetTracingResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetTracingResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetTracingResponseDefaultTypeInternal() {}
+  union {
+    SetTracingResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetTracingResponseDefaultTypeInternal _SetTracingResponse_default_instance_;
+PROTOBUF_CONSTEXPR GetTraceRequest::GetTraceRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.format_)*/0
+  , /*decltype(_impl_.clear_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetTraceRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetTraceRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetTraceRequestDefaultTypeInternal() {}
+  union {
+    GetTraceRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetTraceRequestDefaultTypeInternal _GetTraceRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetTraceResponse::GetTraceResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.trace_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.spans_)*/uint64_t{0u}
+  , /*decltype(_impl_.overwritten_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetTraceResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetTraceResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetTraceResponseDefaultTypeInternal() {}
+  union {
+    GetTraceResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetTraceResponseDefaultTypeInternal _GetTraceResponse_default_instance_;
 PROTOBUF_CONSTEXPR ControlStatus::ControlStatus(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.control_mode_)*/0
@@ -222,6 +569,139 @@ struct ControlStatusDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ControlStatusDefaultTypeInternal _ControlStatus_default_instance_;
+PROTOBUF_CONSTEXPR TelemetryRate::TelemetryRate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rate_hz_)*/0
+  , /*decltype(_impl_.stream_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TelemetryRateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TelemetryRateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TelemetryRateDefaultTypeInternal() {}
+  union {
+    TelemetryRate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TelemetryRateDefaultTypeInternal _TelemetryRate_default_instance_;
+PROTOBUF_CONSTEXPR MavlinkFilter::MavlinkFilter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_ids_)*/{}
+  , /*decltype(_impl_._message_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MavlinkFilterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MavlinkFilterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MavlinkFilterDefaultTypeInternal() {}
+  union {
+    MavlinkFilter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MavlinkFilterDefaultTypeInternal _MavlinkFilter_default_instance_;
+PROTOBUF_CONSTEXPR AttitudeBatch::AttitudeBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.time_delta_ms_)*/{}
+  , /*decltype(_impl_._time_delta_ms_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.roll_cdeg_)*/{}
+  , /*decltype(_impl_._roll_cdeg_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.pitch_cdeg_)*/{}
+  , /*decltype(_impl_._pitch_cdeg_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.yaw_cdeg_)*/{}
+  , /*decltype(_impl_._yaw_cdeg_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.base_timestamp_ms_)*/uint64_t{0u}
+  , /*decltype(_impl_.base_wall_time_ms_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AttitudeBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AttitudeBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AttitudeBatchDefaultTypeInternal() {}
+  union {
+    AttitudeBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AttitudeBatchDefaultTypeInternal _AttitudeBatch_default_instance_;
+PROTOBUF_CONSTEXPR Setpoint::Setpoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_.mode_)*/0
+  , /*decltype(_impl_.pitch_deg_)*/0
+  , /*decltype(_impl_.yaw_deg_)*/0
+  , /*decltype(_impl_.pitch_rate_deg_s_)*/0
+  , /*decltype(_impl_.apply_time_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.yaw_rate_deg_s_)*/0
+  , /*decltype(_impl_.jitter_buffered_)*/false
+  , /*decltype(_impl_.sample_time_us_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SetpointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetpointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetpointDefaultTypeInternal() {}
+  union {
+    Setpoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetpointDefaultTypeInternal _Setpoint_default_instance_;
+PROTOBUF_CONSTEXPR SetpointAck::SetpointAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.gimbal_result_)*/nullptr
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SetpointAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetpointAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetpointAckDefaultTypeInternal() {}
+  union {
+    SetpointAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetpointAckDefaultTypeInternal _SetpointAck_default_instance_;
+PROTOBUF_CONSTEXPR ServoGains::ServoGains(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.kp_)*/0
+  , /*decltype(_impl_.ki_)*/0
+  , /*decltype(_impl_.kd_)*/0
+  , /*decltype(_impl_.kff_)*/0
+  , /*decltype(_impl_.max_rate_deg_s_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServoGainsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServoGainsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServoGainsDefaultTypeInternal() {}
+  union {
+    ServoGains _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServoGainsDefaultTypeInternal _ServoGains_default_instance_;
+PROTOBUF_CONSTEXPR MotionProfile::MotionProfile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.shape_)*/0
+  , /*decltype(_impl_.max_velocity_deg_s_)*/0
+  , /*decltype(_impl_.max_acceleration_deg_s2_)*/0
+  , /*decltype(_impl_.max_jerk_deg_s3_)*/0
+  , /*decltype(_impl_.rate_hz_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MotionProfileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MotionProfileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MotionProfileDefaultTypeInternal() {}
+  union {
+    MotionProfile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MotionProfileDefaultTypeInternal _MotionProfile_default_instance_;
+PROTOBUF_CONSTEXPR Metric::Metric(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MetricDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MetricDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MetricDefaultTypeInternal() {}
+  union {
+    Metric _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MetricDefaultTypeInternal _Metric_default_instance_;
 PROTOBUF_CONSTEXPR GimbalResult::GimbalResult(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.result_str_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
@@ -239,8 +719,8 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 }  // namespace gimbal
 }  // namespace rpc
 }  // namespace mavsdk
-static ::_pb::Metadata file_level_metadata_gimbal_2eproto[16];
-static const ::_pb::EnumDescriptor* file_level_enum_descriptors_gimbal_2eproto[3];
+static ::_pb::Metadata file_level_metadata_gimbal_2eproto[47];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_gimbal_2eproto[7];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_gimbal_2eproto = nullptr;
 
 const uint32_t TableStruct_gimbal_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -252,6 +732,7 @@ const uint32_t TableStruct_gimbal_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetPitchAndYawRequest, _impl_.pitch_deg_),
   PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetPitchAndYawRequest, _impl_.yaw_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetPitchAndYawRequest, _impl_.profile_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetPitchAndYawResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -311,6 +792,7 @@ const uint32_t TableStruct_gimbal_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::TakeControlRequest, _impl_.control_mode_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::TakeControlRequest, _impl_.force_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::TakeControlResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -324,6 +806,7 @@ const uint32_t TableStruct_gimbal_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ReleaseControlRequest, _impl_.force_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ReleaseControlResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -345,154 +828,632 @@ const uint32_t TableStruct_gimbal_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlResponse, _impl_.control_status_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetMetricsRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _impl_.control_mode_),
-  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _impl_.sysid_primary_control_),
-  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _impl_.compid_primary_control_),
-  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _impl_.sysid_secondary_control_),
-  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _impl_.compid_secondary_control_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GimbalResult, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetMetricsResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GimbalResult, _impl_.result_),
-  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GimbalResult, _impl_.result_str_),
-};
-static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetPitchAndYawRequest)},
-  { 8, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetPitchAndYawResponse)},
-  { 15, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest)},
-  { 23, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse)},
-  { 30, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetModeRequest)},
-  { 37, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetModeResponse)},
-  { 44, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetRoiLocationRequest)},
-  { 53, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetRoiLocationResponse)},
-  { 60, -1, -1, sizeof(::mavsdk::rpc::gimbal::TakeControlRequest)},
-  { 67, -1, -1, sizeof(::mavsdk::rpc::gimbal::TakeControlResponse)},
-  { 74, -1, -1, sizeof(::mavsdk::rpc::gimbal::ReleaseControlRequest)},
-  { 80, -1, -1, sizeof(::mavsdk::rpc::gimbal::ReleaseControlResponse)},
-  { 87, -1, -1, sizeof(::mavsdk::rpc::gimbal::SubscribeControlRequest)},
-  { 93, -1, -1, sizeof(::mavsdk::rpc::gimbal::ControlResponse)},
-  { 100, -1, -1, sizeof(::mavsdk::rpc::gimbal::ControlStatus)},
-  { 111, -1, -1, sizeof(::mavsdk::rpc::gimbal::GimbalResult)},
-};
-
-static const ::_pb::Message* const file_default_instances[] = {
-  &::mavsdk::rpc::gimbal::_SetPitchAndYawRequest_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_SetPitchAndYawResponse_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_SetPitchRateAndYawRateRequest_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_SetPitchRateAndYawRateResponse_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_SetModeRequest_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_SetModeResponse_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_SetRoiLocationRequest_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_SetRoiLocationResponse_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_TakeControlRequest_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_TakeControlResponse_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_ReleaseControlRequest_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_ReleaseControlResponse_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_SubscribeControlRequest_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_ControlResponse_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_ControlStatus_default_instance_._instance,
-  &::mavsdk::rpc::gimbal::_GimbalResult_default_instance_._instance,
-};
-
-const char descriptor_table_protodef_gimbal_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\014gimbal.proto\022\021mavsdk.rpc.gimbal\";\n\025Set"
-  "PitchAndYawRequest\022\021\n\tpitch_deg\030\001 \001(\002\022\017\n"
-  "\007yaw_deg\030\002 \001(\002\"P\n\026SetPitchAndYawResponse"
-  "\0226\n\rgimbal_result\030\001 \001(\0132\037.mavsdk.rpc.gim"
-  "bal.GimbalResult\"Q\n\035SetPitchRateAndYawRa"
-  "teRequest\022\030\n\020pitch_rate_deg_s\030\001 \001(\002\022\026\n\016y"
-  "aw_rate_deg_s\030\002 \001(\002\"X\n\036SetPitchRateAndYa"
-  "wRateResponse\0226\n\rgimbal_result\030\001 \001(\0132\037.m"
-  "avsdk.rpc.gimbal.GimbalResult\"D\n\016SetMode"
-  "Request\0222\n\013gimbal_mode\030\001 \001(\0162\035.mavsdk.rp"
-  "c.gimbal.GimbalMode\"I\n\017SetModeResponse\0226"
-  "\n\rgimbal_result\030\001 \001(\0132\037.mavsdk.rpc.gimba"
-  "l.GimbalResult\"X\n\025SetRoiLocationRequest\022"
-  "\024\n\014latitude_deg\030\001 \001(\001\022\025\n\rlongitude_deg\030\002"
-  " \001(\001\022\022\n\naltitude_m\030\003 \001(\002\"P\n\026SetRoiLocati"
-  "onResponse\0226\n\rgimbal_result\030\001 \001(\0132\037.mavs"
-  "dk.rpc.gimbal.GimbalResult\"J\n\022TakeContro"
-  "lRequest\0224\n\014control_mode\030\001 \001(\0162\036.mavsdk."
-  "rpc.gimbal.ControlMode\"M\n\023TakeControlRes"
-  "ponse\0226\n\rgimbal_result\030\001 \001(\0132\037.mavsdk.rp"
-  "c.gimbal.GimbalResult\"\027\n\025ReleaseControlR"
-  "equest\"P\n\026ReleaseControlResponse\0226\n\rgimb"
-  "al_result\030\001 \001(\0132\037.mavsdk.rpc.gimbal.Gimb"
-  "alResult\"\031\n\027SubscribeControlRequest\"K\n\017C"
-  "ontrolResponse\0228\n\016control_status\030\001 \001(\0132 "
-  ".mavsdk.rpc.gimbal.ControlStatus\"\307\001\n\rCon"
-  "trolStatus\0224\n\014control_mode\030\001 \001(\0162\036.mavsd"
-  "k.rpc.gimbal.ControlMode\022\035\n\025sysid_primar"
-  "y_control\030\002 \001(\005\022\036\n\026compid_primary_contro"
-  "l\030\003 \001(\005\022\037\n\027sysid_secondary_control\030\004 \001(\005"
-  "\022 \n\030compid_secondary_control\030\005 \001(\005\"\341\001\n\014G"
-  "imbalResult\0226\n\006result\030\001 \001(\0162&.mavsdk.rpc"
-  ".gimbal.GimbalResult.Result\022\022\n\nresult_st"
-  "r\030\002 \001(\t\"\204\001\n\006Result\022\022\n\016RESULT_UNKNOWN\020\000\022\022"
-  "\n\016RESULT_SUCCESS\020\001\022\020\n\014RESULT_ERROR\020\002\022\022\n\016"
-  "RESULT_TIMEOUT\020\003\022\026\n\022RESULT_UNSUPPORTED\020\004"
-  "\022\024\n\020RESULT_NO_SYSTEM\020\005*B\n\nGimbalMode\022\032\n\026"
-  "GIMBAL_MODE_YAW_FOLLOW\020\000\022\030\n\024GIMBAL_MODE_"
-  "YAW_LOCK\020\001*Z\n\013ControlMode\022\025\n\021CONTROL_MOD"
-  "E_NONE\020\000\022\030\n\024CONTROL_MODE_PRIMARY\020\001\022\032\n\026CO"
-  "NTROL_MODE_SECONDARY\020\0022\347\005\n\rGimbalService"
-  "\022g\n\016SetPitchAndYaw\022(.mavsdk.rpc.gimbal.S"
-  "etPitchAndYawRequest\032).mavsdk.rpc.gimbal"
-  ".SetPitchAndYawResponse\"\000\022\177\n\026SetPitchRat"
-  "eAndYawRate\0220.mavsdk.rpc.gimbal.SetPitch"
-  "RateAndYawRateRequest\0321.mavsdk.rpc.gimba"
-  "l.SetPitchRateAndYawRateResponse\"\000\022R\n\007Se"
-  "tMode\022!.mavsdk.rpc.gimbal.SetModeRequest"
-  "\032\".mavsdk.rpc.gimbal.SetModeResponse\"\000\022g"
-  "\n\016SetRoiLocation\022(.mavsdk.rpc.gimbal.Set"
-  "RoiLocationRequest\032).mavsdk.rpc.gimbal.S"
-  "etRoiLocationResponse\"\000\022^\n\013TakeControl\022%"
-  ".mavsdk.rpc.gimbal.TakeControlRequest\032&."
-  "mavsdk.rpc.gimbal.TakeControlResponse\"\000\022"
-  "g\n\016ReleaseControl\022(.mavsdk.rpc.gimbal.Re"
-  "leaseControlRequest\032).mavsdk.rpc.gimbal."
-  "ReleaseControlResponse\"\000\022f\n\020SubscribeCon"
-  "trol\022*.mavsdk.rpc.gimbal.SubscribeContro"
-  "lRequest\032\".mavsdk.rpc.gimbal.ControlResp"
-  "onse\"\0000\001B\037\n\020io.mavsdk.gimbalB\013GimbalProt"
-  "ob\006proto3"
-  ;
-static ::_pbi::once_flag descriptor_table_gimbal_2eproto_once;
-const ::_pbi::DescriptorTable descriptor_table_gimbal_2eproto = {
-    false, false, 2409, descriptor_table_protodef_gimbal_2eproto,
-    "gimbal.proto",
-    &descriptor_table_gimbal_2eproto_once, nullptr, 0, 16,
-    schemas, file_default_instances, TableStruct_gimbal_2eproto::offsets,
-    file_level_metadata_gimbal_2eproto, file_level_enum_descriptors_gimbal_2eproto,
-    file_level_service_descriptors_gimbal_2eproto,
-};
-PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_gimbal_2eproto_getter() {
-  return &descriptor_table_gimbal_2eproto;
-}
-
-// Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_gimbal_2eproto(&descriptor_table_gimbal_2eproto);
-namespace mavsdk {
-namespace rpc {
-namespace gimbal {
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GimbalResult_Result_descriptor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gimbal_2eproto);
-  return file_level_enum_descriptors_gimbal_2eproto[0];
-}
-bool GimbalResult_Result_IsValid(int value) {
-  switch (value) {
-    case 0:
-    case 1:
-    case 2:
-    case 3:
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetMetricsResponse, _impl_.metrics_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetTelemetryRatesRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetTelemetryRatesRequest, _impl_.rates_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetTelemetryRatesResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetTelemetryRatesResponse, _impl_.gimbal_result_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MavlinkTunnelRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MavlinkTunnelRequest, _impl_.frames_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MavlinkTunnelRequest, _impl_.filter_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MavlinkTunnelResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MavlinkTunnelResponse, _impl_.frames_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MavlinkTunnelResponse, _impl_.dropped_frames_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MavlinkTunnelResponse, _impl_.rejected_frames_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest, _impl_.batch_window_ms_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest, _impl_.prediction_rate_hz_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SyncClockRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SyncClockRequest, _impl_.client_send_time_ns_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SyncClockResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SyncClockResponse, _impl_.client_send_time_ns_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SyncClockResponse, _impl_.server_receive_time_ns_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SyncClockResponse, _impl_.server_send_time_ns_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::PredictAttitudeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::PredictAttitudeRequest, _impl_.time_ns_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::PredictAttitudeResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::PredictAttitudeResponse, _impl_.roll_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::PredictAttitudeResponse, _impl_.pitch_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::PredictAttitudeResponse, _impl_.yaw_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::PredictAttitudeResponse, _impl_.timestamp_us_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudeAtRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudeAtRequest, _impl_.time_ns_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudeAtResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudeAtResponse, _impl_.roll_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudeAtResponse, _impl_.pitch_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudeAtResponse, _impl_.yaw_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudeAtResponse, _impl_.q_w_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudeAtResponse, _impl_.q_x_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudeAtResponse, _impl_.q_y_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudeAtResponse, _impl_.q_z_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudesAtRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudesAtRequest, _impl_.time_ns_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudesAtResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudesAtResponse, _impl_.found_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudesAtResponse, _impl_.roll_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudesAtResponse, _impl_.pitch_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudesAtResponse, _impl_.yaw_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudesAtResponse, _impl_.q_w_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudesAtResponse, _impl_.q_x_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudesAtResponse, _impl_.q_y_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetAttitudesAtResponse, _impl_.q_z_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoRequest, _impl_.error_x_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoRequest, _impl_.error_y_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoRequest, _impl_.horizontal_fov_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoRequest, _impl_.vertical_fov_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoRequest, _impl_.target_lost_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoRequest, _impl_.capture_time_ns_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoRequest, _impl_.gains_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoStatus, _impl_.pitch_rate_deg_s_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoStatus, _impl_.yaw_rate_deg_s_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoStatus, _impl_.pitch_error_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoStatus, _impl_.yaw_error_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoStatus, _impl_.tracking_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoStatus, _impl_.ticks_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoStatus, _impl_.overruns_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoStatus, _impl_.lateness_avg_us_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoStatus, _impl_.lateness_max_us_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::VisualServoStatus, _impl_.gains_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, _impl_.take_control_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, _impl_.set_mode_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ApplyGimbalStateRequest, _impl_.target_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ApplyGimbalStateResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ApplyGimbalStateResponse, _impl_.gimbal_result_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ApplyGimbalStateResponse, _impl_.control_result_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ApplyGimbalStateResponse, _impl_.mode_result_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ApplyGimbalStateResponse, _impl_.target_result_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetTracingRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetTracingRequest, _impl_.enabled_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetTracingRequest, _impl_.clear_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetTracingResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetTraceRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetTraceRequest, _impl_.format_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetTraceRequest, _impl_.clear_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetTraceResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetTraceResponse, _impl_.trace_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetTraceResponse, _impl_.spans_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GetTraceResponse, _impl_.overwritten_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _impl_.control_mode_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _impl_.sysid_primary_control_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _impl_.compid_primary_control_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _impl_.sysid_secondary_control_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ControlStatus, _impl_.compid_secondary_control_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::TelemetryRate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::TelemetryRate, _impl_.stream_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::TelemetryRate, _impl_.rate_hz_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MavlinkFilter, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MavlinkFilter, _impl_.message_ids_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::AttitudeBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::AttitudeBatch, _impl_.base_timestamp_ms_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::AttitudeBatch, _impl_.time_delta_ms_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::AttitudeBatch, _impl_.roll_cdeg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::AttitudeBatch, _impl_.pitch_cdeg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::AttitudeBatch, _impl_.yaw_cdeg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::AttitudeBatch, _impl_.base_wall_time_ms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Setpoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Setpoint, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Setpoint, _impl_.mode_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Setpoint, _impl_.pitch_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Setpoint, _impl_.yaw_deg_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Setpoint, _impl_.pitch_rate_deg_s_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Setpoint, _impl_.yaw_rate_deg_s_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Setpoint, _impl_.apply_time_ns_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Setpoint, _impl_.jitter_buffered_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Setpoint, _impl_.sample_time_us_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetpointAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetpointAck, _impl_.sequence_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::SetpointAck, _impl_.gimbal_result_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ServoGains, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ServoGains, _impl_.kp_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ServoGains, _impl_.ki_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ServoGains, _impl_.kd_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ServoGains, _impl_.kff_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::ServoGains, _impl_.max_rate_deg_s_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MotionProfile, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MotionProfile, _impl_.shape_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MotionProfile, _impl_.max_velocity_deg_s_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MotionProfile, _impl_.max_acceleration_deg_s2_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MotionProfile, _impl_.max_jerk_deg_s3_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::MotionProfile, _impl_.rate_hz_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Metric, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Metric, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::Metric, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GimbalResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GimbalResult, _impl_.result_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::gimbal::GimbalResult, _impl_.result_str_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetPitchAndYawRequest)},
+  { 9, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetPitchAndYawResponse)},
+  { 16, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest)},
+  { 24, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse)},
+  { 31, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetModeRequest)},
+  { 38, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetModeResponse)},
+  { 45, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetRoiLocationRequest)},
+  { 54, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetRoiLocationResponse)},
+  { 61, -1, -1, sizeof(::mavsdk::rpc::gimbal::TakeControlRequest)},
+  { 69, -1, -1, sizeof(::mavsdk::rpc::gimbal::TakeControlResponse)},
+  { 76, -1, -1, sizeof(::mavsdk::rpc::gimbal::ReleaseControlRequest)},
+  { 83, -1, -1, sizeof(::mavsdk::rpc::gimbal::ReleaseControlResponse)},
+  { 90, -1, -1, sizeof(::mavsdk::rpc::gimbal::SubscribeControlRequest)},
+  { 96, -1, -1, sizeof(::mavsdk::rpc::gimbal::ControlResponse)},
+  { 103, -1, -1, sizeof(::mavsdk::rpc::gimbal::GetMetricsRequest)},
+  { 109, -1, -1, sizeof(::mavsdk::rpc::gimbal::GetMetricsResponse)},
+  { 116, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetTelemetryRatesRequest)},
+  { 123, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetTelemetryRatesResponse)},
+  { 130, -1, -1, sizeof(::mavsdk::rpc::gimbal::MavlinkTunnelRequest)},
+  { 138, -1, -1, sizeof(::mavsdk::rpc::gimbal::MavlinkTunnelResponse)},
+  { 147, -1, -1, sizeof(::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest)},
+  { 155, -1, -1, sizeof(::mavsdk::rpc::gimbal::SyncClockRequest)},
+  { 162, -1, -1, sizeof(::mavsdk::rpc::gimbal::SyncClockResponse)},
+  { 171, -1, -1, sizeof(::mavsdk::rpc::gimbal::PredictAttitudeRequest)},
+  { 178, -1, -1, sizeof(::mavsdk::rpc::gimbal::PredictAttitudeResponse)},
+  { 188, -1, -1, sizeof(::mavsdk::rpc::gimbal::GetAttitudeAtRequest)},
+  { 195, -1, -1, sizeof(::mavsdk::rpc::gimbal::GetAttitudeAtResponse)},
+  { 208, -1, -1, sizeof(::mavsdk::rpc::gimbal::GetAttitudesAtRequest)},
+  { 215, -1, -1, sizeof(::mavsdk::rpc::gimbal::GetAttitudesAtResponse)},
+  { 229, -1, -1, sizeof(::mavsdk::rpc::gimbal::VisualServoRequest)},
+  { 242, -1, -1, sizeof(::mavsdk::rpc::gimbal::VisualServoStatus)},
+  { 258, -1, -1, sizeof(::mavsdk::rpc::gimbal::ApplyGimbalStateRequest)},
+  { 269, -1, -1, sizeof(::mavsdk::rpc::gimbal::ApplyGimbalStateResponse)},
+  { 279, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetTracingRequest)},
+  { 287, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetTracingResponse)},
+  { 293, -1, -1, sizeof(::mavsdk::rpc::gimbal::GetTraceRequest)},
+  { 301, -1, -1, sizeof(::mavsdk::rpc::gimbal::GetTraceResponse)},
+  { 310, -1, -1, sizeof(::mavsdk::rpc::gimbal::ControlStatus)},
+  { 321, -1, -1, sizeof(::mavsdk::rpc::gimbal::TelemetryRate)},
+  { 329, -1, -1, sizeof(::mavsdk::rpc::gimbal::MavlinkFilter)},
+  { 336, -1, -1, sizeof(::mavsdk::rpc::gimbal::AttitudeBatch)},
+  { 348, -1, -1, sizeof(::mavsdk::rpc::gimbal::Setpoint)},
+  { 363, -1, -1, sizeof(::mavsdk::rpc::gimbal::SetpointAck)},
+  { 371, -1, -1, sizeof(::mavsdk::rpc::gimbal::ServoGains)},
+  { 382, -1, -1, sizeof(::mavsdk::rpc::gimbal::MotionProfile)},
+  { 393, -1, -1, sizeof(::mavsdk::rpc::gimbal::Metric)},
+  { 401, -1, -1, sizeof(::mavsdk::rpc::gimbal::GimbalResult)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::mavsdk::rpc::gimbal::_SetPitchAndYawRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetPitchAndYawResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetPitchRateAndYawRateRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetPitchRateAndYawRateResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetModeRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetModeResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetRoiLocationRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetRoiLocationResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_TakeControlRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_TakeControlResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_ReleaseControlRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_ReleaseControlResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SubscribeControlRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_ControlResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_GetMetricsRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_GetMetricsResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetTelemetryRatesRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetTelemetryRatesResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_MavlinkTunnelRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_MavlinkTunnelResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SubscribeAttitudeBatchRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SyncClockRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SyncClockResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_PredictAttitudeRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_PredictAttitudeResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_GetAttitudeAtRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_GetAttitudeAtResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_GetAttitudesAtRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_GetAttitudesAtResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_VisualServoRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_VisualServoStatus_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_ApplyGimbalStateRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_ApplyGimbalStateResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetTracingRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetTracingResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_GetTraceRequest_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_GetTraceResponse_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_ControlStatus_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_TelemetryRate_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_MavlinkFilter_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_AttitudeBatch_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_Setpoint_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_SetpointAck_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_ServoGains_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_MotionProfile_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_Metric_default_instance_._instance,
+  &::mavsdk::rpc::gimbal::_GimbalResult_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_gimbal_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\014gimbal.proto\022\021mavsdk.rpc.gimbal\"n\n\025Set"
+  "PitchAndYawRequest\022\021\n\tpitch_deg\030\001 \001(\002\022\017\n"
+  "\007yaw_deg\030\002 \001(\002\0221\n\007profile\030\003 \001(\0132 .mavsdk"
+  ".rpc.gimbal.MotionProfile\"P\n\026SetPitchAnd"
+  "YawResponse\0226\n\rgimbal_result\030\001 \001(\0132\037.mav"
+  "sdk.rpc.gimbal.GimbalResult\"Q\n\035SetPitchR"
+  "ateAndYawRateRequest\022\030\n\020pitch_rate_deg_s"
+  "\030\001 \001(\002\022\026\n\016yaw_rate_deg_s\030\002 \001(\002\"X\n\036SetPit"
+  "chRateAndYawRateResponse\0226\n\rgimbal_resul"
+  "t\030\001 \001(\0132\037.mavsdk.rpc.gimbal.GimbalResult"
+  "\"D\n\016SetModeRequest\0222\n\013gimbal_mode\030\001 \001(\0162"
+  "\035.mavsdk.rpc.gimbal.GimbalMode\"I\n\017SetMod"
+  "eResponse\0226\n\rgimbal_result\030\001 \001(\0132\037.mavsd"
+  "k.rpc.gimbal.GimbalResult\"X\n\025SetRoiLocat"
+  "ionRequest\022\024\n\014latitude_deg\030\001 \001(\001\022\025\n\rlong"
+  "itude_deg\030\002 \001(\001\022\022\n\naltitude_m\030\003 \001(\002\"P\n\026S"
+  "etRoiLocationResponse\0226\n\rgimbal_result\030\001"
+  " \001(\0132\037.mavsdk.rpc.gimbal.GimbalResult\"Y\n"
+  "\022TakeControlRequest\0224\n\014control_mode\030\001 \001("
+  "\0162\036.mavsdk.rpc.gimbal.ControlMode\022\r\n\005for"
+  "ce\030\002 \001(\010\"M\n\023TakeControlResponse\0226\n\rgimba"
+  "l_result\030\001 \001(\0132\037.mavsdk.rpc.gimbal.Gimba"
+  "lResult\"&\n\025ReleaseControlRequest\022\r\n\005forc"
+  "e\030\001 \001(\010\"P\n\026ReleaseControlResponse\0226\n\rgim"
+  "bal_result\030\001 \001(\0132\037.mavsdk.rpc.gimbal.Gim"
+  "balResult\"\031\n\027SubscribeControlRequest\"K\n\017"
+  "ControlResponse\0228\n\016control_status\030\001 \001(\0132"
+  " .mavsdk.rpc.gimbal.ControlStatus\"\023\n\021Get"
+  "MetricsRequest\"@\n\022GetMetricsResponse\022*\n\007"
+  "metrics\030\001 \003(\0132\031.mavsdk.rpc.gimbal.Metric"
+  "\"K\n\030SetTelemetryRatesRequest\022/\n\005rates\030\001 "
+  "\003(\0132 .mavsdk.rpc.gimbal.TelemetryRate\"S\n"
+  "\031SetTelemetryRatesResponse\0226\n\rgimbal_res"
+  "ult\030\001 \001(\0132\037.mavsdk.rpc.gimbal.GimbalResu"
+  "lt\"X\n\024MavlinkTunnelRequest\022\016\n\006frames\030\001 \001"
+  "(\014\0220\n\006filter\030\002 \001(\0132 .mavsdk.rpc.gimbal.M"
+  "avlinkFilter\"X\n\025MavlinkTunnelResponse\022\016\n"
+  "\006frames\030\001 \001(\014\022\026\n\016dropped_frames\030\002 \001(\r\022\027\n"
+  "\017rejected_frames\030\003 \001(\r\"T\n\035SubscribeAttit"
+  "udeBatchRequest\022\027\n\017batch_window_ms\030\001 \001(\r"
+  "\022\032\n\022prediction_rate_hz\030\002 \001(\r\"/\n\020SyncCloc"
+  "kRequest\022\033\n\023client_send_time_ns\030\001 \001(\004\"m\n"
+  "\021SyncClockResponse\022\033\n\023client_send_time_n"
+  "s\030\001 \001(\004\022\036\n\026server_receive_time_ns\030\002 \001(\004\022"
+  "\033\n\023server_send_time_ns\030\003 \001(\004\")\n\026PredictA"
+  "ttitudeRequest\022\017\n\007time_ns\030\001 \001(\004\"e\n\027Predi"
+  "ctAttitudeResponse\022\020\n\010roll_deg\030\001 \001(\002\022\021\n\t"
+  "pitch_deg\030\002 \001(\002\022\017\n\007yaw_deg\030\003 \001(\002\022\024\n\014time"
+  "stamp_us\030\004 \001(\004\"\'\n\024GetAttitudeAtRequest\022\017"
+  "\n\007time_ns\030\001 \001(\004\"\201\001\n\025GetAttitudeAtRespons"
+  "e\022\020\n\010roll_deg\030\001 \001(\002\022\021\n\tpitch_deg\030\002 \001(\002\022\017"
+  "\n\007yaw_deg\030\003 \001(\002\022\013\n\003q_w\030\004 \001(\002\022\013\n\003q_x\030\005 \001("
+  "\002\022\013\n\003q_y\030\006 \001(\002\022\013\n\003q_z\030\007 \001(\002\"(\n\025GetAttitu"
+  "desAtRequest\022\017\n\007time_ns\030\001 \003(\004\"\221\001\n\026GetAtt"
+  "itudesAtResponse\022\r\n\005found\030\001 \003(\010\022\020\n\010roll_"
+  "deg\030\002 \003(\002\022\021\n\tpitch_deg\030\003 \003(\002\022\017\n\007yaw_deg\030"
+  "\004 \003(\002\022\013\n\003q_w\030\005 \003(\002\022\013\n\003q_x\030\006 \003(\002\022\013\n\003q_y\030\007"
+  " \003(\002\022\013\n\003q_z\030\010 \003(\002\"\310\001\n\022VisualServoRequest"
+  "\022\017\n\007error_x\030\001 \001(\002\022\017\n\007error_y\030\002 \001(\002\022\032\n\022ho"
+  "rizontal_fov_deg\030\003 \001(\002\022\030\n\020vertical_fov_d"
+  "eg\030\004 \001(\002\022\023\n\013target_lost\030\005 \001(\010\022\027\n\017capture"
+  "_time_ns\030\006 \001(\004\022,\n\005gains\030\007 \001(\0132\035.mavsdk.r"
+  "pc.gimbal.ServoGains\"\210\002\n\021VisualServoStat"
+  "us\022\030\n\020pitch_rate_deg_s\030\001 \001(\002\022\026\n\016yaw_rate"
+  "_deg_s\030\002 \001(\002\022\027\n\017pitch_error_deg\030\003 \001(\002\022\025\n"
+  "\ryaw_error_deg\030\004 \001(\002\022\020\n\010tracking\030\005 \001(\010\022\r"
+  "\n\005ticks\030\006 \001(\004\022\020\n\010overruns\030\007 \001(\004\022\027\n\017laten"
+  "ess_avg_us\030\010 \001(\001\022\027\n\017lateness_max_us\030\t \001("
+  "\001\022,\n\005gains\030\n \001(\0132\035.mavsdk.rpc.gimbal.Ser"
+  "voGains\"\232\002\n\027ApplyGimbalStateRequest\022;\n\014t"
+  "ake_control\030\001 \001(\0132%.mavsdk.rpc.gimbal.Ta"
+  "keControlRequest\0223\n\010set_mode\030\002 \001(\0132!.mav"
+  "sdk.rpc.gimbal.SetModeRequest\022A\n\rpitch_a"
+  "nd_yaw\030\003 \001(\0132(.mavsdk.rpc.gimbal.SetPitc"
+  "hAndYawRequestH\000\022@\n\014roi_location\030\004 \001(\0132("
+  ".mavsdk.rpc.gimbal.SetRoiLocationRequest"
+  "H\000B\010\n\006target\"\371\001\n\030ApplyGimbalStateRespons"
+  "e\0226\n\rgimbal_result\030\001 \001(\0132\037.mavsdk.rpc.gi"
+  "mbal.GimbalResult\0227\n\016control_result\030\002 \001("
+  "\0132\037.mavsdk.rpc.gimbal.GimbalResult\0224\n\013mo"
+  "de_result\030\003 \001(\0132\037.mavsdk.rpc.gimbal.Gimb"
+  "alResult\0226\n\rtarget_result\030\004 \001(\0132\037.mavsdk"
+  ".rpc.gimbal.GimbalResult\"3\n\021SetTracingRe"
+  "quest\022\017\n\007enabled\030\001 \001(\010\022\r\n\005clear\030\002 \001(\010\"\024\n"
+  "\022SetTracingResponse\"P\n\017GetTraceRequest\022."
+  "\n\006format\030\001 \001(\0162\036.mavsdk.rpc.gimbal.Trace"
+  "Format\022\r\n\005clear\030\002 \001(\010\"E\n\020GetTraceRespons"
+  "e\022\r\n\005trace\030\001 \001(\014\022\r\n\005spans\030\002 \001(\004\022\023\n\013overw"
+  "ritten\030\003 \001(\004\"\307\001\n\rControlStatus\0224\n\014contro"
+  "l_mode\030\001 \001(\0162\036.mavsdk.rpc.gimbal.Control"
+  "Mode\022\035\n\025sysid_primary_control\030\002 \001(\005\022\036\n\026c"
+  "ompid_primary_control\030\003 \001(\005\022\037\n\027sysid_sec"
+  "ondary_control\030\004 \001(\005\022 \n\030compid_secondary"
+  "_control\030\005 \001(\005\"T\n\rTelemetryRate\0222\n\006strea"
+  "m\030\001 \001(\0162\".mavsdk.rpc.gimbal.TelemetryStr"
+  "eam\022\017\n\007rate_hz\030\002 \001(\001\"$\n\rMavlinkFilter\022\023\n"
+  "\013message_ids\030\001 \003(\r\"\225\001\n\rAttitudeBatch\022\031\n\021"
+  "base_timestamp_ms\030\001 \001(\004\022\025\n\rtime_delta_ms"
+  "\030\002 \003(\021\022\021\n\troll_cdeg\030\003 \003(\021\022\022\n\npitch_cdeg\030"
+  "\004 \003(\021\022\020\n\010yaw_cdeg\030\005 \003(\021\022\031\n\021base_wall_tim"
+  "e_ms\030\006 \001(\004\"\351\001\n\010Setpoint\022\020\n\010sequence\030\001 \001("
+  "\004\022-\n\004mode\030\002 \001(\0162\037.mavsdk.rpc.gimbal.Setp"
+  "ointMode\022\021\n\tpitch_deg\030\003 \001(\002\022\017\n\007yaw_deg\030\004"
+  " \001(\002\022\030\n\020pitch_rate_deg_s\030\005 \001(\002\022\026\n\016yaw_ra"
+  "te_deg_s\030\006 \001(\002\022\025\n\rapply_time_ns\030\007 \001(\004\022\027\n"
+  "\017jitter_buffered\030\010 \001(\010\022\026\n\016sample_time_us"
+  "\030\t \001(\004\"W\n\013SetpointAck\022\020\n\010sequence\030\001 \001(\004\022"
+  "6\n\rgimbal_result\030\002 \001(\0132\037.mavsdk.rpc.gimb"
+  "al.GimbalResult\"U\n\nServoGains\022\n\n\002kp\030\001 \001("
+  "\002\022\n\n\002ki\030\002 \001(\002\022\n\n\002kd\030\003 \001(\002\022\013\n\003kff\030\004 \001(\002\022\026"
+  "\n\016max_rate_deg_s\030\005 \001(\002\"\246\001\n\rMotionProfile"
+  "\022.\n\005shape\030\001 \001(\0162\037.mavsdk.rpc.gimbal.Prof"
+  "ileShape\022\032\n\022max_velocity_deg_s\030\002 \001(\002\022\037\n\027"
+  "max_acceleration_deg_s2\030\003 \001(\002\022\027\n\017max_jer"
+  "k_deg_s3\030\004 \001(\002\022\017\n\007rate_hz\030\005 \001(\002\"%\n\006Metri"
+  "c\022\014\n\004name\030\001 \001(\t\022\r\n\005value\030\002 \001(\001\"\341\001\n\014Gimba"
+  "lResult\0226\n\006result\030\001 \001(\0162&.mavsdk.rpc.gim"
+  "bal.GimbalResult.Result\022\022\n\nresult_str\030\002 "
+  "\001(\t\"\204\001\n\006Result\022\022\n\016RESULT_UNKNOWN\020\000\022\022\n\016RE"
+  "SULT_SUCCESS\020\001\022\020\n\014RESULT_ERROR\020\002\022\022\n\016RESU"
+  "LT_TIMEOUT\020\003\022\026\n\022RESULT_UNSUPPORTED\020\004\022\024\n\020"
+  "RESULT_NO_SYSTEM\020\005*B\n\nGimbalMode\022\032\n\026GIMB"
+  "AL_MODE_YAW_FOLLOW\020\000\022\030\n\024GIMBAL_MODE_YAW_"
+  "LOCK\020\001*Z\n\013ControlMode\022\025\n\021CONTROL_MODE_NO"
+  "NE\020\000\022\030\n\024CONTROL_MODE_PRIMARY\020\001\022\032\n\026CONTRO"
+  "L_MODE_SECONDARY\020\002*\217\002\n\017TelemetryStream\022$"
+  "\n TELEMETRY_STREAM_CAMERA_ATTITUDE\020\000\022\035\n\031"
+  "TELEMETRY_STREAM_POSITION\020\001\022\035\n\031TELEMETRY"
+  "_STREAM_ATTITUDE\020\002\022!\n\035TELEMETRY_STREAM_V"
+  "ELOCITY_NED\020\003\022\035\n\031TELEMETRY_STREAM_GPS_IN"
+  "FO\020\004\022\034\n\030TELEMETRY_STREAM_BATTERY\020\005\022\036\n\032TE"
+  "LEMETRY_STREAM_RC_STATUS\020\006\022\030\n\024TELEMETRY_"
+  "STREAM_IMU\020\007*\?\n\014SetpointMode\022\027\n\023SETPOINT"
+  "_MODE_ANGLE\020\000\022\026\n\022SETPOINT_MODE_RATE\020\001*F\n"
+  "\014ProfileShape\022\033\n\027PROFILE_SHAPE_TRAPEZOID"
+  "\020\000\022\031\n\025PROFILE_SHAPE_S_CURVE\020\001*F\n\013TraceFo"
+  "rmat\022\034\n\030TRACE_FORMAT_CHROME_JSON\020\000\022\031\n\025TR"
+  "ACE_FORMAT_PERFETTO\020\0012\202\020\n\rGimbalService\022"
+  "g\n\016SetPitchAndYaw\022(.mavsdk.rpc.gimbal.Se"
+  "tPitchAndYawRequest\032).mavsdk.rpc.gimbal."
+  "SetPitchAndYawResponse\"\000\022\177\n\026SetPitchRate"
+  "AndYawRate\0220.mavsdk.rpc.gimbal.SetPitchR"
+  "ateAndYawRateRequest\0321.mavsdk.rpc.gimbal"
+  ".SetPitchRateAndYawRateResponse\"\000\022R\n\007Set"
+  "Mode\022!.mavsdk.rpc.gimbal.SetModeRequest\032"
+  "\".mavsdk.rpc.gimbal.SetModeResponse\"\000\022g\n"
+  "\016SetRoiLocation\022(.mavsdk.rpc.gimbal.SetR"
+  "oiLocationRequest\032).mavsdk.rpc.gimbal.Se"
+  "tRoiLocationResponse\"\000\022^\n\013TakeControl\022%."
+  "mavsdk.rpc.gimbal.TakeControlRequest\032&.m"
+  "avsdk.rpc.gimbal.TakeControlResponse\"\000\022g"
+  "\n\016ReleaseControl\022(.mavsdk.rpc.gimbal.Rel"
+  "easeControlRequest\032).mavsdk.rpc.gimbal.R"
+  "eleaseControlResponse\"\000\022f\n\020SubscribeCont"
+  "rol\022*.mavsdk.rpc.gimbal.SubscribeControl"
+  "Request\032\".mavsdk.rpc.gimbal.ControlRespo"
+  "nse\"\0000\001\022[\n\nGetMetrics\022$.mavsdk.rpc.gimba"
+  "l.GetMetricsRequest\032%.mavsdk.rpc.gimbal."
+  "GetMetricsResponse\"\000\022p\n\021SetTelemetryRate"
+  "s\022+.mavsdk.rpc.gimbal.SetTelemetryRatesR"
+  "equest\032,.mavsdk.rpc.gimbal.SetTelemetryR"
+  "atesResponse\"\000\022h\n\rMavlinkTunnel\022\'.mavsdk"
+  ".rpc.gimbal.MavlinkTunnelRequest\032(.mavsd"
+  "k.rpc.gimbal.MavlinkTunnelResponse\"\000(\0010\001"
+  "\022p\n\026SubscribeAttitudeBatch\0220.mavsdk.rpc."
+  "gimbal.SubscribeAttitudeBatchRequest\032 .m"
+  "avsdk.rpc.gimbal.AttitudeBatch\"\0000\001\022T\n\017St"
+  "reamSetpoints\022\033.mavsdk.rpc.gimbal.Setpoi"
+  "nt\032\036.mavsdk.rpc.gimbal.SetpointAck\"\000(\0010\001"
+  "\022X\n\tSyncClock\022#.mavsdk.rpc.gimbal.SyncCl"
+  "ockRequest\032$.mavsdk.rpc.gimbal.SyncClock"
+  "Response\"\000\022j\n\017PredictAttitude\022).mavsdk.r"
+  "pc.gimbal.PredictAttitudeRequest\032*.mavsd"
+  "k.rpc.gimbal.PredictAttitudeResponse\"\000\022d"
+  "\n\rGetAttitudeAt\022\'.mavsdk.rpc.gimbal.GetA"
+  "ttitudeAtRequest\032(.mavsdk.rpc.gimbal.Get"
+  "AttitudeAtResponse\"\000\022g\n\016GetAttitudesAt\022("
+  ".mavsdk.rpc.gimbal.GetAttitudesAtRequest"
+  "\032).mavsdk.rpc.gimbal.GetAttitudesAtRespo"
+  "nse\"\000\022`\n\013VisualServo\022%.mavsdk.rpc.gimbal"
+  ".VisualServoRequest\032$.mavsdk.rpc.gimbal."
+  "VisualServoStatus\"\000(\0010\001\022m\n\020ApplyGimbalSt"
+  "ate\022*.mavsdk.rpc.gimbal.ApplyGimbalState"
+  "Request\032+.mavsdk.rpc.gimbal.ApplyGimbalS"
+  "tateResponse\"\000\022[\n\nSetTracing\022$.mavsdk.rp"
+  "c.gimbal.SetTracingRequest\032%.mavsdk.rpc."
+  "gimbal.SetTracingResponse\"\000\022U\n\010GetTrace\022"
+  "\".mavsdk.rpc.gimbal.GetTraceRequest\032#.ma"
+  "vsdk.rpc.gimbal.GetTraceResponse\"\000B\037\n\020io"
+  ".mavsdk.gimbalB\013GimbalProtob\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_gimbal_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_gimbal_2eproto = {
+    false, false, 7595, descriptor_table_protodef_gimbal_2eproto,
+    "gimbal.proto",
+    &descriptor_table_gimbal_2eproto_once, nullptr, 0, 47,
+    schemas, file_default_instances, TableStruct_gimbal_2eproto::offsets,
+    file_level_metadata_gimbal_2eproto, file_level_enum_descriptors_gimbal_2eproto,
+    file_level_service_descriptors_gimbal_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_gimbal_2eproto_getter() {
+  return &descriptor_table_gimbal_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_gimbal_2eproto(&descriptor_table_gimbal_2eproto);
+namespace mavsdk {
+namespace rpc {
+namespace gimbal {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GimbalResult_Result_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gimbal_2eproto);
+  return file_level_enum_descriptors_gimbal_2eproto[0];
+}
+bool GimbalResult_Result_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
     case 4:
     case 5:
       return true;
@@ -501,87 +1462,7608 @@ bool GimbalResult_Result_IsValid(int value) {
   }
 }
 
-#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
-constexpr GimbalResult_Result GimbalResult::RESULT_UNKNOWN;
-constexpr GimbalResult_Result GimbalResult::RESULT_SUCCESS;
-constexpr GimbalResult_Result GimbalResult::RESULT_ERROR;
-constexpr GimbalResult_Result GimbalResult::RESULT_TIMEOUT;
-constexpr GimbalResult_Result GimbalResult::RESULT_UNSUPPORTED;
-constexpr GimbalResult_Result GimbalResult::RESULT_NO_SYSTEM;
-constexpr GimbalResult_Result GimbalResult::Result_MIN;
-constexpr GimbalResult_Result GimbalResult::Result_MAX;
-constexpr int GimbalResult::Result_ARRAYSIZE;
-#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GimbalMode_descriptor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gimbal_2eproto);
-  return file_level_enum_descriptors_gimbal_2eproto[1];
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr GimbalResult_Result GimbalResult::RESULT_UNKNOWN;
+constexpr GimbalResult_Result GimbalResult::RESULT_SUCCESS;
+constexpr GimbalResult_Result GimbalResult::RESULT_ERROR;
+constexpr GimbalResult_Result GimbalResult::RESULT_TIMEOUT;
+constexpr GimbalResult_Result GimbalResult::RESULT_UNSUPPORTED;
+constexpr GimbalResult_Result GimbalResult::RESULT_NO_SYSTEM;
+constexpr GimbalResult_Result GimbalResult::Result_MIN;
+constexpr GimbalResult_Result GimbalResult::Result_MAX;
+constexpr int GimbalResult::Result_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GimbalMode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gimbal_2eproto);
+  return file_level_enum_descriptors_gimbal_2eproto[1];
+}
+bool GimbalMode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ControlMode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gimbal_2eproto);
+  return file_level_enum_descriptors_gimbal_2eproto[2];
+}
+bool ControlMode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TelemetryStream_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gimbal_2eproto);
+  return file_level_enum_descriptors_gimbal_2eproto[3];
+}
+bool TelemetryStream_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetpointMode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gimbal_2eproto);
+  return file_level_enum_descriptors_gimbal_2eproto[4];
+}
+bool SetpointMode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ProfileShape_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gimbal_2eproto);
+  return file_level_enum_descriptors_gimbal_2eproto[5];
+}
+bool ProfileShape_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TraceFormat_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gimbal_2eproto);
+  return file_level_enum_descriptors_gimbal_2eproto[6];
+}
+bool TraceFormat_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class SetPitchAndYawRequest::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::MotionProfile& profile(const SetPitchAndYawRequest* msg);
+};
+
+const ::mavsdk::rpc::gimbal::MotionProfile&
+SetPitchAndYawRequest::_Internal::profile(const SetPitchAndYawRequest* msg) {
+  return *msg->_impl_.profile_;
+}
+SetPitchAndYawRequest::SetPitchAndYawRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+}
+SetPitchAndYawRequest::SetPitchAndYawRequest(const SetPitchAndYawRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetPitchAndYawRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.profile_){nullptr}
+    , decltype(_impl_.pitch_deg_){}
+    , decltype(_impl_.yaw_deg_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_profile()) {
+    _this->_impl_.profile_ = new ::mavsdk::rpc::gimbal::MotionProfile(*from._impl_.profile_);
+  }
+  ::memcpy(&_impl_.pitch_deg_, &from._impl_.pitch_deg_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.yaw_deg_) -
+    reinterpret_cast<char*>(&_impl_.pitch_deg_)) + sizeof(_impl_.yaw_deg_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+}
+
+inline void SetPitchAndYawRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.profile_){nullptr}
+    , decltype(_impl_.pitch_deg_){0}
+    , decltype(_impl_.yaw_deg_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetPitchAndYawRequest::~SetPitchAndYawRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetPitchAndYawRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.profile_;
+}
+
+void SetPitchAndYawRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetPitchAndYawRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.profile_ != nullptr) {
+    delete _impl_.profile_;
+  }
+  _impl_.profile_ = nullptr;
+  ::memset(&_impl_.pitch_deg_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.yaw_deg_) -
+      reinterpret_cast<char*>(&_impl_.pitch_deg_)) + sizeof(_impl_.yaw_deg_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetPitchAndYawRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float pitch_deg = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.pitch_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float yaw_deg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.yaw_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.gimbal.MotionProfile profile = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_profile(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetPitchAndYawRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float pitch_deg = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = this->_internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_pitch_deg(), target);
+  }
+
+  // float yaw_deg = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = this->_internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_yaw_deg(), target);
+  }
+
+  // .mavsdk.rpc.gimbal.MotionProfile profile = 3;
+  if (this->_internal_has_profile()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::profile(this),
+        _Internal::profile(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+  return target;
+}
+
+size_t SetPitchAndYawRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.MotionProfile profile = 3;
+  if (this->_internal_has_profile()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.profile_);
+  }
+
+  // float pitch_deg = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = this->_internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float yaw_deg = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = this->_internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetPitchAndYawRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetPitchAndYawRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetPitchAndYawRequest::GetClassData() const { return &_class_data_; }
+
+
+void SetPitchAndYawRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetPitchAndYawRequest*>(&to_msg);
+  auto& from = static_cast<const SetPitchAndYawRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_profile()) {
+    _this->_internal_mutable_profile()->::mavsdk::rpc::gimbal::MotionProfile::MergeFrom(
+        from._internal_profile());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = from._internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    _this->_internal_set_pitch_deg(from._internal_pitch_deg());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = from._internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    _this->_internal_set_yaw_deg(from._internal_yaw_deg());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetPitchAndYawRequest::CopyFrom(const SetPitchAndYawRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetPitchAndYawRequest::IsInitialized() const {
+  return true;
+}
+
+void SetPitchAndYawRequest::InternalSwap(SetPitchAndYawRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetPitchAndYawRequest, _impl_.yaw_deg_)
+      + sizeof(SetPitchAndYawRequest::_impl_.yaw_deg_)
+      - PROTOBUF_FIELD_OFFSET(SetPitchAndYawRequest, _impl_.profile_)>(
+          reinterpret_cast<char*>(&_impl_.profile_),
+          reinterpret_cast<char*>(&other->_impl_.profile_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetPitchAndYawRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[0]);
+}
+
+// ===================================================================
+
+class SetPitchAndYawResponse::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const SetPitchAndYawResponse* msg);
+};
+
+const ::mavsdk::rpc::gimbal::GimbalResult&
+SetPitchAndYawResponse::_Internal::gimbal_result(const SetPitchAndYawResponse* msg) {
+  return *msg->_impl_.gimbal_result_;
+}
+SetPitchAndYawResponse::SetPitchAndYawResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+}
+SetPitchAndYawResponse::SetPitchAndYawResponse(const SetPitchAndYawResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetPitchAndYawResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_gimbal_result()) {
+    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+}
+
+inline void SetPitchAndYawResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetPitchAndYawResponse::~SetPitchAndYawResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetPitchAndYawResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
+}
+
+void SetPitchAndYawResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetPitchAndYawResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetPitchAndYawResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetPitchAndYawResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::gimbal_result(this),
+        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+  return target;
+}
+
+size_t SetPitchAndYawResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.gimbal_result_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetPitchAndYawResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetPitchAndYawResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetPitchAndYawResponse::GetClassData() const { return &_class_data_; }
+
+
+void SetPitchAndYawResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetPitchAndYawResponse*>(&to_msg);
+  auto& from = static_cast<const SetPitchAndYawResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_gimbal_result()) {
+    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
+        from._internal_gimbal_result());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetPitchAndYawResponse::CopyFrom(const SetPitchAndYawResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetPitchAndYawResponse::IsInitialized() const {
+  return true;
+}
+
+void SetPitchAndYawResponse::InternalSwap(SetPitchAndYawResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetPitchAndYawResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[1]);
+}
+
+// ===================================================================
+
+class SetPitchRateAndYawRateRequest::_Internal {
+ public:
+};
+
+SetPitchRateAndYawRateRequest::SetPitchRateAndYawRateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+}
+SetPitchRateAndYawRateRequest::SetPitchRateAndYawRateRequest(const SetPitchRateAndYawRateRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetPitchRateAndYawRateRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pitch_rate_deg_s_){}
+    , decltype(_impl_.yaw_rate_deg_s_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.pitch_rate_deg_s_, &from._impl_.pitch_rate_deg_s_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.yaw_rate_deg_s_) -
+    reinterpret_cast<char*>(&_impl_.pitch_rate_deg_s_)) + sizeof(_impl_.yaw_rate_deg_s_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+}
+
+inline void SetPitchRateAndYawRateRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pitch_rate_deg_s_){0}
+    , decltype(_impl_.yaw_rate_deg_s_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetPitchRateAndYawRateRequest::~SetPitchRateAndYawRateRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetPitchRateAndYawRateRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SetPitchRateAndYawRateRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetPitchRateAndYawRateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.pitch_rate_deg_s_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.yaw_rate_deg_s_) -
+      reinterpret_cast<char*>(&_impl_.pitch_rate_deg_s_)) + sizeof(_impl_.yaw_rate_deg_s_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetPitchRateAndYawRateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float pitch_rate_deg_s = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.pitch_rate_deg_s_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float yaw_rate_deg_s = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.yaw_rate_deg_s_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetPitchRateAndYawRateRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float pitch_rate_deg_s = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_rate_deg_s = this->_internal_pitch_rate_deg_s();
+  uint32_t raw_pitch_rate_deg_s;
+  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
+  if (raw_pitch_rate_deg_s != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_pitch_rate_deg_s(), target);
+  }
+
+  // float yaw_rate_deg_s = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_rate_deg_s = this->_internal_yaw_rate_deg_s();
+  uint32_t raw_yaw_rate_deg_s;
+  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
+  if (raw_yaw_rate_deg_s != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_yaw_rate_deg_s(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+  return target;
+}
+
+size_t SetPitchRateAndYawRateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // float pitch_rate_deg_s = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_rate_deg_s = this->_internal_pitch_rate_deg_s();
+  uint32_t raw_pitch_rate_deg_s;
+  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
+  if (raw_pitch_rate_deg_s != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float yaw_rate_deg_s = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_rate_deg_s = this->_internal_yaw_rate_deg_s();
+  uint32_t raw_yaw_rate_deg_s;
+  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
+  if (raw_yaw_rate_deg_s != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetPitchRateAndYawRateRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetPitchRateAndYawRateRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetPitchRateAndYawRateRequest::GetClassData() const { return &_class_data_; }
+
+
+void SetPitchRateAndYawRateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetPitchRateAndYawRateRequest*>(&to_msg);
+  auto& from = static_cast<const SetPitchRateAndYawRateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_rate_deg_s = from._internal_pitch_rate_deg_s();
+  uint32_t raw_pitch_rate_deg_s;
+  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
+  if (raw_pitch_rate_deg_s != 0) {
+    _this->_internal_set_pitch_rate_deg_s(from._internal_pitch_rate_deg_s());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_rate_deg_s = from._internal_yaw_rate_deg_s();
+  uint32_t raw_yaw_rate_deg_s;
+  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
+  if (raw_yaw_rate_deg_s != 0) {
+    _this->_internal_set_yaw_rate_deg_s(from._internal_yaw_rate_deg_s());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetPitchRateAndYawRateRequest::CopyFrom(const SetPitchRateAndYawRateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetPitchRateAndYawRateRequest::IsInitialized() const {
+  return true;
+}
+
+void SetPitchRateAndYawRateRequest::InternalSwap(SetPitchRateAndYawRateRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetPitchRateAndYawRateRequest, _impl_.yaw_rate_deg_s_)
+      + sizeof(SetPitchRateAndYawRateRequest::_impl_.yaw_rate_deg_s_)
+      - PROTOBUF_FIELD_OFFSET(SetPitchRateAndYawRateRequest, _impl_.pitch_rate_deg_s_)>(
+          reinterpret_cast<char*>(&_impl_.pitch_rate_deg_s_),
+          reinterpret_cast<char*>(&other->_impl_.pitch_rate_deg_s_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetPitchRateAndYawRateRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[2]);
+}
+
+// ===================================================================
+
+class SetPitchRateAndYawRateResponse::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const SetPitchRateAndYawRateResponse* msg);
+};
+
+const ::mavsdk::rpc::gimbal::GimbalResult&
+SetPitchRateAndYawRateResponse::_Internal::gimbal_result(const SetPitchRateAndYawRateResponse* msg) {
+  return *msg->_impl_.gimbal_result_;
+}
+SetPitchRateAndYawRateResponse::SetPitchRateAndYawRateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+}
+SetPitchRateAndYawRateResponse::SetPitchRateAndYawRateResponse(const SetPitchRateAndYawRateResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetPitchRateAndYawRateResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_gimbal_result()) {
+    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+}
+
+inline void SetPitchRateAndYawRateResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetPitchRateAndYawRateResponse::~SetPitchRateAndYawRateResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetPitchRateAndYawRateResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
+}
+
+void SetPitchRateAndYawRateResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetPitchRateAndYawRateResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetPitchRateAndYawRateResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetPitchRateAndYawRateResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::gimbal_result(this),
+        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+  return target;
+}
+
+size_t SetPitchRateAndYawRateResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.gimbal_result_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetPitchRateAndYawRateResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetPitchRateAndYawRateResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetPitchRateAndYawRateResponse::GetClassData() const { return &_class_data_; }
+
+
+void SetPitchRateAndYawRateResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetPitchRateAndYawRateResponse*>(&to_msg);
+  auto& from = static_cast<const SetPitchRateAndYawRateResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_gimbal_result()) {
+    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
+        from._internal_gimbal_result());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetPitchRateAndYawRateResponse::CopyFrom(const SetPitchRateAndYawRateResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetPitchRateAndYawRateResponse::IsInitialized() const {
+  return true;
+}
+
+void SetPitchRateAndYawRateResponse::InternalSwap(SetPitchRateAndYawRateResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetPitchRateAndYawRateResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[3]);
+}
+
+// ===================================================================
+
+class SetModeRequest::_Internal {
+ public:
+};
+
+SetModeRequest::SetModeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetModeRequest)
+}
+SetModeRequest::SetModeRequest(const SetModeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetModeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_mode_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.gimbal_mode_ = from._impl_.gimbal_mode_;
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetModeRequest)
+}
+
+inline void SetModeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_mode_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetModeRequest::~SetModeRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetModeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetModeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SetModeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetModeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetModeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.gimbal_mode_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetModeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.gimbal.GimbalMode gimbal_mode = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_gimbal_mode(static_cast<::mavsdk::rpc::gimbal::GimbalMode>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetModeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetModeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalMode gimbal_mode = 1;
+  if (this->_internal_gimbal_mode() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_gimbal_mode(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetModeRequest)
+  return target;
+}
+
+size_t SetModeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetModeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalMode gimbal_mode = 1;
+  if (this->_internal_gimbal_mode() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_gimbal_mode());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetModeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetModeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetModeRequest::GetClassData() const { return &_class_data_; }
+
+
+void SetModeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetModeRequest*>(&to_msg);
+  auto& from = static_cast<const SetModeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetModeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_gimbal_mode() != 0) {
+    _this->_internal_set_gimbal_mode(from._internal_gimbal_mode());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetModeRequest::CopyFrom(const SetModeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetModeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetModeRequest::IsInitialized() const {
+  return true;
+}
+
+void SetModeRequest::InternalSwap(SetModeRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.gimbal_mode_, other->_impl_.gimbal_mode_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetModeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[4]);
+}
+
+// ===================================================================
+
+class SetModeResponse::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const SetModeResponse* msg);
+};
+
+const ::mavsdk::rpc::gimbal::GimbalResult&
+SetModeResponse::_Internal::gimbal_result(const SetModeResponse* msg) {
+  return *msg->_impl_.gimbal_result_;
+}
+SetModeResponse::SetModeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetModeResponse)
+}
+SetModeResponse::SetModeResponse(const SetModeResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetModeResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_gimbal_result()) {
+    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetModeResponse)
+}
+
+inline void SetModeResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetModeResponse::~SetModeResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetModeResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetModeResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
+}
+
+void SetModeResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetModeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetModeResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetModeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetModeResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetModeResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::gimbal_result(this),
+        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetModeResponse)
+  return target;
+}
+
+size_t SetModeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetModeResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.gimbal_result_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetModeResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetModeResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetModeResponse::GetClassData() const { return &_class_data_; }
+
+
+void SetModeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetModeResponse*>(&to_msg);
+  auto& from = static_cast<const SetModeResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetModeResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_gimbal_result()) {
+    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
+        from._internal_gimbal_result());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetModeResponse::CopyFrom(const SetModeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetModeResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetModeResponse::IsInitialized() const {
+  return true;
+}
+
+void SetModeResponse::InternalSwap(SetModeResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetModeResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[5]);
+}
+
+// ===================================================================
+
+class SetRoiLocationRequest::_Internal {
+ public:
+};
+
+SetRoiLocationRequest::SetRoiLocationRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+}
+SetRoiLocationRequest::SetRoiLocationRequest(const SetRoiLocationRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetRoiLocationRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.latitude_deg_){}
+    , decltype(_impl_.longitude_deg_){}
+    , decltype(_impl_.altitude_m_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.latitude_deg_, &from._impl_.latitude_deg_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.altitude_m_) -
+    reinterpret_cast<char*>(&_impl_.latitude_deg_)) + sizeof(_impl_.altitude_m_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+}
+
+inline void SetRoiLocationRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.latitude_deg_){0}
+    , decltype(_impl_.longitude_deg_){0}
+    , decltype(_impl_.altitude_m_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetRoiLocationRequest::~SetRoiLocationRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetRoiLocationRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SetRoiLocationRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetRoiLocationRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.latitude_deg_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.altitude_m_) -
+      reinterpret_cast<char*>(&_impl_.latitude_deg_)) + sizeof(_impl_.altitude_m_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetRoiLocationRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double latitude_deg = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.latitude_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double longitude_deg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.longitude_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // float altitude_m = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.altitude_m_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetRoiLocationRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double latitude_deg = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_latitude_deg = this->_internal_latitude_deg();
+  uint64_t raw_latitude_deg;
+  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
+  if (raw_latitude_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_latitude_deg(), target);
+  }
+
+  // double longitude_deg = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_longitude_deg = this->_internal_longitude_deg();
+  uint64_t raw_longitude_deg;
+  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
+  if (raw_longitude_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_longitude_deg(), target);
+  }
+
+  // float altitude_m = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_altitude_m = this->_internal_altitude_m();
+  uint32_t raw_altitude_m;
+  memcpy(&raw_altitude_m, &tmp_altitude_m, sizeof(tmp_altitude_m));
+  if (raw_altitude_m != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_altitude_m(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+  return target;
+}
+
+size_t SetRoiLocationRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double latitude_deg = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_latitude_deg = this->_internal_latitude_deg();
+  uint64_t raw_latitude_deg;
+  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
+  if (raw_latitude_deg != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double longitude_deg = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_longitude_deg = this->_internal_longitude_deg();
+  uint64_t raw_longitude_deg;
+  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
+  if (raw_longitude_deg != 0) {
+    total_size += 1 + 8;
+  }
+
+  // float altitude_m = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_altitude_m = this->_internal_altitude_m();
+  uint32_t raw_altitude_m;
+  memcpy(&raw_altitude_m, &tmp_altitude_m, sizeof(tmp_altitude_m));
+  if (raw_altitude_m != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetRoiLocationRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetRoiLocationRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetRoiLocationRequest::GetClassData() const { return &_class_data_; }
+
+
+void SetRoiLocationRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetRoiLocationRequest*>(&to_msg);
+  auto& from = static_cast<const SetRoiLocationRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_latitude_deg = from._internal_latitude_deg();
+  uint64_t raw_latitude_deg;
+  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
+  if (raw_latitude_deg != 0) {
+    _this->_internal_set_latitude_deg(from._internal_latitude_deg());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_longitude_deg = from._internal_longitude_deg();
+  uint64_t raw_longitude_deg;
+  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
+  if (raw_longitude_deg != 0) {
+    _this->_internal_set_longitude_deg(from._internal_longitude_deg());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_altitude_m = from._internal_altitude_m();
+  uint32_t raw_altitude_m;
+  memcpy(&raw_altitude_m, &tmp_altitude_m, sizeof(tmp_altitude_m));
+  if (raw_altitude_m != 0) {
+    _this->_internal_set_altitude_m(from._internal_altitude_m());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetRoiLocationRequest::CopyFrom(const SetRoiLocationRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetRoiLocationRequest::IsInitialized() const {
+  return true;
+}
+
+void SetRoiLocationRequest::InternalSwap(SetRoiLocationRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetRoiLocationRequest, _impl_.altitude_m_)
+      + sizeof(SetRoiLocationRequest::_impl_.altitude_m_)
+      - PROTOBUF_FIELD_OFFSET(SetRoiLocationRequest, _impl_.latitude_deg_)>(
+          reinterpret_cast<char*>(&_impl_.latitude_deg_),
+          reinterpret_cast<char*>(&other->_impl_.latitude_deg_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetRoiLocationRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[6]);
+}
+
+// ===================================================================
+
+class SetRoiLocationResponse::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const SetRoiLocationResponse* msg);
+};
+
+const ::mavsdk::rpc::gimbal::GimbalResult&
+SetRoiLocationResponse::_Internal::gimbal_result(const SetRoiLocationResponse* msg) {
+  return *msg->_impl_.gimbal_result_;
+}
+SetRoiLocationResponse::SetRoiLocationResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+}
+SetRoiLocationResponse::SetRoiLocationResponse(const SetRoiLocationResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetRoiLocationResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_gimbal_result()) {
+    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+}
+
+inline void SetRoiLocationResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetRoiLocationResponse::~SetRoiLocationResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetRoiLocationResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
+}
+
+void SetRoiLocationResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetRoiLocationResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetRoiLocationResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetRoiLocationResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::gimbal_result(this),
+        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+  return target;
+}
+
+size_t SetRoiLocationResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.gimbal_result_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetRoiLocationResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetRoiLocationResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetRoiLocationResponse::GetClassData() const { return &_class_data_; }
+
+
+void SetRoiLocationResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetRoiLocationResponse*>(&to_msg);
+  auto& from = static_cast<const SetRoiLocationResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_gimbal_result()) {
+    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
+        from._internal_gimbal_result());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetRoiLocationResponse::CopyFrom(const SetRoiLocationResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetRoiLocationResponse::IsInitialized() const {
+  return true;
+}
+
+void SetRoiLocationResponse::InternalSwap(SetRoiLocationResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetRoiLocationResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[7]);
+}
+
+// ===================================================================
+
+class TakeControlRequest::_Internal {
+ public:
+};
+
+TakeControlRequest::TakeControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.TakeControlRequest)
+}
+TakeControlRequest::TakeControlRequest(const TakeControlRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TakeControlRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.control_mode_){}
+    , decltype(_impl_.force_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.control_mode_, &from._impl_.control_mode_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.force_) -
+    reinterpret_cast<char*>(&_impl_.control_mode_)) + sizeof(_impl_.force_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.TakeControlRequest)
+}
+
+inline void TakeControlRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.control_mode_){0}
+    , decltype(_impl_.force_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TakeControlRequest::~TakeControlRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.TakeControlRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TakeControlRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TakeControlRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TakeControlRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.TakeControlRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.control_mode_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.force_) -
+      reinterpret_cast<char*>(&_impl_.control_mode_)) + sizeof(_impl_.force_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TakeControlRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_control_mode(static_cast<::mavsdk::rpc::gimbal::ControlMode>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool force = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.force_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TakeControlRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.TakeControlRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
+  if (this->_internal_control_mode() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_control_mode(), target);
+  }
+
+  // bool force = 2;
+  if (this->_internal_force() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_force(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.TakeControlRequest)
+  return target;
+}
+
+size_t TakeControlRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.TakeControlRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
+  if (this->_internal_control_mode() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_control_mode());
+  }
+
+  // bool force = 2;
+  if (this->_internal_force() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TakeControlRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TakeControlRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TakeControlRequest::GetClassData() const { return &_class_data_; }
+
+
+void TakeControlRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TakeControlRequest*>(&to_msg);
+  auto& from = static_cast<const TakeControlRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.TakeControlRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_control_mode() != 0) {
+    _this->_internal_set_control_mode(from._internal_control_mode());
+  }
+  if (from._internal_force() != 0) {
+    _this->_internal_set_force(from._internal_force());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TakeControlRequest::CopyFrom(const TakeControlRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.TakeControlRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TakeControlRequest::IsInitialized() const {
+  return true;
+}
+
+void TakeControlRequest::InternalSwap(TakeControlRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TakeControlRequest, _impl_.force_)
+      + sizeof(TakeControlRequest::_impl_.force_)
+      - PROTOBUF_FIELD_OFFSET(TakeControlRequest, _impl_.control_mode_)>(
+          reinterpret_cast<char*>(&_impl_.control_mode_),
+          reinterpret_cast<char*>(&other->_impl_.control_mode_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TakeControlRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[8]);
+}
+
+// ===================================================================
+
+class TakeControlResponse::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const TakeControlResponse* msg);
+};
+
+const ::mavsdk::rpc::gimbal::GimbalResult&
+TakeControlResponse::_Internal::gimbal_result(const TakeControlResponse* msg) {
+  return *msg->_impl_.gimbal_result_;
+}
+TakeControlResponse::TakeControlResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.TakeControlResponse)
+}
+TakeControlResponse::TakeControlResponse(const TakeControlResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TakeControlResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_gimbal_result()) {
+    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.TakeControlResponse)
+}
+
+inline void TakeControlResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TakeControlResponse::~TakeControlResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.TakeControlResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TakeControlResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
+}
+
+void TakeControlResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TakeControlResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.TakeControlResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TakeControlResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TakeControlResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.TakeControlResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::gimbal_result(this),
+        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.TakeControlResponse)
+  return target;
+}
+
+size_t TakeControlResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.TakeControlResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.gimbal_result_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TakeControlResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TakeControlResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TakeControlResponse::GetClassData() const { return &_class_data_; }
+
+
+void TakeControlResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TakeControlResponse*>(&to_msg);
+  auto& from = static_cast<const TakeControlResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.TakeControlResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_gimbal_result()) {
+    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
+        from._internal_gimbal_result());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TakeControlResponse::CopyFrom(const TakeControlResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.TakeControlResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TakeControlResponse::IsInitialized() const {
+  return true;
+}
+
+void TakeControlResponse::InternalSwap(TakeControlResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TakeControlResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[9]);
+}
+
+// ===================================================================
+
+class ReleaseControlRequest::_Internal {
+ public:
+};
+
+ReleaseControlRequest::ReleaseControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.ReleaseControlRequest)
+}
+ReleaseControlRequest::ReleaseControlRequest(const ReleaseControlRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReleaseControlRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.force_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.force_ = from._impl_.force_;
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.ReleaseControlRequest)
+}
+
+inline void ReleaseControlRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.force_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReleaseControlRequest::~ReleaseControlRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.ReleaseControlRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReleaseControlRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ReleaseControlRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReleaseControlRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.ReleaseControlRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.force_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReleaseControlRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool force = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.force_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReleaseControlRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.ReleaseControlRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool force = 1;
+  if (this->_internal_force() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_force(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.ReleaseControlRequest)
+  return target;
+}
+
+size_t ReleaseControlRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.ReleaseControlRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bool force = 1;
+  if (this->_internal_force() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReleaseControlRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReleaseControlRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReleaseControlRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReleaseControlRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReleaseControlRequest*>(&to_msg);
+  auto& from = static_cast<const ReleaseControlRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.ReleaseControlRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_force() != 0) {
+    _this->_internal_set_force(from._internal_force());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReleaseControlRequest::CopyFrom(const ReleaseControlRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.ReleaseControlRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReleaseControlRequest::IsInitialized() const {
+  return true;
+}
+
+void ReleaseControlRequest::InternalSwap(ReleaseControlRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.force_, other->_impl_.force_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReleaseControlRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[10]);
+}
+
+// ===================================================================
+
+class ReleaseControlResponse::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const ReleaseControlResponse* msg);
+};
+
+const ::mavsdk::rpc::gimbal::GimbalResult&
+ReleaseControlResponse::_Internal::gimbal_result(const ReleaseControlResponse* msg) {
+  return *msg->_impl_.gimbal_result_;
+}
+ReleaseControlResponse::ReleaseControlResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.ReleaseControlResponse)
+}
+ReleaseControlResponse::ReleaseControlResponse(const ReleaseControlResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReleaseControlResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_gimbal_result()) {
+    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.ReleaseControlResponse)
+}
+
+inline void ReleaseControlResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReleaseControlResponse::~ReleaseControlResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.ReleaseControlResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReleaseControlResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
+}
+
+void ReleaseControlResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReleaseControlResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.ReleaseControlResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReleaseControlResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReleaseControlResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.ReleaseControlResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::gimbal_result(this),
+        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.ReleaseControlResponse)
+  return target;
+}
+
+size_t ReleaseControlResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.ReleaseControlResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.gimbal_result_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReleaseControlResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReleaseControlResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReleaseControlResponse::GetClassData() const { return &_class_data_; }
+
+
+void ReleaseControlResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReleaseControlResponse*>(&to_msg);
+  auto& from = static_cast<const ReleaseControlResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.ReleaseControlResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_gimbal_result()) {
+    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
+        from._internal_gimbal_result());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReleaseControlResponse::CopyFrom(const ReleaseControlResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.ReleaseControlResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReleaseControlResponse::IsInitialized() const {
+  return true;
+}
+
+void ReleaseControlResponse::InternalSwap(ReleaseControlResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReleaseControlResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[11]);
+}
+
+// ===================================================================
+
+class SubscribeControlRequest::_Internal {
+ public:
+};
+
+SubscribeControlRequest::SubscribeControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SubscribeControlRequest)
+}
+SubscribeControlRequest::SubscribeControlRequest(const SubscribeControlRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  SubscribeControlRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SubscribeControlRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubscribeControlRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubscribeControlRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata SubscribeControlRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[12]);
+}
+
+// ===================================================================
+
+class ControlResponse::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::ControlStatus& control_status(const ControlResponse* msg);
+};
+
+const ::mavsdk::rpc::gimbal::ControlStatus&
+ControlResponse::_Internal::control_status(const ControlResponse* msg) {
+  return *msg->_impl_.control_status_;
+}
+ControlResponse::ControlResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.ControlResponse)
+}
+ControlResponse::ControlResponse(const ControlResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ControlResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.control_status_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_control_status()) {
+    _this->_impl_.control_status_ = new ::mavsdk::rpc::gimbal::ControlStatus(*from._impl_.control_status_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.ControlResponse)
+}
+
+inline void ControlResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.control_status_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ControlResponse::~ControlResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.ControlResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ControlResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.control_status_;
+}
+
+void ControlResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ControlResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.ControlResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.control_status_ != nullptr) {
+    delete _impl_.control_status_;
+  }
+  _impl_.control_status_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ControlResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.gimbal.ControlStatus control_status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_control_status(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ControlResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.ControlResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.ControlStatus control_status = 1;
+  if (this->_internal_has_control_status()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::control_status(this),
+        _Internal::control_status(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.ControlResponse)
+  return target;
+}
+
+size_t ControlResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.ControlResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.ControlStatus control_status = 1;
+  if (this->_internal_has_control_status()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.control_status_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ControlResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlResponse::GetClassData() const { return &_class_data_; }
+
+
+void ControlResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ControlResponse*>(&to_msg);
+  auto& from = static_cast<const ControlResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.ControlResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_control_status()) {
+    _this->_internal_mutable_control_status()->::mavsdk::rpc::gimbal::ControlStatus::MergeFrom(
+        from._internal_control_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ControlResponse::CopyFrom(const ControlResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.ControlResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ControlResponse::IsInitialized() const {
+  return true;
+}
+
+void ControlResponse::InternalSwap(ControlResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.control_status_, other->_impl_.control_status_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ControlResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[13]);
+}
+
+// ===================================================================
+
+class GetMetricsRequest::_Internal {
+ public:
+};
+
+GetMetricsRequest::GetMetricsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.GetMetricsRequest)
+}
+GetMetricsRequest::GetMetricsRequest(const GetMetricsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  GetMetricsRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.GetMetricsRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetMetricsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetMetricsRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetMetricsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[14]);
+}
+
+// ===================================================================
+
+class GetMetricsResponse::_Internal {
+ public:
+};
+
+GetMetricsResponse::GetMetricsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.GetMetricsResponse)
+}
+GetMetricsResponse::GetMetricsResponse(const GetMetricsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetMetricsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.metrics_){from._impl_.metrics_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.GetMetricsResponse)
+}
+
+inline void GetMetricsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.metrics_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GetMetricsResponse::~GetMetricsResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.GetMetricsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetMetricsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.metrics_.~RepeatedPtrField();
+}
+
+void GetMetricsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetMetricsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.GetMetricsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.metrics_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetMetricsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .mavsdk.rpc.gimbal.Metric metrics = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_metrics(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetMetricsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.GetMetricsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .mavsdk.rpc.gimbal.Metric metrics = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_metrics_size()); i < n; i++) {
+    const auto& repfield = this->_internal_metrics(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.GetMetricsResponse)
+  return target;
+}
+
+size_t GetMetricsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.GetMetricsResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .mavsdk.rpc.gimbal.Metric metrics = 1;
+  total_size += 1UL * this->_internal_metrics_size();
+  for (const auto& msg : this->_impl_.metrics_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetMetricsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetMetricsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetMetricsResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetMetricsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetMetricsResponse*>(&to_msg);
+  auto& from = static_cast<const GetMetricsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.GetMetricsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.metrics_.MergeFrom(from._impl_.metrics_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetMetricsResponse::CopyFrom(const GetMetricsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.GetMetricsResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetMetricsResponse::IsInitialized() const {
+  return true;
+}
+
+void GetMetricsResponse::InternalSwap(GetMetricsResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.metrics_.InternalSwap(&other->_impl_.metrics_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetMetricsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[15]);
+}
+
+// ===================================================================
+
+class SetTelemetryRatesRequest::_Internal {
+ public:
+};
+
+SetTelemetryRatesRequest::SetTelemetryRatesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetTelemetryRatesRequest)
+}
+SetTelemetryRatesRequest::SetTelemetryRatesRequest(const SetTelemetryRatesRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetTelemetryRatesRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rates_){from._impl_.rates_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetTelemetryRatesRequest)
+}
+
+inline void SetTelemetryRatesRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rates_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetTelemetryRatesRequest::~SetTelemetryRatesRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetTelemetryRatesRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetTelemetryRatesRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rates_.~RepeatedPtrField();
+}
+
+void SetTelemetryRatesRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetTelemetryRatesRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetTelemetryRatesRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rates_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetTelemetryRatesRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .mavsdk.rpc.gimbal.TelemetryRate rates = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rates(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetTelemetryRatesRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetTelemetryRatesRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .mavsdk.rpc.gimbal.TelemetryRate rates = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rates_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rates(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetTelemetryRatesRequest)
+  return target;
+}
+
+size_t SetTelemetryRatesRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetTelemetryRatesRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .mavsdk.rpc.gimbal.TelemetryRate rates = 1;
+  total_size += 1UL * this->_internal_rates_size();
+  for (const auto& msg : this->_impl_.rates_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetTelemetryRatesRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetTelemetryRatesRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetTelemetryRatesRequest::GetClassData() const { return &_class_data_; }
+
+
+void SetTelemetryRatesRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetTelemetryRatesRequest*>(&to_msg);
+  auto& from = static_cast<const SetTelemetryRatesRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetTelemetryRatesRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rates_.MergeFrom(from._impl_.rates_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetTelemetryRatesRequest::CopyFrom(const SetTelemetryRatesRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetTelemetryRatesRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetTelemetryRatesRequest::IsInitialized() const {
+  return true;
+}
+
+void SetTelemetryRatesRequest::InternalSwap(SetTelemetryRatesRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rates_.InternalSwap(&other->_impl_.rates_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetTelemetryRatesRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[16]);
+}
+
+// ===================================================================
+
+class SetTelemetryRatesResponse::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const SetTelemetryRatesResponse* msg);
+};
+
+const ::mavsdk::rpc::gimbal::GimbalResult&
+SetTelemetryRatesResponse::_Internal::gimbal_result(const SetTelemetryRatesResponse* msg) {
+  return *msg->_impl_.gimbal_result_;
+}
+SetTelemetryRatesResponse::SetTelemetryRatesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetTelemetryRatesResponse)
+}
+SetTelemetryRatesResponse::SetTelemetryRatesResponse(const SetTelemetryRatesResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetTelemetryRatesResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_gimbal_result()) {
+    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetTelemetryRatesResponse)
+}
+
+inline void SetTelemetryRatesResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gimbal_result_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetTelemetryRatesResponse::~SetTelemetryRatesResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetTelemetryRatesResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetTelemetryRatesResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
+}
+
+void SetTelemetryRatesResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetTelemetryRatesResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetTelemetryRatesResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetTelemetryRatesResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetTelemetryRatesResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetTelemetryRatesResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::gimbal_result(this),
+        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetTelemetryRatesResponse)
+  return target;
+}
+
+size_t SetTelemetryRatesResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetTelemetryRatesResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.gimbal_result_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetTelemetryRatesResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetTelemetryRatesResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetTelemetryRatesResponse::GetClassData() const { return &_class_data_; }
+
+
+void SetTelemetryRatesResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetTelemetryRatesResponse*>(&to_msg);
+  auto& from = static_cast<const SetTelemetryRatesResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetTelemetryRatesResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_gimbal_result()) {
+    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
+        from._internal_gimbal_result());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetTelemetryRatesResponse::CopyFrom(const SetTelemetryRatesResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetTelemetryRatesResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetTelemetryRatesResponse::IsInitialized() const {
+  return true;
+}
+
+void SetTelemetryRatesResponse::InternalSwap(SetTelemetryRatesResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetTelemetryRatesResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[17]);
+}
+
+// ===================================================================
+
+class MavlinkTunnelRequest::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::MavlinkFilter& filter(const MavlinkTunnelRequest* msg);
+};
+
+const ::mavsdk::rpc::gimbal::MavlinkFilter&
+MavlinkTunnelRequest::_Internal::filter(const MavlinkTunnelRequest* msg) {
+  return *msg->_impl_.filter_;
+}
+MavlinkTunnelRequest::MavlinkTunnelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.MavlinkTunnelRequest)
+}
+MavlinkTunnelRequest::MavlinkTunnelRequest(const MavlinkTunnelRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MavlinkTunnelRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frames_){}
+    , decltype(_impl_.filter_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.frames_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.frames_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_frames().empty()) {
+    _this->_impl_.frames_.Set(from._internal_frames(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_filter()) {
+    _this->_impl_.filter_ = new ::mavsdk::rpc::gimbal::MavlinkFilter(*from._impl_.filter_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.MavlinkTunnelRequest)
+}
+
+inline void MavlinkTunnelRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frames_){}
+    , decltype(_impl_.filter_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.frames_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.frames_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MavlinkTunnelRequest::~MavlinkTunnelRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.MavlinkTunnelRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MavlinkTunnelRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.frames_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.filter_;
+}
+
+void MavlinkTunnelRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MavlinkTunnelRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.MavlinkTunnelRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.frames_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.filter_ != nullptr) {
+    delete _impl_.filter_;
+  }
+  _impl_.filter_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MavlinkTunnelRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes frames = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_frames();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.gimbal.MavlinkFilter filter = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_filter(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MavlinkTunnelRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.MavlinkTunnelRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes frames = 1;
+  if (!this->_internal_frames().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_frames(), target);
+  }
+
+  // .mavsdk.rpc.gimbal.MavlinkFilter filter = 2;
+  if (this->_internal_has_filter()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::filter(this),
+        _Internal::filter(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.MavlinkTunnelRequest)
+  return target;
+}
+
+size_t MavlinkTunnelRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.MavlinkTunnelRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes frames = 1;
+  if (!this->_internal_frames().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_frames());
+  }
+
+  // .mavsdk.rpc.gimbal.MavlinkFilter filter = 2;
+  if (this->_internal_has_filter()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.filter_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MavlinkTunnelRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MavlinkTunnelRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MavlinkTunnelRequest::GetClassData() const { return &_class_data_; }
+
+
+void MavlinkTunnelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MavlinkTunnelRequest*>(&to_msg);
+  auto& from = static_cast<const MavlinkTunnelRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.MavlinkTunnelRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_frames().empty()) {
+    _this->_internal_set_frames(from._internal_frames());
+  }
+  if (from._internal_has_filter()) {
+    _this->_internal_mutable_filter()->::mavsdk::rpc::gimbal::MavlinkFilter::MergeFrom(
+        from._internal_filter());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MavlinkTunnelRequest::CopyFrom(const MavlinkTunnelRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.MavlinkTunnelRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MavlinkTunnelRequest::IsInitialized() const {
+  return true;
+}
+
+void MavlinkTunnelRequest::InternalSwap(MavlinkTunnelRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.frames_, lhs_arena,
+      &other->_impl_.frames_, rhs_arena
+  );
+  swap(_impl_.filter_, other->_impl_.filter_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MavlinkTunnelRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[18]);
+}
+
+// ===================================================================
+
+class MavlinkTunnelResponse::_Internal {
+ public:
+};
+
+MavlinkTunnelResponse::MavlinkTunnelResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.MavlinkTunnelResponse)
+}
+MavlinkTunnelResponse::MavlinkTunnelResponse(const MavlinkTunnelResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MavlinkTunnelResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frames_){}
+    , decltype(_impl_.dropped_frames_){}
+    , decltype(_impl_.rejected_frames_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.frames_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.frames_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_frames().empty()) {
+    _this->_impl_.frames_.Set(from._internal_frames(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.dropped_frames_, &from._impl_.dropped_frames_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.rejected_frames_) -
+    reinterpret_cast<char*>(&_impl_.dropped_frames_)) + sizeof(_impl_.rejected_frames_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.MavlinkTunnelResponse)
+}
+
+inline void MavlinkTunnelResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frames_){}
+    , decltype(_impl_.dropped_frames_){0u}
+    , decltype(_impl_.rejected_frames_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.frames_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.frames_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MavlinkTunnelResponse::~MavlinkTunnelResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.MavlinkTunnelResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MavlinkTunnelResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.frames_.Destroy();
+}
+
+void MavlinkTunnelResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MavlinkTunnelResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.MavlinkTunnelResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.frames_.ClearToEmpty();
+  ::memset(&_impl_.dropped_frames_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.rejected_frames_) -
+      reinterpret_cast<char*>(&_impl_.dropped_frames_)) + sizeof(_impl_.rejected_frames_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MavlinkTunnelResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes frames = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_frames();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 dropped_frames = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.dropped_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 rejected_frames = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.rejected_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MavlinkTunnelResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.MavlinkTunnelResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes frames = 1;
+  if (!this->_internal_frames().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_frames(), target);
+  }
+
+  // uint32 dropped_frames = 2;
+  if (this->_internal_dropped_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_dropped_frames(), target);
+  }
+
+  // uint32 rejected_frames = 3;
+  if (this->_internal_rejected_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_rejected_frames(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.MavlinkTunnelResponse)
+  return target;
+}
+
+size_t MavlinkTunnelResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.MavlinkTunnelResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes frames = 1;
+  if (!this->_internal_frames().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_frames());
+  }
+
+  // uint32 dropped_frames = 2;
+  if (this->_internal_dropped_frames() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dropped_frames());
+  }
+
+  // uint32 rejected_frames = 3;
+  if (this->_internal_rejected_frames() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_rejected_frames());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MavlinkTunnelResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MavlinkTunnelResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MavlinkTunnelResponse::GetClassData() const { return &_class_data_; }
+
+
+void MavlinkTunnelResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MavlinkTunnelResponse*>(&to_msg);
+  auto& from = static_cast<const MavlinkTunnelResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.MavlinkTunnelResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_frames().empty()) {
+    _this->_internal_set_frames(from._internal_frames());
+  }
+  if (from._internal_dropped_frames() != 0) {
+    _this->_internal_set_dropped_frames(from._internal_dropped_frames());
+  }
+  if (from._internal_rejected_frames() != 0) {
+    _this->_internal_set_rejected_frames(from._internal_rejected_frames());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MavlinkTunnelResponse::CopyFrom(const MavlinkTunnelResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.MavlinkTunnelResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MavlinkTunnelResponse::IsInitialized() const {
+  return true;
+}
+
+void MavlinkTunnelResponse::InternalSwap(MavlinkTunnelResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.frames_, lhs_arena,
+      &other->_impl_.frames_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MavlinkTunnelResponse, _impl_.rejected_frames_)
+      + sizeof(MavlinkTunnelResponse::_impl_.rejected_frames_)
+      - PROTOBUF_FIELD_OFFSET(MavlinkTunnelResponse, _impl_.dropped_frames_)>(
+          reinterpret_cast<char*>(&_impl_.dropped_frames_),
+          reinterpret_cast<char*>(&other->_impl_.dropped_frames_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MavlinkTunnelResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[19]);
+}
+
+// ===================================================================
+
+class SubscribeAttitudeBatchRequest::_Internal {
+ public:
+};
+
+SubscribeAttitudeBatchRequest::SubscribeAttitudeBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest)
+}
+SubscribeAttitudeBatchRequest::SubscribeAttitudeBatchRequest(const SubscribeAttitudeBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SubscribeAttitudeBatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.batch_window_ms_){}
+    , decltype(_impl_.prediction_rate_hz_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.batch_window_ms_, &from._impl_.batch_window_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.prediction_rate_hz_) -
+    reinterpret_cast<char*>(&_impl_.batch_window_ms_)) + sizeof(_impl_.prediction_rate_hz_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest)
+}
+
+inline void SubscribeAttitudeBatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.batch_window_ms_){0u}
+    , decltype(_impl_.prediction_rate_hz_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SubscribeAttitudeBatchRequest::~SubscribeAttitudeBatchRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubscribeAttitudeBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SubscribeAttitudeBatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubscribeAttitudeBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.batch_window_ms_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.prediction_rate_hz_) -
+      reinterpret_cast<char*>(&_impl_.batch_window_ms_)) + sizeof(_impl_.prediction_rate_hz_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SubscribeAttitudeBatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 batch_window_ms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.batch_window_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 prediction_rate_hz = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.prediction_rate_hz_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubscribeAttitudeBatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 batch_window_ms = 1;
+  if (this->_internal_batch_window_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_batch_window_ms(), target);
+  }
+
+  // uint32 prediction_rate_hz = 2;
+  if (this->_internal_prediction_rate_hz() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_prediction_rate_hz(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest)
+  return target;
+}
+
+size_t SubscribeAttitudeBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 batch_window_ms = 1;
+  if (this->_internal_batch_window_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_batch_window_ms());
+  }
+
+  // uint32 prediction_rate_hz = 2;
+  if (this->_internal_prediction_rate_hz() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_prediction_rate_hz());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubscribeAttitudeBatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SubscribeAttitudeBatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubscribeAttitudeBatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void SubscribeAttitudeBatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SubscribeAttitudeBatchRequest*>(&to_msg);
+  auto& from = static_cast<const SubscribeAttitudeBatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_batch_window_ms() != 0) {
+    _this->_internal_set_batch_window_ms(from._internal_batch_window_ms());
+  }
+  if (from._internal_prediction_rate_hz() != 0) {
+    _this->_internal_set_prediction_rate_hz(from._internal_prediction_rate_hz());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SubscribeAttitudeBatchRequest::CopyFrom(const SubscribeAttitudeBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubscribeAttitudeBatchRequest::IsInitialized() const {
+  return true;
+}
+
+void SubscribeAttitudeBatchRequest::InternalSwap(SubscribeAttitudeBatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubscribeAttitudeBatchRequest, _impl_.prediction_rate_hz_)
+      + sizeof(SubscribeAttitudeBatchRequest::_impl_.prediction_rate_hz_)
+      - PROTOBUF_FIELD_OFFSET(SubscribeAttitudeBatchRequest, _impl_.batch_window_ms_)>(
+          reinterpret_cast<char*>(&_impl_.batch_window_ms_),
+          reinterpret_cast<char*>(&other->_impl_.batch_window_ms_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SubscribeAttitudeBatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[20]);
+}
+
+// ===================================================================
+
+class SyncClockRequest::_Internal {
+ public:
+};
+
+SyncClockRequest::SyncClockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SyncClockRequest)
+}
+SyncClockRequest::SyncClockRequest(const SyncClockRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncClockRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.client_send_time_ns_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.client_send_time_ns_ = from._impl_.client_send_time_ns_;
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SyncClockRequest)
+}
+
+inline void SyncClockRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.client_send_time_ns_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SyncClockRequest::~SyncClockRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SyncClockRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncClockRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SyncClockRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncClockRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SyncClockRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.client_send_time_ns_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncClockRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 client_send_time_ns = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.client_send_time_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncClockRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SyncClockRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 client_send_time_ns = 1;
+  if (this->_internal_client_send_time_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_client_send_time_ns(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SyncClockRequest)
+  return target;
+}
+
+size_t SyncClockRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SyncClockRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 client_send_time_ns = 1;
+  if (this->_internal_client_send_time_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_client_send_time_ns());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncClockRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncClockRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncClockRequest::GetClassData() const { return &_class_data_; }
+
+
+void SyncClockRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncClockRequest*>(&to_msg);
+  auto& from = static_cast<const SyncClockRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SyncClockRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_client_send_time_ns() != 0) {
+    _this->_internal_set_client_send_time_ns(from._internal_client_send_time_ns());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncClockRequest::CopyFrom(const SyncClockRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SyncClockRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncClockRequest::IsInitialized() const {
+  return true;
+}
+
+void SyncClockRequest::InternalSwap(SyncClockRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.client_send_time_ns_, other->_impl_.client_send_time_ns_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncClockRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[21]);
+}
+
+// ===================================================================
+
+class SyncClockResponse::_Internal {
+ public:
+};
+
+SyncClockResponse::SyncClockResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SyncClockResponse)
+}
+SyncClockResponse::SyncClockResponse(const SyncClockResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncClockResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.client_send_time_ns_){}
+    , decltype(_impl_.server_receive_time_ns_){}
+    , decltype(_impl_.server_send_time_ns_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.client_send_time_ns_, &from._impl_.client_send_time_ns_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.server_send_time_ns_) -
+    reinterpret_cast<char*>(&_impl_.client_send_time_ns_)) + sizeof(_impl_.server_send_time_ns_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SyncClockResponse)
+}
+
+inline void SyncClockResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.client_send_time_ns_){uint64_t{0u}}
+    , decltype(_impl_.server_receive_time_ns_){uint64_t{0u}}
+    , decltype(_impl_.server_send_time_ns_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SyncClockResponse::~SyncClockResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SyncClockResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncClockResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SyncClockResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncClockResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SyncClockResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.client_send_time_ns_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.server_send_time_ns_) -
+      reinterpret_cast<char*>(&_impl_.client_send_time_ns_)) + sizeof(_impl_.server_send_time_ns_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncClockResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 client_send_time_ns = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.client_send_time_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 server_receive_time_ns = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.server_receive_time_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 server_send_time_ns = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.server_send_time_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncClockResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SyncClockResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 client_send_time_ns = 1;
+  if (this->_internal_client_send_time_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_client_send_time_ns(), target);
+  }
+
+  // uint64 server_receive_time_ns = 2;
+  if (this->_internal_server_receive_time_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_server_receive_time_ns(), target);
+  }
+
+  // uint64 server_send_time_ns = 3;
+  if (this->_internal_server_send_time_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_server_send_time_ns(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SyncClockResponse)
+  return target;
+}
+
+size_t SyncClockResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SyncClockResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 client_send_time_ns = 1;
+  if (this->_internal_client_send_time_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_client_send_time_ns());
+  }
+
+  // uint64 server_receive_time_ns = 2;
+  if (this->_internal_server_receive_time_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_server_receive_time_ns());
+  }
+
+  // uint64 server_send_time_ns = 3;
+  if (this->_internal_server_send_time_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_server_send_time_ns());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncClockResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncClockResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncClockResponse::GetClassData() const { return &_class_data_; }
+
+
+void SyncClockResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncClockResponse*>(&to_msg);
+  auto& from = static_cast<const SyncClockResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SyncClockResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_client_send_time_ns() != 0) {
+    _this->_internal_set_client_send_time_ns(from._internal_client_send_time_ns());
+  }
+  if (from._internal_server_receive_time_ns() != 0) {
+    _this->_internal_set_server_receive_time_ns(from._internal_server_receive_time_ns());
+  }
+  if (from._internal_server_send_time_ns() != 0) {
+    _this->_internal_set_server_send_time_ns(from._internal_server_send_time_ns());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncClockResponse::CopyFrom(const SyncClockResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SyncClockResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncClockResponse::IsInitialized() const {
+  return true;
+}
+
+void SyncClockResponse::InternalSwap(SyncClockResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SyncClockResponse, _impl_.server_send_time_ns_)
+      + sizeof(SyncClockResponse::_impl_.server_send_time_ns_)
+      - PROTOBUF_FIELD_OFFSET(SyncClockResponse, _impl_.client_send_time_ns_)>(
+          reinterpret_cast<char*>(&_impl_.client_send_time_ns_),
+          reinterpret_cast<char*>(&other->_impl_.client_send_time_ns_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SyncClockResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[22]);
+}
+
+// ===================================================================
+
+class PredictAttitudeRequest::_Internal {
+ public:
+};
+
+PredictAttitudeRequest::PredictAttitudeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.PredictAttitudeRequest)
+}
+PredictAttitudeRequest::PredictAttitudeRequest(const PredictAttitudeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PredictAttitudeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_ns_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.time_ns_ = from._impl_.time_ns_;
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.PredictAttitudeRequest)
+}
+
+inline void PredictAttitudeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_ns_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PredictAttitudeRequest::~PredictAttitudeRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.PredictAttitudeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PredictAttitudeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PredictAttitudeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PredictAttitudeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.PredictAttitudeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.time_ns_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PredictAttitudeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 time_ns = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.time_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PredictAttitudeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.PredictAttitudeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 time_ns = 1;
+  if (this->_internal_time_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_time_ns(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.PredictAttitudeRequest)
+  return target;
+}
+
+size_t PredictAttitudeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.PredictAttitudeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 time_ns = 1;
+  if (this->_internal_time_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_ns());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PredictAttitudeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PredictAttitudeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PredictAttitudeRequest::GetClassData() const { return &_class_data_; }
+
+
+void PredictAttitudeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PredictAttitudeRequest*>(&to_msg);
+  auto& from = static_cast<const PredictAttitudeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.PredictAttitudeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_time_ns() != 0) {
+    _this->_internal_set_time_ns(from._internal_time_ns());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PredictAttitudeRequest::CopyFrom(const PredictAttitudeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.PredictAttitudeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PredictAttitudeRequest::IsInitialized() const {
+  return true;
+}
+
+void PredictAttitudeRequest::InternalSwap(PredictAttitudeRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.time_ns_, other->_impl_.time_ns_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PredictAttitudeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[23]);
+}
+
+// ===================================================================
+
+class PredictAttitudeResponse::_Internal {
+ public:
+};
+
+PredictAttitudeResponse::PredictAttitudeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.PredictAttitudeResponse)
+}
+PredictAttitudeResponse::PredictAttitudeResponse(const PredictAttitudeResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PredictAttitudeResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roll_deg_){}
+    , decltype(_impl_.pitch_deg_){}
+    , decltype(_impl_.timestamp_us_){}
+    , decltype(_impl_.yaw_deg_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.roll_deg_, &from._impl_.roll_deg_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.yaw_deg_) -
+    reinterpret_cast<char*>(&_impl_.roll_deg_)) + sizeof(_impl_.yaw_deg_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.PredictAttitudeResponse)
+}
+
+inline void PredictAttitudeResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roll_deg_){0}
+    , decltype(_impl_.pitch_deg_){0}
+    , decltype(_impl_.timestamp_us_){uint64_t{0u}}
+    , decltype(_impl_.yaw_deg_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PredictAttitudeResponse::~PredictAttitudeResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.PredictAttitudeResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PredictAttitudeResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PredictAttitudeResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PredictAttitudeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.PredictAttitudeResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.roll_deg_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.yaw_deg_) -
+      reinterpret_cast<char*>(&_impl_.roll_deg_)) + sizeof(_impl_.yaw_deg_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PredictAttitudeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float roll_deg = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.roll_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float pitch_deg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.pitch_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float yaw_deg = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.yaw_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 timestamp_us = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.timestamp_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PredictAttitudeResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.PredictAttitudeResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float roll_deg = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_roll_deg = this->_internal_roll_deg();
+  uint32_t raw_roll_deg;
+  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
+  if (raw_roll_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_roll_deg(), target);
+  }
+
+  // float pitch_deg = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = this->_internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_pitch_deg(), target);
+  }
+
+  // float yaw_deg = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = this->_internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_yaw_deg(), target);
+  }
+
+  // uint64 timestamp_us = 4;
+  if (this->_internal_timestamp_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_timestamp_us(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.PredictAttitudeResponse)
+  return target;
+}
+
+size_t PredictAttitudeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.PredictAttitudeResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // float roll_deg = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_roll_deg = this->_internal_roll_deg();
+  uint32_t raw_roll_deg;
+  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
+  if (raw_roll_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float pitch_deg = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = this->_internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // uint64 timestamp_us = 4;
+  if (this->_internal_timestamp_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp_us());
+  }
+
+  // float yaw_deg = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = this->_internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PredictAttitudeResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PredictAttitudeResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PredictAttitudeResponse::GetClassData() const { return &_class_data_; }
+
+
+void PredictAttitudeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PredictAttitudeResponse*>(&to_msg);
+  auto& from = static_cast<const PredictAttitudeResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.PredictAttitudeResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_roll_deg = from._internal_roll_deg();
+  uint32_t raw_roll_deg;
+  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
+  if (raw_roll_deg != 0) {
+    _this->_internal_set_roll_deg(from._internal_roll_deg());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = from._internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    _this->_internal_set_pitch_deg(from._internal_pitch_deg());
+  }
+  if (from._internal_timestamp_us() != 0) {
+    _this->_internal_set_timestamp_us(from._internal_timestamp_us());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = from._internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    _this->_internal_set_yaw_deg(from._internal_yaw_deg());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PredictAttitudeResponse::CopyFrom(const PredictAttitudeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.PredictAttitudeResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PredictAttitudeResponse::IsInitialized() const {
+  return true;
+}
+
+void PredictAttitudeResponse::InternalSwap(PredictAttitudeResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PredictAttitudeResponse, _impl_.yaw_deg_)
+      + sizeof(PredictAttitudeResponse::_impl_.yaw_deg_)
+      - PROTOBUF_FIELD_OFFSET(PredictAttitudeResponse, _impl_.roll_deg_)>(
+          reinterpret_cast<char*>(&_impl_.roll_deg_),
+          reinterpret_cast<char*>(&other->_impl_.roll_deg_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PredictAttitudeResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[24]);
+}
+
+// ===================================================================
+
+class GetAttitudeAtRequest::_Internal {
+ public:
+};
+
+GetAttitudeAtRequest::GetAttitudeAtRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.GetAttitudeAtRequest)
+}
+GetAttitudeAtRequest::GetAttitudeAtRequest(const GetAttitudeAtRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetAttitudeAtRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_ns_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.time_ns_ = from._impl_.time_ns_;
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.GetAttitudeAtRequest)
+}
+
+inline void GetAttitudeAtRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_ns_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GetAttitudeAtRequest::~GetAttitudeAtRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.GetAttitudeAtRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetAttitudeAtRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void GetAttitudeAtRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetAttitudeAtRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.GetAttitudeAtRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.time_ns_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetAttitudeAtRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 time_ns = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.time_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetAttitudeAtRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.GetAttitudeAtRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 time_ns = 1;
+  if (this->_internal_time_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_time_ns(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.GetAttitudeAtRequest)
+  return target;
+}
+
+size_t GetAttitudeAtRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.GetAttitudeAtRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 time_ns = 1;
+  if (this->_internal_time_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_ns());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetAttitudeAtRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetAttitudeAtRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetAttitudeAtRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetAttitudeAtRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetAttitudeAtRequest*>(&to_msg);
+  auto& from = static_cast<const GetAttitudeAtRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.GetAttitudeAtRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_time_ns() != 0) {
+    _this->_internal_set_time_ns(from._internal_time_ns());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetAttitudeAtRequest::CopyFrom(const GetAttitudeAtRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.GetAttitudeAtRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetAttitudeAtRequest::IsInitialized() const {
+  return true;
+}
+
+void GetAttitudeAtRequest::InternalSwap(GetAttitudeAtRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.time_ns_, other->_impl_.time_ns_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetAttitudeAtRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[25]);
+}
+
+// ===================================================================
+
+class GetAttitudeAtResponse::_Internal {
+ public:
+};
+
+GetAttitudeAtResponse::GetAttitudeAtResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.GetAttitudeAtResponse)
+}
+GetAttitudeAtResponse::GetAttitudeAtResponse(const GetAttitudeAtResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetAttitudeAtResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roll_deg_){}
+    , decltype(_impl_.pitch_deg_){}
+    , decltype(_impl_.yaw_deg_){}
+    , decltype(_impl_.q_w_){}
+    , decltype(_impl_.q_x_){}
+    , decltype(_impl_.q_y_){}
+    , decltype(_impl_.q_z_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.roll_deg_, &from._impl_.roll_deg_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.q_z_) -
+    reinterpret_cast<char*>(&_impl_.roll_deg_)) + sizeof(_impl_.q_z_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.GetAttitudeAtResponse)
+}
+
+inline void GetAttitudeAtResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roll_deg_){0}
+    , decltype(_impl_.pitch_deg_){0}
+    , decltype(_impl_.yaw_deg_){0}
+    , decltype(_impl_.q_w_){0}
+    , decltype(_impl_.q_x_){0}
+    , decltype(_impl_.q_y_){0}
+    , decltype(_impl_.q_z_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GetAttitudeAtResponse::~GetAttitudeAtResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.GetAttitudeAtResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetAttitudeAtResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void GetAttitudeAtResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetAttitudeAtResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.GetAttitudeAtResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.roll_deg_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.q_z_) -
+      reinterpret_cast<char*>(&_impl_.roll_deg_)) + sizeof(_impl_.q_z_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetAttitudeAtResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float roll_deg = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.roll_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float pitch_deg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.pitch_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float yaw_deg = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.yaw_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float q_w = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.q_w_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float q_x = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _impl_.q_x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float q_y = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _impl_.q_y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float q_z = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _impl_.q_z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetAttitudeAtResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.GetAttitudeAtResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float roll_deg = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_roll_deg = this->_internal_roll_deg();
+  uint32_t raw_roll_deg;
+  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
+  if (raw_roll_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_roll_deg(), target);
+  }
+
+  // float pitch_deg = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = this->_internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_pitch_deg(), target);
+  }
+
+  // float yaw_deg = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = this->_internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_yaw_deg(), target);
+  }
+
+  // float q_w = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_w = this->_internal_q_w();
+  uint32_t raw_q_w;
+  memcpy(&raw_q_w, &tmp_q_w, sizeof(tmp_q_w));
+  if (raw_q_w != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_q_w(), target);
+  }
+
+  // float q_x = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_x = this->_internal_q_x();
+  uint32_t raw_q_x;
+  memcpy(&raw_q_x, &tmp_q_x, sizeof(tmp_q_x));
+  if (raw_q_x != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_q_x(), target);
+  }
+
+  // float q_y = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_y = this->_internal_q_y();
+  uint32_t raw_q_y;
+  memcpy(&raw_q_y, &tmp_q_y, sizeof(tmp_q_y));
+  if (raw_q_y != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_q_y(), target);
+  }
+
+  // float q_z = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_z = this->_internal_q_z();
+  uint32_t raw_q_z;
+  memcpy(&raw_q_z, &tmp_q_z, sizeof(tmp_q_z));
+  if (raw_q_z != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_q_z(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.GetAttitudeAtResponse)
+  return target;
+}
+
+size_t GetAttitudeAtResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.GetAttitudeAtResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // float roll_deg = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_roll_deg = this->_internal_roll_deg();
+  uint32_t raw_roll_deg;
+  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
+  if (raw_roll_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float pitch_deg = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = this->_internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float yaw_deg = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = this->_internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float q_w = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_w = this->_internal_q_w();
+  uint32_t raw_q_w;
+  memcpy(&raw_q_w, &tmp_q_w, sizeof(tmp_q_w));
+  if (raw_q_w != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float q_x = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_x = this->_internal_q_x();
+  uint32_t raw_q_x;
+  memcpy(&raw_q_x, &tmp_q_x, sizeof(tmp_q_x));
+  if (raw_q_x != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float q_y = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_y = this->_internal_q_y();
+  uint32_t raw_q_y;
+  memcpy(&raw_q_y, &tmp_q_y, sizeof(tmp_q_y));
+  if (raw_q_y != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float q_z = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_z = this->_internal_q_z();
+  uint32_t raw_q_z;
+  memcpy(&raw_q_z, &tmp_q_z, sizeof(tmp_q_z));
+  if (raw_q_z != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetAttitudeAtResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetAttitudeAtResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetAttitudeAtResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetAttitudeAtResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetAttitudeAtResponse*>(&to_msg);
+  auto& from = static_cast<const GetAttitudeAtResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.GetAttitudeAtResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_roll_deg = from._internal_roll_deg();
+  uint32_t raw_roll_deg;
+  memcpy(&raw_roll_deg, &tmp_roll_deg, sizeof(tmp_roll_deg));
+  if (raw_roll_deg != 0) {
+    _this->_internal_set_roll_deg(from._internal_roll_deg());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = from._internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    _this->_internal_set_pitch_deg(from._internal_pitch_deg());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = from._internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    _this->_internal_set_yaw_deg(from._internal_yaw_deg());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_w = from._internal_q_w();
+  uint32_t raw_q_w;
+  memcpy(&raw_q_w, &tmp_q_w, sizeof(tmp_q_w));
+  if (raw_q_w != 0) {
+    _this->_internal_set_q_w(from._internal_q_w());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_x = from._internal_q_x();
+  uint32_t raw_q_x;
+  memcpy(&raw_q_x, &tmp_q_x, sizeof(tmp_q_x));
+  if (raw_q_x != 0) {
+    _this->_internal_set_q_x(from._internal_q_x());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_y = from._internal_q_y();
+  uint32_t raw_q_y;
+  memcpy(&raw_q_y, &tmp_q_y, sizeof(tmp_q_y));
+  if (raw_q_y != 0) {
+    _this->_internal_set_q_y(from._internal_q_y());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_q_z = from._internal_q_z();
+  uint32_t raw_q_z;
+  memcpy(&raw_q_z, &tmp_q_z, sizeof(tmp_q_z));
+  if (raw_q_z != 0) {
+    _this->_internal_set_q_z(from._internal_q_z());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetAttitudeAtResponse::CopyFrom(const GetAttitudeAtResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.GetAttitudeAtResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetAttitudeAtResponse::IsInitialized() const {
+  return true;
+}
+
+void GetAttitudeAtResponse::InternalSwap(GetAttitudeAtResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetAttitudeAtResponse, _impl_.q_z_)
+      + sizeof(GetAttitudeAtResponse::_impl_.q_z_)
+      - PROTOBUF_FIELD_OFFSET(GetAttitudeAtResponse, _impl_.roll_deg_)>(
+          reinterpret_cast<char*>(&_impl_.roll_deg_),
+          reinterpret_cast<char*>(&other->_impl_.roll_deg_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetAttitudeAtResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[26]);
+}
+
+// ===================================================================
+
+class GetAttitudesAtRequest::_Internal {
+ public:
+};
+
+GetAttitudesAtRequest::GetAttitudesAtRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.GetAttitudesAtRequest)
+}
+GetAttitudesAtRequest::GetAttitudesAtRequest(const GetAttitudesAtRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetAttitudesAtRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_ns_){from._impl_.time_ns_}
+    , /*decltype(_impl_._time_ns_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.GetAttitudesAtRequest)
+}
+
+inline void GetAttitudesAtRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.time_ns_){arena}
+    , /*decltype(_impl_._time_ns_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GetAttitudesAtRequest::~GetAttitudesAtRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.GetAttitudesAtRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetAttitudesAtRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.time_ns_.~RepeatedField();
+}
+
+void GetAttitudesAtRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetAttitudesAtRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.GetAttitudesAtRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.time_ns_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetAttitudesAtRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint64 time_ns = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_time_ns(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_time_ns(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetAttitudesAtRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.GetAttitudesAtRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint64 time_ns = 1;
+  {
+    int byte_size = _impl_._time_ns_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          1, _internal_time_ns(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.GetAttitudesAtRequest)
+  return target;
+}
+
+size_t GetAttitudesAtRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.GetAttitudesAtRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 time_ns = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.time_ns_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._time_ns_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetAttitudesAtRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetAttitudesAtRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetAttitudesAtRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetAttitudesAtRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetAttitudesAtRequest*>(&to_msg);
+  auto& from = static_cast<const GetAttitudesAtRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.GetAttitudesAtRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.time_ns_.MergeFrom(from._impl_.time_ns_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetAttitudesAtRequest::CopyFrom(const GetAttitudesAtRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.GetAttitudesAtRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetAttitudesAtRequest::IsInitialized() const {
+  return true;
+}
+
+void GetAttitudesAtRequest::InternalSwap(GetAttitudesAtRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.time_ns_.InternalSwap(&other->_impl_.time_ns_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetAttitudesAtRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[27]);
+}
+
+// ===================================================================
+
+class GetAttitudesAtResponse::_Internal {
+ public:
+};
+
+GetAttitudesAtResponse::GetAttitudesAtResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.GetAttitudesAtResponse)
+}
+GetAttitudesAtResponse::GetAttitudesAtResponse(const GetAttitudesAtResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetAttitudesAtResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.found_){from._impl_.found_}
+    , decltype(_impl_.roll_deg_){from._impl_.roll_deg_}
+    , decltype(_impl_.pitch_deg_){from._impl_.pitch_deg_}
+    , decltype(_impl_.yaw_deg_){from._impl_.yaw_deg_}
+    , decltype(_impl_.q_w_){from._impl_.q_w_}
+    , decltype(_impl_.q_x_){from._impl_.q_x_}
+    , decltype(_impl_.q_y_){from._impl_.q_y_}
+    , decltype(_impl_.q_z_){from._impl_.q_z_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.GetAttitudesAtResponse)
+}
+
+inline void GetAttitudesAtResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.found_){arena}
+    , decltype(_impl_.roll_deg_){arena}
+    , decltype(_impl_.pitch_deg_){arena}
+    , decltype(_impl_.yaw_deg_){arena}
+    , decltype(_impl_.q_w_){arena}
+    , decltype(_impl_.q_x_){arena}
+    , decltype(_impl_.q_y_){arena}
+    , decltype(_impl_.q_z_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GetAttitudesAtResponse::~GetAttitudesAtResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.GetAttitudesAtResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetAttitudesAtResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.found_.~RepeatedField();
+  _impl_.roll_deg_.~RepeatedField();
+  _impl_.pitch_deg_.~RepeatedField();
+  _impl_.yaw_deg_.~RepeatedField();
+  _impl_.q_w_.~RepeatedField();
+  _impl_.q_x_.~RepeatedField();
+  _impl_.q_y_.~RepeatedField();
+  _impl_.q_z_.~RepeatedField();
+}
+
+void GetAttitudesAtResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetAttitudesAtResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.GetAttitudesAtResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.found_.Clear();
+  _impl_.roll_deg_.Clear();
+  _impl_.pitch_deg_.Clear();
+  _impl_.yaw_deg_.Clear();
+  _impl_.q_w_.Clear();
+  _impl_.q_x_.Clear();
+  _impl_.q_y_.Clear();
+  _impl_.q_z_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetAttitudesAtResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bool found = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(_internal_mutable_found(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_found(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float roll_deg = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_roll_deg(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 21) {
+          _internal_add_roll_deg(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float pitch_deg = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_pitch_deg(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 29) {
+          _internal_add_pitch_deg(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float yaw_deg = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_yaw_deg(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 37) {
+          _internal_add_yaw_deg(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float q_w = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_q_w(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 45) {
+          _internal_add_q_w(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float q_x = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_q_x(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 53) {
+          _internal_add_q_x(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float q_y = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_q_y(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 61) {
+          _internal_add_q_y(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float q_z = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_q_z(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 69) {
+          _internal_add_q_z(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetAttitudesAtResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.GetAttitudesAtResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bool found = 1;
+  if (this->_internal_found_size() > 0) {
+    target = stream->WriteFixedPacked(1, _internal_found(), target);
+  }
+
+  // repeated float roll_deg = 2;
+  if (this->_internal_roll_deg_size() > 0) {
+    target = stream->WriteFixedPacked(2, _internal_roll_deg(), target);
+  }
+
+  // repeated float pitch_deg = 3;
+  if (this->_internal_pitch_deg_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_pitch_deg(), target);
+  }
+
+  // repeated float yaw_deg = 4;
+  if (this->_internal_yaw_deg_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_yaw_deg(), target);
+  }
+
+  // repeated float q_w = 5;
+  if (this->_internal_q_w_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_q_w(), target);
+  }
+
+  // repeated float q_x = 6;
+  if (this->_internal_q_x_size() > 0) {
+    target = stream->WriteFixedPacked(6, _internal_q_x(), target);
+  }
+
+  // repeated float q_y = 7;
+  if (this->_internal_q_y_size() > 0) {
+    target = stream->WriteFixedPacked(7, _internal_q_y(), target);
+  }
+
+  // repeated float q_z = 8;
+  if (this->_internal_q_z_size() > 0) {
+    target = stream->WriteFixedPacked(8, _internal_q_z(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.GetAttitudesAtResponse)
+  return target;
+}
+
+size_t GetAttitudesAtResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.GetAttitudesAtResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bool found = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_found_size());
+    size_t data_size = 1UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float roll_deg = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_roll_deg_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float pitch_deg = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_pitch_deg_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float yaw_deg = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_yaw_deg_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float q_w = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_q_w_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float q_x = 6;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_q_x_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float q_y = 7;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_q_y_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float q_z = 8;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_q_z_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetAttitudesAtResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetAttitudesAtResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetAttitudesAtResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetAttitudesAtResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetAttitudesAtResponse*>(&to_msg);
+  auto& from = static_cast<const GetAttitudesAtResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.GetAttitudesAtResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.found_.MergeFrom(from._impl_.found_);
+  _this->_impl_.roll_deg_.MergeFrom(from._impl_.roll_deg_);
+  _this->_impl_.pitch_deg_.MergeFrom(from._impl_.pitch_deg_);
+  _this->_impl_.yaw_deg_.MergeFrom(from._impl_.yaw_deg_);
+  _this->_impl_.q_w_.MergeFrom(from._impl_.q_w_);
+  _this->_impl_.q_x_.MergeFrom(from._impl_.q_x_);
+  _this->_impl_.q_y_.MergeFrom(from._impl_.q_y_);
+  _this->_impl_.q_z_.MergeFrom(from._impl_.q_z_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetAttitudesAtResponse::CopyFrom(const GetAttitudesAtResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.GetAttitudesAtResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetAttitudesAtResponse::IsInitialized() const {
+  return true;
+}
+
+void GetAttitudesAtResponse::InternalSwap(GetAttitudesAtResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.found_.InternalSwap(&other->_impl_.found_);
+  _impl_.roll_deg_.InternalSwap(&other->_impl_.roll_deg_);
+  _impl_.pitch_deg_.InternalSwap(&other->_impl_.pitch_deg_);
+  _impl_.yaw_deg_.InternalSwap(&other->_impl_.yaw_deg_);
+  _impl_.q_w_.InternalSwap(&other->_impl_.q_w_);
+  _impl_.q_x_.InternalSwap(&other->_impl_.q_x_);
+  _impl_.q_y_.InternalSwap(&other->_impl_.q_y_);
+  _impl_.q_z_.InternalSwap(&other->_impl_.q_z_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetAttitudesAtResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[28]);
+}
+
+// ===================================================================
+
+class VisualServoRequest::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::ServoGains& gains(const VisualServoRequest* msg);
+};
+
+const ::mavsdk::rpc::gimbal::ServoGains&
+VisualServoRequest::_Internal::gains(const VisualServoRequest* msg) {
+  return *msg->_impl_.gains_;
+}
+VisualServoRequest::VisualServoRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.VisualServoRequest)
+}
+VisualServoRequest::VisualServoRequest(const VisualServoRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VisualServoRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gains_){nullptr}
+    , decltype(_impl_.error_x_){}
+    , decltype(_impl_.error_y_){}
+    , decltype(_impl_.horizontal_fov_deg_){}
+    , decltype(_impl_.vertical_fov_deg_){}
+    , decltype(_impl_.capture_time_ns_){}
+    , decltype(_impl_.target_lost_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_gains()) {
+    _this->_impl_.gains_ = new ::mavsdk::rpc::gimbal::ServoGains(*from._impl_.gains_);
+  }
+  ::memcpy(&_impl_.error_x_, &from._impl_.error_x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.target_lost_) -
+    reinterpret_cast<char*>(&_impl_.error_x_)) + sizeof(_impl_.target_lost_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.VisualServoRequest)
+}
+
+inline void VisualServoRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gains_){nullptr}
+    , decltype(_impl_.error_x_){0}
+    , decltype(_impl_.error_y_){0}
+    , decltype(_impl_.horizontal_fov_deg_){0}
+    , decltype(_impl_.vertical_fov_deg_){0}
+    , decltype(_impl_.capture_time_ns_){uint64_t{0u}}
+    , decltype(_impl_.target_lost_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+VisualServoRequest::~VisualServoRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.VisualServoRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VisualServoRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.gains_;
+}
+
+void VisualServoRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VisualServoRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.VisualServoRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.gains_ != nullptr) {
+    delete _impl_.gains_;
+  }
+  _impl_.gains_ = nullptr;
+  ::memset(&_impl_.error_x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.target_lost_) -
+      reinterpret_cast<char*>(&_impl_.error_x_)) + sizeof(_impl_.target_lost_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VisualServoRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float error_x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.error_x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float error_y = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.error_y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float horizontal_fov_deg = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.horizontal_fov_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float vertical_fov_deg = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.vertical_fov_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool target_lost = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.target_lost_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 capture_time_ns = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.capture_time_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.gimbal.ServoGains gains = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gains(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VisualServoRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.VisualServoRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float error_x = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_error_x = this->_internal_error_x();
+  uint32_t raw_error_x;
+  memcpy(&raw_error_x, &tmp_error_x, sizeof(tmp_error_x));
+  if (raw_error_x != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_error_x(), target);
+  }
+
+  // float error_y = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_error_y = this->_internal_error_y();
+  uint32_t raw_error_y;
+  memcpy(&raw_error_y, &tmp_error_y, sizeof(tmp_error_y));
+  if (raw_error_y != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_error_y(), target);
+  }
+
+  // float horizontal_fov_deg = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_horizontal_fov_deg = this->_internal_horizontal_fov_deg();
+  uint32_t raw_horizontal_fov_deg;
+  memcpy(&raw_horizontal_fov_deg, &tmp_horizontal_fov_deg, sizeof(tmp_horizontal_fov_deg));
+  if (raw_horizontal_fov_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_horizontal_fov_deg(), target);
+  }
+
+  // float vertical_fov_deg = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_vertical_fov_deg = this->_internal_vertical_fov_deg();
+  uint32_t raw_vertical_fov_deg;
+  memcpy(&raw_vertical_fov_deg, &tmp_vertical_fov_deg, sizeof(tmp_vertical_fov_deg));
+  if (raw_vertical_fov_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_vertical_fov_deg(), target);
+  }
+
+  // bool target_lost = 5;
+  if (this->_internal_target_lost() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_target_lost(), target);
+  }
+
+  // uint64 capture_time_ns = 6;
+  if (this->_internal_capture_time_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_capture_time_ns(), target);
+  }
+
+  // .mavsdk.rpc.gimbal.ServoGains gains = 7;
+  if (this->_internal_has_gains()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::gains(this),
+        _Internal::gains(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.VisualServoRequest)
+  return target;
+}
+
+size_t VisualServoRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.VisualServoRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.ServoGains gains = 7;
+  if (this->_internal_has_gains()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.gains_);
+  }
+
+  // float error_x = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_error_x = this->_internal_error_x();
+  uint32_t raw_error_x;
+  memcpy(&raw_error_x, &tmp_error_x, sizeof(tmp_error_x));
+  if (raw_error_x != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float error_y = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_error_y = this->_internal_error_y();
+  uint32_t raw_error_y;
+  memcpy(&raw_error_y, &tmp_error_y, sizeof(tmp_error_y));
+  if (raw_error_y != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float horizontal_fov_deg = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_horizontal_fov_deg = this->_internal_horizontal_fov_deg();
+  uint32_t raw_horizontal_fov_deg;
+  memcpy(&raw_horizontal_fov_deg, &tmp_horizontal_fov_deg, sizeof(tmp_horizontal_fov_deg));
+  if (raw_horizontal_fov_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float vertical_fov_deg = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_vertical_fov_deg = this->_internal_vertical_fov_deg();
+  uint32_t raw_vertical_fov_deg;
+  memcpy(&raw_vertical_fov_deg, &tmp_vertical_fov_deg, sizeof(tmp_vertical_fov_deg));
+  if (raw_vertical_fov_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // uint64 capture_time_ns = 6;
+  if (this->_internal_capture_time_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_capture_time_ns());
+  }
+
+  // bool target_lost = 5;
+  if (this->_internal_target_lost() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VisualServoRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VisualServoRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VisualServoRequest::GetClassData() const { return &_class_data_; }
+
+
+void VisualServoRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VisualServoRequest*>(&to_msg);
+  auto& from = static_cast<const VisualServoRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.VisualServoRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_gains()) {
+    _this->_internal_mutable_gains()->::mavsdk::rpc::gimbal::ServoGains::MergeFrom(
+        from._internal_gains());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_error_x = from._internal_error_x();
+  uint32_t raw_error_x;
+  memcpy(&raw_error_x, &tmp_error_x, sizeof(tmp_error_x));
+  if (raw_error_x != 0) {
+    _this->_internal_set_error_x(from._internal_error_x());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_error_y = from._internal_error_y();
+  uint32_t raw_error_y;
+  memcpy(&raw_error_y, &tmp_error_y, sizeof(tmp_error_y));
+  if (raw_error_y != 0) {
+    _this->_internal_set_error_y(from._internal_error_y());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_horizontal_fov_deg = from._internal_horizontal_fov_deg();
+  uint32_t raw_horizontal_fov_deg;
+  memcpy(&raw_horizontal_fov_deg, &tmp_horizontal_fov_deg, sizeof(tmp_horizontal_fov_deg));
+  if (raw_horizontal_fov_deg != 0) {
+    _this->_internal_set_horizontal_fov_deg(from._internal_horizontal_fov_deg());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_vertical_fov_deg = from._internal_vertical_fov_deg();
+  uint32_t raw_vertical_fov_deg;
+  memcpy(&raw_vertical_fov_deg, &tmp_vertical_fov_deg, sizeof(tmp_vertical_fov_deg));
+  if (raw_vertical_fov_deg != 0) {
+    _this->_internal_set_vertical_fov_deg(from._internal_vertical_fov_deg());
+  }
+  if (from._internal_capture_time_ns() != 0) {
+    _this->_internal_set_capture_time_ns(from._internal_capture_time_ns());
+  }
+  if (from._internal_target_lost() != 0) {
+    _this->_internal_set_target_lost(from._internal_target_lost());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VisualServoRequest::CopyFrom(const VisualServoRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.VisualServoRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VisualServoRequest::IsInitialized() const {
+  return true;
+}
+
+void VisualServoRequest::InternalSwap(VisualServoRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VisualServoRequest, _impl_.target_lost_)
+      + sizeof(VisualServoRequest::_impl_.target_lost_)
+      - PROTOBUF_FIELD_OFFSET(VisualServoRequest, _impl_.gains_)>(
+          reinterpret_cast<char*>(&_impl_.gains_),
+          reinterpret_cast<char*>(&other->_impl_.gains_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VisualServoRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[29]);
+}
+
+// ===================================================================
+
+class VisualServoStatus::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::ServoGains& gains(const VisualServoStatus* msg);
+};
+
+const ::mavsdk::rpc::gimbal::ServoGains&
+VisualServoStatus::_Internal::gains(const VisualServoStatus* msg) {
+  return *msg->_impl_.gains_;
+}
+VisualServoStatus::VisualServoStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.VisualServoStatus)
+}
+VisualServoStatus::VisualServoStatus(const VisualServoStatus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VisualServoStatus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gains_){nullptr}
+    , decltype(_impl_.pitch_rate_deg_s_){}
+    , decltype(_impl_.yaw_rate_deg_s_){}
+    , decltype(_impl_.pitch_error_deg_){}
+    , decltype(_impl_.yaw_error_deg_){}
+    , decltype(_impl_.ticks_){}
+    , decltype(_impl_.overruns_){}
+    , decltype(_impl_.lateness_avg_us_){}
+    , decltype(_impl_.lateness_max_us_){}
+    , decltype(_impl_.tracking_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_gains()) {
+    _this->_impl_.gains_ = new ::mavsdk::rpc::gimbal::ServoGains(*from._impl_.gains_);
+  }
+  ::memcpy(&_impl_.pitch_rate_deg_s_, &from._impl_.pitch_rate_deg_s_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.tracking_) -
+    reinterpret_cast<char*>(&_impl_.pitch_rate_deg_s_)) + sizeof(_impl_.tracking_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.VisualServoStatus)
+}
+
+inline void VisualServoStatus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.gains_){nullptr}
+    , decltype(_impl_.pitch_rate_deg_s_){0}
+    , decltype(_impl_.yaw_rate_deg_s_){0}
+    , decltype(_impl_.pitch_error_deg_){0}
+    , decltype(_impl_.yaw_error_deg_){0}
+    , decltype(_impl_.ticks_){uint64_t{0u}}
+    , decltype(_impl_.overruns_){uint64_t{0u}}
+    , decltype(_impl_.lateness_avg_us_){0}
+    , decltype(_impl_.lateness_max_us_){0}
+    , decltype(_impl_.tracking_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+VisualServoStatus::~VisualServoStatus() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.VisualServoStatus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void VisualServoStatus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.gains_;
+}
+
+void VisualServoStatus::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void VisualServoStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.VisualServoStatus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.gains_ != nullptr) {
+    delete _impl_.gains_;
+  }
+  _impl_.gains_ = nullptr;
+  ::memset(&_impl_.pitch_rate_deg_s_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.tracking_) -
+      reinterpret_cast<char*>(&_impl_.pitch_rate_deg_s_)) + sizeof(_impl_.tracking_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* VisualServoStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float pitch_rate_deg_s = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.pitch_rate_deg_s_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float yaw_rate_deg_s = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.yaw_rate_deg_s_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float pitch_error_deg = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.pitch_error_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float yaw_error_deg = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.yaw_error_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool tracking = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.tracking_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 ticks = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.ticks_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 overruns = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.overruns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double lateness_avg_us = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _impl_.lateness_avg_us_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double lateness_max_us = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _impl_.lateness_max_us_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.gimbal.ServoGains gains = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gains(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* VisualServoStatus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.VisualServoStatus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float pitch_rate_deg_s = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_rate_deg_s = this->_internal_pitch_rate_deg_s();
+  uint32_t raw_pitch_rate_deg_s;
+  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
+  if (raw_pitch_rate_deg_s != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_pitch_rate_deg_s(), target);
+  }
+
+  // float yaw_rate_deg_s = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_rate_deg_s = this->_internal_yaw_rate_deg_s();
+  uint32_t raw_yaw_rate_deg_s;
+  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
+  if (raw_yaw_rate_deg_s != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_yaw_rate_deg_s(), target);
+  }
+
+  // float pitch_error_deg = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_error_deg = this->_internal_pitch_error_deg();
+  uint32_t raw_pitch_error_deg;
+  memcpy(&raw_pitch_error_deg, &tmp_pitch_error_deg, sizeof(tmp_pitch_error_deg));
+  if (raw_pitch_error_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_pitch_error_deg(), target);
+  }
+
+  // float yaw_error_deg = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_error_deg = this->_internal_yaw_error_deg();
+  uint32_t raw_yaw_error_deg;
+  memcpy(&raw_yaw_error_deg, &tmp_yaw_error_deg, sizeof(tmp_yaw_error_deg));
+  if (raw_yaw_error_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_yaw_error_deg(), target);
+  }
+
+  // bool tracking = 5;
+  if (this->_internal_tracking() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_tracking(), target);
+  }
+
+  // uint64 ticks = 6;
+  if (this->_internal_ticks() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_ticks(), target);
+  }
+
+  // uint64 overruns = 7;
+  if (this->_internal_overruns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_overruns(), target);
+  }
+
+  // double lateness_avg_us = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lateness_avg_us = this->_internal_lateness_avg_us();
+  uint64_t raw_lateness_avg_us;
+  memcpy(&raw_lateness_avg_us, &tmp_lateness_avg_us, sizeof(tmp_lateness_avg_us));
+  if (raw_lateness_avg_us != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_lateness_avg_us(), target);
+  }
+
+  // double lateness_max_us = 9;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lateness_max_us = this->_internal_lateness_max_us();
+  uint64_t raw_lateness_max_us;
+  memcpy(&raw_lateness_max_us, &tmp_lateness_max_us, sizeof(tmp_lateness_max_us));
+  if (raw_lateness_max_us != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_lateness_max_us(), target);
+  }
+
+  // .mavsdk.rpc.gimbal.ServoGains gains = 10;
+  if (this->_internal_has_gains()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::gains(this),
+        _Internal::gains(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.VisualServoStatus)
+  return target;
+}
+
+size_t VisualServoStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.VisualServoStatus)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.ServoGains gains = 10;
+  if (this->_internal_has_gains()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.gains_);
+  }
+
+  // float pitch_rate_deg_s = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_rate_deg_s = this->_internal_pitch_rate_deg_s();
+  uint32_t raw_pitch_rate_deg_s;
+  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
+  if (raw_pitch_rate_deg_s != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float yaw_rate_deg_s = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_rate_deg_s = this->_internal_yaw_rate_deg_s();
+  uint32_t raw_yaw_rate_deg_s;
+  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
+  if (raw_yaw_rate_deg_s != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float pitch_error_deg = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_error_deg = this->_internal_pitch_error_deg();
+  uint32_t raw_pitch_error_deg;
+  memcpy(&raw_pitch_error_deg, &tmp_pitch_error_deg, sizeof(tmp_pitch_error_deg));
+  if (raw_pitch_error_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float yaw_error_deg = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_error_deg = this->_internal_yaw_error_deg();
+  uint32_t raw_yaw_error_deg;
+  memcpy(&raw_yaw_error_deg, &tmp_yaw_error_deg, sizeof(tmp_yaw_error_deg));
+  if (raw_yaw_error_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // uint64 ticks = 6;
+  if (this->_internal_ticks() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ticks());
+  }
+
+  // uint64 overruns = 7;
+  if (this->_internal_overruns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_overruns());
+  }
+
+  // double lateness_avg_us = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lateness_avg_us = this->_internal_lateness_avg_us();
+  uint64_t raw_lateness_avg_us;
+  memcpy(&raw_lateness_avg_us, &tmp_lateness_avg_us, sizeof(tmp_lateness_avg_us));
+  if (raw_lateness_avg_us != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double lateness_max_us = 9;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lateness_max_us = this->_internal_lateness_max_us();
+  uint64_t raw_lateness_max_us;
+  memcpy(&raw_lateness_max_us, &tmp_lateness_max_us, sizeof(tmp_lateness_max_us));
+  if (raw_lateness_max_us != 0) {
+    total_size += 1 + 8;
+  }
+
+  // bool tracking = 5;
+  if (this->_internal_tracking() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VisualServoStatus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VisualServoStatus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VisualServoStatus::GetClassData() const { return &_class_data_; }
+
+
+void VisualServoStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VisualServoStatus*>(&to_msg);
+  auto& from = static_cast<const VisualServoStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.VisualServoStatus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_gains()) {
+    _this->_internal_mutable_gains()->::mavsdk::rpc::gimbal::ServoGains::MergeFrom(
+        from._internal_gains());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_rate_deg_s = from._internal_pitch_rate_deg_s();
+  uint32_t raw_pitch_rate_deg_s;
+  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
+  if (raw_pitch_rate_deg_s != 0) {
+    _this->_internal_set_pitch_rate_deg_s(from._internal_pitch_rate_deg_s());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_rate_deg_s = from._internal_yaw_rate_deg_s();
+  uint32_t raw_yaw_rate_deg_s;
+  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
+  if (raw_yaw_rate_deg_s != 0) {
+    _this->_internal_set_yaw_rate_deg_s(from._internal_yaw_rate_deg_s());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_error_deg = from._internal_pitch_error_deg();
+  uint32_t raw_pitch_error_deg;
+  memcpy(&raw_pitch_error_deg, &tmp_pitch_error_deg, sizeof(tmp_pitch_error_deg));
+  if (raw_pitch_error_deg != 0) {
+    _this->_internal_set_pitch_error_deg(from._internal_pitch_error_deg());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_error_deg = from._internal_yaw_error_deg();
+  uint32_t raw_yaw_error_deg;
+  memcpy(&raw_yaw_error_deg, &tmp_yaw_error_deg, sizeof(tmp_yaw_error_deg));
+  if (raw_yaw_error_deg != 0) {
+    _this->_internal_set_yaw_error_deg(from._internal_yaw_error_deg());
+  }
+  if (from._internal_ticks() != 0) {
+    _this->_internal_set_ticks(from._internal_ticks());
+  }
+  if (from._internal_overruns() != 0) {
+    _this->_internal_set_overruns(from._internal_overruns());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lateness_avg_us = from._internal_lateness_avg_us();
+  uint64_t raw_lateness_avg_us;
+  memcpy(&raw_lateness_avg_us, &tmp_lateness_avg_us, sizeof(tmp_lateness_avg_us));
+  if (raw_lateness_avg_us != 0) {
+    _this->_internal_set_lateness_avg_us(from._internal_lateness_avg_us());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lateness_max_us = from._internal_lateness_max_us();
+  uint64_t raw_lateness_max_us;
+  memcpy(&raw_lateness_max_us, &tmp_lateness_max_us, sizeof(tmp_lateness_max_us));
+  if (raw_lateness_max_us != 0) {
+    _this->_internal_set_lateness_max_us(from._internal_lateness_max_us());
+  }
+  if (from._internal_tracking() != 0) {
+    _this->_internal_set_tracking(from._internal_tracking());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void VisualServoStatus::CopyFrom(const VisualServoStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.VisualServoStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool VisualServoStatus::IsInitialized() const {
+  return true;
+}
+
+void VisualServoStatus::InternalSwap(VisualServoStatus* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(VisualServoStatus, _impl_.tracking_)
+      + sizeof(VisualServoStatus::_impl_.tracking_)
+      - PROTOBUF_FIELD_OFFSET(VisualServoStatus, _impl_.gains_)>(
+          reinterpret_cast<char*>(&_impl_.gains_),
+          reinterpret_cast<char*>(&other->_impl_.gains_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata VisualServoStatus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[30]);
+}
+
+// ===================================================================
+
+class ApplyGimbalStateRequest::_Internal {
+ public:
+  static const ::mavsdk::rpc::gimbal::TakeControlRequest& take_control(const ApplyGimbalStateRequest* msg);
+  static const ::mavsdk::rpc::gimbal::SetModeRequest& set_mode(const ApplyGimbalStateRequest* msg);
+  static const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest& pitch_and_yaw(const ApplyGimbalStateRequest* msg);
+  static const ::mavsdk::rpc::gimbal::SetRoiLocationRequest& roi_location(const ApplyGimbalStateRequest* msg);
+};
+
+const ::mavsdk::rpc::gimbal::TakeControlRequest&
+ApplyGimbalStateRequest::_Internal::take_control(const ApplyGimbalStateRequest* msg) {
+  return *msg->_impl_.take_control_;
+}
+const ::mavsdk::rpc::gimbal::SetModeRequest&
+ApplyGimbalStateRequest::_Internal::set_mode(const ApplyGimbalStateRequest* msg) {
+  return *msg->_impl_.set_mode_;
+}
+const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest&
+ApplyGimbalStateRequest::_Internal::pitch_and_yaw(const ApplyGimbalStateRequest* msg) {
+  return *msg->_impl_.target_.pitch_and_yaw_;
+}
+const ::mavsdk::rpc::gimbal::SetRoiLocationRequest&
+ApplyGimbalStateRequest::_Internal::roi_location(const ApplyGimbalStateRequest* msg) {
+  return *msg->_impl_.target_.roi_location_;
+}
+void ApplyGimbalStateRequest::set_allocated_pitch_and_yaw(::mavsdk::rpc::gimbal::SetPitchAndYawRequest* pitch_and_yaw) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_target();
+  if (pitch_and_yaw) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pitch_and_yaw);
+    if (message_arena != submessage_arena) {
+      pitch_and_yaw = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pitch_and_yaw, submessage_arena);
+    }
+    set_has_pitch_and_yaw();
+    _impl_.target_.pitch_and_yaw_ = pitch_and_yaw;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.pitch_and_yaw)
+}
+void ApplyGimbalStateRequest::set_allocated_roi_location(::mavsdk::rpc::gimbal::SetRoiLocationRequest* roi_location) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_target();
+  if (roi_location) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(roi_location);
+    if (message_arena != submessage_arena) {
+      roi_location = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, roi_location, submessage_arena);
+    }
+    set_has_roi_location();
+    _impl_.target_.roi_location_ = roi_location;
+  }
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.roi_location)
+}
+ApplyGimbalStateRequest::ApplyGimbalStateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.ApplyGimbalStateRequest)
+}
+ApplyGimbalStateRequest::ApplyGimbalStateRequest(const ApplyGimbalStateRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ApplyGimbalStateRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.take_control_){nullptr}
+    , decltype(_impl_.set_mode_){nullptr}
+    , decltype(_impl_.target_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_take_control()) {
+    _this->_impl_.take_control_ = new ::mavsdk::rpc::gimbal::TakeControlRequest(*from._impl_.take_control_);
+  }
+  if (from._internal_has_set_mode()) {
+    _this->_impl_.set_mode_ = new ::mavsdk::rpc::gimbal::SetModeRequest(*from._impl_.set_mode_);
+  }
+  clear_has_target();
+  switch (from.target_case()) {
+    case kPitchAndYaw: {
+      _this->_internal_mutable_pitch_and_yaw()->::mavsdk::rpc::gimbal::SetPitchAndYawRequest::MergeFrom(
+          from._internal_pitch_and_yaw());
+      break;
+    }
+    case kRoiLocation: {
+      _this->_internal_mutable_roi_location()->::mavsdk::rpc::gimbal::SetRoiLocationRequest::MergeFrom(
+          from._internal_roi_location());
+      break;
+    }
+    case TARGET_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.ApplyGimbalStateRequest)
+}
+
+inline void ApplyGimbalStateRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.take_control_){nullptr}
+    , decltype(_impl_.set_mode_){nullptr}
+    , decltype(_impl_.target_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_target();
 }
-bool GimbalMode_IsValid(int value) {
-  switch (value) {
-    case 0:
-    case 1:
-      return true;
-    default:
-      return false;
+
+ApplyGimbalStateRequest::~ApplyGimbalStateRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.ApplyGimbalStateRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ControlMode_descriptor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_gimbal_2eproto);
-  return file_level_enum_descriptors_gimbal_2eproto[2];
+inline void ApplyGimbalStateRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.take_control_;
+  if (this != internal_default_instance()) delete _impl_.set_mode_;
+  if (has_target()) {
+    clear_target();
+  }
 }
-bool ControlMode_IsValid(int value) {
-  switch (value) {
-    case 0:
-    case 1:
-    case 2:
-      return true;
-    default:
-      return false;
+
+void ApplyGimbalStateRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ApplyGimbalStateRequest::clear_target() {
+// @@protoc_insertion_point(one_of_clear_start:mavsdk.rpc.gimbal.ApplyGimbalStateRequest)
+  switch (target_case()) {
+    case kPitchAndYaw: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.target_.pitch_and_yaw_;
+      }
+      break;
+    }
+    case kRoiLocation: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.target_.roi_location_;
+      }
+      break;
+    }
+    case TARGET_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = TARGET_NOT_SET;
+}
+
+
+void ApplyGimbalStateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.ApplyGimbalStateRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.take_control_ != nullptr) {
+    delete _impl_.take_control_;
+  }
+  _impl_.take_control_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.set_mode_ != nullptr) {
+    delete _impl_.set_mode_;
+  }
+  _impl_.set_mode_ = nullptr;
+  clear_target();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ApplyGimbalStateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.gimbal.TakeControlRequest take_control = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_take_control(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.gimbal.SetModeRequest set_mode = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_mode(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.gimbal.SetPitchAndYawRequest pitch_and_yaw = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pitch_and_yaw(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.gimbal.SetRoiLocationRequest roi_location = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_roi_location(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ApplyGimbalStateRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.ApplyGimbalStateRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.TakeControlRequest take_control = 1;
+  if (this->_internal_has_take_control()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::take_control(this),
+        _Internal::take_control(this).GetCachedSize(), target, stream);
+  }
+
+  // .mavsdk.rpc.gimbal.SetModeRequest set_mode = 2;
+  if (this->_internal_has_set_mode()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::set_mode(this),
+        _Internal::set_mode(this).GetCachedSize(), target, stream);
+  }
+
+  // .mavsdk.rpc.gimbal.SetPitchAndYawRequest pitch_and_yaw = 3;
+  if (_internal_has_pitch_and_yaw()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::pitch_and_yaw(this),
+        _Internal::pitch_and_yaw(this).GetCachedSize(), target, stream);
   }
+
+  // .mavsdk.rpc.gimbal.SetRoiLocationRequest roi_location = 4;
+  if (_internal_has_roi_location()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::roi_location(this),
+        _Internal::roi_location(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.ApplyGimbalStateRequest)
+  return target;
+}
+
+size_t ApplyGimbalStateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.ApplyGimbalStateRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.gimbal.TakeControlRequest take_control = 1;
+  if (this->_internal_has_take_control()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.take_control_);
+  }
+
+  // .mavsdk.rpc.gimbal.SetModeRequest set_mode = 2;
+  if (this->_internal_has_set_mode()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.set_mode_);
+  }
+
+  switch (target_case()) {
+    // .mavsdk.rpc.gimbal.SetPitchAndYawRequest pitch_and_yaw = 3;
+    case kPitchAndYaw: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.target_.pitch_and_yaw_);
+      break;
+    }
+    // .mavsdk.rpc.gimbal.SetRoiLocationRequest roi_location = 4;
+    case kRoiLocation: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.target_.roi_location_);
+      break;
+    }
+    case TARGET_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ApplyGimbalStateRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ApplyGimbalStateRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ApplyGimbalStateRequest::GetClassData() const { return &_class_data_; }
+
+
+void ApplyGimbalStateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ApplyGimbalStateRequest*>(&to_msg);
+  auto& from = static_cast<const ApplyGimbalStateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.ApplyGimbalStateRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_take_control()) {
+    _this->_internal_mutable_take_control()->::mavsdk::rpc::gimbal::TakeControlRequest::MergeFrom(
+        from._internal_take_control());
+  }
+  if (from._internal_has_set_mode()) {
+    _this->_internal_mutable_set_mode()->::mavsdk::rpc::gimbal::SetModeRequest::MergeFrom(
+        from._internal_set_mode());
+  }
+  switch (from.target_case()) {
+    case kPitchAndYaw: {
+      _this->_internal_mutable_pitch_and_yaw()->::mavsdk::rpc::gimbal::SetPitchAndYawRequest::MergeFrom(
+          from._internal_pitch_and_yaw());
+      break;
+    }
+    case kRoiLocation: {
+      _this->_internal_mutable_roi_location()->::mavsdk::rpc::gimbal::SetRoiLocationRequest::MergeFrom(
+          from._internal_roi_location());
+      break;
+    }
+    case TARGET_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ApplyGimbalStateRequest::CopyFrom(const ApplyGimbalStateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.ApplyGimbalStateRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ApplyGimbalStateRequest::IsInitialized() const {
+  return true;
+}
+
+void ApplyGimbalStateRequest::InternalSwap(ApplyGimbalStateRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ApplyGimbalStateRequest, _impl_.set_mode_)
+      + sizeof(ApplyGimbalStateRequest::_impl_.set_mode_)
+      - PROTOBUF_FIELD_OFFSET(ApplyGimbalStateRequest, _impl_.take_control_)>(
+          reinterpret_cast<char*>(&_impl_.take_control_),
+          reinterpret_cast<char*>(&other->_impl_.take_control_));
+  swap(_impl_.target_, other->_impl_.target_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
+::PROTOBUF_NAMESPACE_ID::Metadata ApplyGimbalStateRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[31]);
+}
 
 // ===================================================================
 
-class SetPitchAndYawRequest::_Internal {
+class ApplyGimbalStateResponse::_Internal {
  public:
+  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const ApplyGimbalStateResponse* msg);
+  static const ::mavsdk::rpc::gimbal::GimbalResult& control_result(const ApplyGimbalStateResponse* msg);
+  static const ::mavsdk::rpc::gimbal::GimbalResult& mode_result(const ApplyGimbalStateResponse* msg);
+  static const ::mavsdk::rpc::gimbal::GimbalResult& target_result(const ApplyGimbalStateResponse* msg);
 };
 
-SetPitchAndYawRequest::SetPitchAndYawRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::mavsdk::rpc::gimbal::GimbalResult&
+ApplyGimbalStateResponse::_Internal::gimbal_result(const ApplyGimbalStateResponse* msg) {
+  return *msg->_impl_.gimbal_result_;
+}
+const ::mavsdk::rpc::gimbal::GimbalResult&
+ApplyGimbalStateResponse::_Internal::control_result(const ApplyGimbalStateResponse* msg) {
+  return *msg->_impl_.control_result_;
+}
+const ::mavsdk::rpc::gimbal::GimbalResult&
+ApplyGimbalStateResponse::_Internal::mode_result(const ApplyGimbalStateResponse* msg) {
+  return *msg->_impl_.mode_result_;
+}
+const ::mavsdk::rpc::gimbal::GimbalResult&
+ApplyGimbalStateResponse::_Internal::target_result(const ApplyGimbalStateResponse* msg) {
+  return *msg->_impl_.target_result_;
+}
+ApplyGimbalStateResponse::ApplyGimbalStateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.ApplyGimbalStateResponse)
 }
-SetPitchAndYawRequest::SetPitchAndYawRequest(const SetPitchAndYawRequest& from)
+ApplyGimbalStateResponse::ApplyGimbalStateResponse(const ApplyGimbalStateResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetPitchAndYawRequest* const _this = this; (void)_this;
+  ApplyGimbalStateResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.pitch_deg_){}
-    , decltype(_impl_.yaw_deg_){}
+      decltype(_impl_.gimbal_result_){nullptr}
+    , decltype(_impl_.control_result_){nullptr}
+    , decltype(_impl_.mode_result_){nullptr}
+    , decltype(_impl_.target_result_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.pitch_deg_, &from._impl_.pitch_deg_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.yaw_deg_) -
-    reinterpret_cast<char*>(&_impl_.pitch_deg_)) + sizeof(_impl_.yaw_deg_));
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+  if (from._internal_has_gimbal_result()) {
+    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
+  }
+  if (from._internal_has_control_result()) {
+    _this->_impl_.control_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.control_result_);
+  }
+  if (from._internal_has_mode_result()) {
+    _this->_impl_.mode_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.mode_result_);
+  }
+  if (from._internal_has_target_result()) {
+    _this->_impl_.target_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.target_result_);
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.ApplyGimbalStateResponse)
 }
 
-inline void SetPitchAndYawRequest::SharedCtor(
+inline void ApplyGimbalStateResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.pitch_deg_){0}
-    , decltype(_impl_.yaw_deg_){0}
+      decltype(_impl_.gimbal_result_){nullptr}
+    , decltype(_impl_.control_result_){nullptr}
+    , decltype(_impl_.mode_result_){nullptr}
+    , decltype(_impl_.target_result_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SetPitchAndYawRequest::~SetPitchAndYawRequest() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+ApplyGimbalStateResponse::~ApplyGimbalStateResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.ApplyGimbalStateResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -589,45 +9071,78 @@ SetPitchAndYawRequest::~SetPitchAndYawRequest() {
   SharedDtor();
 }
 
-inline void SetPitchAndYawRequest::SharedDtor() {
+inline void ApplyGimbalStateResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
+  if (this != internal_default_instance()) delete _impl_.control_result_;
+  if (this != internal_default_instance()) delete _impl_.mode_result_;
+  if (this != internal_default_instance()) delete _impl_.target_result_;
 }
 
-void SetPitchAndYawRequest::SetCachedSize(int size) const {
+void ApplyGimbalStateResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetPitchAndYawRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+void ApplyGimbalStateResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.ApplyGimbalStateResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.pitch_deg_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.yaw_deg_) -
-      reinterpret_cast<char*>(&_impl_.pitch_deg_)) + sizeof(_impl_.yaw_deg_));
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.control_result_ != nullptr) {
+    delete _impl_.control_result_;
+  }
+  _impl_.control_result_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.mode_result_ != nullptr) {
+    delete _impl_.mode_result_;
+  }
+  _impl_.mode_result_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.target_result_ != nullptr) {
+    delete _impl_.target_result_;
+  }
+  _impl_.target_result_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetPitchAndYawRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ApplyGimbalStateResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // float pitch_deg = 1;
+      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
-          _impl_.pitch_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // float yaw_deg = 2;
+      // .mavsdk.rpc.gimbal.GimbalResult control_result = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
-          _impl_.yaw_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_control_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.gimbal.GimbalResult mode_result = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_mode_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.gimbal.GimbalResult target_result = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_target_result(), ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -654,172 +9169,189 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetPitchAndYawRequest::_InternalSerialize(
+uint8_t* ApplyGimbalStateResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.ApplyGimbalStateResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float pitch_deg = 1;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_pitch_deg = this->_internal_pitch_deg();
-  uint32_t raw_pitch_deg;
-  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
-  if (raw_pitch_deg != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_pitch_deg(), target);
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::gimbal_result(this),
+        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
   }
 
-  // float yaw_deg = 2;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_yaw_deg = this->_internal_yaw_deg();
-  uint32_t raw_yaw_deg;
-  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
-  if (raw_yaw_deg != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_yaw_deg(), target);
+  // .mavsdk.rpc.gimbal.GimbalResult control_result = 2;
+  if (this->_internal_has_control_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::control_result(this),
+        _Internal::control_result(this).GetCachedSize(), target, stream);
+  }
+
+  // .mavsdk.rpc.gimbal.GimbalResult mode_result = 3;
+  if (this->_internal_has_mode_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::mode_result(this),
+        _Internal::mode_result(this).GetCachedSize(), target, stream);
+  }
+
+  // .mavsdk.rpc.gimbal.GimbalResult target_result = 4;
+  if (this->_internal_has_target_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::target_result(this),
+        _Internal::target_result(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.ApplyGimbalStateResponse)
   return target;
 }
 
-size_t SetPitchAndYawRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+size_t ApplyGimbalStateResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.ApplyGimbalStateResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // float pitch_deg = 1;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_pitch_deg = this->_internal_pitch_deg();
-  uint32_t raw_pitch_deg;
-  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
-  if (raw_pitch_deg != 0) {
-    total_size += 1 + 4;
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  if (this->_internal_has_gimbal_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.gimbal_result_);
   }
 
-  // float yaw_deg = 2;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_yaw_deg = this->_internal_yaw_deg();
-  uint32_t raw_yaw_deg;
-  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
-  if (raw_yaw_deg != 0) {
-    total_size += 1 + 4;
+  // .mavsdk.rpc.gimbal.GimbalResult control_result = 2;
+  if (this->_internal_has_control_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.control_result_);
+  }
+
+  // .mavsdk.rpc.gimbal.GimbalResult mode_result = 3;
+  if (this->_internal_has_mode_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.mode_result_);
+  }
+
+  // .mavsdk.rpc.gimbal.GimbalResult target_result = 4;
+  if (this->_internal_has_target_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.target_result_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetPitchAndYawRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ApplyGimbalStateResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetPitchAndYawRequest::MergeImpl
+    ApplyGimbalStateResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetPitchAndYawRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ApplyGimbalStateResponse::GetClassData() const { return &_class_data_; }
 
 
-void SetPitchAndYawRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetPitchAndYawRequest*>(&to_msg);
-  auto& from = static_cast<const SetPitchAndYawRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+void ApplyGimbalStateResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ApplyGimbalStateResponse*>(&to_msg);
+  auto& from = static_cast<const ApplyGimbalStateResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.ApplyGimbalStateResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_pitch_deg = from._internal_pitch_deg();
-  uint32_t raw_pitch_deg;
-  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
-  if (raw_pitch_deg != 0) {
-    _this->_internal_set_pitch_deg(from._internal_pitch_deg());
+  if (from._internal_has_gimbal_result()) {
+    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
+        from._internal_gimbal_result());
   }
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_yaw_deg = from._internal_yaw_deg();
-  uint32_t raw_yaw_deg;
-  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
-  if (raw_yaw_deg != 0) {
-    _this->_internal_set_yaw_deg(from._internal_yaw_deg());
+  if (from._internal_has_control_result()) {
+    _this->_internal_mutable_control_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
+        from._internal_control_result());
+  }
+  if (from._internal_has_mode_result()) {
+    _this->_internal_mutable_mode_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
+        from._internal_mode_result());
+  }
+  if (from._internal_has_target_result()) {
+    _this->_internal_mutable_target_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
+        from._internal_target_result());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetPitchAndYawRequest::CopyFrom(const SetPitchAndYawRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetPitchAndYawRequest)
+void ApplyGimbalStateResponse::CopyFrom(const ApplyGimbalStateResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.ApplyGimbalStateResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetPitchAndYawRequest::IsInitialized() const {
+bool ApplyGimbalStateResponse::IsInitialized() const {
   return true;
 }
 
-void SetPitchAndYawRequest::InternalSwap(SetPitchAndYawRequest* other) {
+void ApplyGimbalStateResponse::InternalSwap(ApplyGimbalStateResponse* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetPitchAndYawRequest, _impl_.yaw_deg_)
-      + sizeof(SetPitchAndYawRequest::_impl_.yaw_deg_)
-      - PROTOBUF_FIELD_OFFSET(SetPitchAndYawRequest, _impl_.pitch_deg_)>(
-          reinterpret_cast<char*>(&_impl_.pitch_deg_),
-          reinterpret_cast<char*>(&other->_impl_.pitch_deg_));
+      PROTOBUF_FIELD_OFFSET(ApplyGimbalStateResponse, _impl_.target_result_)
+      + sizeof(ApplyGimbalStateResponse::_impl_.target_result_)
+      - PROTOBUF_FIELD_OFFSET(ApplyGimbalStateResponse, _impl_.gimbal_result_)>(
+          reinterpret_cast<char*>(&_impl_.gimbal_result_),
+          reinterpret_cast<char*>(&other->_impl_.gimbal_result_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetPitchAndYawRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ApplyGimbalStateResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[0]);
+      file_level_metadata_gimbal_2eproto[32]);
 }
 
 // ===================================================================
 
-class SetPitchAndYawResponse::_Internal {
+class SetTracingRequest::_Internal {
  public:
-  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const SetPitchAndYawResponse* msg);
 };
 
-const ::mavsdk::rpc::gimbal::GimbalResult&
-SetPitchAndYawResponse::_Internal::gimbal_result(const SetPitchAndYawResponse* msg) {
-  return *msg->_impl_.gimbal_result_;
-}
-SetPitchAndYawResponse::SetPitchAndYawResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetTracingRequest::SetTracingRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetTracingRequest)
 }
-SetPitchAndYawResponse::SetPitchAndYawResponse(const SetPitchAndYawResponse& from)
+SetTracingRequest::SetTracingRequest(const SetTracingRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetPitchAndYawResponse* const _this = this; (void)_this;
+  SetTracingRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_result_){nullptr}
+      decltype(_impl_.enabled_){}
+    , decltype(_impl_.clear_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_gimbal_result()) {
-    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
-  }
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+  ::memcpy(&_impl_.enabled_, &from._impl_.enabled_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clear_) -
+    reinterpret_cast<char*>(&_impl_.enabled_)) + sizeof(_impl_.clear_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetTracingRequest)
 }
 
-inline void SetPitchAndYawResponse::SharedCtor(
+inline void SetTracingRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_result_){nullptr}
+      decltype(_impl_.enabled_){false}
+    , decltype(_impl_.clear_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SetPitchAndYawResponse::~SetPitchAndYawResponse() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+SetTracingRequest::~SetTracingRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetTracingRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -827,38 +9359,44 @@ SetPitchAndYawResponse::~SetPitchAndYawResponse() {
   SharedDtor();
 }
 
-inline void SetPitchAndYawResponse::SharedDtor() {
+inline void SetTracingRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
 }
 
-void SetPitchAndYawResponse::SetCachedSize(int size) const {
+void SetTracingRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetPitchAndYawResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+void SetTracingRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetTracingRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  _impl_.gimbal_result_ = nullptr;
+  ::memset(&_impl_.enabled_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.clear_) -
+      reinterpret_cast<char*>(&_impl_.enabled_)) + sizeof(_impl_.clear_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetPitchAndYawResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SetTracingRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      // bool enabled = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.enabled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool clear = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.clear_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -886,130 +9424,185 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetPitchAndYawResponse::_InternalSerialize(
+uint8_t* SetTracingRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetTracingRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-  if (this->_internal_has_gimbal_result()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::gimbal_result(this),
-        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  // bool enabled = 1;
+  if (this->_internal_enabled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_enabled(), target);
+  }
+
+  // bool clear = 2;
+  if (this->_internal_clear() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_clear(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetTracingRequest)
   return target;
 }
 
-size_t SetPitchAndYawResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+size_t SetTracingRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetTracingRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-  if (this->_internal_has_gimbal_result()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.gimbal_result_);
+  // bool enabled = 1;
+  if (this->_internal_enabled() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool clear = 2;
+  if (this->_internal_clear() != 0) {
+    total_size += 1 + 1;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetPitchAndYawResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetTracingRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetPitchAndYawResponse::MergeImpl
+    SetTracingRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetPitchAndYawResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetTracingRequest::GetClassData() const { return &_class_data_; }
 
 
-void SetPitchAndYawResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetPitchAndYawResponse*>(&to_msg);
-  auto& from = static_cast<const SetPitchAndYawResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+void SetTracingRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetTracingRequest*>(&to_msg);
+  auto& from = static_cast<const SetTracingRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetTracingRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_gimbal_result()) {
-    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
-        from._internal_gimbal_result());
+  if (from._internal_enabled() != 0) {
+    _this->_internal_set_enabled(from._internal_enabled());
+  }
+  if (from._internal_clear() != 0) {
+    _this->_internal_set_clear(from._internal_clear());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetPitchAndYawResponse::CopyFrom(const SetPitchAndYawResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetPitchAndYawResponse)
+void SetTracingRequest::CopyFrom(const SetTracingRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetTracingRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetPitchAndYawResponse::IsInitialized() const {
+bool SetTracingRequest::IsInitialized() const {
   return true;
 }
 
-void SetPitchAndYawResponse::InternalSwap(SetPitchAndYawResponse* other) {
+void SetTracingRequest::InternalSwap(SetTracingRequest* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetTracingRequest, _impl_.clear_)
+      + sizeof(SetTracingRequest::_impl_.clear_)
+      - PROTOBUF_FIELD_OFFSET(SetTracingRequest, _impl_.enabled_)>(
+          reinterpret_cast<char*>(&_impl_.enabled_),
+          reinterpret_cast<char*>(&other->_impl_.enabled_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetPitchAndYawResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetTracingRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[1]);
+      file_level_metadata_gimbal_2eproto[33]);
 }
 
 // ===================================================================
 
-class SetPitchRateAndYawRateRequest::_Internal {
+class SetTracingResponse::_Internal {
  public:
 };
 
-SetPitchRateAndYawRateRequest::SetPitchRateAndYawRateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetTracingResponse::SetTracingResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetTracingResponse)
+}
+SetTracingResponse::SetTracingResponse(const SetTracingResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  SetTracingResponse* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetTracingResponse)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetTracingResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetTracingResponse::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetTracingResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
+      file_level_metadata_gimbal_2eproto[34]);
+}
+
+// ===================================================================
+
+class GetTraceRequest::_Internal {
+ public:
+};
+
+GetTraceRequest::GetTraceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.GetTraceRequest)
 }
-SetPitchRateAndYawRateRequest::SetPitchRateAndYawRateRequest(const SetPitchRateAndYawRateRequest& from)
+GetTraceRequest::GetTraceRequest(const GetTraceRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetPitchRateAndYawRateRequest* const _this = this; (void)_this;
+  GetTraceRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.pitch_rate_deg_s_){}
-    , decltype(_impl_.yaw_rate_deg_s_){}
+      decltype(_impl_.format_){}
+    , decltype(_impl_.clear_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.pitch_rate_deg_s_, &from._impl_.pitch_rate_deg_s_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.yaw_rate_deg_s_) -
-    reinterpret_cast<char*>(&_impl_.pitch_rate_deg_s_)) + sizeof(_impl_.yaw_rate_deg_s_));
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+  ::memcpy(&_impl_.format_, &from._impl_.format_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.clear_) -
+    reinterpret_cast<char*>(&_impl_.format_)) + sizeof(_impl_.clear_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.GetTraceRequest)
 }
 
-inline void SetPitchRateAndYawRateRequest::SharedCtor(
+inline void GetTraceRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.pitch_rate_deg_s_){0}
-    , decltype(_impl_.yaw_rate_deg_s_){0}
+      decltype(_impl_.format_){0}
+    , decltype(_impl_.clear_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SetPitchRateAndYawRateRequest::~SetPitchRateAndYawRateRequest() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+GetTraceRequest::~GetTraceRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.GetTraceRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1017,45 +9610,46 @@ SetPitchRateAndYawRateRequest::~SetPitchRateAndYawRateRequest() {
   SharedDtor();
 }
 
-inline void SetPitchRateAndYawRateRequest::SharedDtor() {
+inline void GetTraceRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void SetPitchRateAndYawRateRequest::SetCachedSize(int size) const {
+void GetTraceRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetPitchRateAndYawRateRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+void GetTraceRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.GetTraceRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.pitch_rate_deg_s_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.yaw_rate_deg_s_) -
-      reinterpret_cast<char*>(&_impl_.pitch_rate_deg_s_)) + sizeof(_impl_.yaw_rate_deg_s_));
+  ::memset(&_impl_.format_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.clear_) -
+      reinterpret_cast<char*>(&_impl_.format_)) + sizeof(_impl_.clear_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetPitchRateAndYawRateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* GetTraceRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // float pitch_rate_deg_s = 1;
+      // .mavsdk.rpc.gimbal.TraceFormat format = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
-          _impl_.pitch_rate_deg_s_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_format(static_cast<::mavsdk::rpc::gimbal::TraceFormat>(val));
         } else
           goto handle_unusual;
         continue;
-      // float yaw_rate_deg_s = 2;
+      // bool clear = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
-          _impl_.yaw_rate_deg_s_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.clear_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -1082,172 +9676,161 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetPitchRateAndYawRateRequest::_InternalSerialize(
+uint8_t* GetTraceRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.GetTraceRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // float pitch_rate_deg_s = 1;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_pitch_rate_deg_s = this->_internal_pitch_rate_deg_s();
-  uint32_t raw_pitch_rate_deg_s;
-  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
-  if (raw_pitch_rate_deg_s != 0) {
+  // .mavsdk.rpc.gimbal.TraceFormat format = 1;
+  if (this->_internal_format() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_pitch_rate_deg_s(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_format(), target);
   }
 
-  // float yaw_rate_deg_s = 2;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_yaw_rate_deg_s = this->_internal_yaw_rate_deg_s();
-  uint32_t raw_yaw_rate_deg_s;
-  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
-  if (raw_yaw_rate_deg_s != 0) {
+  // bool clear = 2;
+  if (this->_internal_clear() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_yaw_rate_deg_s(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_clear(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.GetTraceRequest)
   return target;
 }
 
-size_t SetPitchRateAndYawRateRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+size_t GetTraceRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.GetTraceRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // float pitch_rate_deg_s = 1;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_pitch_rate_deg_s = this->_internal_pitch_rate_deg_s();
-  uint32_t raw_pitch_rate_deg_s;
-  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
-  if (raw_pitch_rate_deg_s != 0) {
-    total_size += 1 + 4;
+  // .mavsdk.rpc.gimbal.TraceFormat format = 1;
+  if (this->_internal_format() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_format());
   }
 
-  // float yaw_rate_deg_s = 2;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_yaw_rate_deg_s = this->_internal_yaw_rate_deg_s();
-  uint32_t raw_yaw_rate_deg_s;
-  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
-  if (raw_yaw_rate_deg_s != 0) {
-    total_size += 1 + 4;
+  // bool clear = 2;
+  if (this->_internal_clear() != 0) {
+    total_size += 1 + 1;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetPitchRateAndYawRateRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetTraceRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetPitchRateAndYawRateRequest::MergeImpl
+    GetTraceRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetPitchRateAndYawRateRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetTraceRequest::GetClassData() const { return &_class_data_; }
 
 
-void SetPitchRateAndYawRateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetPitchRateAndYawRateRequest*>(&to_msg);
-  auto& from = static_cast<const SetPitchRateAndYawRateRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+void GetTraceRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetTraceRequest*>(&to_msg);
+  auto& from = static_cast<const GetTraceRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.GetTraceRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_pitch_rate_deg_s = from._internal_pitch_rate_deg_s();
-  uint32_t raw_pitch_rate_deg_s;
-  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
-  if (raw_pitch_rate_deg_s != 0) {
-    _this->_internal_set_pitch_rate_deg_s(from._internal_pitch_rate_deg_s());
+  if (from._internal_format() != 0) {
+    _this->_internal_set_format(from._internal_format());
   }
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_yaw_rate_deg_s = from._internal_yaw_rate_deg_s();
-  uint32_t raw_yaw_rate_deg_s;
-  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
-  if (raw_yaw_rate_deg_s != 0) {
-    _this->_internal_set_yaw_rate_deg_s(from._internal_yaw_rate_deg_s());
+  if (from._internal_clear() != 0) {
+    _this->_internal_set_clear(from._internal_clear());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetPitchRateAndYawRateRequest::CopyFrom(const SetPitchRateAndYawRateRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest)
+void GetTraceRequest::CopyFrom(const GetTraceRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.GetTraceRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetPitchRateAndYawRateRequest::IsInitialized() const {
+bool GetTraceRequest::IsInitialized() const {
   return true;
 }
 
-void SetPitchRateAndYawRateRequest::InternalSwap(SetPitchRateAndYawRateRequest* other) {
+void GetTraceRequest::InternalSwap(GetTraceRequest* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetPitchRateAndYawRateRequest, _impl_.yaw_rate_deg_s_)
-      + sizeof(SetPitchRateAndYawRateRequest::_impl_.yaw_rate_deg_s_)
-      - PROTOBUF_FIELD_OFFSET(SetPitchRateAndYawRateRequest, _impl_.pitch_rate_deg_s_)>(
-          reinterpret_cast<char*>(&_impl_.pitch_rate_deg_s_),
-          reinterpret_cast<char*>(&other->_impl_.pitch_rate_deg_s_));
+      PROTOBUF_FIELD_OFFSET(GetTraceRequest, _impl_.clear_)
+      + sizeof(GetTraceRequest::_impl_.clear_)
+      - PROTOBUF_FIELD_OFFSET(GetTraceRequest, _impl_.format_)>(
+          reinterpret_cast<char*>(&_impl_.format_),
+          reinterpret_cast<char*>(&other->_impl_.format_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetPitchRateAndYawRateRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetTraceRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[2]);
+      file_level_metadata_gimbal_2eproto[35]);
 }
 
 // ===================================================================
 
-class SetPitchRateAndYawRateResponse::_Internal {
+class GetTraceResponse::_Internal {
  public:
-  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const SetPitchRateAndYawRateResponse* msg);
 };
 
-const ::mavsdk::rpc::gimbal::GimbalResult&
-SetPitchRateAndYawRateResponse::_Internal::gimbal_result(const SetPitchRateAndYawRateResponse* msg) {
-  return *msg->_impl_.gimbal_result_;
-}
-SetPitchRateAndYawRateResponse::SetPitchRateAndYawRateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+GetTraceResponse::GetTraceResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.GetTraceResponse)
 }
-SetPitchRateAndYawRateResponse::SetPitchRateAndYawRateResponse(const SetPitchRateAndYawRateResponse& from)
+GetTraceResponse::GetTraceResponse(const GetTraceResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetPitchRateAndYawRateResponse* const _this = this; (void)_this;
+  GetTraceResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_result_){nullptr}
+      decltype(_impl_.trace_){}
+    , decltype(_impl_.spans_){}
+    , decltype(_impl_.overwritten_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_gimbal_result()) {
-    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
+  _impl_.trace_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.trace_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_trace().empty()) {
+    _this->_impl_.trace_.Set(from._internal_trace(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+  ::memcpy(&_impl_.spans_, &from._impl_.spans_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.overwritten_) -
+    reinterpret_cast<char*>(&_impl_.spans_)) + sizeof(_impl_.overwritten_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.GetTraceResponse)
 }
 
-inline void SetPitchRateAndYawRateResponse::SharedCtor(
+inline void GetTraceResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_result_){nullptr}
+      decltype(_impl_.trace_){}
+    , decltype(_impl_.spans_){uint64_t{0u}}
+    , decltype(_impl_.overwritten_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.trace_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.trace_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SetPitchRateAndYawRateResponse::~SetPitchRateAndYawRateResponse() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+GetTraceResponse::~GetTraceResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.GetTraceResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1255,38 +9838,55 @@ SetPitchRateAndYawRateResponse::~SetPitchRateAndYawRateResponse() {
   SharedDtor();
 }
 
-inline void SetPitchRateAndYawRateResponse::SharedDtor() {
+inline void GetTraceResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
+  _impl_.trace_.Destroy();
 }
 
-void SetPitchRateAndYawRateResponse::SetCachedSize(int size) const {
+void GetTraceResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetPitchRateAndYawRateResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+void GetTraceResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.GetTraceResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  _impl_.gimbal_result_ = nullptr;
+  _impl_.trace_.ClearToEmpty();
+  ::memset(&_impl_.spans_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.overwritten_) -
+      reinterpret_cast<char*>(&_impl_.spans_)) + sizeof(_impl_.overwritten_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetPitchRateAndYawRateResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* GetTraceResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      // bytes trace = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+          auto str = _internal_mutable_trace();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 spans = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.spans_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 overwritten = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.overwritten_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1314,126 +9914,173 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetPitchRateAndYawRateResponse::_InternalSerialize(
+uint8_t* GetTraceResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.GetTraceResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-  if (this->_internal_has_gimbal_result()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::gimbal_result(this),
-        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  // bytes trace = 1;
+  if (!this->_internal_trace().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_trace(), target);
+  }
+
+  // uint64 spans = 2;
+  if (this->_internal_spans() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_spans(), target);
+  }
+
+  // uint64 overwritten = 3;
+  if (this->_internal_overwritten() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_overwritten(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.GetTraceResponse)
   return target;
 }
 
-size_t SetPitchRateAndYawRateResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+size_t GetTraceResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.GetTraceResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-  if (this->_internal_has_gimbal_result()) {
+  // bytes trace = 1;
+  if (!this->_internal_trace().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.gimbal_result_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_trace());
+  }
+
+  // uint64 spans = 2;
+  if (this->_internal_spans() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_spans());
+  }
+
+  // uint64 overwritten = 3;
+  if (this->_internal_overwritten() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_overwritten());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetPitchRateAndYawRateResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetTraceResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetPitchRateAndYawRateResponse::MergeImpl
+    GetTraceResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetPitchRateAndYawRateResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetTraceResponse::GetClassData() const { return &_class_data_; }
 
 
-void SetPitchRateAndYawRateResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetPitchRateAndYawRateResponse*>(&to_msg);
-  auto& from = static_cast<const SetPitchRateAndYawRateResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+void GetTraceResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetTraceResponse*>(&to_msg);
+  auto& from = static_cast<const GetTraceResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.GetTraceResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_gimbal_result()) {
-    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
-        from._internal_gimbal_result());
+  if (!from._internal_trace().empty()) {
+    _this->_internal_set_trace(from._internal_trace());
+  }
+  if (from._internal_spans() != 0) {
+    _this->_internal_set_spans(from._internal_spans());
+  }
+  if (from._internal_overwritten() != 0) {
+    _this->_internal_set_overwritten(from._internal_overwritten());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetPitchRateAndYawRateResponse::CopyFrom(const SetPitchRateAndYawRateResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse)
+void GetTraceResponse::CopyFrom(const GetTraceResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.GetTraceResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetPitchRateAndYawRateResponse::IsInitialized() const {
+bool GetTraceResponse::IsInitialized() const {
   return true;
 }
 
-void SetPitchRateAndYawRateResponse::InternalSwap(SetPitchRateAndYawRateResponse* other) {
+void GetTraceResponse::InternalSwap(GetTraceResponse* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.trace_, lhs_arena,
+      &other->_impl_.trace_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetTraceResponse, _impl_.overwritten_)
+      + sizeof(GetTraceResponse::_impl_.overwritten_)
+      - PROTOBUF_FIELD_OFFSET(GetTraceResponse, _impl_.spans_)>(
+          reinterpret_cast<char*>(&_impl_.spans_),
+          reinterpret_cast<char*>(&other->_impl_.spans_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetPitchRateAndYawRateResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetTraceResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[3]);
+      file_level_metadata_gimbal_2eproto[36]);
 }
 
 // ===================================================================
 
-class SetModeRequest::_Internal {
+class ControlStatus::_Internal {
  public:
 };
 
-SetModeRequest::SetModeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ControlStatus::ControlStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetModeRequest)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.ControlStatus)
 }
-SetModeRequest::SetModeRequest(const SetModeRequest& from)
+ControlStatus::ControlStatus(const ControlStatus& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetModeRequest* const _this = this; (void)_this;
+  ControlStatus* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_mode_){}
+      decltype(_impl_.control_mode_){}
+    , decltype(_impl_.sysid_primary_control_){}
+    , decltype(_impl_.compid_primary_control_){}
+    , decltype(_impl_.sysid_secondary_control_){}
+    , decltype(_impl_.compid_secondary_control_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.gimbal_mode_ = from._impl_.gimbal_mode_;
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetModeRequest)
+  ::memcpy(&_impl_.control_mode_, &from._impl_.control_mode_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compid_secondary_control_) -
+    reinterpret_cast<char*>(&_impl_.control_mode_)) + sizeof(_impl_.compid_secondary_control_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.ControlStatus)
 }
 
-inline void SetModeRequest::SharedCtor(
+inline void ControlStatus::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_mode_){0}
+      decltype(_impl_.control_mode_){0}
+    , decltype(_impl_.sysid_primary_control_){0}
+    , decltype(_impl_.compid_primary_control_){0}
+    , decltype(_impl_.sysid_secondary_control_){0}
+    , decltype(_impl_.compid_secondary_control_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SetModeRequest::~SetModeRequest() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetModeRequest)
+ControlStatus::~ControlStatus() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.ControlStatus)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1441,36 +10088,70 @@ SetModeRequest::~SetModeRequest() {
   SharedDtor();
 }
 
-inline void SetModeRequest::SharedDtor() {
+inline void ControlStatus::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void SetModeRequest::SetCachedSize(int size) const {
+void ControlStatus::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetModeRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetModeRequest)
+void ControlStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.ControlStatus)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.gimbal_mode_ = 0;
+  ::memset(&_impl_.control_mode_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.compid_secondary_control_) -
+      reinterpret_cast<char*>(&_impl_.control_mode_)) + sizeof(_impl_.compid_secondary_control_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetModeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ControlStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .mavsdk.rpc.gimbal.GimbalMode gimbal_mode = 1;
+      // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
           uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          _internal_set_gimbal_mode(static_cast<::mavsdk::rpc::gimbal::GimbalMode>(val));
+          _internal_set_control_mode(static_cast<::mavsdk::rpc::gimbal::ControlMode>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 sysid_primary_control = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.sysid_primary_control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 compid_primary_control = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.compid_primary_control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 sysid_secondary_control = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.sysid_secondary_control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 compid_secondary_control = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.compid_secondary_control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -1497,131 +10178,189 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetModeRequest::_InternalSerialize(
+uint8_t* ControlStatus::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetModeRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.ControlStatus)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalMode gimbal_mode = 1;
-  if (this->_internal_gimbal_mode() != 0) {
+  // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
+  if (this->_internal_control_mode() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_control_mode(), target);
+  }
+
+  // int32 sysid_primary_control = 2;
+  if (this->_internal_sysid_primary_control() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_sysid_primary_control(), target);
+  }
+
+  // int32 compid_primary_control = 3;
+  if (this->_internal_compid_primary_control() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_compid_primary_control(), target);
+  }
+
+  // int32 sysid_secondary_control = 4;
+  if (this->_internal_sysid_secondary_control() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_gimbal_mode(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_sysid_secondary_control(), target);
+  }
+
+  // int32 compid_secondary_control = 5;
+  if (this->_internal_compid_secondary_control() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_compid_secondary_control(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetModeRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.ControlStatus)
   return target;
 }
 
-size_t SetModeRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetModeRequest)
+size_t ControlStatus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.ControlStatus)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalMode gimbal_mode = 1;
-  if (this->_internal_gimbal_mode() != 0) {
+  // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
+  if (this->_internal_control_mode() != 0) {
     total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_gimbal_mode());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_control_mode());
+  }
+
+  // int32 sysid_primary_control = 2;
+  if (this->_internal_sysid_primary_control() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sysid_primary_control());
+  }
+
+  // int32 compid_primary_control = 3;
+  if (this->_internal_compid_primary_control() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_compid_primary_control());
+  }
+
+  // int32 sysid_secondary_control = 4;
+  if (this->_internal_sysid_secondary_control() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sysid_secondary_control());
+  }
+
+  // int32 compid_secondary_control = 5;
+  if (this->_internal_compid_secondary_control() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_compid_secondary_control());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetModeRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlStatus::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetModeRequest::MergeImpl
+    ControlStatus::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetModeRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlStatus::GetClassData() const { return &_class_data_; }
 
 
-void SetModeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetModeRequest*>(&to_msg);
-  auto& from = static_cast<const SetModeRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetModeRequest)
+void ControlStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ControlStatus*>(&to_msg);
+  auto& from = static_cast<const ControlStatus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.ControlStatus)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_gimbal_mode() != 0) {
-    _this->_internal_set_gimbal_mode(from._internal_gimbal_mode());
+  if (from._internal_control_mode() != 0) {
+    _this->_internal_set_control_mode(from._internal_control_mode());
+  }
+  if (from._internal_sysid_primary_control() != 0) {
+    _this->_internal_set_sysid_primary_control(from._internal_sysid_primary_control());
+  }
+  if (from._internal_compid_primary_control() != 0) {
+    _this->_internal_set_compid_primary_control(from._internal_compid_primary_control());
+  }
+  if (from._internal_sysid_secondary_control() != 0) {
+    _this->_internal_set_sysid_secondary_control(from._internal_sysid_secondary_control());
+  }
+  if (from._internal_compid_secondary_control() != 0) {
+    _this->_internal_set_compid_secondary_control(from._internal_compid_secondary_control());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetModeRequest::CopyFrom(const SetModeRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetModeRequest)
+void ControlStatus::CopyFrom(const ControlStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.ControlStatus)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetModeRequest::IsInitialized() const {
+bool ControlStatus::IsInitialized() const {
   return true;
 }
 
-void SetModeRequest::InternalSwap(SetModeRequest* other) {
+void ControlStatus::InternalSwap(ControlStatus* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.gimbal_mode_, other->_impl_.gimbal_mode_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ControlStatus, _impl_.compid_secondary_control_)
+      + sizeof(ControlStatus::_impl_.compid_secondary_control_)
+      - PROTOBUF_FIELD_OFFSET(ControlStatus, _impl_.control_mode_)>(
+          reinterpret_cast<char*>(&_impl_.control_mode_),
+          reinterpret_cast<char*>(&other->_impl_.control_mode_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetModeRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ControlStatus::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[4]);
+      file_level_metadata_gimbal_2eproto[37]);
 }
 
 // ===================================================================
 
-class SetModeResponse::_Internal {
+class TelemetryRate::_Internal {
  public:
-  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const SetModeResponse* msg);
 };
 
-const ::mavsdk::rpc::gimbal::GimbalResult&
-SetModeResponse::_Internal::gimbal_result(const SetModeResponse* msg) {
-  return *msg->_impl_.gimbal_result_;
-}
-SetModeResponse::SetModeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+TelemetryRate::TelemetryRate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetModeResponse)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.TelemetryRate)
 }
-SetModeResponse::SetModeResponse(const SetModeResponse& from)
+TelemetryRate::TelemetryRate(const TelemetryRate& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetModeResponse* const _this = this; (void)_this;
+  TelemetryRate* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_result_){nullptr}
+      decltype(_impl_.rate_hz_){}
+    , decltype(_impl_.stream_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_gimbal_result()) {
-    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
-  }
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetModeResponse)
+  ::memcpy(&_impl_.rate_hz_, &from._impl_.rate_hz_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.stream_) -
+    reinterpret_cast<char*>(&_impl_.rate_hz_)) + sizeof(_impl_.stream_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.TelemetryRate)
 }
 
-inline void SetModeResponse::SharedCtor(
+inline void TelemetryRate::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_result_){nullptr}
+      decltype(_impl_.rate_hz_){0}
+    , decltype(_impl_.stream_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SetModeResponse::~SetModeResponse() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetModeResponse)
+TelemetryRate::~TelemetryRate() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.TelemetryRate)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1629,39 +10368,46 @@ SetModeResponse::~SetModeResponse() {
   SharedDtor();
 }
 
-inline void SetModeResponse::SharedDtor() {
+inline void TelemetryRate::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
 }
 
-void SetModeResponse::SetCachedSize(int size) const {
+void TelemetryRate::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetModeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetModeResponse)
+void TelemetryRate::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.TelemetryRate)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  _impl_.gimbal_result_ = nullptr;
+  ::memset(&_impl_.rate_hz_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.stream_) -
+      reinterpret_cast<char*>(&_impl_.rate_hz_)) + sizeof(_impl_.stream_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetModeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* TelemetryRate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      // .mavsdk.rpc.gimbal.TelemetryStream stream = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_stream(static_cast<::mavsdk::rpc::gimbal::TelemetryStream>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // double rate_hz = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.rate_hz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
@@ -1688,132 +10434,156 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetModeResponse::_InternalSerialize(
+uint8_t* TelemetryRate::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetModeResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.TelemetryRate)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-  if (this->_internal_has_gimbal_result()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::gimbal_result(this),
-        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  // .mavsdk.rpc.gimbal.TelemetryStream stream = 1;
+  if (this->_internal_stream() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_stream(), target);
+  }
+
+  // double rate_hz = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate_hz = this->_internal_rate_hz();
+  uint64_t raw_rate_hz;
+  memcpy(&raw_rate_hz, &tmp_rate_hz, sizeof(tmp_rate_hz));
+  if (raw_rate_hz != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_rate_hz(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetModeResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.TelemetryRate)
   return target;
 }
 
-size_t SetModeResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetModeResponse)
+size_t TelemetryRate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.TelemetryRate)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-  if (this->_internal_has_gimbal_result()) {
+  // double rate_hz = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate_hz = this->_internal_rate_hz();
+  uint64_t raw_rate_hz;
+  memcpy(&raw_rate_hz, &tmp_rate_hz, sizeof(tmp_rate_hz));
+  if (raw_rate_hz != 0) {
+    total_size += 1 + 8;
+  }
+
+  // .mavsdk.rpc.gimbal.TelemetryStream stream = 1;
+  if (this->_internal_stream() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.gimbal_result_);
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_stream());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetModeResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TelemetryRate::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetModeResponse::MergeImpl
+    TelemetryRate::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetModeResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TelemetryRate::GetClassData() const { return &_class_data_; }
 
 
-void SetModeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetModeResponse*>(&to_msg);
-  auto& from = static_cast<const SetModeResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetModeResponse)
+void TelemetryRate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TelemetryRate*>(&to_msg);
+  auto& from = static_cast<const TelemetryRate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.TelemetryRate)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_gimbal_result()) {
-    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
-        from._internal_gimbal_result());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_rate_hz = from._internal_rate_hz();
+  uint64_t raw_rate_hz;
+  memcpy(&raw_rate_hz, &tmp_rate_hz, sizeof(tmp_rate_hz));
+  if (raw_rate_hz != 0) {
+    _this->_internal_set_rate_hz(from._internal_rate_hz());
+  }
+  if (from._internal_stream() != 0) {
+    _this->_internal_set_stream(from._internal_stream());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetModeResponse::CopyFrom(const SetModeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetModeResponse)
+void TelemetryRate::CopyFrom(const TelemetryRate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.TelemetryRate)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetModeResponse::IsInitialized() const {
+bool TelemetryRate::IsInitialized() const {
   return true;
 }
 
-void SetModeResponse::InternalSwap(SetModeResponse* other) {
+void TelemetryRate::InternalSwap(TelemetryRate* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TelemetryRate, _impl_.stream_)
+      + sizeof(TelemetryRate::_impl_.stream_)
+      - PROTOBUF_FIELD_OFFSET(TelemetryRate, _impl_.rate_hz_)>(
+          reinterpret_cast<char*>(&_impl_.rate_hz_),
+          reinterpret_cast<char*>(&other->_impl_.rate_hz_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetModeResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TelemetryRate::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[5]);
+      file_level_metadata_gimbal_2eproto[38]);
 }
 
 // ===================================================================
 
-class SetRoiLocationRequest::_Internal {
+class MavlinkFilter::_Internal {
  public:
 };
 
-SetRoiLocationRequest::SetRoiLocationRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+MavlinkFilter::MavlinkFilter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.MavlinkFilter)
 }
-SetRoiLocationRequest::SetRoiLocationRequest(const SetRoiLocationRequest& from)
+MavlinkFilter::MavlinkFilter(const MavlinkFilter& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetRoiLocationRequest* const _this = this; (void)_this;
+  MavlinkFilter* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.latitude_deg_){}
-    , decltype(_impl_.longitude_deg_){}
-    , decltype(_impl_.altitude_m_){}
+      decltype(_impl_.message_ids_){from._impl_.message_ids_}
+    , /*decltype(_impl_._message_ids_cached_byte_size_)*/{0}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.latitude_deg_, &from._impl_.latitude_deg_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.altitude_m_) -
-    reinterpret_cast<char*>(&_impl_.latitude_deg_)) + sizeof(_impl_.altitude_m_));
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.MavlinkFilter)
 }
 
-inline void SetRoiLocationRequest::SharedCtor(
+inline void MavlinkFilter::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.latitude_deg_){0}
-    , decltype(_impl_.longitude_deg_){0}
-    , decltype(_impl_.altitude_m_){0}
+      decltype(_impl_.message_ids_){arena}
+    , /*decltype(_impl_._message_ids_cached_byte_size_)*/{0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SetRoiLocationRequest::~SetRoiLocationRequest() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+MavlinkFilter::~MavlinkFilter() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.MavlinkFilter)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1821,53 +10591,39 @@ SetRoiLocationRequest::~SetRoiLocationRequest() {
   SharedDtor();
 }
 
-inline void SetRoiLocationRequest::SharedDtor() {
+inline void MavlinkFilter::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_ids_.~RepeatedField();
 }
 
-void SetRoiLocationRequest::SetCachedSize(int size) const {
+void MavlinkFilter::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetRoiLocationRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+void MavlinkFilter::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.MavlinkFilter)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.latitude_deg_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.altitude_m_) -
-      reinterpret_cast<char*>(&_impl_.latitude_deg_)) + sizeof(_impl_.altitude_m_));
+  _impl_.message_ids_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetRoiLocationRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* MavlinkFilter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // double latitude_deg = 1;
+      // repeated uint32 message_ids = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
-          _impl_.latitude_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // double longitude_deg = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
-          _impl_.longitude_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // float altitude_m = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
-          _impl_.altitude_m_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
-          ptr += sizeof(float);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_message_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_message_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -1891,201 +10647,155 @@ message_done:
 failure:
   ptr = nullptr;
   goto message_done;
-#undef CHK_
-}
-
-uint8_t* SetRoiLocationRequest::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetRoiLocationRequest)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // double latitude_deg = 1;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_latitude_deg = this->_internal_latitude_deg();
-  uint64_t raw_latitude_deg;
-  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
-  if (raw_latitude_deg != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_latitude_deg(), target);
-  }
-
-  // double longitude_deg = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_longitude_deg = this->_internal_longitude_deg();
-  uint64_t raw_longitude_deg;
-  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
-  if (raw_longitude_deg != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_longitude_deg(), target);
-  }
+#undef CHK_
+}
 
-  // float altitude_m = 3;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_altitude_m = this->_internal_altitude_m();
-  uint32_t raw_altitude_m;
-  memcpy(&raw_altitude_m, &tmp_altitude_m, sizeof(tmp_altitude_m));
-  if (raw_altitude_m != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_altitude_m(), target);
+uint8_t* MavlinkFilter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.MavlinkFilter)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 message_ids = 1;
+  {
+    int byte_size = _impl_._message_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_message_ids(), byte_size, target);
+    }
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.MavlinkFilter)
   return target;
 }
 
-size_t SetRoiLocationRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+size_t MavlinkFilter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.MavlinkFilter)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // double latitude_deg = 1;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_latitude_deg = this->_internal_latitude_deg();
-  uint64_t raw_latitude_deg;
-  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
-  if (raw_latitude_deg != 0) {
-    total_size += 1 + 8;
-  }
-
-  // double longitude_deg = 2;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_longitude_deg = this->_internal_longitude_deg();
-  uint64_t raw_longitude_deg;
-  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
-  if (raw_longitude_deg != 0) {
-    total_size += 1 + 8;
-  }
-
-  // float altitude_m = 3;
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_altitude_m = this->_internal_altitude_m();
-  uint32_t raw_altitude_m;
-  memcpy(&raw_altitude_m, &tmp_altitude_m, sizeof(tmp_altitude_m));
-  if (raw_altitude_m != 0) {
-    total_size += 1 + 4;
+  // repeated uint32 message_ids = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.message_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._message_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetRoiLocationRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MavlinkFilter::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetRoiLocationRequest::MergeImpl
+    MavlinkFilter::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetRoiLocationRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MavlinkFilter::GetClassData() const { return &_class_data_; }
 
 
-void SetRoiLocationRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetRoiLocationRequest*>(&to_msg);
-  auto& from = static_cast<const SetRoiLocationRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+void MavlinkFilter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MavlinkFilter*>(&to_msg);
+  auto& from = static_cast<const MavlinkFilter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.MavlinkFilter)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_latitude_deg = from._internal_latitude_deg();
-  uint64_t raw_latitude_deg;
-  memcpy(&raw_latitude_deg, &tmp_latitude_deg, sizeof(tmp_latitude_deg));
-  if (raw_latitude_deg != 0) {
-    _this->_internal_set_latitude_deg(from._internal_latitude_deg());
-  }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_longitude_deg = from._internal_longitude_deg();
-  uint64_t raw_longitude_deg;
-  memcpy(&raw_longitude_deg, &tmp_longitude_deg, sizeof(tmp_longitude_deg));
-  if (raw_longitude_deg != 0) {
-    _this->_internal_set_longitude_deg(from._internal_longitude_deg());
-  }
-  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
-  float tmp_altitude_m = from._internal_altitude_m();
-  uint32_t raw_altitude_m;
-  memcpy(&raw_altitude_m, &tmp_altitude_m, sizeof(tmp_altitude_m));
-  if (raw_altitude_m != 0) {
-    _this->_internal_set_altitude_m(from._internal_altitude_m());
-  }
+  _this->_impl_.message_ids_.MergeFrom(from._impl_.message_ids_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetRoiLocationRequest::CopyFrom(const SetRoiLocationRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetRoiLocationRequest)
+void MavlinkFilter::CopyFrom(const MavlinkFilter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.MavlinkFilter)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetRoiLocationRequest::IsInitialized() const {
+bool MavlinkFilter::IsInitialized() const {
   return true;
 }
 
-void SetRoiLocationRequest::InternalSwap(SetRoiLocationRequest* other) {
+void MavlinkFilter::InternalSwap(MavlinkFilter* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetRoiLocationRequest, _impl_.altitude_m_)
-      + sizeof(SetRoiLocationRequest::_impl_.altitude_m_)
-      - PROTOBUF_FIELD_OFFSET(SetRoiLocationRequest, _impl_.latitude_deg_)>(
-          reinterpret_cast<char*>(&_impl_.latitude_deg_),
-          reinterpret_cast<char*>(&other->_impl_.latitude_deg_));
+  _impl_.message_ids_.InternalSwap(&other->_impl_.message_ids_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetRoiLocationRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata MavlinkFilter::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[6]);
+      file_level_metadata_gimbal_2eproto[39]);
 }
 
 // ===================================================================
 
-class SetRoiLocationResponse::_Internal {
+class AttitudeBatch::_Internal {
  public:
-  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const SetRoiLocationResponse* msg);
 };
 
-const ::mavsdk::rpc::gimbal::GimbalResult&
-SetRoiLocationResponse::_Internal::gimbal_result(const SetRoiLocationResponse* msg) {
-  return *msg->_impl_.gimbal_result_;
-}
-SetRoiLocationResponse::SetRoiLocationResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+AttitudeBatch::AttitudeBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.AttitudeBatch)
 }
-SetRoiLocationResponse::SetRoiLocationResponse(const SetRoiLocationResponse& from)
+AttitudeBatch::AttitudeBatch(const AttitudeBatch& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetRoiLocationResponse* const _this = this; (void)_this;
+  AttitudeBatch* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_result_){nullptr}
+      decltype(_impl_.time_delta_ms_){from._impl_.time_delta_ms_}
+    , /*decltype(_impl_._time_delta_ms_cached_byte_size_)*/{0}
+    , decltype(_impl_.roll_cdeg_){from._impl_.roll_cdeg_}
+    , /*decltype(_impl_._roll_cdeg_cached_byte_size_)*/{0}
+    , decltype(_impl_.pitch_cdeg_){from._impl_.pitch_cdeg_}
+    , /*decltype(_impl_._pitch_cdeg_cached_byte_size_)*/{0}
+    , decltype(_impl_.yaw_cdeg_){from._impl_.yaw_cdeg_}
+    , /*decltype(_impl_._yaw_cdeg_cached_byte_size_)*/{0}
+    , decltype(_impl_.base_timestamp_ms_){}
+    , decltype(_impl_.base_wall_time_ms_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_gimbal_result()) {
-    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
-  }
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+  ::memcpy(&_impl_.base_timestamp_ms_, &from._impl_.base_timestamp_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.base_wall_time_ms_) -
+    reinterpret_cast<char*>(&_impl_.base_timestamp_ms_)) + sizeof(_impl_.base_wall_time_ms_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.AttitudeBatch)
 }
 
-inline void SetRoiLocationResponse::SharedCtor(
+inline void AttitudeBatch::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_result_){nullptr}
+      decltype(_impl_.time_delta_ms_){arena}
+    , /*decltype(_impl_._time_delta_ms_cached_byte_size_)*/{0}
+    , decltype(_impl_.roll_cdeg_){arena}
+    , /*decltype(_impl_._roll_cdeg_cached_byte_size_)*/{0}
+    , decltype(_impl_.pitch_cdeg_){arena}
+    , /*decltype(_impl_._pitch_cdeg_cached_byte_size_)*/{0}
+    , decltype(_impl_.yaw_cdeg_){arena}
+    , /*decltype(_impl_._yaw_cdeg_cached_byte_size_)*/{0}
+    , decltype(_impl_.base_timestamp_ms_){uint64_t{0u}}
+    , decltype(_impl_.base_wall_time_ms_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-SetRoiLocationResponse::~SetRoiLocationResponse() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+AttitudeBatch::~AttitudeBatch() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.AttitudeBatch)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2093,38 +10803,96 @@ SetRoiLocationResponse::~SetRoiLocationResponse() {
   SharedDtor();
 }
 
-inline void SetRoiLocationResponse::SharedDtor() {
+inline void AttitudeBatch::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
+  _impl_.time_delta_ms_.~RepeatedField();
+  _impl_.roll_cdeg_.~RepeatedField();
+  _impl_.pitch_cdeg_.~RepeatedField();
+  _impl_.yaw_cdeg_.~RepeatedField();
 }
 
-void SetRoiLocationResponse::SetCachedSize(int size) const {
+void AttitudeBatch::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetRoiLocationResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+void AttitudeBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.AttitudeBatch)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  _impl_.gimbal_result_ = nullptr;
+  _impl_.time_delta_ms_.Clear();
+  _impl_.roll_cdeg_.Clear();
+  _impl_.pitch_cdeg_.Clear();
+  _impl_.yaw_cdeg_.Clear();
+  ::memset(&_impl_.base_timestamp_ms_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.base_wall_time_ms_) -
+      reinterpret_cast<char*>(&_impl_.base_timestamp_ms_)) + sizeof(_impl_.base_wall_time_ms_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetRoiLocationResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* AttitudeBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      // uint64 base_timestamp_ms = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.base_timestamp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 time_delta_ms = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_time_delta_ms(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_time_delta_ms(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 roll_cdeg = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_roll_cdeg(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_roll_cdeg(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 pitch_cdeg = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_pitch_cdeg(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_pitch_cdeg(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 yaw_cdeg = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_yaw_cdeg(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_yaw_cdeg(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 base_wall_time_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.base_wall_time_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -2152,126 +10920,259 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetRoiLocationResponse::_InternalSerialize(
+uint8_t* AttitudeBatch::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.AttitudeBatch)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-  if (this->_internal_has_gimbal_result()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::gimbal_result(this),
-        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  // uint64 base_timestamp_ms = 1;
+  if (this->_internal_base_timestamp_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_base_timestamp_ms(), target);
+  }
+
+  // repeated sint32 time_delta_ms = 2;
+  {
+    int byte_size = _impl_._time_delta_ms_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          2, _internal_time_delta_ms(), byte_size, target);
+    }
+  }
+
+  // repeated sint32 roll_cdeg = 3;
+  {
+    int byte_size = _impl_._roll_cdeg_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          3, _internal_roll_cdeg(), byte_size, target);
+    }
+  }
+
+  // repeated sint32 pitch_cdeg = 4;
+  {
+    int byte_size = _impl_._pitch_cdeg_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          4, _internal_pitch_cdeg(), byte_size, target);
+    }
+  }
+
+  // repeated sint32 yaw_cdeg = 5;
+  {
+    int byte_size = _impl_._yaw_cdeg_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          5, _internal_yaw_cdeg(), byte_size, target);
+    }
+  }
+
+  // uint64 base_wall_time_ms = 6;
+  if (this->_internal_base_wall_time_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_base_wall_time_ms(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.AttitudeBatch)
   return target;
 }
 
-size_t SetRoiLocationResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+size_t AttitudeBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.AttitudeBatch)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-  if (this->_internal_has_gimbal_result()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.gimbal_result_);
+  // repeated sint32 time_delta_ms = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.time_delta_ms_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._time_delta_ms_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint32 roll_cdeg = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.roll_cdeg_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._roll_cdeg_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint32 pitch_cdeg = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.pitch_cdeg_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._pitch_cdeg_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint32 yaw_cdeg = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.yaw_cdeg_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._yaw_cdeg_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint64 base_timestamp_ms = 1;
+  if (this->_internal_base_timestamp_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_base_timestamp_ms());
+  }
+
+  // uint64 base_wall_time_ms = 6;
+  if (this->_internal_base_wall_time_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_base_wall_time_ms());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetRoiLocationResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AttitudeBatch::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetRoiLocationResponse::MergeImpl
+    AttitudeBatch::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetRoiLocationResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AttitudeBatch::GetClassData() const { return &_class_data_; }
 
 
-void SetRoiLocationResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetRoiLocationResponse*>(&to_msg);
-  auto& from = static_cast<const SetRoiLocationResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+void AttitudeBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AttitudeBatch*>(&to_msg);
+  auto& from = static_cast<const AttitudeBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.AttitudeBatch)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_gimbal_result()) {
-    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
-        from._internal_gimbal_result());
+  _this->_impl_.time_delta_ms_.MergeFrom(from._impl_.time_delta_ms_);
+  _this->_impl_.roll_cdeg_.MergeFrom(from._impl_.roll_cdeg_);
+  _this->_impl_.pitch_cdeg_.MergeFrom(from._impl_.pitch_cdeg_);
+  _this->_impl_.yaw_cdeg_.MergeFrom(from._impl_.yaw_cdeg_);
+  if (from._internal_base_timestamp_ms() != 0) {
+    _this->_internal_set_base_timestamp_ms(from._internal_base_timestamp_ms());
+  }
+  if (from._internal_base_wall_time_ms() != 0) {
+    _this->_internal_set_base_wall_time_ms(from._internal_base_wall_time_ms());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetRoiLocationResponse::CopyFrom(const SetRoiLocationResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetRoiLocationResponse)
+void AttitudeBatch::CopyFrom(const AttitudeBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.AttitudeBatch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetRoiLocationResponse::IsInitialized() const {
+bool AttitudeBatch::IsInitialized() const {
   return true;
 }
 
-void SetRoiLocationResponse::InternalSwap(SetRoiLocationResponse* other) {
+void AttitudeBatch::InternalSwap(AttitudeBatch* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
+  _impl_.time_delta_ms_.InternalSwap(&other->_impl_.time_delta_ms_);
+  _impl_.roll_cdeg_.InternalSwap(&other->_impl_.roll_cdeg_);
+  _impl_.pitch_cdeg_.InternalSwap(&other->_impl_.pitch_cdeg_);
+  _impl_.yaw_cdeg_.InternalSwap(&other->_impl_.yaw_cdeg_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AttitudeBatch, _impl_.base_wall_time_ms_)
+      + sizeof(AttitudeBatch::_impl_.base_wall_time_ms_)
+      - PROTOBUF_FIELD_OFFSET(AttitudeBatch, _impl_.base_timestamp_ms_)>(
+          reinterpret_cast<char*>(&_impl_.base_timestamp_ms_),
+          reinterpret_cast<char*>(&other->_impl_.base_timestamp_ms_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetRoiLocationResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata AttitudeBatch::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[7]);
+      file_level_metadata_gimbal_2eproto[40]);
 }
 
 // ===================================================================
 
-class TakeControlRequest::_Internal {
+class Setpoint::_Internal {
  public:
 };
 
-TakeControlRequest::TakeControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Setpoint::Setpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.TakeControlRequest)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.Setpoint)
 }
-TakeControlRequest::TakeControlRequest(const TakeControlRequest& from)
+Setpoint::Setpoint(const Setpoint& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  TakeControlRequest* const _this = this; (void)_this;
+  Setpoint* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.control_mode_){}
+      decltype(_impl_.sequence_){}
+    , decltype(_impl_.mode_){}
+    , decltype(_impl_.pitch_deg_){}
+    , decltype(_impl_.yaw_deg_){}
+    , decltype(_impl_.pitch_rate_deg_s_){}
+    , decltype(_impl_.apply_time_ns_){}
+    , decltype(_impl_.yaw_rate_deg_s_){}
+    , decltype(_impl_.jitter_buffered_){}
+    , decltype(_impl_.sample_time_us_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.control_mode_ = from._impl_.control_mode_;
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.TakeControlRequest)
+  ::memcpy(&_impl_.sequence_, &from._impl_.sequence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sample_time_us_) -
+    reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.sample_time_us_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.Setpoint)
 }
 
-inline void TakeControlRequest::SharedCtor(
+inline void Setpoint::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.control_mode_){0}
+      decltype(_impl_.sequence_){uint64_t{0u}}
+    , decltype(_impl_.mode_){0}
+    , decltype(_impl_.pitch_deg_){0}
+    , decltype(_impl_.yaw_deg_){0}
+    , decltype(_impl_.pitch_rate_deg_s_){0}
+    , decltype(_impl_.apply_time_ns_){uint64_t{0u}}
+    , decltype(_impl_.yaw_rate_deg_s_){0}
+    , decltype(_impl_.jitter_buffered_){false}
+    , decltype(_impl_.sample_time_us_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-TakeControlRequest::~TakeControlRequest() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.TakeControlRequest)
+Setpoint::~Setpoint() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.Setpoint)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2279,36 +11180,102 @@ TakeControlRequest::~TakeControlRequest() {
   SharedDtor();
 }
 
-inline void TakeControlRequest::SharedDtor() {
+inline void Setpoint::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void TakeControlRequest::SetCachedSize(int size) const {
+void Setpoint::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void TakeControlRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.TakeControlRequest)
+void Setpoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.Setpoint)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.control_mode_ = 0;
+  ::memset(&_impl_.sequence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.sample_time_us_) -
+      reinterpret_cast<char*>(&_impl_.sequence_)) + sizeof(_impl_.sample_time_us_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TakeControlRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Setpoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
+      // uint64 sequence = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.gimbal.SetpointMode mode = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
           uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          _internal_set_control_mode(static_cast<::mavsdk::rpc::gimbal::ControlMode>(val));
+          _internal_set_mode(static_cast<::mavsdk::rpc::gimbal::SetpointMode>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // float pitch_deg = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.pitch_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float yaw_deg = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.yaw_deg_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float pitch_rate_deg_s = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _impl_.pitch_rate_deg_s_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float yaw_rate_deg_s = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _impl_.yaw_rate_deg_s_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 apply_time_ns = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.apply_time_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool jitter_buffered = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.jitter_buffered_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sample_time_us = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.sample_time_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -2335,131 +11302,299 @@ failure:
 #undef CHK_
 }
 
-uint8_t* TakeControlRequest::_InternalSerialize(
+uint8_t* Setpoint::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.TakeControlRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.Setpoint)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
-  if (this->_internal_control_mode() != 0) {
+  // uint64 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sequence(), target);
+  }
+
+  // .mavsdk.rpc.gimbal.SetpointMode mode = 2;
+  if (this->_internal_mode() != 0) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_control_mode(), target);
+      2, this->_internal_mode(), target);
+  }
+
+  // float pitch_deg = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = this->_internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_pitch_deg(), target);
+  }
+
+  // float yaw_deg = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = this->_internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_yaw_deg(), target);
+  }
+
+  // float pitch_rate_deg_s = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_rate_deg_s = this->_internal_pitch_rate_deg_s();
+  uint32_t raw_pitch_rate_deg_s;
+  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
+  if (raw_pitch_rate_deg_s != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_pitch_rate_deg_s(), target);
+  }
+
+  // float yaw_rate_deg_s = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_rate_deg_s = this->_internal_yaw_rate_deg_s();
+  uint32_t raw_yaw_rate_deg_s;
+  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
+  if (raw_yaw_rate_deg_s != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_yaw_rate_deg_s(), target);
+  }
+
+  // uint64 apply_time_ns = 7;
+  if (this->_internal_apply_time_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_apply_time_ns(), target);
+  }
+
+  // bool jitter_buffered = 8;
+  if (this->_internal_jitter_buffered() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_jitter_buffered(), target);
+  }
+
+  // uint64 sample_time_us = 9;
+  if (this->_internal_sample_time_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_sample_time_us(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.TakeControlRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.Setpoint)
   return target;
 }
 
-size_t TakeControlRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.TakeControlRequest)
+size_t Setpoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.Setpoint)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
-  if (this->_internal_control_mode() != 0) {
+  // uint64 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+  }
+
+  // .mavsdk.rpc.gimbal.SetpointMode mode = 2;
+  if (this->_internal_mode() != 0) {
     total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_control_mode());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_mode());
+  }
+
+  // float pitch_deg = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = this->_internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float yaw_deg = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = this->_internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float pitch_rate_deg_s = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_rate_deg_s = this->_internal_pitch_rate_deg_s();
+  uint32_t raw_pitch_rate_deg_s;
+  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
+  if (raw_pitch_rate_deg_s != 0) {
+    total_size += 1 + 4;
+  }
+
+  // uint64 apply_time_ns = 7;
+  if (this->_internal_apply_time_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_apply_time_ns());
+  }
+
+  // float yaw_rate_deg_s = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_rate_deg_s = this->_internal_yaw_rate_deg_s();
+  uint32_t raw_yaw_rate_deg_s;
+  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
+  if (raw_yaw_rate_deg_s != 0) {
+    total_size += 1 + 4;
+  }
+
+  // bool jitter_buffered = 8;
+  if (this->_internal_jitter_buffered() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 sample_time_us = 9;
+  if (this->_internal_sample_time_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sample_time_us());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TakeControlRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Setpoint::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    TakeControlRequest::MergeImpl
+    Setpoint::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TakeControlRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Setpoint::GetClassData() const { return &_class_data_; }
 
 
-void TakeControlRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<TakeControlRequest*>(&to_msg);
-  auto& from = static_cast<const TakeControlRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.TakeControlRequest)
+void Setpoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Setpoint*>(&to_msg);
+  auto& from = static_cast<const Setpoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.Setpoint)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_control_mode() != 0) {
-    _this->_internal_set_control_mode(from._internal_control_mode());
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  if (from._internal_mode() != 0) {
+    _this->_internal_set_mode(from._internal_mode());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_deg = from._internal_pitch_deg();
+  uint32_t raw_pitch_deg;
+  memcpy(&raw_pitch_deg, &tmp_pitch_deg, sizeof(tmp_pitch_deg));
+  if (raw_pitch_deg != 0) {
+    _this->_internal_set_pitch_deg(from._internal_pitch_deg());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_deg = from._internal_yaw_deg();
+  uint32_t raw_yaw_deg;
+  memcpy(&raw_yaw_deg, &tmp_yaw_deg, sizeof(tmp_yaw_deg));
+  if (raw_yaw_deg != 0) {
+    _this->_internal_set_yaw_deg(from._internal_yaw_deg());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pitch_rate_deg_s = from._internal_pitch_rate_deg_s();
+  uint32_t raw_pitch_rate_deg_s;
+  memcpy(&raw_pitch_rate_deg_s, &tmp_pitch_rate_deg_s, sizeof(tmp_pitch_rate_deg_s));
+  if (raw_pitch_rate_deg_s != 0) {
+    _this->_internal_set_pitch_rate_deg_s(from._internal_pitch_rate_deg_s());
+  }
+  if (from._internal_apply_time_ns() != 0) {
+    _this->_internal_set_apply_time_ns(from._internal_apply_time_ns());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_yaw_rate_deg_s = from._internal_yaw_rate_deg_s();
+  uint32_t raw_yaw_rate_deg_s;
+  memcpy(&raw_yaw_rate_deg_s, &tmp_yaw_rate_deg_s, sizeof(tmp_yaw_rate_deg_s));
+  if (raw_yaw_rate_deg_s != 0) {
+    _this->_internal_set_yaw_rate_deg_s(from._internal_yaw_rate_deg_s());
+  }
+  if (from._internal_jitter_buffered() != 0) {
+    _this->_internal_set_jitter_buffered(from._internal_jitter_buffered());
+  }
+  if (from._internal_sample_time_us() != 0) {
+    _this->_internal_set_sample_time_us(from._internal_sample_time_us());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void TakeControlRequest::CopyFrom(const TakeControlRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.TakeControlRequest)
+void Setpoint::CopyFrom(const Setpoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.Setpoint)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TakeControlRequest::IsInitialized() const {
+bool Setpoint::IsInitialized() const {
   return true;
 }
 
-void TakeControlRequest::InternalSwap(TakeControlRequest* other) {
+void Setpoint::InternalSwap(Setpoint* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.control_mode_, other->_impl_.control_mode_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Setpoint, _impl_.sample_time_us_)
+      + sizeof(Setpoint::_impl_.sample_time_us_)
+      - PROTOBUF_FIELD_OFFSET(Setpoint, _impl_.sequence_)>(
+          reinterpret_cast<char*>(&_impl_.sequence_),
+          reinterpret_cast<char*>(&other->_impl_.sequence_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TakeControlRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata Setpoint::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[8]);
+      file_level_metadata_gimbal_2eproto[41]);
 }
 
 // ===================================================================
 
-class TakeControlResponse::_Internal {
+class SetpointAck::_Internal {
  public:
-  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const TakeControlResponse* msg);
+  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const SetpointAck* msg);
 };
 
 const ::mavsdk::rpc::gimbal::GimbalResult&
-TakeControlResponse::_Internal::gimbal_result(const TakeControlResponse* msg) {
+SetpointAck::_Internal::gimbal_result(const SetpointAck* msg) {
   return *msg->_impl_.gimbal_result_;
 }
-TakeControlResponse::TakeControlResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetpointAck::SetpointAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.TakeControlResponse)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SetpointAck)
 }
-TakeControlResponse::TakeControlResponse(const TakeControlResponse& from)
+SetpointAck::SetpointAck(const SetpointAck& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  TakeControlResponse* const _this = this; (void)_this;
+  SetpointAck* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.gimbal_result_){nullptr}
+    , decltype(_impl_.sequence_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_gimbal_result()) {
     _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
   }
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.TakeControlResponse)
+  _this->_impl_.sequence_ = from._impl_.sequence_;
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SetpointAck)
 }
 
-inline void TakeControlResponse::SharedCtor(
+inline void SetpointAck::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.gimbal_result_){nullptr}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-TakeControlResponse::~TakeControlResponse() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.TakeControlResponse)
+SetpointAck::~SetpointAck() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.SetpointAck)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2467,17 +11602,17 @@ TakeControlResponse::~TakeControlResponse() {
   SharedDtor();
 }
 
-inline void TakeControlResponse::SharedDtor() {
+inline void SetpointAck::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (this != internal_default_instance()) delete _impl_.gimbal_result_;
 }
 
-void TakeControlResponse::SetCachedSize(int size) const {
+void SetpointAck::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void TakeControlResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.TakeControlResponse)
+void SetpointAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.SetpointAck)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -2486,18 +11621,27 @@ void TakeControlResponse::Clear() {
     delete _impl_.gimbal_result_;
   }
   _impl_.gimbal_result_ = nullptr;
+  _impl_.sequence_ = uint64_t{0u};
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TakeControlResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SetpointAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      // uint64 sequence = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
           CHK_(ptr);
         } else
@@ -2526,16 +11670,22 @@ failure:
 #undef CHK_
 }
 
-uint8_t* TakeControlResponse::_InternalSerialize(
+uint8_t* SetpointAck::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.TakeControlResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.SetpointAck)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  // uint64 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_sequence(), target);
+  }
+
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 2;
   if (this->_internal_has_gimbal_result()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::gimbal_result(this),
+      InternalWriteMessage(2, _Internal::gimbal_result(this),
         _Internal::gimbal_result(this).GetCachedSize(), target, stream);
   }
 
@@ -2543,39 +11693,44 @@ uint8_t* TakeControlResponse::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.TakeControlResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.SetpointAck)
   return target;
 }
 
-size_t TakeControlResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.TakeControlResponse)
+size_t SetpointAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.SetpointAck)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 2;
   if (this->_internal_has_gimbal_result()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
         *_impl_.gimbal_result_);
   }
 
+  // uint64 sequence = 1;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TakeControlResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetpointAck::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    TakeControlResponse::MergeImpl
+    SetpointAck::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TakeControlResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetpointAck::GetClassData() const { return &_class_data_; }
 
 
-void TakeControlResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<TakeControlResponse*>(&to_msg);
-  auto& from = static_cast<const TakeControlResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.TakeControlResponse)
+void SetpointAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetpointAck*>(&to_msg);
+  auto& from = static_cast<const SetpointAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.SetpointAck)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -2584,115 +11739,86 @@ void TakeControlResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
     _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
         from._internal_gimbal_result());
   }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void TakeControlResponse::CopyFrom(const TakeControlResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.TakeControlResponse)
+void SetpointAck::CopyFrom(const SetpointAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.SetpointAck)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TakeControlResponse::IsInitialized() const {
+bool SetpointAck::IsInitialized() const {
   return true;
-}
-
-void TakeControlResponse::InternalSwap(TakeControlResponse* other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata TakeControlResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[9]);
-}
-
-// ===================================================================
-
-class ReleaseControlRequest::_Internal {
- public:
-};
-
-ReleaseControlRequest::ReleaseControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.ReleaseControlRequest)
-}
-ReleaseControlRequest::ReleaseControlRequest(const ReleaseControlRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  ReleaseControlRequest* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.ReleaseControlRequest)
-}
-
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReleaseControlRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReleaseControlRequest::GetClassData() const { return &_class_data_; }
-
-
-
-
-
+}
 
+void SetpointAck::InternalSwap(SetpointAck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetpointAck, _impl_.sequence_)
+      + sizeof(SetpointAck::_impl_.sequence_)
+      - PROTOBUF_FIELD_OFFSET(SetpointAck, _impl_.gimbal_result_)>(
+          reinterpret_cast<char*>(&_impl_.gimbal_result_),
+          reinterpret_cast<char*>(&other->_impl_.gimbal_result_));
+}
 
-::PROTOBUF_NAMESPACE_ID::Metadata ReleaseControlRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetpointAck::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[10]);
+      file_level_metadata_gimbal_2eproto[42]);
 }
 
 // ===================================================================
 
-class ReleaseControlResponse::_Internal {
+class ServoGains::_Internal {
  public:
-  static const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result(const ReleaseControlResponse* msg);
 };
 
-const ::mavsdk::rpc::gimbal::GimbalResult&
-ReleaseControlResponse::_Internal::gimbal_result(const ReleaseControlResponse* msg) {
-  return *msg->_impl_.gimbal_result_;
-}
-ReleaseControlResponse::ReleaseControlResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ServoGains::ServoGains(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.ReleaseControlResponse)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.ServoGains)
 }
-ReleaseControlResponse::ReleaseControlResponse(const ReleaseControlResponse& from)
+ServoGains::ServoGains(const ServoGains& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ReleaseControlResponse* const _this = this; (void)_this;
+  ServoGains* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_result_){nullptr}
+      decltype(_impl_.kp_){}
+    , decltype(_impl_.ki_){}
+    , decltype(_impl_.kd_){}
+    , decltype(_impl_.kff_){}
+    , decltype(_impl_.max_rate_deg_s_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_gimbal_result()) {
-    _this->_impl_.gimbal_result_ = new ::mavsdk::rpc::gimbal::GimbalResult(*from._impl_.gimbal_result_);
-  }
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.ReleaseControlResponse)
+  ::memcpy(&_impl_.kp_, &from._impl_.kp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_rate_deg_s_) -
+    reinterpret_cast<char*>(&_impl_.kp_)) + sizeof(_impl_.max_rate_deg_s_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.ServoGains)
 }
 
-inline void ReleaseControlResponse::SharedCtor(
+inline void ServoGains::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.gimbal_result_){nullptr}
+      decltype(_impl_.kp_){0}
+    , decltype(_impl_.ki_){0}
+    , decltype(_impl_.kd_){0}
+    , decltype(_impl_.kff_){0}
+    , decltype(_impl_.max_rate_deg_s_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ReleaseControlResponse::~ReleaseControlResponse() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.ReleaseControlResponse)
+ServoGains::~ServoGains() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.ServoGains)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2700,39 +11826,69 @@ ReleaseControlResponse::~ReleaseControlResponse() {
   SharedDtor();
 }
 
-inline void ReleaseControlResponse::SharedDtor() {
+inline void ServoGains::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.gimbal_result_;
 }
 
-void ReleaseControlResponse::SetCachedSize(int size) const {
+void ServoGains::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ReleaseControlResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.ReleaseControlResponse)
+void ServoGains::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.ServoGains)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  _impl_.gimbal_result_ = nullptr;
+  ::memset(&_impl_.kp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_rate_deg_s_) -
+      reinterpret_cast<char*>(&_impl_.kp_)) + sizeof(_impl_.max_rate_deg_s_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ReleaseControlResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ServoGains::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+      // float kp = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_gimbal_result(), ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.kp_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float ki = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.ki_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float kd = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.kd_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float kff = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.kff_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float max_rate_deg_s = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _impl_.max_rate_deg_s_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
         } else
           goto handle_unusual;
         continue;
@@ -2759,173 +11915,253 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ReleaseControlResponse::_InternalSerialize(
+uint8_t* ServoGains::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.ReleaseControlResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.ServoGains)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-  if (this->_internal_has_gimbal_result()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::gimbal_result(this),
-        _Internal::gimbal_result(this).GetCachedSize(), target, stream);
+  // float kp = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_kp = this->_internal_kp();
+  uint32_t raw_kp;
+  memcpy(&raw_kp, &tmp_kp, sizeof(tmp_kp));
+  if (raw_kp != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_kp(), target);
+  }
+
+  // float ki = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ki = this->_internal_ki();
+  uint32_t raw_ki;
+  memcpy(&raw_ki, &tmp_ki, sizeof(tmp_ki));
+  if (raw_ki != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_ki(), target);
+  }
+
+  // float kd = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_kd = this->_internal_kd();
+  uint32_t raw_kd;
+  memcpy(&raw_kd, &tmp_kd, sizeof(tmp_kd));
+  if (raw_kd != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_kd(), target);
+  }
+
+  // float kff = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_kff = this->_internal_kff();
+  uint32_t raw_kff;
+  memcpy(&raw_kff, &tmp_kff, sizeof(tmp_kff));
+  if (raw_kff != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_kff(), target);
+  }
+
+  // float max_rate_deg_s = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_rate_deg_s = this->_internal_max_rate_deg_s();
+  uint32_t raw_max_rate_deg_s;
+  memcpy(&raw_max_rate_deg_s, &tmp_max_rate_deg_s, sizeof(tmp_max_rate_deg_s));
+  if (raw_max_rate_deg_s != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_max_rate_deg_s(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.ReleaseControlResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.ServoGains)
   return target;
 }
 
-size_t ReleaseControlResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.ReleaseControlResponse)
+size_t ServoGains::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.ServoGains)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-  if (this->_internal_has_gimbal_result()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.gimbal_result_);
+  // float kp = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_kp = this->_internal_kp();
+  uint32_t raw_kp;
+  memcpy(&raw_kp, &tmp_kp, sizeof(tmp_kp));
+  if (raw_kp != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float ki = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ki = this->_internal_ki();
+  uint32_t raw_ki;
+  memcpy(&raw_ki, &tmp_ki, sizeof(tmp_ki));
+  if (raw_ki != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float kd = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_kd = this->_internal_kd();
+  uint32_t raw_kd;
+  memcpy(&raw_kd, &tmp_kd, sizeof(tmp_kd));
+  if (raw_kd != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float kff = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_kff = this->_internal_kff();
+  uint32_t raw_kff;
+  memcpy(&raw_kff, &tmp_kff, sizeof(tmp_kff));
+  if (raw_kff != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float max_rate_deg_s = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_rate_deg_s = this->_internal_max_rate_deg_s();
+  uint32_t raw_max_rate_deg_s;
+  memcpy(&raw_max_rate_deg_s, &tmp_max_rate_deg_s, sizeof(tmp_max_rate_deg_s));
+  if (raw_max_rate_deg_s != 0) {
+    total_size += 1 + 4;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReleaseControlResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServoGains::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ReleaseControlResponse::MergeImpl
+    ServoGains::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReleaseControlResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServoGains::GetClassData() const { return &_class_data_; }
 
 
-void ReleaseControlResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ReleaseControlResponse*>(&to_msg);
-  auto& from = static_cast<const ReleaseControlResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.ReleaseControlResponse)
+void ServoGains::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServoGains*>(&to_msg);
+  auto& from = static_cast<const ServoGains&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.ServoGains)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_gimbal_result()) {
-    _this->_internal_mutable_gimbal_result()->::mavsdk::rpc::gimbal::GimbalResult::MergeFrom(
-        from._internal_gimbal_result());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_kp = from._internal_kp();
+  uint32_t raw_kp;
+  memcpy(&raw_kp, &tmp_kp, sizeof(tmp_kp));
+  if (raw_kp != 0) {
+    _this->_internal_set_kp(from._internal_kp());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ki = from._internal_ki();
+  uint32_t raw_ki;
+  memcpy(&raw_ki, &tmp_ki, sizeof(tmp_ki));
+  if (raw_ki != 0) {
+    _this->_internal_set_ki(from._internal_ki());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_kd = from._internal_kd();
+  uint32_t raw_kd;
+  memcpy(&raw_kd, &tmp_kd, sizeof(tmp_kd));
+  if (raw_kd != 0) {
+    _this->_internal_set_kd(from._internal_kd());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_kff = from._internal_kff();
+  uint32_t raw_kff;
+  memcpy(&raw_kff, &tmp_kff, sizeof(tmp_kff));
+  if (raw_kff != 0) {
+    _this->_internal_set_kff(from._internal_kff());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_rate_deg_s = from._internal_max_rate_deg_s();
+  uint32_t raw_max_rate_deg_s;
+  memcpy(&raw_max_rate_deg_s, &tmp_max_rate_deg_s, sizeof(tmp_max_rate_deg_s));
+  if (raw_max_rate_deg_s != 0) {
+    _this->_internal_set_max_rate_deg_s(from._internal_max_rate_deg_s());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ReleaseControlResponse::CopyFrom(const ReleaseControlResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.ReleaseControlResponse)
+void ServoGains::CopyFrom(const ServoGains& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.ServoGains)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReleaseControlResponse::IsInitialized() const {
+bool ServoGains::IsInitialized() const {
   return true;
 }
 
-void ReleaseControlResponse::InternalSwap(ReleaseControlResponse* other) {
+void ServoGains::InternalSwap(ServoGains* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.gimbal_result_, other->_impl_.gimbal_result_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata ReleaseControlResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[11]);
-}
-
-// ===================================================================
-
-class SubscribeControlRequest::_Internal {
- public:
-};
-
-SubscribeControlRequest::SubscribeControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.SubscribeControlRequest)
-}
-SubscribeControlRequest::SubscribeControlRequest(const SubscribeControlRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  SubscribeControlRequest* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.SubscribeControlRequest)
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServoGains, _impl_.max_rate_deg_s_)
+      + sizeof(ServoGains::_impl_.max_rate_deg_s_)
+      - PROTOBUF_FIELD_OFFSET(ServoGains, _impl_.kp_)>(
+          reinterpret_cast<char*>(&_impl_.kp_),
+          reinterpret_cast<char*>(&other->_impl_.kp_));
 }
 
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubscribeControlRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubscribeControlRequest::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata SubscribeControlRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ServoGains::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[12]);
+      file_level_metadata_gimbal_2eproto[43]);
 }
 
 // ===================================================================
 
-class ControlResponse::_Internal {
+class MotionProfile::_Internal {
  public:
-  static const ::mavsdk::rpc::gimbal::ControlStatus& control_status(const ControlResponse* msg);
 };
 
-const ::mavsdk::rpc::gimbal::ControlStatus&
-ControlResponse::_Internal::control_status(const ControlResponse* msg) {
-  return *msg->_impl_.control_status_;
-}
-ControlResponse::ControlResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+MotionProfile::MotionProfile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.ControlResponse)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.MotionProfile)
 }
-ControlResponse::ControlResponse(const ControlResponse& from)
+MotionProfile::MotionProfile(const MotionProfile& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ControlResponse* const _this = this; (void)_this;
+  MotionProfile* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.control_status_){nullptr}
+      decltype(_impl_.shape_){}
+    , decltype(_impl_.max_velocity_deg_s_){}
+    , decltype(_impl_.max_acceleration_deg_s2_){}
+    , decltype(_impl_.max_jerk_deg_s3_){}
+    , decltype(_impl_.rate_hz_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_control_status()) {
-    _this->_impl_.control_status_ = new ::mavsdk::rpc::gimbal::ControlStatus(*from._impl_.control_status_);
-  }
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.ControlResponse)
+  ::memcpy(&_impl_.shape_, &from._impl_.shape_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.rate_hz_) -
+    reinterpret_cast<char*>(&_impl_.shape_)) + sizeof(_impl_.rate_hz_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.MotionProfile)
 }
 
-inline void ControlResponse::SharedCtor(
+inline void MotionProfile::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.control_status_){nullptr}
+      decltype(_impl_.shape_){0}
+    , decltype(_impl_.max_velocity_deg_s_){0}
+    , decltype(_impl_.max_acceleration_deg_s2_){0}
+    , decltype(_impl_.max_jerk_deg_s3_){0}
+    , decltype(_impl_.rate_hz_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-ControlResponse::~ControlResponse() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.ControlResponse)
+MotionProfile::~MotionProfile() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.MotionProfile)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2933,39 +12169,70 @@ ControlResponse::~ControlResponse() {
   SharedDtor();
 }
 
-inline void ControlResponse::SharedDtor() {
+inline void MotionProfile::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.control_status_;
 }
 
-void ControlResponse::SetCachedSize(int size) const {
+void MotionProfile::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ControlResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.ControlResponse)
+void MotionProfile::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.MotionProfile)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.control_status_ != nullptr) {
-    delete _impl_.control_status_;
-  }
-  _impl_.control_status_ = nullptr;
+  ::memset(&_impl_.shape_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.rate_hz_) -
+      reinterpret_cast<char*>(&_impl_.shape_)) + sizeof(_impl_.rate_hz_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ControlResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* MotionProfile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .mavsdk.rpc.gimbal.ControlStatus control_status = 1;
+      // .mavsdk.rpc.gimbal.ProfileShape shape = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_control_status(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_shape(static_cast<::mavsdk::rpc::gimbal::ProfileShape>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // float max_velocity_deg_s = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.max_velocity_deg_s_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float max_acceleration_deg_s2 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.max_acceleration_deg_s2_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float max_jerk_deg_s3 = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.max_jerk_deg_s3_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float rate_hz = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _impl_.rate_hz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
         } else
           goto handle_unusual;
         continue;
@@ -2992,136 +12259,247 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ControlResponse::_InternalSerialize(
+uint8_t* MotionProfile::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.ControlResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.MotionProfile)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.ControlStatus control_status = 1;
-  if (this->_internal_has_control_status()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::control_status(this),
-        _Internal::control_status(this).GetCachedSize(), target, stream);
+  // .mavsdk.rpc.gimbal.ProfileShape shape = 1;
+  if (this->_internal_shape() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_shape(), target);
+  }
+
+  // float max_velocity_deg_s = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_velocity_deg_s = this->_internal_max_velocity_deg_s();
+  uint32_t raw_max_velocity_deg_s;
+  memcpy(&raw_max_velocity_deg_s, &tmp_max_velocity_deg_s, sizeof(tmp_max_velocity_deg_s));
+  if (raw_max_velocity_deg_s != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_max_velocity_deg_s(), target);
+  }
+
+  // float max_acceleration_deg_s2 = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_acceleration_deg_s2 = this->_internal_max_acceleration_deg_s2();
+  uint32_t raw_max_acceleration_deg_s2;
+  memcpy(&raw_max_acceleration_deg_s2, &tmp_max_acceleration_deg_s2, sizeof(tmp_max_acceleration_deg_s2));
+  if (raw_max_acceleration_deg_s2 != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_max_acceleration_deg_s2(), target);
+  }
+
+  // float max_jerk_deg_s3 = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_jerk_deg_s3 = this->_internal_max_jerk_deg_s3();
+  uint32_t raw_max_jerk_deg_s3;
+  memcpy(&raw_max_jerk_deg_s3, &tmp_max_jerk_deg_s3, sizeof(tmp_max_jerk_deg_s3));
+  if (raw_max_jerk_deg_s3 != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_max_jerk_deg_s3(), target);
+  }
+
+  // float rate_hz = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rate_hz = this->_internal_rate_hz();
+  uint32_t raw_rate_hz;
+  memcpy(&raw_rate_hz, &tmp_rate_hz, sizeof(tmp_rate_hz));
+  if (raw_rate_hz != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_rate_hz(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.ControlResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.MotionProfile)
   return target;
 }
 
-size_t ControlResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.ControlResponse)
+size_t MotionProfile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.MotionProfile)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.ControlStatus control_status = 1;
-  if (this->_internal_has_control_status()) {
+  // .mavsdk.rpc.gimbal.ProfileShape shape = 1;
+  if (this->_internal_shape() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.control_status_);
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_shape());
+  }
+
+  // float max_velocity_deg_s = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_velocity_deg_s = this->_internal_max_velocity_deg_s();
+  uint32_t raw_max_velocity_deg_s;
+  memcpy(&raw_max_velocity_deg_s, &tmp_max_velocity_deg_s, sizeof(tmp_max_velocity_deg_s));
+  if (raw_max_velocity_deg_s != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float max_acceleration_deg_s2 = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_acceleration_deg_s2 = this->_internal_max_acceleration_deg_s2();
+  uint32_t raw_max_acceleration_deg_s2;
+  memcpy(&raw_max_acceleration_deg_s2, &tmp_max_acceleration_deg_s2, sizeof(tmp_max_acceleration_deg_s2));
+  if (raw_max_acceleration_deg_s2 != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float max_jerk_deg_s3 = 4;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_jerk_deg_s3 = this->_internal_max_jerk_deg_s3();
+  uint32_t raw_max_jerk_deg_s3;
+  memcpy(&raw_max_jerk_deg_s3, &tmp_max_jerk_deg_s3, sizeof(tmp_max_jerk_deg_s3));
+  if (raw_max_jerk_deg_s3 != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float rate_hz = 5;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rate_hz = this->_internal_rate_hz();
+  uint32_t raw_rate_hz;
+  memcpy(&raw_rate_hz, &tmp_rate_hz, sizeof(tmp_rate_hz));
+  if (raw_rate_hz != 0) {
+    total_size += 1 + 4;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MotionProfile::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ControlResponse::MergeImpl
+    MotionProfile::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MotionProfile::GetClassData() const { return &_class_data_; }
 
 
-void ControlResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ControlResponse*>(&to_msg);
-  auto& from = static_cast<const ControlResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.ControlResponse)
+void MotionProfile::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MotionProfile*>(&to_msg);
+  auto& from = static_cast<const MotionProfile&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.MotionProfile)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_control_status()) {
-    _this->_internal_mutable_control_status()->::mavsdk::rpc::gimbal::ControlStatus::MergeFrom(
-        from._internal_control_status());
+  if (from._internal_shape() != 0) {
+    _this->_internal_set_shape(from._internal_shape());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_velocity_deg_s = from._internal_max_velocity_deg_s();
+  uint32_t raw_max_velocity_deg_s;
+  memcpy(&raw_max_velocity_deg_s, &tmp_max_velocity_deg_s, sizeof(tmp_max_velocity_deg_s));
+  if (raw_max_velocity_deg_s != 0) {
+    _this->_internal_set_max_velocity_deg_s(from._internal_max_velocity_deg_s());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_acceleration_deg_s2 = from._internal_max_acceleration_deg_s2();
+  uint32_t raw_max_acceleration_deg_s2;
+  memcpy(&raw_max_acceleration_deg_s2, &tmp_max_acceleration_deg_s2, sizeof(tmp_max_acceleration_deg_s2));
+  if (raw_max_acceleration_deg_s2 != 0) {
+    _this->_internal_set_max_acceleration_deg_s2(from._internal_max_acceleration_deg_s2());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max_jerk_deg_s3 = from._internal_max_jerk_deg_s3();
+  uint32_t raw_max_jerk_deg_s3;
+  memcpy(&raw_max_jerk_deg_s3, &tmp_max_jerk_deg_s3, sizeof(tmp_max_jerk_deg_s3));
+  if (raw_max_jerk_deg_s3 != 0) {
+    _this->_internal_set_max_jerk_deg_s3(from._internal_max_jerk_deg_s3());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_rate_hz = from._internal_rate_hz();
+  uint32_t raw_rate_hz;
+  memcpy(&raw_rate_hz, &tmp_rate_hz, sizeof(tmp_rate_hz));
+  if (raw_rate_hz != 0) {
+    _this->_internal_set_rate_hz(from._internal_rate_hz());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ControlResponse::CopyFrom(const ControlResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.ControlResponse)
+void MotionProfile::CopyFrom(const MotionProfile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.MotionProfile)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ControlResponse::IsInitialized() const {
+bool MotionProfile::IsInitialized() const {
   return true;
 }
 
-void ControlResponse::InternalSwap(ControlResponse* other) {
+void MotionProfile::InternalSwap(MotionProfile* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.control_status_, other->_impl_.control_status_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MotionProfile, _impl_.rate_hz_)
+      + sizeof(MotionProfile::_impl_.rate_hz_)
+      - PROTOBUF_FIELD_OFFSET(MotionProfile, _impl_.shape_)>(
+          reinterpret_cast<char*>(&_impl_.shape_),
+          reinterpret_cast<char*>(&other->_impl_.shape_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ControlResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata MotionProfile::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[13]);
+      file_level_metadata_gimbal_2eproto[44]);
 }
 
 // ===================================================================
 
-class ControlStatus::_Internal {
+class Metric::_Internal {
  public:
 };
 
-ControlStatus::ControlStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Metric::Metric(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.ControlStatus)
+  // @@protoc_insertion_point(arena_constructor:mavsdk.rpc.gimbal.Metric)
 }
-ControlStatus::ControlStatus(const ControlStatus& from)
+Metric::Metric(const Metric& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ControlStatus* const _this = this; (void)_this;
+  Metric* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.control_mode_){}
-    , decltype(_impl_.sysid_primary_control_){}
-    , decltype(_impl_.compid_primary_control_){}
-    , decltype(_impl_.sysid_secondary_control_){}
-    , decltype(_impl_.compid_secondary_control_){}
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.control_mode_, &from._impl_.control_mode_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compid_secondary_control_) -
-    reinterpret_cast<char*>(&_impl_.control_mode_)) + sizeof(_impl_.compid_secondary_control_));
-  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.ControlStatus)
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.value_ = from._impl_.value_;
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.gimbal.Metric)
 }
 
-inline void ControlStatus::SharedCtor(
+inline void Metric::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.control_mode_){0}
-    , decltype(_impl_.sysid_primary_control_){0}
-    , decltype(_impl_.compid_primary_control_){0}
-    , decltype(_impl_.sysid_secondary_control_){0}
-    , decltype(_impl_.compid_secondary_control_){0}
+      decltype(_impl_.name_){}
+    , decltype(_impl_.value_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-ControlStatus::~ControlStatus() {
-  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.ControlStatus)
+Metric::~Metric() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.gimbal.Metric)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3129,70 +12507,47 @@ ControlStatus::~ControlStatus() {
   SharedDtor();
 }
 
-inline void ControlStatus::SharedDtor() {
+inline void Metric::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-void ControlStatus::SetCachedSize(int size) const {
+void Metric::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ControlStatus::Clear() {
-// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.ControlStatus)
+void Metric::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.gimbal.Metric)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.control_mode_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.compid_secondary_control_) -
-      reinterpret_cast<char*>(&_impl_.control_mode_)) + sizeof(_impl_.compid_secondary_control_));
+  _impl_.name_.ClearToEmpty();
+  _impl_.value_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ControlStatus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Metric::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
+      // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          _internal_set_control_mode(static_cast<::mavsdk::rpc::gimbal::ControlMode>(val));
+          CHK_(::_pbi::VerifyUTF8(str, "mavsdk.rpc.gimbal.Metric.name"));
         } else
           goto handle_unusual;
         continue;
-      // int32 sysid_primary_control = 2;
+      // double value = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.sysid_primary_control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 compid_primary_control = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.compid_primary_control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 sysid_secondary_control = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _impl_.sysid_secondary_control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 compid_secondary_control = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          _impl_.compid_secondary_control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
@@ -3219,147 +12574,122 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ControlStatus::_InternalSerialize(
+uint8_t* Metric::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.ControlStatus)
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.gimbal.Metric)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
-  if (this->_internal_control_mode() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_control_mode(), target);
-  }
-
-  // int32 sysid_primary_control = 2;
-  if (this->_internal_sysid_primary_control() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_sysid_primary_control(), target);
-  }
-
-  // int32 compid_primary_control = 3;
-  if (this->_internal_compid_primary_control() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_compid_primary_control(), target);
-  }
-
-  // int32 sysid_secondary_control = 4;
-  if (this->_internal_sysid_secondary_control() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_sysid_secondary_control(), target);
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "mavsdk.rpc.gimbal.Metric.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
-  // int32 compid_secondary_control = 5;
-  if (this->_internal_compid_secondary_control() != 0) {
+  // double value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_compid_secondary_control(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_value(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.ControlStatus)
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.gimbal.Metric)
   return target;
 }
 
-size_t ControlStatus::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.ControlStatus)
+size_t Metric::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.gimbal.Metric)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
-  if (this->_internal_control_mode() != 0) {
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_control_mode());
-  }
-
-  // int32 sysid_primary_control = 2;
-  if (this->_internal_sysid_primary_control() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sysid_primary_control());
-  }
-
-  // int32 compid_primary_control = 3;
-  if (this->_internal_compid_primary_control() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_compid_primary_control());
-  }
-
-  // int32 sysid_secondary_control = 4;
-  if (this->_internal_sysid_secondary_control() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sysid_secondary_control());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
 
-  // int32 compid_secondary_control = 5;
-  if (this->_internal_compid_secondary_control() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_compid_secondary_control());
+  // double value = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = this->_internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    total_size += 1 + 8;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ControlStatus::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Metric::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ControlStatus::MergeImpl
+    Metric::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ControlStatus::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Metric::GetClassData() const { return &_class_data_; }
 
 
-void ControlStatus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ControlStatus*>(&to_msg);
-  auto& from = static_cast<const ControlStatus&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.ControlStatus)
+void Metric::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Metric*>(&to_msg);
+  auto& from = static_cast<const Metric&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.gimbal.Metric)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_control_mode() != 0) {
-    _this->_internal_set_control_mode(from._internal_control_mode());
-  }
-  if (from._internal_sysid_primary_control() != 0) {
-    _this->_internal_set_sysid_primary_control(from._internal_sysid_primary_control());
-  }
-  if (from._internal_compid_primary_control() != 0) {
-    _this->_internal_set_compid_primary_control(from._internal_compid_primary_control());
-  }
-  if (from._internal_sysid_secondary_control() != 0) {
-    _this->_internal_set_sysid_secondary_control(from._internal_sysid_secondary_control());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from._internal_compid_secondary_control() != 0) {
-    _this->_internal_set_compid_secondary_control(from._internal_compid_secondary_control());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_value = from._internal_value();
+  uint64_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    _this->_internal_set_value(from._internal_value());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ControlStatus::CopyFrom(const ControlStatus& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.ControlStatus)
+void Metric::CopyFrom(const Metric& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.gimbal.Metric)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ControlStatus::IsInitialized() const {
+bool Metric::IsInitialized() const {
   return true;
 }
 
-void ControlStatus::InternalSwap(ControlStatus* other) {
+void Metric::InternalSwap(Metric* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ControlStatus, _impl_.compid_secondary_control_)
-      + sizeof(ControlStatus::_impl_.compid_secondary_control_)
-      - PROTOBUF_FIELD_OFFSET(ControlStatus, _impl_.control_mode_)>(
-          reinterpret_cast<char*>(&_impl_.control_mode_),
-          reinterpret_cast<char*>(&other->_impl_.control_mode_));
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.value_, other->_impl_.value_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ControlStatus::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata Metric::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[14]);
+      file_level_metadata_gimbal_2eproto[45]);
 }
 
 // ===================================================================
@@ -3592,7 +12922,7 @@ void GimbalResult::InternalSwap(GimbalResult* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata GimbalResult::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_gimbal_2eproto_getter, &descriptor_table_gimbal_2eproto_once,
-      file_level_metadata_gimbal_2eproto[15]);
+      file_level_metadata_gimbal_2eproto[46]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -3656,10 +12986,134 @@ template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::ControlResponse*
 Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::ControlResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::ControlResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::GetMetricsRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::GetMetricsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::GetMetricsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::GetMetricsResponse*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::GetMetricsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::GetMetricsResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::MavlinkTunnelRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::MavlinkTunnelRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::MavlinkTunnelResponse*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::MavlinkTunnelResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::MavlinkTunnelResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::SyncClockRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::SyncClockRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::SyncClockRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::SyncClockResponse*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::SyncClockResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::SyncClockResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::PredictAttitudeRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::PredictAttitudeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::PredictAttitudeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::PredictAttitudeResponse*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::PredictAttitudeResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::PredictAttitudeResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::GetAttitudeAtRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::GetAttitudeAtRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::GetAttitudeAtRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::GetAttitudeAtResponse*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::GetAttitudeAtResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::GetAttitudesAtRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::GetAttitudesAtRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::GetAttitudesAtRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::GetAttitudesAtResponse*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::GetAttitudesAtResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::VisualServoRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::VisualServoRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::VisualServoRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::VisualServoStatus*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::VisualServoStatus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::VisualServoStatus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::SetTracingRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::SetTracingRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::SetTracingRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::SetTracingResponse*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::SetTracingResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::SetTracingResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::GetTraceRequest*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::GetTraceRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::GetTraceRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::GetTraceResponse*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::GetTraceResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::GetTraceResponse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::ControlStatus*
 Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::ControlStatus >(Arena* arena) {
   return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::ControlStatus >(arena);
 }
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::TelemetryRate*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::TelemetryRate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::TelemetryRate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::MavlinkFilter*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::MavlinkFilter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::MavlinkFilter >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::AttitudeBatch*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::AttitudeBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::AttitudeBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::Setpoint*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::Setpoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::Setpoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::SetpointAck*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::SetpointAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::SetpointAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::ServoGains*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::ServoGains >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::ServoGains >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::MotionProfile*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::MotionProfile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::MotionProfile >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::Metric*
+Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::Metric >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::Metric >(arena);
+}
 template<> PROTOBUF_NOINLINE ::mavsdk::rpc::gimbal::GimbalResult*
 Arena::CreateMaybeMessage< ::mavsdk::rpc::gimbal::GimbalResult >(Arena* arena) {
   return Arena::CreateMessageInternal< ::mavsdk::rpc::gimbal::GimbalResult >(arena);
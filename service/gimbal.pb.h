@@ -13,7 +13,7 @@
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3021006 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -49,21 +49,78 @@ extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table
 namespace mavsdk {
 namespace rpc {
 namespace gimbal {
+class ApplyGimbalStateRequest;
+struct ApplyGimbalStateRequestDefaultTypeInternal;
+extern ApplyGimbalStateRequestDefaultTypeInternal _ApplyGimbalStateRequest_default_instance_;
+class ApplyGimbalStateResponse;
+struct ApplyGimbalStateResponseDefaultTypeInternal;
+extern ApplyGimbalStateResponseDefaultTypeInternal _ApplyGimbalStateResponse_default_instance_;
+class AttitudeBatch;
+struct AttitudeBatchDefaultTypeInternal;
+extern AttitudeBatchDefaultTypeInternal _AttitudeBatch_default_instance_;
 class ControlResponse;
 struct ControlResponseDefaultTypeInternal;
 extern ControlResponseDefaultTypeInternal _ControlResponse_default_instance_;
 class ControlStatus;
 struct ControlStatusDefaultTypeInternal;
 extern ControlStatusDefaultTypeInternal _ControlStatus_default_instance_;
+class GetAttitudeAtRequest;
+struct GetAttitudeAtRequestDefaultTypeInternal;
+extern GetAttitudeAtRequestDefaultTypeInternal _GetAttitudeAtRequest_default_instance_;
+class GetAttitudeAtResponse;
+struct GetAttitudeAtResponseDefaultTypeInternal;
+extern GetAttitudeAtResponseDefaultTypeInternal _GetAttitudeAtResponse_default_instance_;
+class GetAttitudesAtRequest;
+struct GetAttitudesAtRequestDefaultTypeInternal;
+extern GetAttitudesAtRequestDefaultTypeInternal _GetAttitudesAtRequest_default_instance_;
+class GetAttitudesAtResponse;
+struct GetAttitudesAtResponseDefaultTypeInternal;
+extern GetAttitudesAtResponseDefaultTypeInternal _GetAttitudesAtResponse_default_instance_;
+class GetMetricsRequest;
+struct GetMetricsRequestDefaultTypeInternal;
+extern GetMetricsRequestDefaultTypeInternal _GetMetricsRequest_default_instance_;
+class GetMetricsResponse;
+struct GetMetricsResponseDefaultTypeInternal;
+extern GetMetricsResponseDefaultTypeInternal _GetMetricsResponse_default_instance_;
+class GetTraceRequest;
+struct GetTraceRequestDefaultTypeInternal;
+extern GetTraceRequestDefaultTypeInternal _GetTraceRequest_default_instance_;
+class GetTraceResponse;
+struct GetTraceResponseDefaultTypeInternal;
+extern GetTraceResponseDefaultTypeInternal _GetTraceResponse_default_instance_;
 class GimbalResult;
 struct GimbalResultDefaultTypeInternal;
 extern GimbalResultDefaultTypeInternal _GimbalResult_default_instance_;
+class MavlinkFilter;
+struct MavlinkFilterDefaultTypeInternal;
+extern MavlinkFilterDefaultTypeInternal _MavlinkFilter_default_instance_;
+class MavlinkTunnelRequest;
+struct MavlinkTunnelRequestDefaultTypeInternal;
+extern MavlinkTunnelRequestDefaultTypeInternal _MavlinkTunnelRequest_default_instance_;
+class MavlinkTunnelResponse;
+struct MavlinkTunnelResponseDefaultTypeInternal;
+extern MavlinkTunnelResponseDefaultTypeInternal _MavlinkTunnelResponse_default_instance_;
+class Metric;
+struct MetricDefaultTypeInternal;
+extern MetricDefaultTypeInternal _Metric_default_instance_;
+class MotionProfile;
+struct MotionProfileDefaultTypeInternal;
+extern MotionProfileDefaultTypeInternal _MotionProfile_default_instance_;
+class PredictAttitudeRequest;
+struct PredictAttitudeRequestDefaultTypeInternal;
+extern PredictAttitudeRequestDefaultTypeInternal _PredictAttitudeRequest_default_instance_;
+class PredictAttitudeResponse;
+struct PredictAttitudeResponseDefaultTypeInternal;
+extern PredictAttitudeResponseDefaultTypeInternal _PredictAttitudeResponse_default_instance_;
 class ReleaseControlRequest;
 struct ReleaseControlRequestDefaultTypeInternal;
 extern ReleaseControlRequestDefaultTypeInternal _ReleaseControlRequest_default_instance_;
 class ReleaseControlResponse;
 struct ReleaseControlResponseDefaultTypeInternal;
 extern ReleaseControlResponseDefaultTypeInternal _ReleaseControlResponse_default_instance_;
+class ServoGains;
+struct ServoGainsDefaultTypeInternal;
+extern ServoGainsDefaultTypeInternal _ServoGains_default_instance_;
 class SetModeRequest;
 struct SetModeRequestDefaultTypeInternal;
 extern SetModeRequestDefaultTypeInternal _SetModeRequest_default_instance_;
@@ -88,24 +145,79 @@ extern SetRoiLocationRequestDefaultTypeInternal _SetRoiLocationRequest_default_i
 class SetRoiLocationResponse;
 struct SetRoiLocationResponseDefaultTypeInternal;
 extern SetRoiLocationResponseDefaultTypeInternal _SetRoiLocationResponse_default_instance_;
+class SetTelemetryRatesRequest;
+struct SetTelemetryRatesRequestDefaultTypeInternal;
+extern SetTelemetryRatesRequestDefaultTypeInternal _SetTelemetryRatesRequest_default_instance_;
+class SetTelemetryRatesResponse;
+struct SetTelemetryRatesResponseDefaultTypeInternal;
+extern SetTelemetryRatesResponseDefaultTypeInternal _SetTelemetryRatesResponse_default_instance_;
+class SetTracingRequest;
+struct SetTracingRequestDefaultTypeInternal;
+extern SetTracingRequestDefaultTypeInternal _SetTracingRequest_default_instance_;
+class SetTracingResponse;
+struct SetTracingResponseDefaultTypeInternal;
+extern SetTracingResponseDefaultTypeInternal _SetTracingResponse_default_instance_;
+class Setpoint;
+struct SetpointDefaultTypeInternal;
+extern SetpointDefaultTypeInternal _Setpoint_default_instance_;
+class SetpointAck;
+struct SetpointAckDefaultTypeInternal;
+extern SetpointAckDefaultTypeInternal _SetpointAck_default_instance_;
+class SubscribeAttitudeBatchRequest;
+struct SubscribeAttitudeBatchRequestDefaultTypeInternal;
+extern SubscribeAttitudeBatchRequestDefaultTypeInternal _SubscribeAttitudeBatchRequest_default_instance_;
 class SubscribeControlRequest;
 struct SubscribeControlRequestDefaultTypeInternal;
 extern SubscribeControlRequestDefaultTypeInternal _SubscribeControlRequest_default_instance_;
+class SyncClockRequest;
+struct SyncClockRequestDefaultTypeInternal;
+extern SyncClockRequestDefaultTypeInternal _SyncClockRequest_default_instance_;
+class SyncClockResponse;
+struct SyncClockResponseDefaultTypeInternal;
+extern SyncClockResponseDefaultTypeInternal _SyncClockResponse_default_instance_;
 class TakeControlRequest;
 struct TakeControlRequestDefaultTypeInternal;
 extern TakeControlRequestDefaultTypeInternal _TakeControlRequest_default_instance_;
 class TakeControlResponse;
 struct TakeControlResponseDefaultTypeInternal;
 extern TakeControlResponseDefaultTypeInternal _TakeControlResponse_default_instance_;
+class TelemetryRate;
+struct TelemetryRateDefaultTypeInternal;
+extern TelemetryRateDefaultTypeInternal _TelemetryRate_default_instance_;
+class VisualServoRequest;
+struct VisualServoRequestDefaultTypeInternal;
+extern VisualServoRequestDefaultTypeInternal _VisualServoRequest_default_instance_;
+class VisualServoStatus;
+struct VisualServoStatusDefaultTypeInternal;
+extern VisualServoStatusDefaultTypeInternal _VisualServoStatus_default_instance_;
 }  // namespace gimbal
 }  // namespace rpc
 }  // namespace mavsdk
 PROTOBUF_NAMESPACE_OPEN
+template<> ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::ApplyGimbalStateRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::ApplyGimbalStateResponse>(Arena*);
+template<> ::mavsdk::rpc::gimbal::AttitudeBatch* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::AttitudeBatch>(Arena*);
 template<> ::mavsdk::rpc::gimbal::ControlResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::ControlResponse>(Arena*);
 template<> ::mavsdk::rpc::gimbal::ControlStatus* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::ControlStatus>(Arena*);
+template<> ::mavsdk::rpc::gimbal::GetAttitudeAtRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::GetAttitudeAtRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::GetAttitudeAtResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::GetAttitudeAtResponse>(Arena*);
+template<> ::mavsdk::rpc::gimbal::GetAttitudesAtRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::GetAttitudesAtRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::GetAttitudesAtResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::GetAttitudesAtResponse>(Arena*);
+template<> ::mavsdk::rpc::gimbal::GetMetricsRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::GetMetricsRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::GetMetricsResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::GetMetricsResponse>(Arena*);
+template<> ::mavsdk::rpc::gimbal::GetTraceRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::GetTraceRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::GetTraceResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::GetTraceResponse>(Arena*);
 template<> ::mavsdk::rpc::gimbal::GimbalResult* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(Arena*);
+template<> ::mavsdk::rpc::gimbal::MavlinkFilter* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::MavlinkFilter>(Arena*);
+template<> ::mavsdk::rpc::gimbal::MavlinkTunnelRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::MavlinkTunnelRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::MavlinkTunnelResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::MavlinkTunnelResponse>(Arena*);
+template<> ::mavsdk::rpc::gimbal::Metric* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::Metric>(Arena*);
+template<> ::mavsdk::rpc::gimbal::MotionProfile* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::MotionProfile>(Arena*);
+template<> ::mavsdk::rpc::gimbal::PredictAttitudeRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::PredictAttitudeRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::PredictAttitudeResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::PredictAttitudeResponse>(Arena*);
 template<> ::mavsdk::rpc::gimbal::ReleaseControlRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::ReleaseControlRequest>(Arena*);
 template<> ::mavsdk::rpc::gimbal::ReleaseControlResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::ReleaseControlResponse>(Arena*);
+template<> ::mavsdk::rpc::gimbal::ServoGains* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::ServoGains>(Arena*);
 template<> ::mavsdk::rpc::gimbal::SetModeRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SetModeRequest>(Arena*);
 template<> ::mavsdk::rpc::gimbal::SetModeResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SetModeResponse>(Arena*);
 template<> ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SetPitchAndYawRequest>(Arena*);
@@ -114,9 +226,21 @@ template<> ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest* Arena::CreateMa
 template<> ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse>(Arena*);
 template<> ::mavsdk::rpc::gimbal::SetRoiLocationRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SetRoiLocationRequest>(Arena*);
 template<> ::mavsdk::rpc::gimbal::SetRoiLocationResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SetRoiLocationResponse>(Arena*);
+template<> ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SetTelemetryRatesRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SetTelemetryRatesResponse>(Arena*);
+template<> ::mavsdk::rpc::gimbal::SetTracingRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SetTracingRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::SetTracingResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SetTracingResponse>(Arena*);
+template<> ::mavsdk::rpc::gimbal::Setpoint* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::Setpoint>(Arena*);
+template<> ::mavsdk::rpc::gimbal::SetpointAck* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SetpointAck>(Arena*);
+template<> ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest>(Arena*);
 template<> ::mavsdk::rpc::gimbal::SubscribeControlRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SubscribeControlRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::SyncClockRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SyncClockRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::SyncClockResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::SyncClockResponse>(Arena*);
 template<> ::mavsdk::rpc::gimbal::TakeControlRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::TakeControlRequest>(Arena*);
 template<> ::mavsdk::rpc::gimbal::TakeControlResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::TakeControlResponse>(Arena*);
+template<> ::mavsdk::rpc::gimbal::TelemetryRate* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::TelemetryRate>(Arena*);
+template<> ::mavsdk::rpc::gimbal::VisualServoRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::VisualServoRequest>(Arena*);
+template<> ::mavsdk::rpc::gimbal::VisualServoStatus* Arena::CreateMaybeMessage<::mavsdk::rpc::gimbal::VisualServoStatus>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace mavsdk {
 namespace rpc {
@@ -202,6 +326,112 @@ inline bool ControlMode_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ControlMode>(
     ControlMode_descriptor(), name, value);
 }
+enum TelemetryStream : int {
+  TELEMETRY_STREAM_CAMERA_ATTITUDE = 0,
+  TELEMETRY_STREAM_POSITION = 1,
+  TELEMETRY_STREAM_ATTITUDE = 2,
+  TELEMETRY_STREAM_VELOCITY_NED = 3,
+  TELEMETRY_STREAM_GPS_INFO = 4,
+  TELEMETRY_STREAM_BATTERY = 5,
+  TELEMETRY_STREAM_RC_STATUS = 6,
+  TELEMETRY_STREAM_IMU = 7,
+  TelemetryStream_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TelemetryStream_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool TelemetryStream_IsValid(int value);
+constexpr TelemetryStream TelemetryStream_MIN = TELEMETRY_STREAM_CAMERA_ATTITUDE;
+constexpr TelemetryStream TelemetryStream_MAX = TELEMETRY_STREAM_IMU;
+constexpr int TelemetryStream_ARRAYSIZE = TelemetryStream_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TelemetryStream_descriptor();
+template<typename T>
+inline const std::string& TelemetryStream_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TelemetryStream>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TelemetryStream_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TelemetryStream_descriptor(), enum_t_value);
+}
+inline bool TelemetryStream_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TelemetryStream* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TelemetryStream>(
+    TelemetryStream_descriptor(), name, value);
+}
+enum SetpointMode : int {
+  SETPOINT_MODE_ANGLE = 0,
+  SETPOINT_MODE_RATE = 1,
+  SetpointMode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  SetpointMode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool SetpointMode_IsValid(int value);
+constexpr SetpointMode SetpointMode_MIN = SETPOINT_MODE_ANGLE;
+constexpr SetpointMode SetpointMode_MAX = SETPOINT_MODE_RATE;
+constexpr int SetpointMode_ARRAYSIZE = SetpointMode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SetpointMode_descriptor();
+template<typename T>
+inline const std::string& SetpointMode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SetpointMode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SetpointMode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SetpointMode_descriptor(), enum_t_value);
+}
+inline bool SetpointMode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SetpointMode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SetpointMode>(
+    SetpointMode_descriptor(), name, value);
+}
+enum ProfileShape : int {
+  PROFILE_SHAPE_TRAPEZOID = 0,
+  PROFILE_SHAPE_S_CURVE = 1,
+  ProfileShape_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ProfileShape_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ProfileShape_IsValid(int value);
+constexpr ProfileShape ProfileShape_MIN = PROFILE_SHAPE_TRAPEZOID;
+constexpr ProfileShape ProfileShape_MAX = PROFILE_SHAPE_S_CURVE;
+constexpr int ProfileShape_ARRAYSIZE = ProfileShape_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ProfileShape_descriptor();
+template<typename T>
+inline const std::string& ProfileShape_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ProfileShape>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ProfileShape_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ProfileShape_descriptor(), enum_t_value);
+}
+inline bool ProfileShape_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ProfileShape* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ProfileShape>(
+    ProfileShape_descriptor(), name, value);
+}
+enum TraceFormat : int {
+  TRACE_FORMAT_CHROME_JSON = 0,
+  TRACE_FORMAT_PERFETTO = 1,
+  TraceFormat_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  TraceFormat_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool TraceFormat_IsValid(int value);
+constexpr TraceFormat TraceFormat_MIN = TRACE_FORMAT_CHROME_JSON;
+constexpr TraceFormat TraceFormat_MAX = TRACE_FORMAT_PERFETTO;
+constexpr int TraceFormat_ARRAYSIZE = TraceFormat_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TraceFormat_descriptor();
+template<typename T>
+inline const std::string& TraceFormat_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TraceFormat>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TraceFormat_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TraceFormat_descriptor(), enum_t_value);
+}
+inline bool TraceFormat_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TraceFormat* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TraceFormat>(
+    TraceFormat_descriptor(), name, value);
+}
 // ===================================================================
 
 class SetPitchAndYawRequest final :
@@ -325,9 +555,28 @@ class SetPitchAndYawRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kProfileFieldNumber = 3,
     kPitchDegFieldNumber = 1,
     kYawDegFieldNumber = 2,
   };
+  // .mavsdk.rpc.gimbal.MotionProfile profile = 3;
+  bool has_profile() const;
+  private:
+  bool _internal_has_profile() const;
+  public:
+  void clear_profile();
+  const ::mavsdk::rpc::gimbal::MotionProfile& profile() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::MotionProfile* release_profile();
+  ::mavsdk::rpc::gimbal::MotionProfile* mutable_profile();
+  void set_allocated_profile(::mavsdk::rpc::gimbal::MotionProfile* profile);
+  private:
+  const ::mavsdk::rpc::gimbal::MotionProfile& _internal_profile() const;
+  ::mavsdk::rpc::gimbal::MotionProfile* _internal_mutable_profile();
+  public:
+  void unsafe_arena_set_allocated_profile(
+      ::mavsdk::rpc::gimbal::MotionProfile* profile);
+  ::mavsdk::rpc::gimbal::MotionProfile* unsafe_arena_release_profile();
+
   // float pitch_deg = 1;
   void clear_pitch_deg();
   float pitch_deg() const;
@@ -354,6 +603,7 @@ class SetPitchAndYawRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::mavsdk::rpc::gimbal::MotionProfile* profile_;
     float pitch_deg_;
     float yaw_deg_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
@@ -1590,6 +1840,7 @@ class TakeControlRequest final :
 
   enum : int {
     kControlModeFieldNumber = 1,
+    kForceFieldNumber = 2,
   };
   // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
   void clear_control_mode();
@@ -1600,6 +1851,15 @@ class TakeControlRequest final :
   void _internal_set_control_mode(::mavsdk::rpc::gimbal::ControlMode value);
   public:
 
+  // bool force = 2;
+  void clear_force();
+  bool force() const;
+  void set_force(bool value);
+  private:
+  bool _internal_force() const;
+  void _internal_set_force(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.TakeControlRequest)
  private:
   class _Internal;
@@ -1609,6 +1869,7 @@ class TakeControlRequest final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     int control_mode_;
+    bool force_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1774,9 +2035,10 @@ class TakeControlResponse final :
 // -------------------------------------------------------------------
 
 class ReleaseControlRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.ReleaseControlRequest) */ {
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.ReleaseControlRequest) */ {
  public:
   inline ReleaseControlRequest() : ReleaseControlRequest(nullptr) {}
+  ~ReleaseControlRequest() override;
   explicit PROTOBUF_CONSTEXPR ReleaseControlRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ReleaseControlRequest(const ReleaseControlRequest& from);
@@ -1849,15 +2111,29 @@ class ReleaseControlRequest final :
   ReleaseControlRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ReleaseControlRequest>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const ReleaseControlRequest& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const ReleaseControlRequest& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReleaseControlRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReleaseControlRequest& from) {
+    ReleaseControlRequest::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReleaseControlRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
@@ -1878,6 +2154,18 @@ class ReleaseControlRequest final :
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kForceFieldNumber = 1,
+  };
+  // bool force = 1;
+  void clear_force();
+  bool force() const;
+  void set_force(bool value);
+  private:
+  bool _internal_force() const;
+  void _internal_set_force(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.ReleaseControlRequest)
  private:
   class _Internal;
@@ -1886,7 +2174,10 @@ class ReleaseControlRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    bool force_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_gimbal_2eproto;
 };
 // -------------------------------------------------------------------
@@ -2323,24 +2614,23 @@ class ControlResponse final :
 };
 // -------------------------------------------------------------------
 
-class ControlStatus final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.ControlStatus) */ {
+class GetMetricsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.GetMetricsRequest) */ {
  public:
-  inline ControlStatus() : ControlStatus(nullptr) {}
-  ~ControlStatus() override;
-  explicit PROTOBUF_CONSTEXPR ControlStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline GetMetricsRequest() : GetMetricsRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR GetMetricsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ControlStatus(const ControlStatus& from);
-  ControlStatus(ControlStatus&& from) noexcept
-    : ControlStatus() {
+  GetMetricsRequest(const GetMetricsRequest& from);
+  GetMetricsRequest(GetMetricsRequest&& from) noexcept
+    : GetMetricsRequest() {
     *this = ::std::move(from);
   }
 
-  inline ControlStatus& operator=(const ControlStatus& from) {
+  inline GetMetricsRequest& operator=(const GetMetricsRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ControlStatus& operator=(ControlStatus&& from) noexcept {
+  inline GetMetricsRequest& operator=(GetMetricsRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2363,20 +2653,20 @@ class ControlStatus final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ControlStatus& default_instance() {
+  static const GetMetricsRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ControlStatus* internal_default_instance() {
-    return reinterpret_cast<const ControlStatus*>(
-               &_ControlStatus_default_instance_);
+  static inline const GetMetricsRequest* internal_default_instance() {
+    return reinterpret_cast<const GetMetricsRequest*>(
+               &_GetMetricsRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  friend void swap(ControlStatus& a, ControlStatus& b) {
+  friend void swap(GetMetricsRequest& a, GetMetricsRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ControlStatus* other) {
+  inline void Swap(GetMetricsRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2389,7 +2679,7 @@ class ControlStatus final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ControlStatus* other) {
+  void UnsafeArenaSwap(GetMetricsRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2397,14 +2687,133 @@ class ControlStatus final :
 
   // implements Message ----------------------------------------------
 
-  ControlStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ControlStatus>(arena);
+  GetMetricsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetMetricsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const GetMetricsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const GetMetricsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.GetMetricsRequest";
+  }
+  protected:
+  explicit GetMetricsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.GetMetricsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetMetricsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.GetMetricsResponse) */ {
+ public:
+  inline GetMetricsResponse() : GetMetricsResponse(nullptr) {}
+  ~GetMetricsResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetMetricsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetMetricsResponse(const GetMetricsResponse& from);
+  GetMetricsResponse(GetMetricsResponse&& from) noexcept
+    : GetMetricsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetMetricsResponse& operator=(const GetMetricsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetMetricsResponse& operator=(GetMetricsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetMetricsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetMetricsResponse* internal_default_instance() {
+    return reinterpret_cast<const GetMetricsResponse*>(
+               &_GetMetricsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(GetMetricsResponse& a, GetMetricsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetMetricsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetMetricsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetMetricsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetMetricsResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ControlStatus& from);
+  void CopyFrom(const GetMetricsResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ControlStatus& from) {
-    ControlStatus::MergeImpl(*this, from);
+  void MergeFrom( const GetMetricsResponse& from) {
+    GetMetricsResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2422,15 +2831,15 @@ class ControlStatus final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ControlStatus* other);
+  void InternalSwap(GetMetricsResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "mavsdk.rpc.gimbal.ControlStatus";
+    return "mavsdk.rpc.gimbal.GetMetricsResponse";
   }
   protected:
-  explicit ControlStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit GetMetricsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2444,58 +2853,27 @@ class ControlStatus final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kControlModeFieldNumber = 1,
-    kSysidPrimaryControlFieldNumber = 2,
-    kCompidPrimaryControlFieldNumber = 3,
-    kSysidSecondaryControlFieldNumber = 4,
-    kCompidSecondaryControlFieldNumber = 5,
+    kMetricsFieldNumber = 1,
   };
-  // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
-  void clear_control_mode();
-  ::mavsdk::rpc::gimbal::ControlMode control_mode() const;
-  void set_control_mode(::mavsdk::rpc::gimbal::ControlMode value);
-  private:
-  ::mavsdk::rpc::gimbal::ControlMode _internal_control_mode() const;
-  void _internal_set_control_mode(::mavsdk::rpc::gimbal::ControlMode value);
-  public:
-
-  // int32 sysid_primary_control = 2;
-  void clear_sysid_primary_control();
-  int32_t sysid_primary_control() const;
-  void set_sysid_primary_control(int32_t value);
-  private:
-  int32_t _internal_sysid_primary_control() const;
-  void _internal_set_sysid_primary_control(int32_t value);
-  public:
-
-  // int32 compid_primary_control = 3;
-  void clear_compid_primary_control();
-  int32_t compid_primary_control() const;
-  void set_compid_primary_control(int32_t value);
-  private:
-  int32_t _internal_compid_primary_control() const;
-  void _internal_set_compid_primary_control(int32_t value);
-  public:
-
-  // int32 sysid_secondary_control = 4;
-  void clear_sysid_secondary_control();
-  int32_t sysid_secondary_control() const;
-  void set_sysid_secondary_control(int32_t value);
+  // repeated .mavsdk.rpc.gimbal.Metric metrics = 1;
+  int metrics_size() const;
   private:
-  int32_t _internal_sysid_secondary_control() const;
-  void _internal_set_sysid_secondary_control(int32_t value);
+  int _internal_metrics_size() const;
   public:
-
-  // int32 compid_secondary_control = 5;
-  void clear_compid_secondary_control();
-  int32_t compid_secondary_control() const;
-  void set_compid_secondary_control(int32_t value);
+  void clear_metrics();
+  ::mavsdk::rpc::gimbal::Metric* mutable_metrics(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mavsdk::rpc::gimbal::Metric >*
+      mutable_metrics();
   private:
-  int32_t _internal_compid_secondary_control() const;
-  void _internal_set_compid_secondary_control(int32_t value);
+  const ::mavsdk::rpc::gimbal::Metric& _internal_metrics(int index) const;
+  ::mavsdk::rpc::gimbal::Metric* _internal_add_metrics();
   public:
+  const ::mavsdk::rpc::gimbal::Metric& metrics(int index) const;
+  ::mavsdk::rpc::gimbal::Metric* add_metrics();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mavsdk::rpc::gimbal::Metric >&
+      metrics() const;
 
-  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.ControlStatus)
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.GetMetricsResponse)
  private:
   class _Internal;
 
@@ -2503,11 +2881,7 @@ class ControlStatus final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int control_mode_;
-    int32_t sysid_primary_control_;
-    int32_t compid_primary_control_;
-    int32_t sysid_secondary_control_;
-    int32_t compid_secondary_control_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mavsdk::rpc::gimbal::Metric > metrics_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2515,24 +2889,24 @@ class ControlStatus final :
 };
 // -------------------------------------------------------------------
 
-class GimbalResult final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.GimbalResult) */ {
+class SetTelemetryRatesRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.SetTelemetryRatesRequest) */ {
  public:
-  inline GimbalResult() : GimbalResult(nullptr) {}
-  ~GimbalResult() override;
-  explicit PROTOBUF_CONSTEXPR GimbalResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetTelemetryRatesRequest() : SetTelemetryRatesRequest(nullptr) {}
+  ~SetTelemetryRatesRequest() override;
+  explicit PROTOBUF_CONSTEXPR SetTelemetryRatesRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  GimbalResult(const GimbalResult& from);
-  GimbalResult(GimbalResult&& from) noexcept
-    : GimbalResult() {
+  SetTelemetryRatesRequest(const SetTelemetryRatesRequest& from);
+  SetTelemetryRatesRequest(SetTelemetryRatesRequest&& from) noexcept
+    : SetTelemetryRatesRequest() {
     *this = ::std::move(from);
   }
 
-  inline GimbalResult& operator=(const GimbalResult& from) {
+  inline SetTelemetryRatesRequest& operator=(const SetTelemetryRatesRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline GimbalResult& operator=(GimbalResult&& from) noexcept {
+  inline SetTelemetryRatesRequest& operator=(SetTelemetryRatesRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2555,20 +2929,20 @@ class GimbalResult final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const GimbalResult& default_instance() {
+  static const SetTelemetryRatesRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const GimbalResult* internal_default_instance() {
-    return reinterpret_cast<const GimbalResult*>(
-               &_GimbalResult_default_instance_);
+  static inline const SetTelemetryRatesRequest* internal_default_instance() {
+    return reinterpret_cast<const SetTelemetryRatesRequest*>(
+               &_SetTelemetryRatesRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    15;
+    16;
 
-  friend void swap(GimbalResult& a, GimbalResult& b) {
+  friend void swap(SetTelemetryRatesRequest& a, SetTelemetryRatesRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(GimbalResult* other) {
+  inline void Swap(SetTelemetryRatesRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2581,7 +2955,7 @@ class GimbalResult final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(GimbalResult* other) {
+  void UnsafeArenaSwap(SetTelemetryRatesRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2589,14 +2963,14 @@ class GimbalResult final :
 
   // implements Message ----------------------------------------------
 
-  GimbalResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<GimbalResult>(arena);
+  SetTelemetryRatesRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetTelemetryRatesRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const GimbalResult& from);
+  void CopyFrom(const SetTelemetryRatesRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const GimbalResult& from) {
-    GimbalResult::MergeImpl(*this, from);
+  void MergeFrom( const SetTelemetryRatesRequest& from) {
+    SetTelemetryRatesRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2614,15 +2988,5603 @@ class GimbalResult final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(GimbalResult* other);
+  void InternalSwap(SetTelemetryRatesRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "mavsdk.rpc.gimbal.GimbalResult";
+    return "mavsdk.rpc.gimbal.SetTelemetryRatesRequest";
   }
   protected:
-  explicit GimbalResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetTelemetryRatesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRatesFieldNumber = 1,
+  };
+  // repeated .mavsdk.rpc.gimbal.TelemetryRate rates = 1;
+  int rates_size() const;
+  private:
+  int _internal_rates_size() const;
+  public:
+  void clear_rates();
+  ::mavsdk::rpc::gimbal::TelemetryRate* mutable_rates(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mavsdk::rpc::gimbal::TelemetryRate >*
+      mutable_rates();
+  private:
+  const ::mavsdk::rpc::gimbal::TelemetryRate& _internal_rates(int index) const;
+  ::mavsdk::rpc::gimbal::TelemetryRate* _internal_add_rates();
+  public:
+  const ::mavsdk::rpc::gimbal::TelemetryRate& rates(int index) const;
+  ::mavsdk::rpc::gimbal::TelemetryRate* add_rates();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mavsdk::rpc::gimbal::TelemetryRate >&
+      rates() const;
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.SetTelemetryRatesRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mavsdk::rpc::gimbal::TelemetryRate > rates_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetTelemetryRatesResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.SetTelemetryRatesResponse) */ {
+ public:
+  inline SetTelemetryRatesResponse() : SetTelemetryRatesResponse(nullptr) {}
+  ~SetTelemetryRatesResponse() override;
+  explicit PROTOBUF_CONSTEXPR SetTelemetryRatesResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetTelemetryRatesResponse(const SetTelemetryRatesResponse& from);
+  SetTelemetryRatesResponse(SetTelemetryRatesResponse&& from) noexcept
+    : SetTelemetryRatesResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SetTelemetryRatesResponse& operator=(const SetTelemetryRatesResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetTelemetryRatesResponse& operator=(SetTelemetryRatesResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetTelemetryRatesResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetTelemetryRatesResponse* internal_default_instance() {
+    return reinterpret_cast<const SetTelemetryRatesResponse*>(
+               &_SetTelemetryRatesResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(SetTelemetryRatesResponse& a, SetTelemetryRatesResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetTelemetryRatesResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetTelemetryRatesResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetTelemetryRatesResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetTelemetryRatesResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetTelemetryRatesResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetTelemetryRatesResponse& from) {
+    SetTelemetryRatesResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetTelemetryRatesResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.SetTelemetryRatesResponse";
+  }
+  protected:
+  explicit SetTelemetryRatesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGimbalResultFieldNumber = 1,
+  };
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  bool has_gimbal_result() const;
+  private:
+  bool _internal_has_gimbal_result() const;
+  public:
+  void clear_gimbal_result();
+  const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::GimbalResult* release_gimbal_result();
+  ::mavsdk::rpc::gimbal::GimbalResult* mutable_gimbal_result();
+  void set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result);
+  private:
+  const ::mavsdk::rpc::gimbal::GimbalResult& _internal_gimbal_result() const;
+  ::mavsdk::rpc::gimbal::GimbalResult* _internal_mutable_gimbal_result();
+  public:
+  void unsafe_arena_set_allocated_gimbal_result(
+      ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result);
+  ::mavsdk::rpc::gimbal::GimbalResult* unsafe_arena_release_gimbal_result();
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.SetTelemetryRatesResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MavlinkTunnelRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.MavlinkTunnelRequest) */ {
+ public:
+  inline MavlinkTunnelRequest() : MavlinkTunnelRequest(nullptr) {}
+  ~MavlinkTunnelRequest() override;
+  explicit PROTOBUF_CONSTEXPR MavlinkTunnelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MavlinkTunnelRequest(const MavlinkTunnelRequest& from);
+  MavlinkTunnelRequest(MavlinkTunnelRequest&& from) noexcept
+    : MavlinkTunnelRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MavlinkTunnelRequest& operator=(const MavlinkTunnelRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MavlinkTunnelRequest& operator=(MavlinkTunnelRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MavlinkTunnelRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MavlinkTunnelRequest* internal_default_instance() {
+    return reinterpret_cast<const MavlinkTunnelRequest*>(
+               &_MavlinkTunnelRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(MavlinkTunnelRequest& a, MavlinkTunnelRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MavlinkTunnelRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MavlinkTunnelRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MavlinkTunnelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MavlinkTunnelRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MavlinkTunnelRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MavlinkTunnelRequest& from) {
+    MavlinkTunnelRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MavlinkTunnelRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.MavlinkTunnelRequest";
+  }
+  protected:
+  explicit MavlinkTunnelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFramesFieldNumber = 1,
+    kFilterFieldNumber = 2,
+  };
+  // bytes frames = 1;
+  void clear_frames();
+  const std::string& frames() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_frames(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_frames();
+  PROTOBUF_NODISCARD std::string* release_frames();
+  void set_allocated_frames(std::string* frames);
+  private:
+  const std::string& _internal_frames() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_frames(const std::string& value);
+  std::string* _internal_mutable_frames();
+  public:
+
+  // .mavsdk.rpc.gimbal.MavlinkFilter filter = 2;
+  bool has_filter() const;
+  private:
+  bool _internal_has_filter() const;
+  public:
+  void clear_filter();
+  const ::mavsdk::rpc::gimbal::MavlinkFilter& filter() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::MavlinkFilter* release_filter();
+  ::mavsdk::rpc::gimbal::MavlinkFilter* mutable_filter();
+  void set_allocated_filter(::mavsdk::rpc::gimbal::MavlinkFilter* filter);
+  private:
+  const ::mavsdk::rpc::gimbal::MavlinkFilter& _internal_filter() const;
+  ::mavsdk::rpc::gimbal::MavlinkFilter* _internal_mutable_filter();
+  public:
+  void unsafe_arena_set_allocated_filter(
+      ::mavsdk::rpc::gimbal::MavlinkFilter* filter);
+  ::mavsdk::rpc::gimbal::MavlinkFilter* unsafe_arena_release_filter();
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.MavlinkTunnelRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr frames_;
+    ::mavsdk::rpc::gimbal::MavlinkFilter* filter_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MavlinkTunnelResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.MavlinkTunnelResponse) */ {
+ public:
+  inline MavlinkTunnelResponse() : MavlinkTunnelResponse(nullptr) {}
+  ~MavlinkTunnelResponse() override;
+  explicit PROTOBUF_CONSTEXPR MavlinkTunnelResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MavlinkTunnelResponse(const MavlinkTunnelResponse& from);
+  MavlinkTunnelResponse(MavlinkTunnelResponse&& from) noexcept
+    : MavlinkTunnelResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline MavlinkTunnelResponse& operator=(const MavlinkTunnelResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MavlinkTunnelResponse& operator=(MavlinkTunnelResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MavlinkTunnelResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MavlinkTunnelResponse* internal_default_instance() {
+    return reinterpret_cast<const MavlinkTunnelResponse*>(
+               &_MavlinkTunnelResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(MavlinkTunnelResponse& a, MavlinkTunnelResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MavlinkTunnelResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MavlinkTunnelResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MavlinkTunnelResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MavlinkTunnelResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MavlinkTunnelResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MavlinkTunnelResponse& from) {
+    MavlinkTunnelResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MavlinkTunnelResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.MavlinkTunnelResponse";
+  }
+  protected:
+  explicit MavlinkTunnelResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFramesFieldNumber = 1,
+    kDroppedFramesFieldNumber = 2,
+    kRejectedFramesFieldNumber = 3,
+  };
+  // bytes frames = 1;
+  void clear_frames();
+  const std::string& frames() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_frames(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_frames();
+  PROTOBUF_NODISCARD std::string* release_frames();
+  void set_allocated_frames(std::string* frames);
+  private:
+  const std::string& _internal_frames() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_frames(const std::string& value);
+  std::string* _internal_mutable_frames();
+  public:
+
+  // uint32 dropped_frames = 2;
+  void clear_dropped_frames();
+  uint32_t dropped_frames() const;
+  void set_dropped_frames(uint32_t value);
+  private:
+  uint32_t _internal_dropped_frames() const;
+  void _internal_set_dropped_frames(uint32_t value);
+  public:
+
+  // uint32 rejected_frames = 3;
+  void clear_rejected_frames();
+  uint32_t rejected_frames() const;
+  void set_rejected_frames(uint32_t value);
+  private:
+  uint32_t _internal_rejected_frames() const;
+  void _internal_set_rejected_frames(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.MavlinkTunnelResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr frames_;
+    uint32_t dropped_frames_;
+    uint32_t rejected_frames_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubscribeAttitudeBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest) */ {
+ public:
+  inline SubscribeAttitudeBatchRequest() : SubscribeAttitudeBatchRequest(nullptr) {}
+  ~SubscribeAttitudeBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR SubscribeAttitudeBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubscribeAttitudeBatchRequest(const SubscribeAttitudeBatchRequest& from);
+  SubscribeAttitudeBatchRequest(SubscribeAttitudeBatchRequest&& from) noexcept
+    : SubscribeAttitudeBatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SubscribeAttitudeBatchRequest& operator=(const SubscribeAttitudeBatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubscribeAttitudeBatchRequest& operator=(SubscribeAttitudeBatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubscribeAttitudeBatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubscribeAttitudeBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const SubscribeAttitudeBatchRequest*>(
+               &_SubscribeAttitudeBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(SubscribeAttitudeBatchRequest& a, SubscribeAttitudeBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubscribeAttitudeBatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubscribeAttitudeBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubscribeAttitudeBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubscribeAttitudeBatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SubscribeAttitudeBatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubscribeAttitudeBatchRequest& from) {
+    SubscribeAttitudeBatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SubscribeAttitudeBatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest";
+  }
+  protected:
+  explicit SubscribeAttitudeBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBatchWindowMsFieldNumber = 1,
+    kPredictionRateHzFieldNumber = 2,
+  };
+  // uint32 batch_window_ms = 1;
+  void clear_batch_window_ms();
+  uint32_t batch_window_ms() const;
+  void set_batch_window_ms(uint32_t value);
+  private:
+  uint32_t _internal_batch_window_ms() const;
+  void _internal_set_batch_window_ms(uint32_t value);
+  public:
+
+  // uint32 prediction_rate_hz = 2;
+  void clear_prediction_rate_hz();
+  uint32_t prediction_rate_hz() const;
+  void set_prediction_rate_hz(uint32_t value);
+  private:
+  uint32_t _internal_prediction_rate_hz() const;
+  void _internal_set_prediction_rate_hz(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t batch_window_ms_;
+    uint32_t prediction_rate_hz_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncClockRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.SyncClockRequest) */ {
+ public:
+  inline SyncClockRequest() : SyncClockRequest(nullptr) {}
+  ~SyncClockRequest() override;
+  explicit PROTOBUF_CONSTEXPR SyncClockRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncClockRequest(const SyncClockRequest& from);
+  SyncClockRequest(SyncClockRequest&& from) noexcept
+    : SyncClockRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncClockRequest& operator=(const SyncClockRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncClockRequest& operator=(SyncClockRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncClockRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncClockRequest* internal_default_instance() {
+    return reinterpret_cast<const SyncClockRequest*>(
+               &_SyncClockRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(SyncClockRequest& a, SyncClockRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncClockRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncClockRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncClockRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncClockRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncClockRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncClockRequest& from) {
+    SyncClockRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncClockRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.SyncClockRequest";
+  }
+  protected:
+  explicit SyncClockRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientSendTimeNsFieldNumber = 1,
+  };
+  // uint64 client_send_time_ns = 1;
+  void clear_client_send_time_ns();
+  uint64_t client_send_time_ns() const;
+  void set_client_send_time_ns(uint64_t value);
+  private:
+  uint64_t _internal_client_send_time_ns() const;
+  void _internal_set_client_send_time_ns(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.SyncClockRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t client_send_time_ns_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncClockResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.SyncClockResponse) */ {
+ public:
+  inline SyncClockResponse() : SyncClockResponse(nullptr) {}
+  ~SyncClockResponse() override;
+  explicit PROTOBUF_CONSTEXPR SyncClockResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncClockResponse(const SyncClockResponse& from);
+  SyncClockResponse(SyncClockResponse&& from) noexcept
+    : SyncClockResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncClockResponse& operator=(const SyncClockResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncClockResponse& operator=(SyncClockResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncClockResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncClockResponse* internal_default_instance() {
+    return reinterpret_cast<const SyncClockResponse*>(
+               &_SyncClockResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(SyncClockResponse& a, SyncClockResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncClockResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncClockResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncClockResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncClockResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncClockResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncClockResponse& from) {
+    SyncClockResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncClockResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.SyncClockResponse";
+  }
+  protected:
+  explicit SyncClockResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kClientSendTimeNsFieldNumber = 1,
+    kServerReceiveTimeNsFieldNumber = 2,
+    kServerSendTimeNsFieldNumber = 3,
+  };
+  // uint64 client_send_time_ns = 1;
+  void clear_client_send_time_ns();
+  uint64_t client_send_time_ns() const;
+  void set_client_send_time_ns(uint64_t value);
+  private:
+  uint64_t _internal_client_send_time_ns() const;
+  void _internal_set_client_send_time_ns(uint64_t value);
+  public:
+
+  // uint64 server_receive_time_ns = 2;
+  void clear_server_receive_time_ns();
+  uint64_t server_receive_time_ns() const;
+  void set_server_receive_time_ns(uint64_t value);
+  private:
+  uint64_t _internal_server_receive_time_ns() const;
+  void _internal_set_server_receive_time_ns(uint64_t value);
+  public:
+
+  // uint64 server_send_time_ns = 3;
+  void clear_server_send_time_ns();
+  uint64_t server_send_time_ns() const;
+  void set_server_send_time_ns(uint64_t value);
+  private:
+  uint64_t _internal_server_send_time_ns() const;
+  void _internal_set_server_send_time_ns(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.SyncClockResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t client_send_time_ns_;
+    uint64_t server_receive_time_ns_;
+    uint64_t server_send_time_ns_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PredictAttitudeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.PredictAttitudeRequest) */ {
+ public:
+  inline PredictAttitudeRequest() : PredictAttitudeRequest(nullptr) {}
+  ~PredictAttitudeRequest() override;
+  explicit PROTOBUF_CONSTEXPR PredictAttitudeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PredictAttitudeRequest(const PredictAttitudeRequest& from);
+  PredictAttitudeRequest(PredictAttitudeRequest&& from) noexcept
+    : PredictAttitudeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PredictAttitudeRequest& operator=(const PredictAttitudeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PredictAttitudeRequest& operator=(PredictAttitudeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PredictAttitudeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PredictAttitudeRequest* internal_default_instance() {
+    return reinterpret_cast<const PredictAttitudeRequest*>(
+               &_PredictAttitudeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(PredictAttitudeRequest& a, PredictAttitudeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PredictAttitudeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PredictAttitudeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PredictAttitudeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PredictAttitudeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PredictAttitudeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PredictAttitudeRequest& from) {
+    PredictAttitudeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PredictAttitudeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.PredictAttitudeRequest";
+  }
+  protected:
+  explicit PredictAttitudeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimeNsFieldNumber = 1,
+  };
+  // uint64 time_ns = 1;
+  void clear_time_ns();
+  uint64_t time_ns() const;
+  void set_time_ns(uint64_t value);
+  private:
+  uint64_t _internal_time_ns() const;
+  void _internal_set_time_ns(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.PredictAttitudeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t time_ns_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PredictAttitudeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.PredictAttitudeResponse) */ {
+ public:
+  inline PredictAttitudeResponse() : PredictAttitudeResponse(nullptr) {}
+  ~PredictAttitudeResponse() override;
+  explicit PROTOBUF_CONSTEXPR PredictAttitudeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PredictAttitudeResponse(const PredictAttitudeResponse& from);
+  PredictAttitudeResponse(PredictAttitudeResponse&& from) noexcept
+    : PredictAttitudeResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline PredictAttitudeResponse& operator=(const PredictAttitudeResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PredictAttitudeResponse& operator=(PredictAttitudeResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PredictAttitudeResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PredictAttitudeResponse* internal_default_instance() {
+    return reinterpret_cast<const PredictAttitudeResponse*>(
+               &_PredictAttitudeResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(PredictAttitudeResponse& a, PredictAttitudeResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PredictAttitudeResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PredictAttitudeResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PredictAttitudeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PredictAttitudeResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PredictAttitudeResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PredictAttitudeResponse& from) {
+    PredictAttitudeResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PredictAttitudeResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.PredictAttitudeResponse";
+  }
+  protected:
+  explicit PredictAttitudeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRollDegFieldNumber = 1,
+    kPitchDegFieldNumber = 2,
+    kTimestampUsFieldNumber = 4,
+    kYawDegFieldNumber = 3,
+  };
+  // float roll_deg = 1;
+  void clear_roll_deg();
+  float roll_deg() const;
+  void set_roll_deg(float value);
+  private:
+  float _internal_roll_deg() const;
+  void _internal_set_roll_deg(float value);
+  public:
+
+  // float pitch_deg = 2;
+  void clear_pitch_deg();
+  float pitch_deg() const;
+  void set_pitch_deg(float value);
+  private:
+  float _internal_pitch_deg() const;
+  void _internal_set_pitch_deg(float value);
+  public:
+
+  // uint64 timestamp_us = 4;
+  void clear_timestamp_us();
+  uint64_t timestamp_us() const;
+  void set_timestamp_us(uint64_t value);
+  private:
+  uint64_t _internal_timestamp_us() const;
+  void _internal_set_timestamp_us(uint64_t value);
+  public:
+
+  // float yaw_deg = 3;
+  void clear_yaw_deg();
+  float yaw_deg() const;
+  void set_yaw_deg(float value);
+  private:
+  float _internal_yaw_deg() const;
+  void _internal_set_yaw_deg(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.PredictAttitudeResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float roll_deg_;
+    float pitch_deg_;
+    uint64_t timestamp_us_;
+    float yaw_deg_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetAttitudeAtRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.GetAttitudeAtRequest) */ {
+ public:
+  inline GetAttitudeAtRequest() : GetAttitudeAtRequest(nullptr) {}
+  ~GetAttitudeAtRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetAttitudeAtRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetAttitudeAtRequest(const GetAttitudeAtRequest& from);
+  GetAttitudeAtRequest(GetAttitudeAtRequest&& from) noexcept
+    : GetAttitudeAtRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetAttitudeAtRequest& operator=(const GetAttitudeAtRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetAttitudeAtRequest& operator=(GetAttitudeAtRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetAttitudeAtRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetAttitudeAtRequest* internal_default_instance() {
+    return reinterpret_cast<const GetAttitudeAtRequest*>(
+               &_GetAttitudeAtRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(GetAttitudeAtRequest& a, GetAttitudeAtRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetAttitudeAtRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetAttitudeAtRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetAttitudeAtRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetAttitudeAtRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetAttitudeAtRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetAttitudeAtRequest& from) {
+    GetAttitudeAtRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetAttitudeAtRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.GetAttitudeAtRequest";
+  }
+  protected:
+  explicit GetAttitudeAtRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimeNsFieldNumber = 1,
+  };
+  // uint64 time_ns = 1;
+  void clear_time_ns();
+  uint64_t time_ns() const;
+  void set_time_ns(uint64_t value);
+  private:
+  uint64_t _internal_time_ns() const;
+  void _internal_set_time_ns(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.GetAttitudeAtRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t time_ns_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetAttitudeAtResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.GetAttitudeAtResponse) */ {
+ public:
+  inline GetAttitudeAtResponse() : GetAttitudeAtResponse(nullptr) {}
+  ~GetAttitudeAtResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetAttitudeAtResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetAttitudeAtResponse(const GetAttitudeAtResponse& from);
+  GetAttitudeAtResponse(GetAttitudeAtResponse&& from) noexcept
+    : GetAttitudeAtResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetAttitudeAtResponse& operator=(const GetAttitudeAtResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetAttitudeAtResponse& operator=(GetAttitudeAtResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetAttitudeAtResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetAttitudeAtResponse* internal_default_instance() {
+    return reinterpret_cast<const GetAttitudeAtResponse*>(
+               &_GetAttitudeAtResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(GetAttitudeAtResponse& a, GetAttitudeAtResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetAttitudeAtResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetAttitudeAtResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetAttitudeAtResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetAttitudeAtResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetAttitudeAtResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetAttitudeAtResponse& from) {
+    GetAttitudeAtResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetAttitudeAtResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.GetAttitudeAtResponse";
+  }
+  protected:
+  explicit GetAttitudeAtResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRollDegFieldNumber = 1,
+    kPitchDegFieldNumber = 2,
+    kYawDegFieldNumber = 3,
+    kQWFieldNumber = 4,
+    kQXFieldNumber = 5,
+    kQYFieldNumber = 6,
+    kQZFieldNumber = 7,
+  };
+  // float roll_deg = 1;
+  void clear_roll_deg();
+  float roll_deg() const;
+  void set_roll_deg(float value);
+  private:
+  float _internal_roll_deg() const;
+  void _internal_set_roll_deg(float value);
+  public:
+
+  // float pitch_deg = 2;
+  void clear_pitch_deg();
+  float pitch_deg() const;
+  void set_pitch_deg(float value);
+  private:
+  float _internal_pitch_deg() const;
+  void _internal_set_pitch_deg(float value);
+  public:
+
+  // float yaw_deg = 3;
+  void clear_yaw_deg();
+  float yaw_deg() const;
+  void set_yaw_deg(float value);
+  private:
+  float _internal_yaw_deg() const;
+  void _internal_set_yaw_deg(float value);
+  public:
+
+  // float q_w = 4;
+  void clear_q_w();
+  float q_w() const;
+  void set_q_w(float value);
+  private:
+  float _internal_q_w() const;
+  void _internal_set_q_w(float value);
+  public:
+
+  // float q_x = 5;
+  void clear_q_x();
+  float q_x() const;
+  void set_q_x(float value);
+  private:
+  float _internal_q_x() const;
+  void _internal_set_q_x(float value);
+  public:
+
+  // float q_y = 6;
+  void clear_q_y();
+  float q_y() const;
+  void set_q_y(float value);
+  private:
+  float _internal_q_y() const;
+  void _internal_set_q_y(float value);
+  public:
+
+  // float q_z = 7;
+  void clear_q_z();
+  float q_z() const;
+  void set_q_z(float value);
+  private:
+  float _internal_q_z() const;
+  void _internal_set_q_z(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.GetAttitudeAtResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float roll_deg_;
+    float pitch_deg_;
+    float yaw_deg_;
+    float q_w_;
+    float q_x_;
+    float q_y_;
+    float q_z_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetAttitudesAtRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.GetAttitudesAtRequest) */ {
+ public:
+  inline GetAttitudesAtRequest() : GetAttitudesAtRequest(nullptr) {}
+  ~GetAttitudesAtRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetAttitudesAtRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetAttitudesAtRequest(const GetAttitudesAtRequest& from);
+  GetAttitudesAtRequest(GetAttitudesAtRequest&& from) noexcept
+    : GetAttitudesAtRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetAttitudesAtRequest& operator=(const GetAttitudesAtRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetAttitudesAtRequest& operator=(GetAttitudesAtRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetAttitudesAtRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetAttitudesAtRequest* internal_default_instance() {
+    return reinterpret_cast<const GetAttitudesAtRequest*>(
+               &_GetAttitudesAtRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(GetAttitudesAtRequest& a, GetAttitudesAtRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetAttitudesAtRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetAttitudesAtRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetAttitudesAtRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetAttitudesAtRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetAttitudesAtRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetAttitudesAtRequest& from) {
+    GetAttitudesAtRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetAttitudesAtRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.GetAttitudesAtRequest";
+  }
+  protected:
+  explicit GetAttitudesAtRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimeNsFieldNumber = 1,
+  };
+  // repeated uint64 time_ns = 1;
+  int time_ns_size() const;
+  private:
+  int _internal_time_ns_size() const;
+  public:
+  void clear_time_ns();
+  private:
+  uint64_t _internal_time_ns(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_time_ns() const;
+  void _internal_add_time_ns(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_time_ns();
+  public:
+  uint64_t time_ns(int index) const;
+  void set_time_ns(int index, uint64_t value);
+  void add_time_ns(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      time_ns() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_time_ns();
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.GetAttitudesAtRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > time_ns_;
+    mutable std::atomic<int> _time_ns_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetAttitudesAtResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.GetAttitudesAtResponse) */ {
+ public:
+  inline GetAttitudesAtResponse() : GetAttitudesAtResponse(nullptr) {}
+  ~GetAttitudesAtResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetAttitudesAtResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetAttitudesAtResponse(const GetAttitudesAtResponse& from);
+  GetAttitudesAtResponse(GetAttitudesAtResponse&& from) noexcept
+    : GetAttitudesAtResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetAttitudesAtResponse& operator=(const GetAttitudesAtResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetAttitudesAtResponse& operator=(GetAttitudesAtResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetAttitudesAtResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetAttitudesAtResponse* internal_default_instance() {
+    return reinterpret_cast<const GetAttitudesAtResponse*>(
+               &_GetAttitudesAtResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(GetAttitudesAtResponse& a, GetAttitudesAtResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetAttitudesAtResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetAttitudesAtResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetAttitudesAtResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetAttitudesAtResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetAttitudesAtResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetAttitudesAtResponse& from) {
+    GetAttitudesAtResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetAttitudesAtResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.GetAttitudesAtResponse";
+  }
+  protected:
+  explicit GetAttitudesAtResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFoundFieldNumber = 1,
+    kRollDegFieldNumber = 2,
+    kPitchDegFieldNumber = 3,
+    kYawDegFieldNumber = 4,
+    kQWFieldNumber = 5,
+    kQXFieldNumber = 6,
+    kQYFieldNumber = 7,
+    kQZFieldNumber = 8,
+  };
+  // repeated bool found = 1;
+  int found_size() const;
+  private:
+  int _internal_found_size() const;
+  public:
+  void clear_found();
+  private:
+  bool _internal_found(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_found() const;
+  void _internal_add_found(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_found();
+  public:
+  bool found(int index) const;
+  void set_found(int index, bool value);
+  void add_found(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      found() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_found();
+
+  // repeated float roll_deg = 2;
+  int roll_deg_size() const;
+  private:
+  int _internal_roll_deg_size() const;
+  public:
+  void clear_roll_deg();
+  private:
+  float _internal_roll_deg(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_roll_deg() const;
+  void _internal_add_roll_deg(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_roll_deg();
+  public:
+  float roll_deg(int index) const;
+  void set_roll_deg(int index, float value);
+  void add_roll_deg(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      roll_deg() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_roll_deg();
+
+  // repeated float pitch_deg = 3;
+  int pitch_deg_size() const;
+  private:
+  int _internal_pitch_deg_size() const;
+  public:
+  void clear_pitch_deg();
+  private:
+  float _internal_pitch_deg(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_pitch_deg() const;
+  void _internal_add_pitch_deg(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_pitch_deg();
+  public:
+  float pitch_deg(int index) const;
+  void set_pitch_deg(int index, float value);
+  void add_pitch_deg(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      pitch_deg() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_pitch_deg();
+
+  // repeated float yaw_deg = 4;
+  int yaw_deg_size() const;
+  private:
+  int _internal_yaw_deg_size() const;
+  public:
+  void clear_yaw_deg();
+  private:
+  float _internal_yaw_deg(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_yaw_deg() const;
+  void _internal_add_yaw_deg(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_yaw_deg();
+  public:
+  float yaw_deg(int index) const;
+  void set_yaw_deg(int index, float value);
+  void add_yaw_deg(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      yaw_deg() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_yaw_deg();
+
+  // repeated float q_w = 5;
+  int q_w_size() const;
+  private:
+  int _internal_q_w_size() const;
+  public:
+  void clear_q_w();
+  private:
+  float _internal_q_w(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_q_w() const;
+  void _internal_add_q_w(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_q_w();
+  public:
+  float q_w(int index) const;
+  void set_q_w(int index, float value);
+  void add_q_w(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      q_w() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_q_w();
+
+  // repeated float q_x = 6;
+  int q_x_size() const;
+  private:
+  int _internal_q_x_size() const;
+  public:
+  void clear_q_x();
+  private:
+  float _internal_q_x(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_q_x() const;
+  void _internal_add_q_x(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_q_x();
+  public:
+  float q_x(int index) const;
+  void set_q_x(int index, float value);
+  void add_q_x(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      q_x() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_q_x();
+
+  // repeated float q_y = 7;
+  int q_y_size() const;
+  private:
+  int _internal_q_y_size() const;
+  public:
+  void clear_q_y();
+  private:
+  float _internal_q_y(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_q_y() const;
+  void _internal_add_q_y(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_q_y();
+  public:
+  float q_y(int index) const;
+  void set_q_y(int index, float value);
+  void add_q_y(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      q_y() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_q_y();
+
+  // repeated float q_z = 8;
+  int q_z_size() const;
+  private:
+  int _internal_q_z_size() const;
+  public:
+  void clear_q_z();
+  private:
+  float _internal_q_z(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_q_z() const;
+  void _internal_add_q_z(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_q_z();
+  public:
+  float q_z(int index) const;
+  void set_q_z(int index, float value);
+  void add_q_z(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      q_z() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_q_z();
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.GetAttitudesAtResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > found_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > roll_deg_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > pitch_deg_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > yaw_deg_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > q_w_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > q_x_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > q_y_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > q_z_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VisualServoRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.VisualServoRequest) */ {
+ public:
+  inline VisualServoRequest() : VisualServoRequest(nullptr) {}
+  ~VisualServoRequest() override;
+  explicit PROTOBUF_CONSTEXPR VisualServoRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VisualServoRequest(const VisualServoRequest& from);
+  VisualServoRequest(VisualServoRequest&& from) noexcept
+    : VisualServoRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline VisualServoRequest& operator=(const VisualServoRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VisualServoRequest& operator=(VisualServoRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VisualServoRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VisualServoRequest* internal_default_instance() {
+    return reinterpret_cast<const VisualServoRequest*>(
+               &_VisualServoRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(VisualServoRequest& a, VisualServoRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VisualServoRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VisualServoRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VisualServoRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VisualServoRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VisualServoRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VisualServoRequest& from) {
+    VisualServoRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VisualServoRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.VisualServoRequest";
+  }
+  protected:
+  explicit VisualServoRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGainsFieldNumber = 7,
+    kErrorXFieldNumber = 1,
+    kErrorYFieldNumber = 2,
+    kHorizontalFovDegFieldNumber = 3,
+    kVerticalFovDegFieldNumber = 4,
+    kCaptureTimeNsFieldNumber = 6,
+    kTargetLostFieldNumber = 5,
+  };
+  // .mavsdk.rpc.gimbal.ServoGains gains = 7;
+  bool has_gains() const;
+  private:
+  bool _internal_has_gains() const;
+  public:
+  void clear_gains();
+  const ::mavsdk::rpc::gimbal::ServoGains& gains() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::ServoGains* release_gains();
+  ::mavsdk::rpc::gimbal::ServoGains* mutable_gains();
+  void set_allocated_gains(::mavsdk::rpc::gimbal::ServoGains* gains);
+  private:
+  const ::mavsdk::rpc::gimbal::ServoGains& _internal_gains() const;
+  ::mavsdk::rpc::gimbal::ServoGains* _internal_mutable_gains();
+  public:
+  void unsafe_arena_set_allocated_gains(
+      ::mavsdk::rpc::gimbal::ServoGains* gains);
+  ::mavsdk::rpc::gimbal::ServoGains* unsafe_arena_release_gains();
+
+  // float error_x = 1;
+  void clear_error_x();
+  float error_x() const;
+  void set_error_x(float value);
+  private:
+  float _internal_error_x() const;
+  void _internal_set_error_x(float value);
+  public:
+
+  // float error_y = 2;
+  void clear_error_y();
+  float error_y() const;
+  void set_error_y(float value);
+  private:
+  float _internal_error_y() const;
+  void _internal_set_error_y(float value);
+  public:
+
+  // float horizontal_fov_deg = 3;
+  void clear_horizontal_fov_deg();
+  float horizontal_fov_deg() const;
+  void set_horizontal_fov_deg(float value);
+  private:
+  float _internal_horizontal_fov_deg() const;
+  void _internal_set_horizontal_fov_deg(float value);
+  public:
+
+  // float vertical_fov_deg = 4;
+  void clear_vertical_fov_deg();
+  float vertical_fov_deg() const;
+  void set_vertical_fov_deg(float value);
+  private:
+  float _internal_vertical_fov_deg() const;
+  void _internal_set_vertical_fov_deg(float value);
+  public:
+
+  // uint64 capture_time_ns = 6;
+  void clear_capture_time_ns();
+  uint64_t capture_time_ns() const;
+  void set_capture_time_ns(uint64_t value);
+  private:
+  uint64_t _internal_capture_time_ns() const;
+  void _internal_set_capture_time_ns(uint64_t value);
+  public:
+
+  // bool target_lost = 5;
+  void clear_target_lost();
+  bool target_lost() const;
+  void set_target_lost(bool value);
+  private:
+  bool _internal_target_lost() const;
+  void _internal_set_target_lost(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.VisualServoRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::mavsdk::rpc::gimbal::ServoGains* gains_;
+    float error_x_;
+    float error_y_;
+    float horizontal_fov_deg_;
+    float vertical_fov_deg_;
+    uint64_t capture_time_ns_;
+    bool target_lost_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class VisualServoStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.VisualServoStatus) */ {
+ public:
+  inline VisualServoStatus() : VisualServoStatus(nullptr) {}
+  ~VisualServoStatus() override;
+  explicit PROTOBUF_CONSTEXPR VisualServoStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  VisualServoStatus(const VisualServoStatus& from);
+  VisualServoStatus(VisualServoStatus&& from) noexcept
+    : VisualServoStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline VisualServoStatus& operator=(const VisualServoStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline VisualServoStatus& operator=(VisualServoStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VisualServoStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const VisualServoStatus* internal_default_instance() {
+    return reinterpret_cast<const VisualServoStatus*>(
+               &_VisualServoStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(VisualServoStatus& a, VisualServoStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(VisualServoStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(VisualServoStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  VisualServoStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<VisualServoStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const VisualServoStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VisualServoStatus& from) {
+    VisualServoStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(VisualServoStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.VisualServoStatus";
+  }
+  protected:
+  explicit VisualServoStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGainsFieldNumber = 10,
+    kPitchRateDegSFieldNumber = 1,
+    kYawRateDegSFieldNumber = 2,
+    kPitchErrorDegFieldNumber = 3,
+    kYawErrorDegFieldNumber = 4,
+    kTicksFieldNumber = 6,
+    kOverrunsFieldNumber = 7,
+    kLatenessAvgUsFieldNumber = 8,
+    kLatenessMaxUsFieldNumber = 9,
+    kTrackingFieldNumber = 5,
+  };
+  // .mavsdk.rpc.gimbal.ServoGains gains = 10;
+  bool has_gains() const;
+  private:
+  bool _internal_has_gains() const;
+  public:
+  void clear_gains();
+  const ::mavsdk::rpc::gimbal::ServoGains& gains() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::ServoGains* release_gains();
+  ::mavsdk::rpc::gimbal::ServoGains* mutable_gains();
+  void set_allocated_gains(::mavsdk::rpc::gimbal::ServoGains* gains);
+  private:
+  const ::mavsdk::rpc::gimbal::ServoGains& _internal_gains() const;
+  ::mavsdk::rpc::gimbal::ServoGains* _internal_mutable_gains();
+  public:
+  void unsafe_arena_set_allocated_gains(
+      ::mavsdk::rpc::gimbal::ServoGains* gains);
+  ::mavsdk::rpc::gimbal::ServoGains* unsafe_arena_release_gains();
+
+  // float pitch_rate_deg_s = 1;
+  void clear_pitch_rate_deg_s();
+  float pitch_rate_deg_s() const;
+  void set_pitch_rate_deg_s(float value);
+  private:
+  float _internal_pitch_rate_deg_s() const;
+  void _internal_set_pitch_rate_deg_s(float value);
+  public:
+
+  // float yaw_rate_deg_s = 2;
+  void clear_yaw_rate_deg_s();
+  float yaw_rate_deg_s() const;
+  void set_yaw_rate_deg_s(float value);
+  private:
+  float _internal_yaw_rate_deg_s() const;
+  void _internal_set_yaw_rate_deg_s(float value);
+  public:
+
+  // float pitch_error_deg = 3;
+  void clear_pitch_error_deg();
+  float pitch_error_deg() const;
+  void set_pitch_error_deg(float value);
+  private:
+  float _internal_pitch_error_deg() const;
+  void _internal_set_pitch_error_deg(float value);
+  public:
+
+  // float yaw_error_deg = 4;
+  void clear_yaw_error_deg();
+  float yaw_error_deg() const;
+  void set_yaw_error_deg(float value);
+  private:
+  float _internal_yaw_error_deg() const;
+  void _internal_set_yaw_error_deg(float value);
+  public:
+
+  // uint64 ticks = 6;
+  void clear_ticks();
+  uint64_t ticks() const;
+  void set_ticks(uint64_t value);
+  private:
+  uint64_t _internal_ticks() const;
+  void _internal_set_ticks(uint64_t value);
+  public:
+
+  // uint64 overruns = 7;
+  void clear_overruns();
+  uint64_t overruns() const;
+  void set_overruns(uint64_t value);
+  private:
+  uint64_t _internal_overruns() const;
+  void _internal_set_overruns(uint64_t value);
+  public:
+
+  // double lateness_avg_us = 8;
+  void clear_lateness_avg_us();
+  double lateness_avg_us() const;
+  void set_lateness_avg_us(double value);
+  private:
+  double _internal_lateness_avg_us() const;
+  void _internal_set_lateness_avg_us(double value);
+  public:
+
+  // double lateness_max_us = 9;
+  void clear_lateness_max_us();
+  double lateness_max_us() const;
+  void set_lateness_max_us(double value);
+  private:
+  double _internal_lateness_max_us() const;
+  void _internal_set_lateness_max_us(double value);
+  public:
+
+  // bool tracking = 5;
+  void clear_tracking();
+  bool tracking() const;
+  void set_tracking(bool value);
+  private:
+  bool _internal_tracking() const;
+  void _internal_set_tracking(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.VisualServoStatus)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::mavsdk::rpc::gimbal::ServoGains* gains_;
+    float pitch_rate_deg_s_;
+    float yaw_rate_deg_s_;
+    float pitch_error_deg_;
+    float yaw_error_deg_;
+    uint64_t ticks_;
+    uint64_t overruns_;
+    double lateness_avg_us_;
+    double lateness_max_us_;
+    bool tracking_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ApplyGimbalStateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.ApplyGimbalStateRequest) */ {
+ public:
+  inline ApplyGimbalStateRequest() : ApplyGimbalStateRequest(nullptr) {}
+  ~ApplyGimbalStateRequest() override;
+  explicit PROTOBUF_CONSTEXPR ApplyGimbalStateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ApplyGimbalStateRequest(const ApplyGimbalStateRequest& from);
+  ApplyGimbalStateRequest(ApplyGimbalStateRequest&& from) noexcept
+    : ApplyGimbalStateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ApplyGimbalStateRequest& operator=(const ApplyGimbalStateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ApplyGimbalStateRequest& operator=(ApplyGimbalStateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ApplyGimbalStateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  enum TargetCase {
+    kPitchAndYaw = 3,
+    kRoiLocation = 4,
+    TARGET_NOT_SET = 0,
+  };
+
+  static inline const ApplyGimbalStateRequest* internal_default_instance() {
+    return reinterpret_cast<const ApplyGimbalStateRequest*>(
+               &_ApplyGimbalStateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(ApplyGimbalStateRequest& a, ApplyGimbalStateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ApplyGimbalStateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ApplyGimbalStateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ApplyGimbalStateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ApplyGimbalStateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ApplyGimbalStateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ApplyGimbalStateRequest& from) {
+    ApplyGimbalStateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ApplyGimbalStateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.ApplyGimbalStateRequest";
+  }
+  protected:
+  explicit ApplyGimbalStateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTakeControlFieldNumber = 1,
+    kSetModeFieldNumber = 2,
+    kPitchAndYawFieldNumber = 3,
+    kRoiLocationFieldNumber = 4,
+  };
+  // .mavsdk.rpc.gimbal.TakeControlRequest take_control = 1;
+  bool has_take_control() const;
+  private:
+  bool _internal_has_take_control() const;
+  public:
+  void clear_take_control();
+  const ::mavsdk::rpc::gimbal::TakeControlRequest& take_control() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::TakeControlRequest* release_take_control();
+  ::mavsdk::rpc::gimbal::TakeControlRequest* mutable_take_control();
+  void set_allocated_take_control(::mavsdk::rpc::gimbal::TakeControlRequest* take_control);
+  private:
+  const ::mavsdk::rpc::gimbal::TakeControlRequest& _internal_take_control() const;
+  ::mavsdk::rpc::gimbal::TakeControlRequest* _internal_mutable_take_control();
+  public:
+  void unsafe_arena_set_allocated_take_control(
+      ::mavsdk::rpc::gimbal::TakeControlRequest* take_control);
+  ::mavsdk::rpc::gimbal::TakeControlRequest* unsafe_arena_release_take_control();
+
+  // .mavsdk.rpc.gimbal.SetModeRequest set_mode = 2;
+  bool has_set_mode() const;
+  private:
+  bool _internal_has_set_mode() const;
+  public:
+  void clear_set_mode();
+  const ::mavsdk::rpc::gimbal::SetModeRequest& set_mode() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::SetModeRequest* release_set_mode();
+  ::mavsdk::rpc::gimbal::SetModeRequest* mutable_set_mode();
+  void set_allocated_set_mode(::mavsdk::rpc::gimbal::SetModeRequest* set_mode);
+  private:
+  const ::mavsdk::rpc::gimbal::SetModeRequest& _internal_set_mode() const;
+  ::mavsdk::rpc::gimbal::SetModeRequest* _internal_mutable_set_mode();
+  public:
+  void unsafe_arena_set_allocated_set_mode(
+      ::mavsdk::rpc::gimbal::SetModeRequest* set_mode);
+  ::mavsdk::rpc::gimbal::SetModeRequest* unsafe_arena_release_set_mode();
+
+  // .mavsdk.rpc.gimbal.SetPitchAndYawRequest pitch_and_yaw = 3;
+  bool has_pitch_and_yaw() const;
+  private:
+  bool _internal_has_pitch_and_yaw() const;
+  public:
+  void clear_pitch_and_yaw();
+  const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest& pitch_and_yaw() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* release_pitch_and_yaw();
+  ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* mutable_pitch_and_yaw();
+  void set_allocated_pitch_and_yaw(::mavsdk::rpc::gimbal::SetPitchAndYawRequest* pitch_and_yaw);
+  private:
+  const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest& _internal_pitch_and_yaw() const;
+  ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* _internal_mutable_pitch_and_yaw();
+  public:
+  void unsafe_arena_set_allocated_pitch_and_yaw(
+      ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* pitch_and_yaw);
+  ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* unsafe_arena_release_pitch_and_yaw();
+
+  // .mavsdk.rpc.gimbal.SetRoiLocationRequest roi_location = 4;
+  bool has_roi_location() const;
+  private:
+  bool _internal_has_roi_location() const;
+  public:
+  void clear_roi_location();
+  const ::mavsdk::rpc::gimbal::SetRoiLocationRequest& roi_location() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::SetRoiLocationRequest* release_roi_location();
+  ::mavsdk::rpc::gimbal::SetRoiLocationRequest* mutable_roi_location();
+  void set_allocated_roi_location(::mavsdk::rpc::gimbal::SetRoiLocationRequest* roi_location);
+  private:
+  const ::mavsdk::rpc::gimbal::SetRoiLocationRequest& _internal_roi_location() const;
+  ::mavsdk::rpc::gimbal::SetRoiLocationRequest* _internal_mutable_roi_location();
+  public:
+  void unsafe_arena_set_allocated_roi_location(
+      ::mavsdk::rpc::gimbal::SetRoiLocationRequest* roi_location);
+  ::mavsdk::rpc::gimbal::SetRoiLocationRequest* unsafe_arena_release_roi_location();
+
+  void clear_target();
+  TargetCase target_case() const;
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.ApplyGimbalStateRequest)
+ private:
+  class _Internal;
+  void set_has_pitch_and_yaw();
+  void set_has_roi_location();
+
+  inline bool has_target() const;
+  inline void clear_has_target();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::mavsdk::rpc::gimbal::TakeControlRequest* take_control_;
+    ::mavsdk::rpc::gimbal::SetModeRequest* set_mode_;
+    union TargetUnion {
+      constexpr TargetUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* pitch_and_yaw_;
+      ::mavsdk::rpc::gimbal::SetRoiLocationRequest* roi_location_;
+    } target_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ApplyGimbalStateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.ApplyGimbalStateResponse) */ {
+ public:
+  inline ApplyGimbalStateResponse() : ApplyGimbalStateResponse(nullptr) {}
+  ~ApplyGimbalStateResponse() override;
+  explicit PROTOBUF_CONSTEXPR ApplyGimbalStateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ApplyGimbalStateResponse(const ApplyGimbalStateResponse& from);
+  ApplyGimbalStateResponse(ApplyGimbalStateResponse&& from) noexcept
+    : ApplyGimbalStateResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ApplyGimbalStateResponse& operator=(const ApplyGimbalStateResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ApplyGimbalStateResponse& operator=(ApplyGimbalStateResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ApplyGimbalStateResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ApplyGimbalStateResponse* internal_default_instance() {
+    return reinterpret_cast<const ApplyGimbalStateResponse*>(
+               &_ApplyGimbalStateResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(ApplyGimbalStateResponse& a, ApplyGimbalStateResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ApplyGimbalStateResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ApplyGimbalStateResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ApplyGimbalStateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ApplyGimbalStateResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ApplyGimbalStateResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ApplyGimbalStateResponse& from) {
+    ApplyGimbalStateResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ApplyGimbalStateResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.ApplyGimbalStateResponse";
+  }
+  protected:
+  explicit ApplyGimbalStateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGimbalResultFieldNumber = 1,
+    kControlResultFieldNumber = 2,
+    kModeResultFieldNumber = 3,
+    kTargetResultFieldNumber = 4,
+  };
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+  bool has_gimbal_result() const;
+  private:
+  bool _internal_has_gimbal_result() const;
+  public:
+  void clear_gimbal_result();
+  const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::GimbalResult* release_gimbal_result();
+  ::mavsdk::rpc::gimbal::GimbalResult* mutable_gimbal_result();
+  void set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result);
+  private:
+  const ::mavsdk::rpc::gimbal::GimbalResult& _internal_gimbal_result() const;
+  ::mavsdk::rpc::gimbal::GimbalResult* _internal_mutable_gimbal_result();
+  public:
+  void unsafe_arena_set_allocated_gimbal_result(
+      ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result);
+  ::mavsdk::rpc::gimbal::GimbalResult* unsafe_arena_release_gimbal_result();
+
+  // .mavsdk.rpc.gimbal.GimbalResult control_result = 2;
+  bool has_control_result() const;
+  private:
+  bool _internal_has_control_result() const;
+  public:
+  void clear_control_result();
+  const ::mavsdk::rpc::gimbal::GimbalResult& control_result() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::GimbalResult* release_control_result();
+  ::mavsdk::rpc::gimbal::GimbalResult* mutable_control_result();
+  void set_allocated_control_result(::mavsdk::rpc::gimbal::GimbalResult* control_result);
+  private:
+  const ::mavsdk::rpc::gimbal::GimbalResult& _internal_control_result() const;
+  ::mavsdk::rpc::gimbal::GimbalResult* _internal_mutable_control_result();
+  public:
+  void unsafe_arena_set_allocated_control_result(
+      ::mavsdk::rpc::gimbal::GimbalResult* control_result);
+  ::mavsdk::rpc::gimbal::GimbalResult* unsafe_arena_release_control_result();
+
+  // .mavsdk.rpc.gimbal.GimbalResult mode_result = 3;
+  bool has_mode_result() const;
+  private:
+  bool _internal_has_mode_result() const;
+  public:
+  void clear_mode_result();
+  const ::mavsdk::rpc::gimbal::GimbalResult& mode_result() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::GimbalResult* release_mode_result();
+  ::mavsdk::rpc::gimbal::GimbalResult* mutable_mode_result();
+  void set_allocated_mode_result(::mavsdk::rpc::gimbal::GimbalResult* mode_result);
+  private:
+  const ::mavsdk::rpc::gimbal::GimbalResult& _internal_mode_result() const;
+  ::mavsdk::rpc::gimbal::GimbalResult* _internal_mutable_mode_result();
+  public:
+  void unsafe_arena_set_allocated_mode_result(
+      ::mavsdk::rpc::gimbal::GimbalResult* mode_result);
+  ::mavsdk::rpc::gimbal::GimbalResult* unsafe_arena_release_mode_result();
+
+  // .mavsdk.rpc.gimbal.GimbalResult target_result = 4;
+  bool has_target_result() const;
+  private:
+  bool _internal_has_target_result() const;
+  public:
+  void clear_target_result();
+  const ::mavsdk::rpc::gimbal::GimbalResult& target_result() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::GimbalResult* release_target_result();
+  ::mavsdk::rpc::gimbal::GimbalResult* mutable_target_result();
+  void set_allocated_target_result(::mavsdk::rpc::gimbal::GimbalResult* target_result);
+  private:
+  const ::mavsdk::rpc::gimbal::GimbalResult& _internal_target_result() const;
+  ::mavsdk::rpc::gimbal::GimbalResult* _internal_mutable_target_result();
+  public:
+  void unsafe_arena_set_allocated_target_result(
+      ::mavsdk::rpc::gimbal::GimbalResult* target_result);
+  ::mavsdk::rpc::gimbal::GimbalResult* unsafe_arena_release_target_result();
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.ApplyGimbalStateResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result_;
+    ::mavsdk::rpc::gimbal::GimbalResult* control_result_;
+    ::mavsdk::rpc::gimbal::GimbalResult* mode_result_;
+    ::mavsdk::rpc::gimbal::GimbalResult* target_result_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetTracingRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.SetTracingRequest) */ {
+ public:
+  inline SetTracingRequest() : SetTracingRequest(nullptr) {}
+  ~SetTracingRequest() override;
+  explicit PROTOBUF_CONSTEXPR SetTracingRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetTracingRequest(const SetTracingRequest& from);
+  SetTracingRequest(SetTracingRequest&& from) noexcept
+    : SetTracingRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SetTracingRequest& operator=(const SetTracingRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetTracingRequest& operator=(SetTracingRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetTracingRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetTracingRequest* internal_default_instance() {
+    return reinterpret_cast<const SetTracingRequest*>(
+               &_SetTracingRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(SetTracingRequest& a, SetTracingRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetTracingRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetTracingRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetTracingRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetTracingRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetTracingRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetTracingRequest& from) {
+    SetTracingRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetTracingRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.SetTracingRequest";
+  }
+  protected:
+  explicit SetTracingRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEnabledFieldNumber = 1,
+    kClearFieldNumber = 2,
+  };
+  // bool enabled = 1;
+  void clear_enabled();
+  bool enabled() const;
+  void set_enabled(bool value);
+  private:
+  bool _internal_enabled() const;
+  void _internal_set_enabled(bool value);
+  public:
+
+  // bool clear = 2;
+  void clear_clear();
+  bool clear() const;
+  void set_clear(bool value);
+  private:
+  bool _internal_clear() const;
+  void _internal_set_clear(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.SetTracingRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool enabled_;
+    bool clear_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetTracingResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.SetTracingResponse) */ {
+ public:
+  inline SetTracingResponse() : SetTracingResponse(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR SetTracingResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetTracingResponse(const SetTracingResponse& from);
+  SetTracingResponse(SetTracingResponse&& from) noexcept
+    : SetTracingResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SetTracingResponse& operator=(const SetTracingResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetTracingResponse& operator=(SetTracingResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetTracingResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetTracingResponse* internal_default_instance() {
+    return reinterpret_cast<const SetTracingResponse*>(
+               &_SetTracingResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(SetTracingResponse& a, SetTracingResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetTracingResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetTracingResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetTracingResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetTracingResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const SetTracingResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const SetTracingResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.SetTracingResponse";
+  }
+  protected:
+  explicit SetTracingResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.SetTracingResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetTraceRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.GetTraceRequest) */ {
+ public:
+  inline GetTraceRequest() : GetTraceRequest(nullptr) {}
+  ~GetTraceRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetTraceRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetTraceRequest(const GetTraceRequest& from);
+  GetTraceRequest(GetTraceRequest&& from) noexcept
+    : GetTraceRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetTraceRequest& operator=(const GetTraceRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetTraceRequest& operator=(GetTraceRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetTraceRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetTraceRequest* internal_default_instance() {
+    return reinterpret_cast<const GetTraceRequest*>(
+               &_GetTraceRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(GetTraceRequest& a, GetTraceRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetTraceRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetTraceRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetTraceRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetTraceRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetTraceRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetTraceRequest& from) {
+    GetTraceRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetTraceRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.GetTraceRequest";
+  }
+  protected:
+  explicit GetTraceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFormatFieldNumber = 1,
+    kClearFieldNumber = 2,
+  };
+  // .mavsdk.rpc.gimbal.TraceFormat format = 1;
+  void clear_format();
+  ::mavsdk::rpc::gimbal::TraceFormat format() const;
+  void set_format(::mavsdk::rpc::gimbal::TraceFormat value);
+  private:
+  ::mavsdk::rpc::gimbal::TraceFormat _internal_format() const;
+  void _internal_set_format(::mavsdk::rpc::gimbal::TraceFormat value);
+  public:
+
+  // bool clear = 2;
+  void clear_clear();
+  bool clear() const;
+  void set_clear(bool value);
+  private:
+  bool _internal_clear() const;
+  void _internal_set_clear(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.GetTraceRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int format_;
+    bool clear_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetTraceResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.GetTraceResponse) */ {
+ public:
+  inline GetTraceResponse() : GetTraceResponse(nullptr) {}
+  ~GetTraceResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetTraceResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetTraceResponse(const GetTraceResponse& from);
+  GetTraceResponse(GetTraceResponse&& from) noexcept
+    : GetTraceResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetTraceResponse& operator=(const GetTraceResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetTraceResponse& operator=(GetTraceResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetTraceResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetTraceResponse* internal_default_instance() {
+    return reinterpret_cast<const GetTraceResponse*>(
+               &_GetTraceResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(GetTraceResponse& a, GetTraceResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetTraceResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetTraceResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetTraceResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetTraceResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetTraceResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetTraceResponse& from) {
+    GetTraceResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetTraceResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.GetTraceResponse";
+  }
+  protected:
+  explicit GetTraceResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTraceFieldNumber = 1,
+    kSpansFieldNumber = 2,
+    kOverwrittenFieldNumber = 3,
+  };
+  // bytes trace = 1;
+  void clear_trace();
+  const std::string& trace() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_trace(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_trace();
+  PROTOBUF_NODISCARD std::string* release_trace();
+  void set_allocated_trace(std::string* trace);
+  private:
+  const std::string& _internal_trace() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_trace(const std::string& value);
+  std::string* _internal_mutable_trace();
+  public:
+
+  // uint64 spans = 2;
+  void clear_spans();
+  uint64_t spans() const;
+  void set_spans(uint64_t value);
+  private:
+  uint64_t _internal_spans() const;
+  void _internal_set_spans(uint64_t value);
+  public:
+
+  // uint64 overwritten = 3;
+  void clear_overwritten();
+  uint64_t overwritten() const;
+  void set_overwritten(uint64_t value);
+  private:
+  uint64_t _internal_overwritten() const;
+  void _internal_set_overwritten(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.GetTraceResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr trace_;
+    uint64_t spans_;
+    uint64_t overwritten_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ControlStatus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.ControlStatus) */ {
+ public:
+  inline ControlStatus() : ControlStatus(nullptr) {}
+  ~ControlStatus() override;
+  explicit PROTOBUF_CONSTEXPR ControlStatus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ControlStatus(const ControlStatus& from);
+  ControlStatus(ControlStatus&& from) noexcept
+    : ControlStatus() {
+    *this = ::std::move(from);
+  }
+
+  inline ControlStatus& operator=(const ControlStatus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ControlStatus& operator=(ControlStatus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ControlStatus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ControlStatus* internal_default_instance() {
+    return reinterpret_cast<const ControlStatus*>(
+               &_ControlStatus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(ControlStatus& a, ControlStatus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ControlStatus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ControlStatus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ControlStatus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ControlStatus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ControlStatus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ControlStatus& from) {
+    ControlStatus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ControlStatus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.ControlStatus";
+  }
+  protected:
+  explicit ControlStatus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kControlModeFieldNumber = 1,
+    kSysidPrimaryControlFieldNumber = 2,
+    kCompidPrimaryControlFieldNumber = 3,
+    kSysidSecondaryControlFieldNumber = 4,
+    kCompidSecondaryControlFieldNumber = 5,
+  };
+  // .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
+  void clear_control_mode();
+  ::mavsdk::rpc::gimbal::ControlMode control_mode() const;
+  void set_control_mode(::mavsdk::rpc::gimbal::ControlMode value);
+  private:
+  ::mavsdk::rpc::gimbal::ControlMode _internal_control_mode() const;
+  void _internal_set_control_mode(::mavsdk::rpc::gimbal::ControlMode value);
+  public:
+
+  // int32 sysid_primary_control = 2;
+  void clear_sysid_primary_control();
+  int32_t sysid_primary_control() const;
+  void set_sysid_primary_control(int32_t value);
+  private:
+  int32_t _internal_sysid_primary_control() const;
+  void _internal_set_sysid_primary_control(int32_t value);
+  public:
+
+  // int32 compid_primary_control = 3;
+  void clear_compid_primary_control();
+  int32_t compid_primary_control() const;
+  void set_compid_primary_control(int32_t value);
+  private:
+  int32_t _internal_compid_primary_control() const;
+  void _internal_set_compid_primary_control(int32_t value);
+  public:
+
+  // int32 sysid_secondary_control = 4;
+  void clear_sysid_secondary_control();
+  int32_t sysid_secondary_control() const;
+  void set_sysid_secondary_control(int32_t value);
+  private:
+  int32_t _internal_sysid_secondary_control() const;
+  void _internal_set_sysid_secondary_control(int32_t value);
+  public:
+
+  // int32 compid_secondary_control = 5;
+  void clear_compid_secondary_control();
+  int32_t compid_secondary_control() const;
+  void set_compid_secondary_control(int32_t value);
+  private:
+  int32_t _internal_compid_secondary_control() const;
+  void _internal_set_compid_secondary_control(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.ControlStatus)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int control_mode_;
+    int32_t sysid_primary_control_;
+    int32_t compid_primary_control_;
+    int32_t sysid_secondary_control_;
+    int32_t compid_secondary_control_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TelemetryRate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.TelemetryRate) */ {
+ public:
+  inline TelemetryRate() : TelemetryRate(nullptr) {}
+  ~TelemetryRate() override;
+  explicit PROTOBUF_CONSTEXPR TelemetryRate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TelemetryRate(const TelemetryRate& from);
+  TelemetryRate(TelemetryRate&& from) noexcept
+    : TelemetryRate() {
+    *this = ::std::move(from);
+  }
+
+  inline TelemetryRate& operator=(const TelemetryRate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TelemetryRate& operator=(TelemetryRate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TelemetryRate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TelemetryRate* internal_default_instance() {
+    return reinterpret_cast<const TelemetryRate*>(
+               &_TelemetryRate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(TelemetryRate& a, TelemetryRate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TelemetryRate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TelemetryRate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TelemetryRate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TelemetryRate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TelemetryRate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TelemetryRate& from) {
+    TelemetryRate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TelemetryRate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.TelemetryRate";
+  }
+  protected:
+  explicit TelemetryRate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRateHzFieldNumber = 2,
+    kStreamFieldNumber = 1,
+  };
+  // double rate_hz = 2;
+  void clear_rate_hz();
+  double rate_hz() const;
+  void set_rate_hz(double value);
+  private:
+  double _internal_rate_hz() const;
+  void _internal_set_rate_hz(double value);
+  public:
+
+  // .mavsdk.rpc.gimbal.TelemetryStream stream = 1;
+  void clear_stream();
+  ::mavsdk::rpc::gimbal::TelemetryStream stream() const;
+  void set_stream(::mavsdk::rpc::gimbal::TelemetryStream value);
+  private:
+  ::mavsdk::rpc::gimbal::TelemetryStream _internal_stream() const;
+  void _internal_set_stream(::mavsdk::rpc::gimbal::TelemetryStream value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.TelemetryRate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double rate_hz_;
+    int stream_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MavlinkFilter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.MavlinkFilter) */ {
+ public:
+  inline MavlinkFilter() : MavlinkFilter(nullptr) {}
+  ~MavlinkFilter() override;
+  explicit PROTOBUF_CONSTEXPR MavlinkFilter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MavlinkFilter(const MavlinkFilter& from);
+  MavlinkFilter(MavlinkFilter&& from) noexcept
+    : MavlinkFilter() {
+    *this = ::std::move(from);
+  }
+
+  inline MavlinkFilter& operator=(const MavlinkFilter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MavlinkFilter& operator=(MavlinkFilter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MavlinkFilter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MavlinkFilter* internal_default_instance() {
+    return reinterpret_cast<const MavlinkFilter*>(
+               &_MavlinkFilter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    39;
+
+  friend void swap(MavlinkFilter& a, MavlinkFilter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MavlinkFilter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MavlinkFilter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MavlinkFilter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MavlinkFilter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MavlinkFilter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MavlinkFilter& from) {
+    MavlinkFilter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MavlinkFilter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.MavlinkFilter";
+  }
+  protected:
+  explicit MavlinkFilter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageIdsFieldNumber = 1,
+  };
+  // repeated uint32 message_ids = 1;
+  int message_ids_size() const;
+  private:
+  int _internal_message_ids_size() const;
+  public:
+  void clear_message_ids();
+  private:
+  uint32_t _internal_message_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_message_ids() const;
+  void _internal_add_message_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_message_ids();
+  public:
+  uint32_t message_ids(int index) const;
+  void set_message_ids(int index, uint32_t value);
+  void add_message_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      message_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_message_ids();
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.MavlinkFilter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > message_ids_;
+    mutable std::atomic<int> _message_ids_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AttitudeBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.AttitudeBatch) */ {
+ public:
+  inline AttitudeBatch() : AttitudeBatch(nullptr) {}
+  ~AttitudeBatch() override;
+  explicit PROTOBUF_CONSTEXPR AttitudeBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AttitudeBatch(const AttitudeBatch& from);
+  AttitudeBatch(AttitudeBatch&& from) noexcept
+    : AttitudeBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline AttitudeBatch& operator=(const AttitudeBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AttitudeBatch& operator=(AttitudeBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AttitudeBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AttitudeBatch* internal_default_instance() {
+    return reinterpret_cast<const AttitudeBatch*>(
+               &_AttitudeBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    40;
+
+  friend void swap(AttitudeBatch& a, AttitudeBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AttitudeBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AttitudeBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AttitudeBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AttitudeBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AttitudeBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AttitudeBatch& from) {
+    AttitudeBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AttitudeBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.AttitudeBatch";
+  }
+  protected:
+  explicit AttitudeBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTimeDeltaMsFieldNumber = 2,
+    kRollCdegFieldNumber = 3,
+    kPitchCdegFieldNumber = 4,
+    kYawCdegFieldNumber = 5,
+    kBaseTimestampMsFieldNumber = 1,
+    kBaseWallTimeMsFieldNumber = 6,
+  };
+  // repeated sint32 time_delta_ms = 2;
+  int time_delta_ms_size() const;
+  private:
+  int _internal_time_delta_ms_size() const;
+  public:
+  void clear_time_delta_ms();
+  private:
+  int32_t _internal_time_delta_ms(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_time_delta_ms() const;
+  void _internal_add_time_delta_ms(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_time_delta_ms();
+  public:
+  int32_t time_delta_ms(int index) const;
+  void set_time_delta_ms(int index, int32_t value);
+  void add_time_delta_ms(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      time_delta_ms() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_time_delta_ms();
+
+  // repeated sint32 roll_cdeg = 3;
+  int roll_cdeg_size() const;
+  private:
+  int _internal_roll_cdeg_size() const;
+  public:
+  void clear_roll_cdeg();
+  private:
+  int32_t _internal_roll_cdeg(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_roll_cdeg() const;
+  void _internal_add_roll_cdeg(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_roll_cdeg();
+  public:
+  int32_t roll_cdeg(int index) const;
+  void set_roll_cdeg(int index, int32_t value);
+  void add_roll_cdeg(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      roll_cdeg() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_roll_cdeg();
+
+  // repeated sint32 pitch_cdeg = 4;
+  int pitch_cdeg_size() const;
+  private:
+  int _internal_pitch_cdeg_size() const;
+  public:
+  void clear_pitch_cdeg();
+  private:
+  int32_t _internal_pitch_cdeg(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_pitch_cdeg() const;
+  void _internal_add_pitch_cdeg(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_pitch_cdeg();
+  public:
+  int32_t pitch_cdeg(int index) const;
+  void set_pitch_cdeg(int index, int32_t value);
+  void add_pitch_cdeg(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      pitch_cdeg() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_pitch_cdeg();
+
+  // repeated sint32 yaw_cdeg = 5;
+  int yaw_cdeg_size() const;
+  private:
+  int _internal_yaw_cdeg_size() const;
+  public:
+  void clear_yaw_cdeg();
+  private:
+  int32_t _internal_yaw_cdeg(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_yaw_cdeg() const;
+  void _internal_add_yaw_cdeg(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_yaw_cdeg();
+  public:
+  int32_t yaw_cdeg(int index) const;
+  void set_yaw_cdeg(int index, int32_t value);
+  void add_yaw_cdeg(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      yaw_cdeg() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_yaw_cdeg();
+
+  // uint64 base_timestamp_ms = 1;
+  void clear_base_timestamp_ms();
+  uint64_t base_timestamp_ms() const;
+  void set_base_timestamp_ms(uint64_t value);
+  private:
+  uint64_t _internal_base_timestamp_ms() const;
+  void _internal_set_base_timestamp_ms(uint64_t value);
+  public:
+
+  // uint64 base_wall_time_ms = 6;
+  void clear_base_wall_time_ms();
+  uint64_t base_wall_time_ms() const;
+  void set_base_wall_time_ms(uint64_t value);
+  private:
+  uint64_t _internal_base_wall_time_ms() const;
+  void _internal_set_base_wall_time_ms(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.AttitudeBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > time_delta_ms_;
+    mutable std::atomic<int> _time_delta_ms_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > roll_cdeg_;
+    mutable std::atomic<int> _roll_cdeg_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > pitch_cdeg_;
+    mutable std::atomic<int> _pitch_cdeg_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > yaw_cdeg_;
+    mutable std::atomic<int> _yaw_cdeg_cached_byte_size_;
+    uint64_t base_timestamp_ms_;
+    uint64_t base_wall_time_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Setpoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.Setpoint) */ {
+ public:
+  inline Setpoint() : Setpoint(nullptr) {}
+  ~Setpoint() override;
+  explicit PROTOBUF_CONSTEXPR Setpoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Setpoint(const Setpoint& from);
+  Setpoint(Setpoint&& from) noexcept
+    : Setpoint() {
+    *this = ::std::move(from);
+  }
+
+  inline Setpoint& operator=(const Setpoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Setpoint& operator=(Setpoint&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Setpoint& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Setpoint* internal_default_instance() {
+    return reinterpret_cast<const Setpoint*>(
+               &_Setpoint_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    41;
+
+  friend void swap(Setpoint& a, Setpoint& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Setpoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Setpoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Setpoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Setpoint>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Setpoint& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Setpoint& from) {
+    Setpoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Setpoint* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.Setpoint";
+  }
+  protected:
+  explicit Setpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSequenceFieldNumber = 1,
+    kModeFieldNumber = 2,
+    kPitchDegFieldNumber = 3,
+    kYawDegFieldNumber = 4,
+    kPitchRateDegSFieldNumber = 5,
+    kApplyTimeNsFieldNumber = 7,
+    kYawRateDegSFieldNumber = 6,
+    kJitterBufferedFieldNumber = 8,
+    kSampleTimeUsFieldNumber = 9,
+  };
+  // uint64 sequence = 1;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // .mavsdk.rpc.gimbal.SetpointMode mode = 2;
+  void clear_mode();
+  ::mavsdk::rpc::gimbal::SetpointMode mode() const;
+  void set_mode(::mavsdk::rpc::gimbal::SetpointMode value);
+  private:
+  ::mavsdk::rpc::gimbal::SetpointMode _internal_mode() const;
+  void _internal_set_mode(::mavsdk::rpc::gimbal::SetpointMode value);
+  public:
+
+  // float pitch_deg = 3;
+  void clear_pitch_deg();
+  float pitch_deg() const;
+  void set_pitch_deg(float value);
+  private:
+  float _internal_pitch_deg() const;
+  void _internal_set_pitch_deg(float value);
+  public:
+
+  // float yaw_deg = 4;
+  void clear_yaw_deg();
+  float yaw_deg() const;
+  void set_yaw_deg(float value);
+  private:
+  float _internal_yaw_deg() const;
+  void _internal_set_yaw_deg(float value);
+  public:
+
+  // float pitch_rate_deg_s = 5;
+  void clear_pitch_rate_deg_s();
+  float pitch_rate_deg_s() const;
+  void set_pitch_rate_deg_s(float value);
+  private:
+  float _internal_pitch_rate_deg_s() const;
+  void _internal_set_pitch_rate_deg_s(float value);
+  public:
+
+  // uint64 apply_time_ns = 7;
+  void clear_apply_time_ns();
+  uint64_t apply_time_ns() const;
+  void set_apply_time_ns(uint64_t value);
+  private:
+  uint64_t _internal_apply_time_ns() const;
+  void _internal_set_apply_time_ns(uint64_t value);
+  public:
+
+  // float yaw_rate_deg_s = 6;
+  void clear_yaw_rate_deg_s();
+  float yaw_rate_deg_s() const;
+  void set_yaw_rate_deg_s(float value);
+  private:
+  float _internal_yaw_rate_deg_s() const;
+  void _internal_set_yaw_rate_deg_s(float value);
+  public:
+
+  // bool jitter_buffered = 8;
+  void clear_jitter_buffered();
+  bool jitter_buffered() const;
+  void set_jitter_buffered(bool value);
+  private:
+  bool _internal_jitter_buffered() const;
+  void _internal_set_jitter_buffered(bool value);
+  public:
+
+  // uint64 sample_time_us = 9;
+  void clear_sample_time_us();
+  uint64_t sample_time_us() const;
+  void set_sample_time_us(uint64_t value);
+  private:
+  uint64_t _internal_sample_time_us() const;
+  void _internal_set_sample_time_us(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.Setpoint)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t sequence_;
+    int mode_;
+    float pitch_deg_;
+    float yaw_deg_;
+    float pitch_rate_deg_s_;
+    uint64_t apply_time_ns_;
+    float yaw_rate_deg_s_;
+    bool jitter_buffered_;
+    uint64_t sample_time_us_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetpointAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.SetpointAck) */ {
+ public:
+  inline SetpointAck() : SetpointAck(nullptr) {}
+  ~SetpointAck() override;
+  explicit PROTOBUF_CONSTEXPR SetpointAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetpointAck(const SetpointAck& from);
+  SetpointAck(SetpointAck&& from) noexcept
+    : SetpointAck() {
+    *this = ::std::move(from);
+  }
+
+  inline SetpointAck& operator=(const SetpointAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetpointAck& operator=(SetpointAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetpointAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetpointAck* internal_default_instance() {
+    return reinterpret_cast<const SetpointAck*>(
+               &_SetpointAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    42;
+
+  friend void swap(SetpointAck& a, SetpointAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetpointAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetpointAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetpointAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetpointAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetpointAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetpointAck& from) {
+    SetpointAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetpointAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.SetpointAck";
+  }
+  protected:
+  explicit SetpointAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGimbalResultFieldNumber = 2,
+    kSequenceFieldNumber = 1,
+  };
+  // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 2;
+  bool has_gimbal_result() const;
+  private:
+  bool _internal_has_gimbal_result() const;
+  public:
+  void clear_gimbal_result();
+  const ::mavsdk::rpc::gimbal::GimbalResult& gimbal_result() const;
+  PROTOBUF_NODISCARD ::mavsdk::rpc::gimbal::GimbalResult* release_gimbal_result();
+  ::mavsdk::rpc::gimbal::GimbalResult* mutable_gimbal_result();
+  void set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result);
+  private:
+  const ::mavsdk::rpc::gimbal::GimbalResult& _internal_gimbal_result() const;
+  ::mavsdk::rpc::gimbal::GimbalResult* _internal_mutable_gimbal_result();
+  public:
+  void unsafe_arena_set_allocated_gimbal_result(
+      ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result);
+  ::mavsdk::rpc::gimbal::GimbalResult* unsafe_arena_release_gimbal_result();
+
+  // uint64 sequence = 1;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.SetpointAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result_;
+    uint64_t sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServoGains final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.ServoGains) */ {
+ public:
+  inline ServoGains() : ServoGains(nullptr) {}
+  ~ServoGains() override;
+  explicit PROTOBUF_CONSTEXPR ServoGains(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServoGains(const ServoGains& from);
+  ServoGains(ServoGains&& from) noexcept
+    : ServoGains() {
+    *this = ::std::move(from);
+  }
+
+  inline ServoGains& operator=(const ServoGains& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServoGains& operator=(ServoGains&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServoGains& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServoGains* internal_default_instance() {
+    return reinterpret_cast<const ServoGains*>(
+               &_ServoGains_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    43;
+
+  friend void swap(ServoGains& a, ServoGains& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServoGains* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServoGains* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServoGains* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServoGains>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServoGains& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServoGains& from) {
+    ServoGains::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServoGains* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.ServoGains";
+  }
+  protected:
+  explicit ServoGains(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKpFieldNumber = 1,
+    kKiFieldNumber = 2,
+    kKdFieldNumber = 3,
+    kKffFieldNumber = 4,
+    kMaxRateDegSFieldNumber = 5,
+  };
+  // float kp = 1;
+  void clear_kp();
+  float kp() const;
+  void set_kp(float value);
+  private:
+  float _internal_kp() const;
+  void _internal_set_kp(float value);
+  public:
+
+  // float ki = 2;
+  void clear_ki();
+  float ki() const;
+  void set_ki(float value);
+  private:
+  float _internal_ki() const;
+  void _internal_set_ki(float value);
+  public:
+
+  // float kd = 3;
+  void clear_kd();
+  float kd() const;
+  void set_kd(float value);
+  private:
+  float _internal_kd() const;
+  void _internal_set_kd(float value);
+  public:
+
+  // float kff = 4;
+  void clear_kff();
+  float kff() const;
+  void set_kff(float value);
+  private:
+  float _internal_kff() const;
+  void _internal_set_kff(float value);
+  public:
+
+  // float max_rate_deg_s = 5;
+  void clear_max_rate_deg_s();
+  float max_rate_deg_s() const;
+  void set_max_rate_deg_s(float value);
+  private:
+  float _internal_max_rate_deg_s() const;
+  void _internal_set_max_rate_deg_s(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.ServoGains)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float kp_;
+    float ki_;
+    float kd_;
+    float kff_;
+    float max_rate_deg_s_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MotionProfile final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.MotionProfile) */ {
+ public:
+  inline MotionProfile() : MotionProfile(nullptr) {}
+  ~MotionProfile() override;
+  explicit PROTOBUF_CONSTEXPR MotionProfile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MotionProfile(const MotionProfile& from);
+  MotionProfile(MotionProfile&& from) noexcept
+    : MotionProfile() {
+    *this = ::std::move(from);
+  }
+
+  inline MotionProfile& operator=(const MotionProfile& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MotionProfile& operator=(MotionProfile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MotionProfile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MotionProfile* internal_default_instance() {
+    return reinterpret_cast<const MotionProfile*>(
+               &_MotionProfile_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    44;
+
+  friend void swap(MotionProfile& a, MotionProfile& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MotionProfile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MotionProfile* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MotionProfile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MotionProfile>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MotionProfile& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MotionProfile& from) {
+    MotionProfile::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MotionProfile* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.MotionProfile";
+  }
+  protected:
+  explicit MotionProfile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kShapeFieldNumber = 1,
+    kMaxVelocityDegSFieldNumber = 2,
+    kMaxAccelerationDegS2FieldNumber = 3,
+    kMaxJerkDegS3FieldNumber = 4,
+    kRateHzFieldNumber = 5,
+  };
+  // .mavsdk.rpc.gimbal.ProfileShape shape = 1;
+  void clear_shape();
+  ::mavsdk::rpc::gimbal::ProfileShape shape() const;
+  void set_shape(::mavsdk::rpc::gimbal::ProfileShape value);
+  private:
+  ::mavsdk::rpc::gimbal::ProfileShape _internal_shape() const;
+  void _internal_set_shape(::mavsdk::rpc::gimbal::ProfileShape value);
+  public:
+
+  // float max_velocity_deg_s = 2;
+  void clear_max_velocity_deg_s();
+  float max_velocity_deg_s() const;
+  void set_max_velocity_deg_s(float value);
+  private:
+  float _internal_max_velocity_deg_s() const;
+  void _internal_set_max_velocity_deg_s(float value);
+  public:
+
+  // float max_acceleration_deg_s2 = 3;
+  void clear_max_acceleration_deg_s2();
+  float max_acceleration_deg_s2() const;
+  void set_max_acceleration_deg_s2(float value);
+  private:
+  float _internal_max_acceleration_deg_s2() const;
+  void _internal_set_max_acceleration_deg_s2(float value);
+  public:
+
+  // float max_jerk_deg_s3 = 4;
+  void clear_max_jerk_deg_s3();
+  float max_jerk_deg_s3() const;
+  void set_max_jerk_deg_s3(float value);
+  private:
+  float _internal_max_jerk_deg_s3() const;
+  void _internal_set_max_jerk_deg_s3(float value);
+  public:
+
+  // float rate_hz = 5;
+  void clear_rate_hz();
+  float rate_hz() const;
+  void set_rate_hz(float value);
+  private:
+  float _internal_rate_hz() const;
+  void _internal_set_rate_hz(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.MotionProfile)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int shape_;
+    float max_velocity_deg_s_;
+    float max_acceleration_deg_s2_;
+    float max_jerk_deg_s3_;
+    float rate_hz_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Metric final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.Metric) */ {
+ public:
+  inline Metric() : Metric(nullptr) {}
+  ~Metric() override;
+  explicit PROTOBUF_CONSTEXPR Metric(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Metric(const Metric& from);
+  Metric(Metric&& from) noexcept
+    : Metric() {
+    *this = ::std::move(from);
+  }
+
+  inline Metric& operator=(const Metric& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Metric& operator=(Metric&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Metric& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Metric* internal_default_instance() {
+    return reinterpret_cast<const Metric*>(
+               &_Metric_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    45;
+
+  friend void swap(Metric& a, Metric& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Metric* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Metric* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Metric* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Metric>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Metric& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Metric& from) {
+    Metric::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Metric* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.Metric";
+  }
+  protected:
+  explicit Metric(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // double value = 2;
+  void clear_value();
+  double value() const;
+  void set_value(double value);
+  private:
+  double _internal_value() const;
+  void _internal_set_value(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.Metric)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    double value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GimbalResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.gimbal.GimbalResult) */ {
+ public:
+  inline GimbalResult() : GimbalResult(nullptr) {}
+  ~GimbalResult() override;
+  explicit PROTOBUF_CONSTEXPR GimbalResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GimbalResult(const GimbalResult& from);
+  GimbalResult(GimbalResult&& from) noexcept
+    : GimbalResult() {
+    *this = ::std::move(from);
+  }
+
+  inline GimbalResult& operator=(const GimbalResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GimbalResult& operator=(GimbalResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GimbalResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GimbalResult* internal_default_instance() {
+    return reinterpret_cast<const GimbalResult*>(
+               &_GimbalResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    46;
+
+  friend void swap(GimbalResult& a, GimbalResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GimbalResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GimbalResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GimbalResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GimbalResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GimbalResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GimbalResult& from) {
+    GimbalResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GimbalResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.gimbal.GimbalResult";
+  }
+  protected:
+  explicit GimbalResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2649,150 +8611,3194 @@ class GimbalResult final :
   static inline bool Result_IsValid(int value) {
     return GimbalResult_Result_IsValid(value);
   }
-  static constexpr Result Result_MIN =
-    GimbalResult_Result_Result_MIN;
-  static constexpr Result Result_MAX =
-    GimbalResult_Result_Result_MAX;
-  static constexpr int Result_ARRAYSIZE =
-    GimbalResult_Result_Result_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  Result_descriptor() {
-    return GimbalResult_Result_descriptor();
+  static constexpr Result Result_MIN =
+    GimbalResult_Result_Result_MIN;
+  static constexpr Result Result_MAX =
+    GimbalResult_Result_Result_MAX;
+  static constexpr int Result_ARRAYSIZE =
+    GimbalResult_Result_Result_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Result_descriptor() {
+    return GimbalResult_Result_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Result_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Result>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Result_Name.");
+    return GimbalResult_Result_Name(enum_t_value);
+  }
+  static inline bool Result_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Result* value) {
+    return GimbalResult_Result_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultStrFieldNumber = 2,
+    kResultFieldNumber = 1,
+  };
+  // string result_str = 2;
+  void clear_result_str();
+  const std::string& result_str() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result_str(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result_str();
+  PROTOBUF_NODISCARD std::string* release_result_str();
+  void set_allocated_result_str(std::string* result_str);
+  private:
+  const std::string& _internal_result_str() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result_str(const std::string& value);
+  std::string* _internal_mutable_result_str();
+  public:
+
+  // .mavsdk.rpc.gimbal.GimbalResult.Result result = 1;
+  void clear_result();
+  ::mavsdk::rpc::gimbal::GimbalResult_Result result() const;
+  void set_result(::mavsdk::rpc::gimbal::GimbalResult_Result value);
+  private:
+  ::mavsdk::rpc::gimbal::GimbalResult_Result _internal_result() const;
+  void _internal_set_result(::mavsdk::rpc::gimbal::GimbalResult_Result value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.GimbalResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_str_;
+    int result_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_gimbal_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SetPitchAndYawRequest
+
+// float pitch_deg = 1;
+inline void SetPitchAndYawRequest::clear_pitch_deg() {
+  _impl_.pitch_deg_ = 0;
+}
+inline float SetPitchAndYawRequest::_internal_pitch_deg() const {
+  return _impl_.pitch_deg_;
+}
+inline float SetPitchAndYawRequest::pitch_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchAndYawRequest.pitch_deg)
+  return _internal_pitch_deg();
+}
+inline void SetPitchAndYawRequest::_internal_set_pitch_deg(float value) {
+  
+  _impl_.pitch_deg_ = value;
+}
+inline void SetPitchAndYawRequest::set_pitch_deg(float value) {
+  _internal_set_pitch_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetPitchAndYawRequest.pitch_deg)
+}
+
+// float yaw_deg = 2;
+inline void SetPitchAndYawRequest::clear_yaw_deg() {
+  _impl_.yaw_deg_ = 0;
+}
+inline float SetPitchAndYawRequest::_internal_yaw_deg() const {
+  return _impl_.yaw_deg_;
+}
+inline float SetPitchAndYawRequest::yaw_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchAndYawRequest.yaw_deg)
+  return _internal_yaw_deg();
+}
+inline void SetPitchAndYawRequest::_internal_set_yaw_deg(float value) {
+  
+  _impl_.yaw_deg_ = value;
+}
+inline void SetPitchAndYawRequest::set_yaw_deg(float value) {
+  _internal_set_yaw_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetPitchAndYawRequest.yaw_deg)
+}
+
+// .mavsdk.rpc.gimbal.MotionProfile profile = 3;
+inline bool SetPitchAndYawRequest::_internal_has_profile() const {
+  return this != internal_default_instance() && _impl_.profile_ != nullptr;
+}
+inline bool SetPitchAndYawRequest::has_profile() const {
+  return _internal_has_profile();
+}
+inline void SetPitchAndYawRequest::clear_profile() {
+  if (GetArenaForAllocation() == nullptr && _impl_.profile_ != nullptr) {
+    delete _impl_.profile_;
+  }
+  _impl_.profile_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::MotionProfile& SetPitchAndYawRequest::_internal_profile() const {
+  const ::mavsdk::rpc::gimbal::MotionProfile* p = _impl_.profile_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::MotionProfile&>(
+      ::mavsdk::rpc::gimbal::_MotionProfile_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::MotionProfile& SetPitchAndYawRequest::profile() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchAndYawRequest.profile)
+  return _internal_profile();
+}
+inline void SetPitchAndYawRequest::unsafe_arena_set_allocated_profile(
+    ::mavsdk::rpc::gimbal::MotionProfile* profile) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.profile_);
+  }
+  _impl_.profile_ = profile;
+  if (profile) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.SetPitchAndYawRequest.profile)
+}
+inline ::mavsdk::rpc::gimbal::MotionProfile* SetPitchAndYawRequest::release_profile() {
+  
+  ::mavsdk::rpc::gimbal::MotionProfile* temp = _impl_.profile_;
+  _impl_.profile_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::MotionProfile* SetPitchAndYawRequest::unsafe_arena_release_profile() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.SetPitchAndYawRequest.profile)
+  
+  ::mavsdk::rpc::gimbal::MotionProfile* temp = _impl_.profile_;
+  _impl_.profile_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::MotionProfile* SetPitchAndYawRequest::_internal_mutable_profile() {
+  
+  if (_impl_.profile_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::MotionProfile>(GetArenaForAllocation());
+    _impl_.profile_ = p;
+  }
+  return _impl_.profile_;
+}
+inline ::mavsdk::rpc::gimbal::MotionProfile* SetPitchAndYawRequest::mutable_profile() {
+  ::mavsdk::rpc::gimbal::MotionProfile* _msg = _internal_mutable_profile();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetPitchAndYawRequest.profile)
+  return _msg;
+}
+inline void SetPitchAndYawRequest::set_allocated_profile(::mavsdk::rpc::gimbal::MotionProfile* profile) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.profile_;
+  }
+  if (profile) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(profile);
+    if (message_arena != submessage_arena) {
+      profile = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, profile, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.profile_ = profile;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.SetPitchAndYawRequest.profile)
+}
+
+// -------------------------------------------------------------------
+
+// SetPitchAndYawResponse
+
+// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+inline bool SetPitchAndYawResponse::_internal_has_gimbal_result() const {
+  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+}
+inline bool SetPitchAndYawResponse::has_gimbal_result() const {
+  return _internal_has_gimbal_result();
+}
+inline void SetPitchAndYawResponse::clear_gimbal_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetPitchAndYawResponse::_internal_gimbal_result() const {
+  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
+      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetPitchAndYawResponse::gimbal_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchAndYawResponse.gimbal_result)
+  return _internal_gimbal_result();
+}
+inline void SetPitchAndYawResponse::unsafe_arena_set_allocated_gimbal_result(
+    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  if (gimbal_result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.SetPitchAndYawResponse.gimbal_result)
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchAndYawResponse::release_gimbal_result() {
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchAndYawResponse::unsafe_arena_release_gimbal_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.SetPitchAndYawResponse.gimbal_result)
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchAndYawResponse::_internal_mutable_gimbal_result() {
+  
+  if (_impl_.gimbal_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
+    _impl_.gimbal_result_ = p;
+  }
+  return _impl_.gimbal_result_;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchAndYawResponse::mutable_gimbal_result() {
+  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetPitchAndYawResponse.gimbal_result)
+  return _msg;
+}
+inline void SetPitchAndYawResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  if (gimbal_result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
+    if (message_arena != submessage_arena) {
+      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gimbal_result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.SetPitchAndYawResponse.gimbal_result)
+}
+
+// -------------------------------------------------------------------
+
+// SetPitchRateAndYawRateRequest
+
+// float pitch_rate_deg_s = 1;
+inline void SetPitchRateAndYawRateRequest::clear_pitch_rate_deg_s() {
+  _impl_.pitch_rate_deg_s_ = 0;
+}
+inline float SetPitchRateAndYawRateRequest::_internal_pitch_rate_deg_s() const {
+  return _impl_.pitch_rate_deg_s_;
+}
+inline float SetPitchRateAndYawRateRequest::pitch_rate_deg_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest.pitch_rate_deg_s)
+  return _internal_pitch_rate_deg_s();
+}
+inline void SetPitchRateAndYawRateRequest::_internal_set_pitch_rate_deg_s(float value) {
+  
+  _impl_.pitch_rate_deg_s_ = value;
+}
+inline void SetPitchRateAndYawRateRequest::set_pitch_rate_deg_s(float value) {
+  _internal_set_pitch_rate_deg_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest.pitch_rate_deg_s)
+}
+
+// float yaw_rate_deg_s = 2;
+inline void SetPitchRateAndYawRateRequest::clear_yaw_rate_deg_s() {
+  _impl_.yaw_rate_deg_s_ = 0;
+}
+inline float SetPitchRateAndYawRateRequest::_internal_yaw_rate_deg_s() const {
+  return _impl_.yaw_rate_deg_s_;
+}
+inline float SetPitchRateAndYawRateRequest::yaw_rate_deg_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest.yaw_rate_deg_s)
+  return _internal_yaw_rate_deg_s();
+}
+inline void SetPitchRateAndYawRateRequest::_internal_set_yaw_rate_deg_s(float value) {
+  
+  _impl_.yaw_rate_deg_s_ = value;
+}
+inline void SetPitchRateAndYawRateRequest::set_yaw_rate_deg_s(float value) {
+  _internal_set_yaw_rate_deg_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest.yaw_rate_deg_s)
+}
+
+// -------------------------------------------------------------------
+
+// SetPitchRateAndYawRateResponse
+
+// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+inline bool SetPitchRateAndYawRateResponse::_internal_has_gimbal_result() const {
+  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+}
+inline bool SetPitchRateAndYawRateResponse::has_gimbal_result() const {
+  return _internal_has_gimbal_result();
+}
+inline void SetPitchRateAndYawRateResponse::clear_gimbal_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetPitchRateAndYawRateResponse::_internal_gimbal_result() const {
+  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
+      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetPitchRateAndYawRateResponse::gimbal_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse.gimbal_result)
+  return _internal_gimbal_result();
+}
+inline void SetPitchRateAndYawRateResponse::unsafe_arena_set_allocated_gimbal_result(
+    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  if (gimbal_result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse.gimbal_result)
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchRateAndYawRateResponse::release_gimbal_result() {
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchRateAndYawRateResponse::unsafe_arena_release_gimbal_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse.gimbal_result)
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchRateAndYawRateResponse::_internal_mutable_gimbal_result() {
+  
+  if (_impl_.gimbal_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
+    _impl_.gimbal_result_ = p;
+  }
+  return _impl_.gimbal_result_;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchRateAndYawRateResponse::mutable_gimbal_result() {
+  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse.gimbal_result)
+  return _msg;
+}
+inline void SetPitchRateAndYawRateResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  if (gimbal_result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
+    if (message_arena != submessage_arena) {
+      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gimbal_result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse.gimbal_result)
+}
+
+// -------------------------------------------------------------------
+
+// SetModeRequest
+
+// .mavsdk.rpc.gimbal.GimbalMode gimbal_mode = 1;
+inline void SetModeRequest::clear_gimbal_mode() {
+  _impl_.gimbal_mode_ = 0;
+}
+inline ::mavsdk::rpc::gimbal::GimbalMode SetModeRequest::_internal_gimbal_mode() const {
+  return static_cast< ::mavsdk::rpc::gimbal::GimbalMode >(_impl_.gimbal_mode_);
+}
+inline ::mavsdk::rpc::gimbal::GimbalMode SetModeRequest::gimbal_mode() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetModeRequest.gimbal_mode)
+  return _internal_gimbal_mode();
+}
+inline void SetModeRequest::_internal_set_gimbal_mode(::mavsdk::rpc::gimbal::GimbalMode value) {
+  
+  _impl_.gimbal_mode_ = value;
+}
+inline void SetModeRequest::set_gimbal_mode(::mavsdk::rpc::gimbal::GimbalMode value) {
+  _internal_set_gimbal_mode(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetModeRequest.gimbal_mode)
+}
+
+// -------------------------------------------------------------------
+
+// SetModeResponse
+
+// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+inline bool SetModeResponse::_internal_has_gimbal_result() const {
+  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+}
+inline bool SetModeResponse::has_gimbal_result() const {
+  return _internal_has_gimbal_result();
+}
+inline void SetModeResponse::clear_gimbal_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetModeResponse::_internal_gimbal_result() const {
+  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
+      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetModeResponse::gimbal_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetModeResponse.gimbal_result)
+  return _internal_gimbal_result();
+}
+inline void SetModeResponse::unsafe_arena_set_allocated_gimbal_result(
+    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  if (gimbal_result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.SetModeResponse.gimbal_result)
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetModeResponse::release_gimbal_result() {
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetModeResponse::unsafe_arena_release_gimbal_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.SetModeResponse.gimbal_result)
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetModeResponse::_internal_mutable_gimbal_result() {
+  
+  if (_impl_.gimbal_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
+    _impl_.gimbal_result_ = p;
+  }
+  return _impl_.gimbal_result_;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetModeResponse::mutable_gimbal_result() {
+  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetModeResponse.gimbal_result)
+  return _msg;
+}
+inline void SetModeResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  if (gimbal_result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
+    if (message_arena != submessage_arena) {
+      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gimbal_result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.SetModeResponse.gimbal_result)
+}
+
+// -------------------------------------------------------------------
+
+// SetRoiLocationRequest
+
+// double latitude_deg = 1;
+inline void SetRoiLocationRequest::clear_latitude_deg() {
+  _impl_.latitude_deg_ = 0;
+}
+inline double SetRoiLocationRequest::_internal_latitude_deg() const {
+  return _impl_.latitude_deg_;
+}
+inline double SetRoiLocationRequest::latitude_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetRoiLocationRequest.latitude_deg)
+  return _internal_latitude_deg();
+}
+inline void SetRoiLocationRequest::_internal_set_latitude_deg(double value) {
+  
+  _impl_.latitude_deg_ = value;
+}
+inline void SetRoiLocationRequest::set_latitude_deg(double value) {
+  _internal_set_latitude_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetRoiLocationRequest.latitude_deg)
+}
+
+// double longitude_deg = 2;
+inline void SetRoiLocationRequest::clear_longitude_deg() {
+  _impl_.longitude_deg_ = 0;
+}
+inline double SetRoiLocationRequest::_internal_longitude_deg() const {
+  return _impl_.longitude_deg_;
+}
+inline double SetRoiLocationRequest::longitude_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetRoiLocationRequest.longitude_deg)
+  return _internal_longitude_deg();
+}
+inline void SetRoiLocationRequest::_internal_set_longitude_deg(double value) {
+  
+  _impl_.longitude_deg_ = value;
+}
+inline void SetRoiLocationRequest::set_longitude_deg(double value) {
+  _internal_set_longitude_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetRoiLocationRequest.longitude_deg)
+}
+
+// float altitude_m = 3;
+inline void SetRoiLocationRequest::clear_altitude_m() {
+  _impl_.altitude_m_ = 0;
+}
+inline float SetRoiLocationRequest::_internal_altitude_m() const {
+  return _impl_.altitude_m_;
+}
+inline float SetRoiLocationRequest::altitude_m() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetRoiLocationRequest.altitude_m)
+  return _internal_altitude_m();
+}
+inline void SetRoiLocationRequest::_internal_set_altitude_m(float value) {
+  
+  _impl_.altitude_m_ = value;
+}
+inline void SetRoiLocationRequest::set_altitude_m(float value) {
+  _internal_set_altitude_m(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetRoiLocationRequest.altitude_m)
+}
+
+// -------------------------------------------------------------------
+
+// SetRoiLocationResponse
+
+// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+inline bool SetRoiLocationResponse::_internal_has_gimbal_result() const {
+  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+}
+inline bool SetRoiLocationResponse::has_gimbal_result() const {
+  return _internal_has_gimbal_result();
+}
+inline void SetRoiLocationResponse::clear_gimbal_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetRoiLocationResponse::_internal_gimbal_result() const {
+  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
+      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetRoiLocationResponse::gimbal_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetRoiLocationResponse.gimbal_result)
+  return _internal_gimbal_result();
+}
+inline void SetRoiLocationResponse::unsafe_arena_set_allocated_gimbal_result(
+    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  if (gimbal_result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.SetRoiLocationResponse.gimbal_result)
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetRoiLocationResponse::release_gimbal_result() {
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetRoiLocationResponse::unsafe_arena_release_gimbal_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.SetRoiLocationResponse.gimbal_result)
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetRoiLocationResponse::_internal_mutable_gimbal_result() {
+  
+  if (_impl_.gimbal_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
+    _impl_.gimbal_result_ = p;
+  }
+  return _impl_.gimbal_result_;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetRoiLocationResponse::mutable_gimbal_result() {
+  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetRoiLocationResponse.gimbal_result)
+  return _msg;
+}
+inline void SetRoiLocationResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  if (gimbal_result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
+    if (message_arena != submessage_arena) {
+      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gimbal_result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.SetRoiLocationResponse.gimbal_result)
+}
+
+// -------------------------------------------------------------------
+
+// TakeControlRequest
+
+// .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
+inline void TakeControlRequest::clear_control_mode() {
+  _impl_.control_mode_ = 0;
+}
+inline ::mavsdk::rpc::gimbal::ControlMode TakeControlRequest::_internal_control_mode() const {
+  return static_cast< ::mavsdk::rpc::gimbal::ControlMode >(_impl_.control_mode_);
+}
+inline ::mavsdk::rpc::gimbal::ControlMode TakeControlRequest::control_mode() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.TakeControlRequest.control_mode)
+  return _internal_control_mode();
+}
+inline void TakeControlRequest::_internal_set_control_mode(::mavsdk::rpc::gimbal::ControlMode value) {
+  
+  _impl_.control_mode_ = value;
+}
+inline void TakeControlRequest::set_control_mode(::mavsdk::rpc::gimbal::ControlMode value) {
+  _internal_set_control_mode(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.TakeControlRequest.control_mode)
+}
+
+// bool force = 2;
+inline void TakeControlRequest::clear_force() {
+  _impl_.force_ = false;
+}
+inline bool TakeControlRequest::_internal_force() const {
+  return _impl_.force_;
+}
+inline bool TakeControlRequest::force() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.TakeControlRequest.force)
+  return _internal_force();
+}
+inline void TakeControlRequest::_internal_set_force(bool value) {
+  
+  _impl_.force_ = value;
+}
+inline void TakeControlRequest::set_force(bool value) {
+  _internal_set_force(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.TakeControlRequest.force)
+}
+
+// -------------------------------------------------------------------
+
+// TakeControlResponse
+
+// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+inline bool TakeControlResponse::_internal_has_gimbal_result() const {
+  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+}
+inline bool TakeControlResponse::has_gimbal_result() const {
+  return _internal_has_gimbal_result();
+}
+inline void TakeControlResponse::clear_gimbal_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& TakeControlResponse::_internal_gimbal_result() const {
+  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
+      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& TakeControlResponse::gimbal_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.TakeControlResponse.gimbal_result)
+  return _internal_gimbal_result();
+}
+inline void TakeControlResponse::unsafe_arena_set_allocated_gimbal_result(
+    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  if (gimbal_result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.TakeControlResponse.gimbal_result)
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* TakeControlResponse::release_gimbal_result() {
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* TakeControlResponse::unsafe_arena_release_gimbal_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.TakeControlResponse.gimbal_result)
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* TakeControlResponse::_internal_mutable_gimbal_result() {
+  
+  if (_impl_.gimbal_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
+    _impl_.gimbal_result_ = p;
+  }
+  return _impl_.gimbal_result_;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* TakeControlResponse::mutable_gimbal_result() {
+  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.TakeControlResponse.gimbal_result)
+  return _msg;
+}
+inline void TakeControlResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  if (gimbal_result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
+    if (message_arena != submessage_arena) {
+      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gimbal_result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.TakeControlResponse.gimbal_result)
+}
+
+// -------------------------------------------------------------------
+
+// ReleaseControlRequest
+
+// bool force = 1;
+inline void ReleaseControlRequest::clear_force() {
+  _impl_.force_ = false;
+}
+inline bool ReleaseControlRequest::_internal_force() const {
+  return _impl_.force_;
+}
+inline bool ReleaseControlRequest::force() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ReleaseControlRequest.force)
+  return _internal_force();
+}
+inline void ReleaseControlRequest::_internal_set_force(bool value) {
+  
+  _impl_.force_ = value;
+}
+inline void ReleaseControlRequest::set_force(bool value) {
+  _internal_set_force(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ReleaseControlRequest.force)
+}
+
+// -------------------------------------------------------------------
+
+// ReleaseControlResponse
+
+// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+inline bool ReleaseControlResponse::_internal_has_gimbal_result() const {
+  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+}
+inline bool ReleaseControlResponse::has_gimbal_result() const {
+  return _internal_has_gimbal_result();
+}
+inline void ReleaseControlResponse::clear_gimbal_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& ReleaseControlResponse::_internal_gimbal_result() const {
+  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
+      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& ReleaseControlResponse::gimbal_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ReleaseControlResponse.gimbal_result)
+  return _internal_gimbal_result();
+}
+inline void ReleaseControlResponse::unsafe_arena_set_allocated_gimbal_result(
+    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  if (gimbal_result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ReleaseControlResponse.gimbal_result)
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* ReleaseControlResponse::release_gimbal_result() {
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* ReleaseControlResponse::unsafe_arena_release_gimbal_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ReleaseControlResponse.gimbal_result)
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* ReleaseControlResponse::_internal_mutable_gimbal_result() {
+  
+  if (_impl_.gimbal_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
+    _impl_.gimbal_result_ = p;
+  }
+  return _impl_.gimbal_result_;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* ReleaseControlResponse::mutable_gimbal_result() {
+  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ReleaseControlResponse.gimbal_result)
+  return _msg;
+}
+inline void ReleaseControlResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  if (gimbal_result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
+    if (message_arena != submessage_arena) {
+      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gimbal_result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ReleaseControlResponse.gimbal_result)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeControlRequest
+
+// -------------------------------------------------------------------
+
+// ControlResponse
+
+// .mavsdk.rpc.gimbal.ControlStatus control_status = 1;
+inline bool ControlResponse::_internal_has_control_status() const {
+  return this != internal_default_instance() && _impl_.control_status_ != nullptr;
+}
+inline bool ControlResponse::has_control_status() const {
+  return _internal_has_control_status();
+}
+inline void ControlResponse::clear_control_status() {
+  if (GetArenaForAllocation() == nullptr && _impl_.control_status_ != nullptr) {
+    delete _impl_.control_status_;
+  }
+  _impl_.control_status_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::ControlStatus& ControlResponse::_internal_control_status() const {
+  const ::mavsdk::rpc::gimbal::ControlStatus* p = _impl_.control_status_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::ControlStatus&>(
+      ::mavsdk::rpc::gimbal::_ControlStatus_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::ControlStatus& ControlResponse::control_status() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlResponse.control_status)
+  return _internal_control_status();
+}
+inline void ControlResponse::unsafe_arena_set_allocated_control_status(
+    ::mavsdk::rpc::gimbal::ControlStatus* control_status) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.control_status_);
+  }
+  _impl_.control_status_ = control_status;
+  if (control_status) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ControlResponse.control_status)
+}
+inline ::mavsdk::rpc::gimbal::ControlStatus* ControlResponse::release_control_status() {
+  
+  ::mavsdk::rpc::gimbal::ControlStatus* temp = _impl_.control_status_;
+  _impl_.control_status_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::ControlStatus* ControlResponse::unsafe_arena_release_control_status() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ControlResponse.control_status)
+  
+  ::mavsdk::rpc::gimbal::ControlStatus* temp = _impl_.control_status_;
+  _impl_.control_status_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::ControlStatus* ControlResponse::_internal_mutable_control_status() {
+  
+  if (_impl_.control_status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::ControlStatus>(GetArenaForAllocation());
+    _impl_.control_status_ = p;
+  }
+  return _impl_.control_status_;
+}
+inline ::mavsdk::rpc::gimbal::ControlStatus* ControlResponse::mutable_control_status() {
+  ::mavsdk::rpc::gimbal::ControlStatus* _msg = _internal_mutable_control_status();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ControlResponse.control_status)
+  return _msg;
+}
+inline void ControlResponse::set_allocated_control_status(::mavsdk::rpc::gimbal::ControlStatus* control_status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.control_status_;
+  }
+  if (control_status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(control_status);
+    if (message_arena != submessage_arena) {
+      control_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, control_status, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.control_status_ = control_status;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ControlResponse.control_status)
+}
+
+// -------------------------------------------------------------------
+
+// GetMetricsRequest
+
+// -------------------------------------------------------------------
+
+// GetMetricsResponse
+
+// repeated .mavsdk.rpc.gimbal.Metric metrics = 1;
+inline int GetMetricsResponse::_internal_metrics_size() const {
+  return _impl_.metrics_.size();
+}
+inline int GetMetricsResponse::metrics_size() const {
+  return _internal_metrics_size();
+}
+inline void GetMetricsResponse::clear_metrics() {
+  _impl_.metrics_.Clear();
+}
+inline ::mavsdk::rpc::gimbal::Metric* GetMetricsResponse::mutable_metrics(int index) {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.GetMetricsResponse.metrics)
+  return _impl_.metrics_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mavsdk::rpc::gimbal::Metric >*
+GetMetricsResponse::mutable_metrics() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.GetMetricsResponse.metrics)
+  return &_impl_.metrics_;
+}
+inline const ::mavsdk::rpc::gimbal::Metric& GetMetricsResponse::_internal_metrics(int index) const {
+  return _impl_.metrics_.Get(index);
+}
+inline const ::mavsdk::rpc::gimbal::Metric& GetMetricsResponse::metrics(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetMetricsResponse.metrics)
+  return _internal_metrics(index);
+}
+inline ::mavsdk::rpc::gimbal::Metric* GetMetricsResponse::_internal_add_metrics() {
+  return _impl_.metrics_.Add();
+}
+inline ::mavsdk::rpc::gimbal::Metric* GetMetricsResponse::add_metrics() {
+  ::mavsdk::rpc::gimbal::Metric* _add = _internal_add_metrics();
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.GetMetricsResponse.metrics)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mavsdk::rpc::gimbal::Metric >&
+GetMetricsResponse::metrics() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.GetMetricsResponse.metrics)
+  return _impl_.metrics_;
+}
+
+// -------------------------------------------------------------------
+
+// SetTelemetryRatesRequest
+
+// repeated .mavsdk.rpc.gimbal.TelemetryRate rates = 1;
+inline int SetTelemetryRatesRequest::_internal_rates_size() const {
+  return _impl_.rates_.size();
+}
+inline int SetTelemetryRatesRequest::rates_size() const {
+  return _internal_rates_size();
+}
+inline void SetTelemetryRatesRequest::clear_rates() {
+  _impl_.rates_.Clear();
+}
+inline ::mavsdk::rpc::gimbal::TelemetryRate* SetTelemetryRatesRequest::mutable_rates(int index) {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetTelemetryRatesRequest.rates)
+  return _impl_.rates_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mavsdk::rpc::gimbal::TelemetryRate >*
+SetTelemetryRatesRequest::mutable_rates() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.SetTelemetryRatesRequest.rates)
+  return &_impl_.rates_;
+}
+inline const ::mavsdk::rpc::gimbal::TelemetryRate& SetTelemetryRatesRequest::_internal_rates(int index) const {
+  return _impl_.rates_.Get(index);
+}
+inline const ::mavsdk::rpc::gimbal::TelemetryRate& SetTelemetryRatesRequest::rates(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetTelemetryRatesRequest.rates)
+  return _internal_rates(index);
+}
+inline ::mavsdk::rpc::gimbal::TelemetryRate* SetTelemetryRatesRequest::_internal_add_rates() {
+  return _impl_.rates_.Add();
+}
+inline ::mavsdk::rpc::gimbal::TelemetryRate* SetTelemetryRatesRequest::add_rates() {
+  ::mavsdk::rpc::gimbal::TelemetryRate* _add = _internal_add_rates();
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.SetTelemetryRatesRequest.rates)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mavsdk::rpc::gimbal::TelemetryRate >&
+SetTelemetryRatesRequest::rates() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.SetTelemetryRatesRequest.rates)
+  return _impl_.rates_;
+}
+
+// -------------------------------------------------------------------
+
+// SetTelemetryRatesResponse
+
+// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
+inline bool SetTelemetryRatesResponse::_internal_has_gimbal_result() const {
+  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+}
+inline bool SetTelemetryRatesResponse::has_gimbal_result() const {
+  return _internal_has_gimbal_result();
+}
+inline void SetTelemetryRatesResponse::clear_gimbal_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  _impl_.gimbal_result_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetTelemetryRatesResponse::_internal_gimbal_result() const {
+  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
+      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetTelemetryRatesResponse::gimbal_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetTelemetryRatesResponse.gimbal_result)
+  return _internal_gimbal_result();
+}
+inline void SetTelemetryRatesResponse::unsafe_arena_set_allocated_gimbal_result(
+    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  if (gimbal_result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.SetTelemetryRatesResponse.gimbal_result)
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetTelemetryRatesResponse::release_gimbal_result() {
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetTelemetryRatesResponse::unsafe_arena_release_gimbal_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.SetTelemetryRatesResponse.gimbal_result)
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetTelemetryRatesResponse::_internal_mutable_gimbal_result() {
+  
+  if (_impl_.gimbal_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
+    _impl_.gimbal_result_ = p;
+  }
+  return _impl_.gimbal_result_;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetTelemetryRatesResponse::mutable_gimbal_result() {
+  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetTelemetryRatesResponse.gimbal_result)
+  return _msg;
+}
+inline void SetTelemetryRatesResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.gimbal_result_;
+  }
+  if (gimbal_result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
+    if (message_arena != submessage_arena) {
+      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gimbal_result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.gimbal_result_ = gimbal_result;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.SetTelemetryRatesResponse.gimbal_result)
+}
+
+// -------------------------------------------------------------------
+
+// MavlinkTunnelRequest
+
+// bytes frames = 1;
+inline void MavlinkTunnelRequest::clear_frames() {
+  _impl_.frames_.ClearToEmpty();
+}
+inline const std::string& MavlinkTunnelRequest::frames() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.MavlinkTunnelRequest.frames)
+  return _internal_frames();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MavlinkTunnelRequest::set_frames(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.frames_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.MavlinkTunnelRequest.frames)
+}
+inline std::string* MavlinkTunnelRequest::mutable_frames() {
+  std::string* _s = _internal_mutable_frames();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.MavlinkTunnelRequest.frames)
+  return _s;
+}
+inline const std::string& MavlinkTunnelRequest::_internal_frames() const {
+  return _impl_.frames_.Get();
+}
+inline void MavlinkTunnelRequest::_internal_set_frames(const std::string& value) {
+  
+  _impl_.frames_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MavlinkTunnelRequest::_internal_mutable_frames() {
+  
+  return _impl_.frames_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MavlinkTunnelRequest::release_frames() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.MavlinkTunnelRequest.frames)
+  return _impl_.frames_.Release();
+}
+inline void MavlinkTunnelRequest::set_allocated_frames(std::string* frames) {
+  if (frames != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.frames_.SetAllocated(frames, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.frames_.IsDefault()) {
+    _impl_.frames_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.MavlinkTunnelRequest.frames)
+}
+
+// .mavsdk.rpc.gimbal.MavlinkFilter filter = 2;
+inline bool MavlinkTunnelRequest::_internal_has_filter() const {
+  return this != internal_default_instance() && _impl_.filter_ != nullptr;
+}
+inline bool MavlinkTunnelRequest::has_filter() const {
+  return _internal_has_filter();
+}
+inline void MavlinkTunnelRequest::clear_filter() {
+  if (GetArenaForAllocation() == nullptr && _impl_.filter_ != nullptr) {
+    delete _impl_.filter_;
+  }
+  _impl_.filter_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::MavlinkFilter& MavlinkTunnelRequest::_internal_filter() const {
+  const ::mavsdk::rpc::gimbal::MavlinkFilter* p = _impl_.filter_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::MavlinkFilter&>(
+      ::mavsdk::rpc::gimbal::_MavlinkFilter_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::MavlinkFilter& MavlinkTunnelRequest::filter() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.MavlinkTunnelRequest.filter)
+  return _internal_filter();
+}
+inline void MavlinkTunnelRequest::unsafe_arena_set_allocated_filter(
+    ::mavsdk::rpc::gimbal::MavlinkFilter* filter) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.filter_);
+  }
+  _impl_.filter_ = filter;
+  if (filter) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.MavlinkTunnelRequest.filter)
+}
+inline ::mavsdk::rpc::gimbal::MavlinkFilter* MavlinkTunnelRequest::release_filter() {
+  
+  ::mavsdk::rpc::gimbal::MavlinkFilter* temp = _impl_.filter_;
+  _impl_.filter_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::MavlinkFilter* MavlinkTunnelRequest::unsafe_arena_release_filter() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.MavlinkTunnelRequest.filter)
+  
+  ::mavsdk::rpc::gimbal::MavlinkFilter* temp = _impl_.filter_;
+  _impl_.filter_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::MavlinkFilter* MavlinkTunnelRequest::_internal_mutable_filter() {
+  
+  if (_impl_.filter_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::MavlinkFilter>(GetArenaForAllocation());
+    _impl_.filter_ = p;
+  }
+  return _impl_.filter_;
+}
+inline ::mavsdk::rpc::gimbal::MavlinkFilter* MavlinkTunnelRequest::mutable_filter() {
+  ::mavsdk::rpc::gimbal::MavlinkFilter* _msg = _internal_mutable_filter();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.MavlinkTunnelRequest.filter)
+  return _msg;
+}
+inline void MavlinkTunnelRequest::set_allocated_filter(::mavsdk::rpc::gimbal::MavlinkFilter* filter) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.filter_;
+  }
+  if (filter) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(filter);
+    if (message_arena != submessage_arena) {
+      filter = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, filter, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.filter_ = filter;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.MavlinkTunnelRequest.filter)
+}
+
+// -------------------------------------------------------------------
+
+// MavlinkTunnelResponse
+
+// bytes frames = 1;
+inline void MavlinkTunnelResponse::clear_frames() {
+  _impl_.frames_.ClearToEmpty();
+}
+inline const std::string& MavlinkTunnelResponse::frames() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.MavlinkTunnelResponse.frames)
+  return _internal_frames();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MavlinkTunnelResponse::set_frames(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.frames_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.MavlinkTunnelResponse.frames)
+}
+inline std::string* MavlinkTunnelResponse::mutable_frames() {
+  std::string* _s = _internal_mutable_frames();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.MavlinkTunnelResponse.frames)
+  return _s;
+}
+inline const std::string& MavlinkTunnelResponse::_internal_frames() const {
+  return _impl_.frames_.Get();
+}
+inline void MavlinkTunnelResponse::_internal_set_frames(const std::string& value) {
+  
+  _impl_.frames_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MavlinkTunnelResponse::_internal_mutable_frames() {
+  
+  return _impl_.frames_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MavlinkTunnelResponse::release_frames() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.MavlinkTunnelResponse.frames)
+  return _impl_.frames_.Release();
+}
+inline void MavlinkTunnelResponse::set_allocated_frames(std::string* frames) {
+  if (frames != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.frames_.SetAllocated(frames, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.frames_.IsDefault()) {
+    _impl_.frames_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.MavlinkTunnelResponse.frames)
+}
+
+// uint32 dropped_frames = 2;
+inline void MavlinkTunnelResponse::clear_dropped_frames() {
+  _impl_.dropped_frames_ = 0u;
+}
+inline uint32_t MavlinkTunnelResponse::_internal_dropped_frames() const {
+  return _impl_.dropped_frames_;
+}
+inline uint32_t MavlinkTunnelResponse::dropped_frames() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.MavlinkTunnelResponse.dropped_frames)
+  return _internal_dropped_frames();
+}
+inline void MavlinkTunnelResponse::_internal_set_dropped_frames(uint32_t value) {
+  
+  _impl_.dropped_frames_ = value;
+}
+inline void MavlinkTunnelResponse::set_dropped_frames(uint32_t value) {
+  _internal_set_dropped_frames(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.MavlinkTunnelResponse.dropped_frames)
+}
+
+// uint32 rejected_frames = 3;
+inline void MavlinkTunnelResponse::clear_rejected_frames() {
+  _impl_.rejected_frames_ = 0u;
+}
+inline uint32_t MavlinkTunnelResponse::_internal_rejected_frames() const {
+  return _impl_.rejected_frames_;
+}
+inline uint32_t MavlinkTunnelResponse::rejected_frames() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.MavlinkTunnelResponse.rejected_frames)
+  return _internal_rejected_frames();
+}
+inline void MavlinkTunnelResponse::_internal_set_rejected_frames(uint32_t value) {
+  
+  _impl_.rejected_frames_ = value;
+}
+inline void MavlinkTunnelResponse::set_rejected_frames(uint32_t value) {
+  _internal_set_rejected_frames(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.MavlinkTunnelResponse.rejected_frames)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeAttitudeBatchRequest
+
+// uint32 batch_window_ms = 1;
+inline void SubscribeAttitudeBatchRequest::clear_batch_window_ms() {
+  _impl_.batch_window_ms_ = 0u;
+}
+inline uint32_t SubscribeAttitudeBatchRequest::_internal_batch_window_ms() const {
+  return _impl_.batch_window_ms_;
+}
+inline uint32_t SubscribeAttitudeBatchRequest::batch_window_ms() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest.batch_window_ms)
+  return _internal_batch_window_ms();
+}
+inline void SubscribeAttitudeBatchRequest::_internal_set_batch_window_ms(uint32_t value) {
+  
+  _impl_.batch_window_ms_ = value;
+}
+inline void SubscribeAttitudeBatchRequest::set_batch_window_ms(uint32_t value) {
+  _internal_set_batch_window_ms(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest.batch_window_ms)
+}
+
+// uint32 prediction_rate_hz = 2;
+inline void SubscribeAttitudeBatchRequest::clear_prediction_rate_hz() {
+  _impl_.prediction_rate_hz_ = 0u;
+}
+inline uint32_t SubscribeAttitudeBatchRequest::_internal_prediction_rate_hz() const {
+  return _impl_.prediction_rate_hz_;
+}
+inline uint32_t SubscribeAttitudeBatchRequest::prediction_rate_hz() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest.prediction_rate_hz)
+  return _internal_prediction_rate_hz();
+}
+inline void SubscribeAttitudeBatchRequest::_internal_set_prediction_rate_hz(uint32_t value) {
+  
+  _impl_.prediction_rate_hz_ = value;
+}
+inline void SubscribeAttitudeBatchRequest::set_prediction_rate_hz(uint32_t value) {
+  _internal_set_prediction_rate_hz(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SubscribeAttitudeBatchRequest.prediction_rate_hz)
+}
+
+// -------------------------------------------------------------------
+
+// SyncClockRequest
+
+// uint64 client_send_time_ns = 1;
+inline void SyncClockRequest::clear_client_send_time_ns() {
+  _impl_.client_send_time_ns_ = uint64_t{0u};
+}
+inline uint64_t SyncClockRequest::_internal_client_send_time_ns() const {
+  return _impl_.client_send_time_ns_;
+}
+inline uint64_t SyncClockRequest::client_send_time_ns() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SyncClockRequest.client_send_time_ns)
+  return _internal_client_send_time_ns();
+}
+inline void SyncClockRequest::_internal_set_client_send_time_ns(uint64_t value) {
+  
+  _impl_.client_send_time_ns_ = value;
+}
+inline void SyncClockRequest::set_client_send_time_ns(uint64_t value) {
+  _internal_set_client_send_time_ns(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SyncClockRequest.client_send_time_ns)
+}
+
+// -------------------------------------------------------------------
+
+// SyncClockResponse
+
+// uint64 client_send_time_ns = 1;
+inline void SyncClockResponse::clear_client_send_time_ns() {
+  _impl_.client_send_time_ns_ = uint64_t{0u};
+}
+inline uint64_t SyncClockResponse::_internal_client_send_time_ns() const {
+  return _impl_.client_send_time_ns_;
+}
+inline uint64_t SyncClockResponse::client_send_time_ns() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SyncClockResponse.client_send_time_ns)
+  return _internal_client_send_time_ns();
+}
+inline void SyncClockResponse::_internal_set_client_send_time_ns(uint64_t value) {
+  
+  _impl_.client_send_time_ns_ = value;
+}
+inline void SyncClockResponse::set_client_send_time_ns(uint64_t value) {
+  _internal_set_client_send_time_ns(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SyncClockResponse.client_send_time_ns)
+}
+
+// uint64 server_receive_time_ns = 2;
+inline void SyncClockResponse::clear_server_receive_time_ns() {
+  _impl_.server_receive_time_ns_ = uint64_t{0u};
+}
+inline uint64_t SyncClockResponse::_internal_server_receive_time_ns() const {
+  return _impl_.server_receive_time_ns_;
+}
+inline uint64_t SyncClockResponse::server_receive_time_ns() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SyncClockResponse.server_receive_time_ns)
+  return _internal_server_receive_time_ns();
+}
+inline void SyncClockResponse::_internal_set_server_receive_time_ns(uint64_t value) {
+  
+  _impl_.server_receive_time_ns_ = value;
+}
+inline void SyncClockResponse::set_server_receive_time_ns(uint64_t value) {
+  _internal_set_server_receive_time_ns(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SyncClockResponse.server_receive_time_ns)
+}
+
+// uint64 server_send_time_ns = 3;
+inline void SyncClockResponse::clear_server_send_time_ns() {
+  _impl_.server_send_time_ns_ = uint64_t{0u};
+}
+inline uint64_t SyncClockResponse::_internal_server_send_time_ns() const {
+  return _impl_.server_send_time_ns_;
+}
+inline uint64_t SyncClockResponse::server_send_time_ns() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SyncClockResponse.server_send_time_ns)
+  return _internal_server_send_time_ns();
+}
+inline void SyncClockResponse::_internal_set_server_send_time_ns(uint64_t value) {
+  
+  _impl_.server_send_time_ns_ = value;
+}
+inline void SyncClockResponse::set_server_send_time_ns(uint64_t value) {
+  _internal_set_server_send_time_ns(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SyncClockResponse.server_send_time_ns)
+}
+
+// -------------------------------------------------------------------
+
+// PredictAttitudeRequest
+
+// uint64 time_ns = 1;
+inline void PredictAttitudeRequest::clear_time_ns() {
+  _impl_.time_ns_ = uint64_t{0u};
+}
+inline uint64_t PredictAttitudeRequest::_internal_time_ns() const {
+  return _impl_.time_ns_;
+}
+inline uint64_t PredictAttitudeRequest::time_ns() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.PredictAttitudeRequest.time_ns)
+  return _internal_time_ns();
+}
+inline void PredictAttitudeRequest::_internal_set_time_ns(uint64_t value) {
+  
+  _impl_.time_ns_ = value;
+}
+inline void PredictAttitudeRequest::set_time_ns(uint64_t value) {
+  _internal_set_time_ns(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.PredictAttitudeRequest.time_ns)
+}
+
+// -------------------------------------------------------------------
+
+// PredictAttitudeResponse
+
+// float roll_deg = 1;
+inline void PredictAttitudeResponse::clear_roll_deg() {
+  _impl_.roll_deg_ = 0;
+}
+inline float PredictAttitudeResponse::_internal_roll_deg() const {
+  return _impl_.roll_deg_;
+}
+inline float PredictAttitudeResponse::roll_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.PredictAttitudeResponse.roll_deg)
+  return _internal_roll_deg();
+}
+inline void PredictAttitudeResponse::_internal_set_roll_deg(float value) {
+  
+  _impl_.roll_deg_ = value;
+}
+inline void PredictAttitudeResponse::set_roll_deg(float value) {
+  _internal_set_roll_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.PredictAttitudeResponse.roll_deg)
+}
+
+// float pitch_deg = 2;
+inline void PredictAttitudeResponse::clear_pitch_deg() {
+  _impl_.pitch_deg_ = 0;
+}
+inline float PredictAttitudeResponse::_internal_pitch_deg() const {
+  return _impl_.pitch_deg_;
+}
+inline float PredictAttitudeResponse::pitch_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.PredictAttitudeResponse.pitch_deg)
+  return _internal_pitch_deg();
+}
+inline void PredictAttitudeResponse::_internal_set_pitch_deg(float value) {
+  
+  _impl_.pitch_deg_ = value;
+}
+inline void PredictAttitudeResponse::set_pitch_deg(float value) {
+  _internal_set_pitch_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.PredictAttitudeResponse.pitch_deg)
+}
+
+// float yaw_deg = 3;
+inline void PredictAttitudeResponse::clear_yaw_deg() {
+  _impl_.yaw_deg_ = 0;
+}
+inline float PredictAttitudeResponse::_internal_yaw_deg() const {
+  return _impl_.yaw_deg_;
+}
+inline float PredictAttitudeResponse::yaw_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.PredictAttitudeResponse.yaw_deg)
+  return _internal_yaw_deg();
+}
+inline void PredictAttitudeResponse::_internal_set_yaw_deg(float value) {
+  
+  _impl_.yaw_deg_ = value;
+}
+inline void PredictAttitudeResponse::set_yaw_deg(float value) {
+  _internal_set_yaw_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.PredictAttitudeResponse.yaw_deg)
+}
+
+// uint64 timestamp_us = 4;
+inline void PredictAttitudeResponse::clear_timestamp_us() {
+  _impl_.timestamp_us_ = uint64_t{0u};
+}
+inline uint64_t PredictAttitudeResponse::_internal_timestamp_us() const {
+  return _impl_.timestamp_us_;
+}
+inline uint64_t PredictAttitudeResponse::timestamp_us() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.PredictAttitudeResponse.timestamp_us)
+  return _internal_timestamp_us();
+}
+inline void PredictAttitudeResponse::_internal_set_timestamp_us(uint64_t value) {
+  
+  _impl_.timestamp_us_ = value;
+}
+inline void PredictAttitudeResponse::set_timestamp_us(uint64_t value) {
+  _internal_set_timestamp_us(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.PredictAttitudeResponse.timestamp_us)
+}
+
+// -------------------------------------------------------------------
+
+// GetAttitudeAtRequest
+
+// uint64 time_ns = 1;
+inline void GetAttitudeAtRequest::clear_time_ns() {
+  _impl_.time_ns_ = uint64_t{0u};
+}
+inline uint64_t GetAttitudeAtRequest::_internal_time_ns() const {
+  return _impl_.time_ns_;
+}
+inline uint64_t GetAttitudeAtRequest::time_ns() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudeAtRequest.time_ns)
+  return _internal_time_ns();
+}
+inline void GetAttitudeAtRequest::_internal_set_time_ns(uint64_t value) {
+  
+  _impl_.time_ns_ = value;
+}
+inline void GetAttitudeAtRequest::set_time_ns(uint64_t value) {
+  _internal_set_time_ns(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudeAtRequest.time_ns)
+}
+
+// -------------------------------------------------------------------
+
+// GetAttitudeAtResponse
+
+// float roll_deg = 1;
+inline void GetAttitudeAtResponse::clear_roll_deg() {
+  _impl_.roll_deg_ = 0;
+}
+inline float GetAttitudeAtResponse::_internal_roll_deg() const {
+  return _impl_.roll_deg_;
+}
+inline float GetAttitudeAtResponse::roll_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudeAtResponse.roll_deg)
+  return _internal_roll_deg();
+}
+inline void GetAttitudeAtResponse::_internal_set_roll_deg(float value) {
+  
+  _impl_.roll_deg_ = value;
+}
+inline void GetAttitudeAtResponse::set_roll_deg(float value) {
+  _internal_set_roll_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudeAtResponse.roll_deg)
+}
+
+// float pitch_deg = 2;
+inline void GetAttitudeAtResponse::clear_pitch_deg() {
+  _impl_.pitch_deg_ = 0;
+}
+inline float GetAttitudeAtResponse::_internal_pitch_deg() const {
+  return _impl_.pitch_deg_;
+}
+inline float GetAttitudeAtResponse::pitch_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudeAtResponse.pitch_deg)
+  return _internal_pitch_deg();
+}
+inline void GetAttitudeAtResponse::_internal_set_pitch_deg(float value) {
+  
+  _impl_.pitch_deg_ = value;
+}
+inline void GetAttitudeAtResponse::set_pitch_deg(float value) {
+  _internal_set_pitch_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudeAtResponse.pitch_deg)
+}
+
+// float yaw_deg = 3;
+inline void GetAttitudeAtResponse::clear_yaw_deg() {
+  _impl_.yaw_deg_ = 0;
+}
+inline float GetAttitudeAtResponse::_internal_yaw_deg() const {
+  return _impl_.yaw_deg_;
+}
+inline float GetAttitudeAtResponse::yaw_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudeAtResponse.yaw_deg)
+  return _internal_yaw_deg();
+}
+inline void GetAttitudeAtResponse::_internal_set_yaw_deg(float value) {
+  
+  _impl_.yaw_deg_ = value;
+}
+inline void GetAttitudeAtResponse::set_yaw_deg(float value) {
+  _internal_set_yaw_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudeAtResponse.yaw_deg)
+}
+
+// float q_w = 4;
+inline void GetAttitudeAtResponse::clear_q_w() {
+  _impl_.q_w_ = 0;
+}
+inline float GetAttitudeAtResponse::_internal_q_w() const {
+  return _impl_.q_w_;
+}
+inline float GetAttitudeAtResponse::q_w() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudeAtResponse.q_w)
+  return _internal_q_w();
+}
+inline void GetAttitudeAtResponse::_internal_set_q_w(float value) {
+  
+  _impl_.q_w_ = value;
+}
+inline void GetAttitudeAtResponse::set_q_w(float value) {
+  _internal_set_q_w(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudeAtResponse.q_w)
+}
+
+// float q_x = 5;
+inline void GetAttitudeAtResponse::clear_q_x() {
+  _impl_.q_x_ = 0;
+}
+inline float GetAttitudeAtResponse::_internal_q_x() const {
+  return _impl_.q_x_;
+}
+inline float GetAttitudeAtResponse::q_x() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudeAtResponse.q_x)
+  return _internal_q_x();
+}
+inline void GetAttitudeAtResponse::_internal_set_q_x(float value) {
+  
+  _impl_.q_x_ = value;
+}
+inline void GetAttitudeAtResponse::set_q_x(float value) {
+  _internal_set_q_x(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudeAtResponse.q_x)
+}
+
+// float q_y = 6;
+inline void GetAttitudeAtResponse::clear_q_y() {
+  _impl_.q_y_ = 0;
+}
+inline float GetAttitudeAtResponse::_internal_q_y() const {
+  return _impl_.q_y_;
+}
+inline float GetAttitudeAtResponse::q_y() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudeAtResponse.q_y)
+  return _internal_q_y();
+}
+inline void GetAttitudeAtResponse::_internal_set_q_y(float value) {
+  
+  _impl_.q_y_ = value;
+}
+inline void GetAttitudeAtResponse::set_q_y(float value) {
+  _internal_set_q_y(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudeAtResponse.q_y)
+}
+
+// float q_z = 7;
+inline void GetAttitudeAtResponse::clear_q_z() {
+  _impl_.q_z_ = 0;
+}
+inline float GetAttitudeAtResponse::_internal_q_z() const {
+  return _impl_.q_z_;
+}
+inline float GetAttitudeAtResponse::q_z() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudeAtResponse.q_z)
+  return _internal_q_z();
+}
+inline void GetAttitudeAtResponse::_internal_set_q_z(float value) {
+  
+  _impl_.q_z_ = value;
+}
+inline void GetAttitudeAtResponse::set_q_z(float value) {
+  _internal_set_q_z(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudeAtResponse.q_z)
+}
+
+// -------------------------------------------------------------------
+
+// GetAttitudesAtRequest
+
+// repeated uint64 time_ns = 1;
+inline int GetAttitudesAtRequest::_internal_time_ns_size() const {
+  return _impl_.time_ns_.size();
+}
+inline int GetAttitudesAtRequest::time_ns_size() const {
+  return _internal_time_ns_size();
+}
+inline void GetAttitudesAtRequest::clear_time_ns() {
+  _impl_.time_ns_.Clear();
+}
+inline uint64_t GetAttitudesAtRequest::_internal_time_ns(int index) const {
+  return _impl_.time_ns_.Get(index);
+}
+inline uint64_t GetAttitudesAtRequest::time_ns(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudesAtRequest.time_ns)
+  return _internal_time_ns(index);
+}
+inline void GetAttitudesAtRequest::set_time_ns(int index, uint64_t value) {
+  _impl_.time_ns_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudesAtRequest.time_ns)
+}
+inline void GetAttitudesAtRequest::_internal_add_time_ns(uint64_t value) {
+  _impl_.time_ns_.Add(value);
+}
+inline void GetAttitudesAtRequest::add_time_ns(uint64_t value) {
+  _internal_add_time_ns(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.GetAttitudesAtRequest.time_ns)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+GetAttitudesAtRequest::_internal_time_ns() const {
+  return _impl_.time_ns_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+GetAttitudesAtRequest::time_ns() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.GetAttitudesAtRequest.time_ns)
+  return _internal_time_ns();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+GetAttitudesAtRequest::_internal_mutable_time_ns() {
+  return &_impl_.time_ns_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+GetAttitudesAtRequest::mutable_time_ns() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.GetAttitudesAtRequest.time_ns)
+  return _internal_mutable_time_ns();
+}
+
+// -------------------------------------------------------------------
+
+// GetAttitudesAtResponse
+
+// repeated bool found = 1;
+inline int GetAttitudesAtResponse::_internal_found_size() const {
+  return _impl_.found_.size();
+}
+inline int GetAttitudesAtResponse::found_size() const {
+  return _internal_found_size();
+}
+inline void GetAttitudesAtResponse::clear_found() {
+  _impl_.found_.Clear();
+}
+inline bool GetAttitudesAtResponse::_internal_found(int index) const {
+  return _impl_.found_.Get(index);
+}
+inline bool GetAttitudesAtResponse::found(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudesAtResponse.found)
+  return _internal_found(index);
+}
+inline void GetAttitudesAtResponse::set_found(int index, bool value) {
+  _impl_.found_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudesAtResponse.found)
+}
+inline void GetAttitudesAtResponse::_internal_add_found(bool value) {
+  _impl_.found_.Add(value);
+}
+inline void GetAttitudesAtResponse::add_found(bool value) {
+  _internal_add_found(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.GetAttitudesAtResponse.found)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+GetAttitudesAtResponse::_internal_found() const {
+  return _impl_.found_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+GetAttitudesAtResponse::found() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.found)
+  return _internal_found();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+GetAttitudesAtResponse::_internal_mutable_found() {
+  return &_impl_.found_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+GetAttitudesAtResponse::mutable_found() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.found)
+  return _internal_mutable_found();
+}
+
+// repeated float roll_deg = 2;
+inline int GetAttitudesAtResponse::_internal_roll_deg_size() const {
+  return _impl_.roll_deg_.size();
+}
+inline int GetAttitudesAtResponse::roll_deg_size() const {
+  return _internal_roll_deg_size();
+}
+inline void GetAttitudesAtResponse::clear_roll_deg() {
+  _impl_.roll_deg_.Clear();
+}
+inline float GetAttitudesAtResponse::_internal_roll_deg(int index) const {
+  return _impl_.roll_deg_.Get(index);
+}
+inline float GetAttitudesAtResponse::roll_deg(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudesAtResponse.roll_deg)
+  return _internal_roll_deg(index);
+}
+inline void GetAttitudesAtResponse::set_roll_deg(int index, float value) {
+  _impl_.roll_deg_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudesAtResponse.roll_deg)
+}
+inline void GetAttitudesAtResponse::_internal_add_roll_deg(float value) {
+  _impl_.roll_deg_.Add(value);
+}
+inline void GetAttitudesAtResponse::add_roll_deg(float value) {
+  _internal_add_roll_deg(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.GetAttitudesAtResponse.roll_deg)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::_internal_roll_deg() const {
+  return _impl_.roll_deg_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::roll_deg() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.roll_deg)
+  return _internal_roll_deg();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::_internal_mutable_roll_deg() {
+  return &_impl_.roll_deg_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::mutable_roll_deg() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.roll_deg)
+  return _internal_mutable_roll_deg();
+}
+
+// repeated float pitch_deg = 3;
+inline int GetAttitudesAtResponse::_internal_pitch_deg_size() const {
+  return _impl_.pitch_deg_.size();
+}
+inline int GetAttitudesAtResponse::pitch_deg_size() const {
+  return _internal_pitch_deg_size();
+}
+inline void GetAttitudesAtResponse::clear_pitch_deg() {
+  _impl_.pitch_deg_.Clear();
+}
+inline float GetAttitudesAtResponse::_internal_pitch_deg(int index) const {
+  return _impl_.pitch_deg_.Get(index);
+}
+inline float GetAttitudesAtResponse::pitch_deg(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudesAtResponse.pitch_deg)
+  return _internal_pitch_deg(index);
+}
+inline void GetAttitudesAtResponse::set_pitch_deg(int index, float value) {
+  _impl_.pitch_deg_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudesAtResponse.pitch_deg)
+}
+inline void GetAttitudesAtResponse::_internal_add_pitch_deg(float value) {
+  _impl_.pitch_deg_.Add(value);
+}
+inline void GetAttitudesAtResponse::add_pitch_deg(float value) {
+  _internal_add_pitch_deg(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.GetAttitudesAtResponse.pitch_deg)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::_internal_pitch_deg() const {
+  return _impl_.pitch_deg_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::pitch_deg() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.pitch_deg)
+  return _internal_pitch_deg();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::_internal_mutable_pitch_deg() {
+  return &_impl_.pitch_deg_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::mutable_pitch_deg() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.pitch_deg)
+  return _internal_mutable_pitch_deg();
+}
+
+// repeated float yaw_deg = 4;
+inline int GetAttitudesAtResponse::_internal_yaw_deg_size() const {
+  return _impl_.yaw_deg_.size();
+}
+inline int GetAttitudesAtResponse::yaw_deg_size() const {
+  return _internal_yaw_deg_size();
+}
+inline void GetAttitudesAtResponse::clear_yaw_deg() {
+  _impl_.yaw_deg_.Clear();
+}
+inline float GetAttitudesAtResponse::_internal_yaw_deg(int index) const {
+  return _impl_.yaw_deg_.Get(index);
+}
+inline float GetAttitudesAtResponse::yaw_deg(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudesAtResponse.yaw_deg)
+  return _internal_yaw_deg(index);
+}
+inline void GetAttitudesAtResponse::set_yaw_deg(int index, float value) {
+  _impl_.yaw_deg_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudesAtResponse.yaw_deg)
+}
+inline void GetAttitudesAtResponse::_internal_add_yaw_deg(float value) {
+  _impl_.yaw_deg_.Add(value);
+}
+inline void GetAttitudesAtResponse::add_yaw_deg(float value) {
+  _internal_add_yaw_deg(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.GetAttitudesAtResponse.yaw_deg)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::_internal_yaw_deg() const {
+  return _impl_.yaw_deg_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::yaw_deg() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.yaw_deg)
+  return _internal_yaw_deg();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::_internal_mutable_yaw_deg() {
+  return &_impl_.yaw_deg_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::mutable_yaw_deg() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.yaw_deg)
+  return _internal_mutable_yaw_deg();
+}
+
+// repeated float q_w = 5;
+inline int GetAttitudesAtResponse::_internal_q_w_size() const {
+  return _impl_.q_w_.size();
+}
+inline int GetAttitudesAtResponse::q_w_size() const {
+  return _internal_q_w_size();
+}
+inline void GetAttitudesAtResponse::clear_q_w() {
+  _impl_.q_w_.Clear();
+}
+inline float GetAttitudesAtResponse::_internal_q_w(int index) const {
+  return _impl_.q_w_.Get(index);
+}
+inline float GetAttitudesAtResponse::q_w(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_w)
+  return _internal_q_w(index);
+}
+inline void GetAttitudesAtResponse::set_q_w(int index, float value) {
+  _impl_.q_w_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_w)
+}
+inline void GetAttitudesAtResponse::_internal_add_q_w(float value) {
+  _impl_.q_w_.Add(value);
+}
+inline void GetAttitudesAtResponse::add_q_w(float value) {
+  _internal_add_q_w(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_w)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::_internal_q_w() const {
+  return _impl_.q_w_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::q_w() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_w)
+  return _internal_q_w();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::_internal_mutable_q_w() {
+  return &_impl_.q_w_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::mutable_q_w() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_w)
+  return _internal_mutable_q_w();
+}
+
+// repeated float q_x = 6;
+inline int GetAttitudesAtResponse::_internal_q_x_size() const {
+  return _impl_.q_x_.size();
+}
+inline int GetAttitudesAtResponse::q_x_size() const {
+  return _internal_q_x_size();
+}
+inline void GetAttitudesAtResponse::clear_q_x() {
+  _impl_.q_x_.Clear();
+}
+inline float GetAttitudesAtResponse::_internal_q_x(int index) const {
+  return _impl_.q_x_.Get(index);
+}
+inline float GetAttitudesAtResponse::q_x(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_x)
+  return _internal_q_x(index);
+}
+inline void GetAttitudesAtResponse::set_q_x(int index, float value) {
+  _impl_.q_x_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_x)
+}
+inline void GetAttitudesAtResponse::_internal_add_q_x(float value) {
+  _impl_.q_x_.Add(value);
+}
+inline void GetAttitudesAtResponse::add_q_x(float value) {
+  _internal_add_q_x(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_x)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::_internal_q_x() const {
+  return _impl_.q_x_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::q_x() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_x)
+  return _internal_q_x();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::_internal_mutable_q_x() {
+  return &_impl_.q_x_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::mutable_q_x() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_x)
+  return _internal_mutable_q_x();
+}
+
+// repeated float q_y = 7;
+inline int GetAttitudesAtResponse::_internal_q_y_size() const {
+  return _impl_.q_y_.size();
+}
+inline int GetAttitudesAtResponse::q_y_size() const {
+  return _internal_q_y_size();
+}
+inline void GetAttitudesAtResponse::clear_q_y() {
+  _impl_.q_y_.Clear();
+}
+inline float GetAttitudesAtResponse::_internal_q_y(int index) const {
+  return _impl_.q_y_.Get(index);
+}
+inline float GetAttitudesAtResponse::q_y(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_y)
+  return _internal_q_y(index);
+}
+inline void GetAttitudesAtResponse::set_q_y(int index, float value) {
+  _impl_.q_y_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_y)
+}
+inline void GetAttitudesAtResponse::_internal_add_q_y(float value) {
+  _impl_.q_y_.Add(value);
+}
+inline void GetAttitudesAtResponse::add_q_y(float value) {
+  _internal_add_q_y(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_y)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::_internal_q_y() const {
+  return _impl_.q_y_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::q_y() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_y)
+  return _internal_q_y();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::_internal_mutable_q_y() {
+  return &_impl_.q_y_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::mutable_q_y() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_y)
+  return _internal_mutable_q_y();
+}
+
+// repeated float q_z = 8;
+inline int GetAttitudesAtResponse::_internal_q_z_size() const {
+  return _impl_.q_z_.size();
+}
+inline int GetAttitudesAtResponse::q_z_size() const {
+  return _internal_q_z_size();
+}
+inline void GetAttitudesAtResponse::clear_q_z() {
+  _impl_.q_z_.Clear();
+}
+inline float GetAttitudesAtResponse::_internal_q_z(int index) const {
+  return _impl_.q_z_.Get(index);
+}
+inline float GetAttitudesAtResponse::q_z(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_z)
+  return _internal_q_z(index);
+}
+inline void GetAttitudesAtResponse::set_q_z(int index, float value) {
+  _impl_.q_z_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_z)
+}
+inline void GetAttitudesAtResponse::_internal_add_q_z(float value) {
+  _impl_.q_z_.Add(value);
+}
+inline void GetAttitudesAtResponse::add_q_z(float value) {
+  _internal_add_q_z(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_z)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::_internal_q_z() const {
+  return _impl_.q_z_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+GetAttitudesAtResponse::q_z() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_z)
+  return _internal_q_z();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::_internal_mutable_q_z() {
+  return &_impl_.q_z_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+GetAttitudesAtResponse::mutable_q_z() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.GetAttitudesAtResponse.q_z)
+  return _internal_mutable_q_z();
+}
+
+// -------------------------------------------------------------------
+
+// VisualServoRequest
+
+// float error_x = 1;
+inline void VisualServoRequest::clear_error_x() {
+  _impl_.error_x_ = 0;
+}
+inline float VisualServoRequest::_internal_error_x() const {
+  return _impl_.error_x_;
+}
+inline float VisualServoRequest::error_x() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoRequest.error_x)
+  return _internal_error_x();
+}
+inline void VisualServoRequest::_internal_set_error_x(float value) {
+  
+  _impl_.error_x_ = value;
+}
+inline void VisualServoRequest::set_error_x(float value) {
+  _internal_set_error_x(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoRequest.error_x)
+}
+
+// float error_y = 2;
+inline void VisualServoRequest::clear_error_y() {
+  _impl_.error_y_ = 0;
+}
+inline float VisualServoRequest::_internal_error_y() const {
+  return _impl_.error_y_;
+}
+inline float VisualServoRequest::error_y() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoRequest.error_y)
+  return _internal_error_y();
+}
+inline void VisualServoRequest::_internal_set_error_y(float value) {
+  
+  _impl_.error_y_ = value;
+}
+inline void VisualServoRequest::set_error_y(float value) {
+  _internal_set_error_y(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoRequest.error_y)
+}
+
+// float horizontal_fov_deg = 3;
+inline void VisualServoRequest::clear_horizontal_fov_deg() {
+  _impl_.horizontal_fov_deg_ = 0;
+}
+inline float VisualServoRequest::_internal_horizontal_fov_deg() const {
+  return _impl_.horizontal_fov_deg_;
+}
+inline float VisualServoRequest::horizontal_fov_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoRequest.horizontal_fov_deg)
+  return _internal_horizontal_fov_deg();
+}
+inline void VisualServoRequest::_internal_set_horizontal_fov_deg(float value) {
+  
+  _impl_.horizontal_fov_deg_ = value;
+}
+inline void VisualServoRequest::set_horizontal_fov_deg(float value) {
+  _internal_set_horizontal_fov_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoRequest.horizontal_fov_deg)
+}
+
+// float vertical_fov_deg = 4;
+inline void VisualServoRequest::clear_vertical_fov_deg() {
+  _impl_.vertical_fov_deg_ = 0;
+}
+inline float VisualServoRequest::_internal_vertical_fov_deg() const {
+  return _impl_.vertical_fov_deg_;
+}
+inline float VisualServoRequest::vertical_fov_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoRequest.vertical_fov_deg)
+  return _internal_vertical_fov_deg();
+}
+inline void VisualServoRequest::_internal_set_vertical_fov_deg(float value) {
+  
+  _impl_.vertical_fov_deg_ = value;
+}
+inline void VisualServoRequest::set_vertical_fov_deg(float value) {
+  _internal_set_vertical_fov_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoRequest.vertical_fov_deg)
+}
+
+// bool target_lost = 5;
+inline void VisualServoRequest::clear_target_lost() {
+  _impl_.target_lost_ = false;
+}
+inline bool VisualServoRequest::_internal_target_lost() const {
+  return _impl_.target_lost_;
+}
+inline bool VisualServoRequest::target_lost() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoRequest.target_lost)
+  return _internal_target_lost();
+}
+inline void VisualServoRequest::_internal_set_target_lost(bool value) {
+  
+  _impl_.target_lost_ = value;
+}
+inline void VisualServoRequest::set_target_lost(bool value) {
+  _internal_set_target_lost(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoRequest.target_lost)
+}
+
+// uint64 capture_time_ns = 6;
+inline void VisualServoRequest::clear_capture_time_ns() {
+  _impl_.capture_time_ns_ = uint64_t{0u};
+}
+inline uint64_t VisualServoRequest::_internal_capture_time_ns() const {
+  return _impl_.capture_time_ns_;
+}
+inline uint64_t VisualServoRequest::capture_time_ns() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoRequest.capture_time_ns)
+  return _internal_capture_time_ns();
+}
+inline void VisualServoRequest::_internal_set_capture_time_ns(uint64_t value) {
+  
+  _impl_.capture_time_ns_ = value;
+}
+inline void VisualServoRequest::set_capture_time_ns(uint64_t value) {
+  _internal_set_capture_time_ns(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoRequest.capture_time_ns)
+}
+
+// .mavsdk.rpc.gimbal.ServoGains gains = 7;
+inline bool VisualServoRequest::_internal_has_gains() const {
+  return this != internal_default_instance() && _impl_.gains_ != nullptr;
+}
+inline bool VisualServoRequest::has_gains() const {
+  return _internal_has_gains();
+}
+inline void VisualServoRequest::clear_gains() {
+  if (GetArenaForAllocation() == nullptr && _impl_.gains_ != nullptr) {
+    delete _impl_.gains_;
+  }
+  _impl_.gains_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::ServoGains& VisualServoRequest::_internal_gains() const {
+  const ::mavsdk::rpc::gimbal::ServoGains* p = _impl_.gains_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::ServoGains&>(
+      ::mavsdk::rpc::gimbal::_ServoGains_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::ServoGains& VisualServoRequest::gains() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoRequest.gains)
+  return _internal_gains();
+}
+inline void VisualServoRequest::unsafe_arena_set_allocated_gains(
+    ::mavsdk::rpc::gimbal::ServoGains* gains) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gains_);
+  }
+  _impl_.gains_ = gains;
+  if (gains) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.VisualServoRequest.gains)
+}
+inline ::mavsdk::rpc::gimbal::ServoGains* VisualServoRequest::release_gains() {
+  
+  ::mavsdk::rpc::gimbal::ServoGains* temp = _impl_.gains_;
+  _impl_.gains_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::ServoGains* VisualServoRequest::unsafe_arena_release_gains() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.VisualServoRequest.gains)
+  
+  ::mavsdk::rpc::gimbal::ServoGains* temp = _impl_.gains_;
+  _impl_.gains_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::ServoGains* VisualServoRequest::_internal_mutable_gains() {
+  
+  if (_impl_.gains_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::ServoGains>(GetArenaForAllocation());
+    _impl_.gains_ = p;
+  }
+  return _impl_.gains_;
+}
+inline ::mavsdk::rpc::gimbal::ServoGains* VisualServoRequest::mutable_gains() {
+  ::mavsdk::rpc::gimbal::ServoGains* _msg = _internal_mutable_gains();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.VisualServoRequest.gains)
+  return _msg;
+}
+inline void VisualServoRequest::set_allocated_gains(::mavsdk::rpc::gimbal::ServoGains* gains) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.gains_;
+  }
+  if (gains) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gains);
+    if (message_arena != submessage_arena) {
+      gains = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gains, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.gains_ = gains;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.VisualServoRequest.gains)
+}
+
+// -------------------------------------------------------------------
+
+// VisualServoStatus
+
+// float pitch_rate_deg_s = 1;
+inline void VisualServoStatus::clear_pitch_rate_deg_s() {
+  _impl_.pitch_rate_deg_s_ = 0;
+}
+inline float VisualServoStatus::_internal_pitch_rate_deg_s() const {
+  return _impl_.pitch_rate_deg_s_;
+}
+inline float VisualServoStatus::pitch_rate_deg_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoStatus.pitch_rate_deg_s)
+  return _internal_pitch_rate_deg_s();
+}
+inline void VisualServoStatus::_internal_set_pitch_rate_deg_s(float value) {
+  
+  _impl_.pitch_rate_deg_s_ = value;
+}
+inline void VisualServoStatus::set_pitch_rate_deg_s(float value) {
+  _internal_set_pitch_rate_deg_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoStatus.pitch_rate_deg_s)
+}
+
+// float yaw_rate_deg_s = 2;
+inline void VisualServoStatus::clear_yaw_rate_deg_s() {
+  _impl_.yaw_rate_deg_s_ = 0;
+}
+inline float VisualServoStatus::_internal_yaw_rate_deg_s() const {
+  return _impl_.yaw_rate_deg_s_;
+}
+inline float VisualServoStatus::yaw_rate_deg_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoStatus.yaw_rate_deg_s)
+  return _internal_yaw_rate_deg_s();
+}
+inline void VisualServoStatus::_internal_set_yaw_rate_deg_s(float value) {
+  
+  _impl_.yaw_rate_deg_s_ = value;
+}
+inline void VisualServoStatus::set_yaw_rate_deg_s(float value) {
+  _internal_set_yaw_rate_deg_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoStatus.yaw_rate_deg_s)
+}
+
+// float pitch_error_deg = 3;
+inline void VisualServoStatus::clear_pitch_error_deg() {
+  _impl_.pitch_error_deg_ = 0;
+}
+inline float VisualServoStatus::_internal_pitch_error_deg() const {
+  return _impl_.pitch_error_deg_;
+}
+inline float VisualServoStatus::pitch_error_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoStatus.pitch_error_deg)
+  return _internal_pitch_error_deg();
+}
+inline void VisualServoStatus::_internal_set_pitch_error_deg(float value) {
+  
+  _impl_.pitch_error_deg_ = value;
+}
+inline void VisualServoStatus::set_pitch_error_deg(float value) {
+  _internal_set_pitch_error_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoStatus.pitch_error_deg)
+}
+
+// float yaw_error_deg = 4;
+inline void VisualServoStatus::clear_yaw_error_deg() {
+  _impl_.yaw_error_deg_ = 0;
+}
+inline float VisualServoStatus::_internal_yaw_error_deg() const {
+  return _impl_.yaw_error_deg_;
+}
+inline float VisualServoStatus::yaw_error_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoStatus.yaw_error_deg)
+  return _internal_yaw_error_deg();
+}
+inline void VisualServoStatus::_internal_set_yaw_error_deg(float value) {
+  
+  _impl_.yaw_error_deg_ = value;
+}
+inline void VisualServoStatus::set_yaw_error_deg(float value) {
+  _internal_set_yaw_error_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoStatus.yaw_error_deg)
+}
+
+// bool tracking = 5;
+inline void VisualServoStatus::clear_tracking() {
+  _impl_.tracking_ = false;
+}
+inline bool VisualServoStatus::_internal_tracking() const {
+  return _impl_.tracking_;
+}
+inline bool VisualServoStatus::tracking() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoStatus.tracking)
+  return _internal_tracking();
+}
+inline void VisualServoStatus::_internal_set_tracking(bool value) {
+  
+  _impl_.tracking_ = value;
+}
+inline void VisualServoStatus::set_tracking(bool value) {
+  _internal_set_tracking(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoStatus.tracking)
+}
+
+// uint64 ticks = 6;
+inline void VisualServoStatus::clear_ticks() {
+  _impl_.ticks_ = uint64_t{0u};
+}
+inline uint64_t VisualServoStatus::_internal_ticks() const {
+  return _impl_.ticks_;
+}
+inline uint64_t VisualServoStatus::ticks() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoStatus.ticks)
+  return _internal_ticks();
+}
+inline void VisualServoStatus::_internal_set_ticks(uint64_t value) {
+  
+  _impl_.ticks_ = value;
+}
+inline void VisualServoStatus::set_ticks(uint64_t value) {
+  _internal_set_ticks(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoStatus.ticks)
+}
+
+// uint64 overruns = 7;
+inline void VisualServoStatus::clear_overruns() {
+  _impl_.overruns_ = uint64_t{0u};
+}
+inline uint64_t VisualServoStatus::_internal_overruns() const {
+  return _impl_.overruns_;
+}
+inline uint64_t VisualServoStatus::overruns() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoStatus.overruns)
+  return _internal_overruns();
+}
+inline void VisualServoStatus::_internal_set_overruns(uint64_t value) {
+  
+  _impl_.overruns_ = value;
+}
+inline void VisualServoStatus::set_overruns(uint64_t value) {
+  _internal_set_overruns(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoStatus.overruns)
+}
+
+// double lateness_avg_us = 8;
+inline void VisualServoStatus::clear_lateness_avg_us() {
+  _impl_.lateness_avg_us_ = 0;
+}
+inline double VisualServoStatus::_internal_lateness_avg_us() const {
+  return _impl_.lateness_avg_us_;
+}
+inline double VisualServoStatus::lateness_avg_us() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoStatus.lateness_avg_us)
+  return _internal_lateness_avg_us();
+}
+inline void VisualServoStatus::_internal_set_lateness_avg_us(double value) {
+  
+  _impl_.lateness_avg_us_ = value;
+}
+inline void VisualServoStatus::set_lateness_avg_us(double value) {
+  _internal_set_lateness_avg_us(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoStatus.lateness_avg_us)
+}
+
+// double lateness_max_us = 9;
+inline void VisualServoStatus::clear_lateness_max_us() {
+  _impl_.lateness_max_us_ = 0;
+}
+inline double VisualServoStatus::_internal_lateness_max_us() const {
+  return _impl_.lateness_max_us_;
+}
+inline double VisualServoStatus::lateness_max_us() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoStatus.lateness_max_us)
+  return _internal_lateness_max_us();
+}
+inline void VisualServoStatus::_internal_set_lateness_max_us(double value) {
+  
+  _impl_.lateness_max_us_ = value;
+}
+inline void VisualServoStatus::set_lateness_max_us(double value) {
+  _internal_set_lateness_max_us(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.VisualServoStatus.lateness_max_us)
+}
+
+// .mavsdk.rpc.gimbal.ServoGains gains = 10;
+inline bool VisualServoStatus::_internal_has_gains() const {
+  return this != internal_default_instance() && _impl_.gains_ != nullptr;
+}
+inline bool VisualServoStatus::has_gains() const {
+  return _internal_has_gains();
+}
+inline void VisualServoStatus::clear_gains() {
+  if (GetArenaForAllocation() == nullptr && _impl_.gains_ != nullptr) {
+    delete _impl_.gains_;
+  }
+  _impl_.gains_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::ServoGains& VisualServoStatus::_internal_gains() const {
+  const ::mavsdk::rpc::gimbal::ServoGains* p = _impl_.gains_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::ServoGains&>(
+      ::mavsdk::rpc::gimbal::_ServoGains_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::ServoGains& VisualServoStatus::gains() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.VisualServoStatus.gains)
+  return _internal_gains();
+}
+inline void VisualServoStatus::unsafe_arena_set_allocated_gains(
+    ::mavsdk::rpc::gimbal::ServoGains* gains) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gains_);
+  }
+  _impl_.gains_ = gains;
+  if (gains) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.VisualServoStatus.gains)
+}
+inline ::mavsdk::rpc::gimbal::ServoGains* VisualServoStatus::release_gains() {
+  
+  ::mavsdk::rpc::gimbal::ServoGains* temp = _impl_.gains_;
+  _impl_.gains_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::ServoGains* VisualServoStatus::unsafe_arena_release_gains() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.VisualServoStatus.gains)
+  
+  ::mavsdk::rpc::gimbal::ServoGains* temp = _impl_.gains_;
+  _impl_.gains_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::ServoGains* VisualServoStatus::_internal_mutable_gains() {
+  
+  if (_impl_.gains_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::ServoGains>(GetArenaForAllocation());
+    _impl_.gains_ = p;
+  }
+  return _impl_.gains_;
+}
+inline ::mavsdk::rpc::gimbal::ServoGains* VisualServoStatus::mutable_gains() {
+  ::mavsdk::rpc::gimbal::ServoGains* _msg = _internal_mutable_gains();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.VisualServoStatus.gains)
+  return _msg;
+}
+inline void VisualServoStatus::set_allocated_gains(::mavsdk::rpc::gimbal::ServoGains* gains) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.gains_;
+  }
+  if (gains) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gains);
+    if (message_arena != submessage_arena) {
+      gains = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gains, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.gains_ = gains;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.VisualServoStatus.gains)
+}
+
+// -------------------------------------------------------------------
+
+// ApplyGimbalStateRequest
+
+// .mavsdk.rpc.gimbal.TakeControlRequest take_control = 1;
+inline bool ApplyGimbalStateRequest::_internal_has_take_control() const {
+  return this != internal_default_instance() && _impl_.take_control_ != nullptr;
+}
+inline bool ApplyGimbalStateRequest::has_take_control() const {
+  return _internal_has_take_control();
+}
+inline void ApplyGimbalStateRequest::clear_take_control() {
+  if (GetArenaForAllocation() == nullptr && _impl_.take_control_ != nullptr) {
+    delete _impl_.take_control_;
+  }
+  _impl_.take_control_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::TakeControlRequest& ApplyGimbalStateRequest::_internal_take_control() const {
+  const ::mavsdk::rpc::gimbal::TakeControlRequest* p = _impl_.take_control_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::TakeControlRequest&>(
+      ::mavsdk::rpc::gimbal::_TakeControlRequest_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::TakeControlRequest& ApplyGimbalStateRequest::take_control() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.take_control)
+  return _internal_take_control();
+}
+inline void ApplyGimbalStateRequest::unsafe_arena_set_allocated_take_control(
+    ::mavsdk::rpc::gimbal::TakeControlRequest* take_control) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.take_control_);
+  }
+  _impl_.take_control_ = take_control;
+  if (take_control) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.take_control)
+}
+inline ::mavsdk::rpc::gimbal::TakeControlRequest* ApplyGimbalStateRequest::release_take_control() {
+  
+  ::mavsdk::rpc::gimbal::TakeControlRequest* temp = _impl_.take_control_;
+  _impl_.take_control_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::TakeControlRequest* ApplyGimbalStateRequest::unsafe_arena_release_take_control() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.take_control)
+  
+  ::mavsdk::rpc::gimbal::TakeControlRequest* temp = _impl_.take_control_;
+  _impl_.take_control_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::TakeControlRequest* ApplyGimbalStateRequest::_internal_mutable_take_control() {
+  
+  if (_impl_.take_control_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::TakeControlRequest>(GetArenaForAllocation());
+    _impl_.take_control_ = p;
+  }
+  return _impl_.take_control_;
+}
+inline ::mavsdk::rpc::gimbal::TakeControlRequest* ApplyGimbalStateRequest::mutable_take_control() {
+  ::mavsdk::rpc::gimbal::TakeControlRequest* _msg = _internal_mutable_take_control();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.take_control)
+  return _msg;
+}
+inline void ApplyGimbalStateRequest::set_allocated_take_control(::mavsdk::rpc::gimbal::TakeControlRequest* take_control) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.take_control_;
+  }
+  if (take_control) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(take_control);
+    if (message_arena != submessage_arena) {
+      take_control = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, take_control, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.take_control_ = take_control;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.take_control)
+}
+
+// .mavsdk.rpc.gimbal.SetModeRequest set_mode = 2;
+inline bool ApplyGimbalStateRequest::_internal_has_set_mode() const {
+  return this != internal_default_instance() && _impl_.set_mode_ != nullptr;
+}
+inline bool ApplyGimbalStateRequest::has_set_mode() const {
+  return _internal_has_set_mode();
+}
+inline void ApplyGimbalStateRequest::clear_set_mode() {
+  if (GetArenaForAllocation() == nullptr && _impl_.set_mode_ != nullptr) {
+    delete _impl_.set_mode_;
+  }
+  _impl_.set_mode_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::SetModeRequest& ApplyGimbalStateRequest::_internal_set_mode() const {
+  const ::mavsdk::rpc::gimbal::SetModeRequest* p = _impl_.set_mode_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::SetModeRequest&>(
+      ::mavsdk::rpc::gimbal::_SetModeRequest_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::SetModeRequest& ApplyGimbalStateRequest::set_mode() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.set_mode)
+  return _internal_set_mode();
+}
+inline void ApplyGimbalStateRequest::unsafe_arena_set_allocated_set_mode(
+    ::mavsdk::rpc::gimbal::SetModeRequest* set_mode) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.set_mode_);
+  }
+  _impl_.set_mode_ = set_mode;
+  if (set_mode) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.set_mode)
+}
+inline ::mavsdk::rpc::gimbal::SetModeRequest* ApplyGimbalStateRequest::release_set_mode() {
+  
+  ::mavsdk::rpc::gimbal::SetModeRequest* temp = _impl_.set_mode_;
+  _impl_.set_mode_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::SetModeRequest* ApplyGimbalStateRequest::unsafe_arena_release_set_mode() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.set_mode)
+  
+  ::mavsdk::rpc::gimbal::SetModeRequest* temp = _impl_.set_mode_;
+  _impl_.set_mode_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::SetModeRequest* ApplyGimbalStateRequest::_internal_mutable_set_mode() {
+  
+  if (_impl_.set_mode_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::SetModeRequest>(GetArenaForAllocation());
+    _impl_.set_mode_ = p;
   }
-  template<typename T>
-  static inline const std::string& Result_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, Result>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function Result_Name.");
-    return GimbalResult_Result_Name(enum_t_value);
+  return _impl_.set_mode_;
+}
+inline ::mavsdk::rpc::gimbal::SetModeRequest* ApplyGimbalStateRequest::mutable_set_mode() {
+  ::mavsdk::rpc::gimbal::SetModeRequest* _msg = _internal_mutable_set_mode();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.set_mode)
+  return _msg;
+}
+inline void ApplyGimbalStateRequest::set_allocated_set_mode(::mavsdk::rpc::gimbal::SetModeRequest* set_mode) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.set_mode_;
   }
-  static inline bool Result_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      Result* value) {
-    return GimbalResult_Result_Parse(name, value);
+  if (set_mode) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_mode);
+    if (message_arena != submessage_arena) {
+      set_mode = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set_mode, submessage_arena);
+    }
+    
+  } else {
+    
   }
+  _impl_.set_mode_ = set_mode;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.set_mode)
+}
 
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kResultStrFieldNumber = 2,
-    kResultFieldNumber = 1,
-  };
-  // string result_str = 2;
-  void clear_result_str();
-  const std::string& result_str() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_result_str(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_result_str();
-  PROTOBUF_NODISCARD std::string* release_result_str();
-  void set_allocated_result_str(std::string* result_str);
-  private:
-  const std::string& _internal_result_str() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result_str(const std::string& value);
-  std::string* _internal_mutable_result_str();
-  public:
-
-  // .mavsdk.rpc.gimbal.GimbalResult.Result result = 1;
-  void clear_result();
-  ::mavsdk::rpc::gimbal::GimbalResult_Result result() const;
-  void set_result(::mavsdk::rpc::gimbal::GimbalResult_Result value);
-  private:
-  ::mavsdk::rpc::gimbal::GimbalResult_Result _internal_result() const;
-  void _internal_set_result(::mavsdk::rpc::gimbal::GimbalResult_Result value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:mavsdk.rpc.gimbal.GimbalResult)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_str_;
-    int result_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_gimbal_2eproto;
-};
-// ===================================================================
-
-
-// ===================================================================
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// SetPitchAndYawRequest
-
-// float pitch_deg = 1;
-inline void SetPitchAndYawRequest::clear_pitch_deg() {
-  _impl_.pitch_deg_ = 0;
+// .mavsdk.rpc.gimbal.SetPitchAndYawRequest pitch_and_yaw = 3;
+inline bool ApplyGimbalStateRequest::_internal_has_pitch_and_yaw() const {
+  return target_case() == kPitchAndYaw;
 }
-inline float SetPitchAndYawRequest::_internal_pitch_deg() const {
-  return _impl_.pitch_deg_;
+inline bool ApplyGimbalStateRequest::has_pitch_and_yaw() const {
+  return _internal_has_pitch_and_yaw();
 }
-inline float SetPitchAndYawRequest::pitch_deg() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchAndYawRequest.pitch_deg)
-  return _internal_pitch_deg();
+inline void ApplyGimbalStateRequest::set_has_pitch_and_yaw() {
+  _impl_._oneof_case_[0] = kPitchAndYaw;
 }
-inline void SetPitchAndYawRequest::_internal_set_pitch_deg(float value) {
-  
-  _impl_.pitch_deg_ = value;
+inline void ApplyGimbalStateRequest::clear_pitch_and_yaw() {
+  if (_internal_has_pitch_and_yaw()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.target_.pitch_and_yaw_;
+    }
+    clear_has_target();
+  }
 }
-inline void SetPitchAndYawRequest::set_pitch_deg(float value) {
-  _internal_set_pitch_deg(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetPitchAndYawRequest.pitch_deg)
+inline ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* ApplyGimbalStateRequest::release_pitch_and_yaw() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.pitch_and_yaw)
+  if (_internal_has_pitch_and_yaw()) {
+    clear_has_target();
+    ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* temp = _impl_.target_.pitch_and_yaw_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.target_.pitch_and_yaw_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest& ApplyGimbalStateRequest::_internal_pitch_and_yaw() const {
+  return _internal_has_pitch_and_yaw()
+      ? *_impl_.target_.pitch_and_yaw_
+      : reinterpret_cast< ::mavsdk::rpc::gimbal::SetPitchAndYawRequest&>(::mavsdk::rpc::gimbal::_SetPitchAndYawRequest_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest& ApplyGimbalStateRequest::pitch_and_yaw() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.pitch_and_yaw)
+  return _internal_pitch_and_yaw();
+}
+inline ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* ApplyGimbalStateRequest::unsafe_arena_release_pitch_and_yaw() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.pitch_and_yaw)
+  if (_internal_has_pitch_and_yaw()) {
+    clear_has_target();
+    ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* temp = _impl_.target_.pitch_and_yaw_;
+    _impl_.target_.pitch_and_yaw_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyGimbalStateRequest::unsafe_arena_set_allocated_pitch_and_yaw(::mavsdk::rpc::gimbal::SetPitchAndYawRequest* pitch_and_yaw) {
+  clear_target();
+  if (pitch_and_yaw) {
+    set_has_pitch_and_yaw();
+    _impl_.target_.pitch_and_yaw_ = pitch_and_yaw;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.pitch_and_yaw)
+}
+inline ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* ApplyGimbalStateRequest::_internal_mutable_pitch_and_yaw() {
+  if (!_internal_has_pitch_and_yaw()) {
+    clear_target();
+    set_has_pitch_and_yaw();
+    _impl_.target_.pitch_and_yaw_ = CreateMaybeMessage< ::mavsdk::rpc::gimbal::SetPitchAndYawRequest >(GetArenaForAllocation());
+  }
+  return _impl_.target_.pitch_and_yaw_;
+}
+inline ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* ApplyGimbalStateRequest::mutable_pitch_and_yaw() {
+  ::mavsdk::rpc::gimbal::SetPitchAndYawRequest* _msg = _internal_mutable_pitch_and_yaw();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.pitch_and_yaw)
+  return _msg;
 }
 
-// float yaw_deg = 2;
-inline void SetPitchAndYawRequest::clear_yaw_deg() {
-  _impl_.yaw_deg_ = 0;
+// .mavsdk.rpc.gimbal.SetRoiLocationRequest roi_location = 4;
+inline bool ApplyGimbalStateRequest::_internal_has_roi_location() const {
+  return target_case() == kRoiLocation;
 }
-inline float SetPitchAndYawRequest::_internal_yaw_deg() const {
-  return _impl_.yaw_deg_;
+inline bool ApplyGimbalStateRequest::has_roi_location() const {
+  return _internal_has_roi_location();
 }
-inline float SetPitchAndYawRequest::yaw_deg() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchAndYawRequest.yaw_deg)
-  return _internal_yaw_deg();
+inline void ApplyGimbalStateRequest::set_has_roi_location() {
+  _impl_._oneof_case_[0] = kRoiLocation;
 }
-inline void SetPitchAndYawRequest::_internal_set_yaw_deg(float value) {
-  
-  _impl_.yaw_deg_ = value;
+inline void ApplyGimbalStateRequest::clear_roi_location() {
+  if (_internal_has_roi_location()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.target_.roi_location_;
+    }
+    clear_has_target();
+  }
 }
-inline void SetPitchAndYawRequest::set_yaw_deg(float value) {
-  _internal_set_yaw_deg(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetPitchAndYawRequest.yaw_deg)
+inline ::mavsdk::rpc::gimbal::SetRoiLocationRequest* ApplyGimbalStateRequest::release_roi_location() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.roi_location)
+  if (_internal_has_roi_location()) {
+    clear_has_target();
+    ::mavsdk::rpc::gimbal::SetRoiLocationRequest* temp = _impl_.target_.roi_location_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.target_.roi_location_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::mavsdk::rpc::gimbal::SetRoiLocationRequest& ApplyGimbalStateRequest::_internal_roi_location() const {
+  return _internal_has_roi_location()
+      ? *_impl_.target_.roi_location_
+      : reinterpret_cast< ::mavsdk::rpc::gimbal::SetRoiLocationRequest&>(::mavsdk::rpc::gimbal::_SetRoiLocationRequest_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::SetRoiLocationRequest& ApplyGimbalStateRequest::roi_location() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.roi_location)
+  return _internal_roi_location();
+}
+inline ::mavsdk::rpc::gimbal::SetRoiLocationRequest* ApplyGimbalStateRequest::unsafe_arena_release_roi_location() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.roi_location)
+  if (_internal_has_roi_location()) {
+    clear_has_target();
+    ::mavsdk::rpc::gimbal::SetRoiLocationRequest* temp = _impl_.target_.roi_location_;
+    _impl_.target_.roi_location_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyGimbalStateRequest::unsafe_arena_set_allocated_roi_location(::mavsdk::rpc::gimbal::SetRoiLocationRequest* roi_location) {
+  clear_target();
+  if (roi_location) {
+    set_has_roi_location();
+    _impl_.target_.roi_location_ = roi_location;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.roi_location)
+}
+inline ::mavsdk::rpc::gimbal::SetRoiLocationRequest* ApplyGimbalStateRequest::_internal_mutable_roi_location() {
+  if (!_internal_has_roi_location()) {
+    clear_target();
+    set_has_roi_location();
+    _impl_.target_.roi_location_ = CreateMaybeMessage< ::mavsdk::rpc::gimbal::SetRoiLocationRequest >(GetArenaForAllocation());
+  }
+  return _impl_.target_.roi_location_;
+}
+inline ::mavsdk::rpc::gimbal::SetRoiLocationRequest* ApplyGimbalStateRequest::mutable_roi_location() {
+  ::mavsdk::rpc::gimbal::SetRoiLocationRequest* _msg = _internal_mutable_roi_location();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ApplyGimbalStateRequest.roi_location)
+  return _msg;
 }
 
+inline bool ApplyGimbalStateRequest::has_target() const {
+  return target_case() != TARGET_NOT_SET;
+}
+inline void ApplyGimbalStateRequest::clear_has_target() {
+  _impl_._oneof_case_[0] = TARGET_NOT_SET;
+}
+inline ApplyGimbalStateRequest::TargetCase ApplyGimbalStateRequest::target_case() const {
+  return ApplyGimbalStateRequest::TargetCase(_impl_._oneof_case_[0]);
+}
 // -------------------------------------------------------------------
 
-// SetPitchAndYawResponse
+// ApplyGimbalStateResponse
 
 // .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-inline bool SetPitchAndYawResponse::_internal_has_gimbal_result() const {
+inline bool ApplyGimbalStateResponse::_internal_has_gimbal_result() const {
   return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
 }
-inline bool SetPitchAndYawResponse::has_gimbal_result() const {
+inline bool ApplyGimbalStateResponse::has_gimbal_result() const {
   return _internal_has_gimbal_result();
 }
-inline void SetPitchAndYawResponse::clear_gimbal_result() {
+inline void ApplyGimbalStateResponse::clear_gimbal_result() {
   if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
     delete _impl_.gimbal_result_;
   }
   _impl_.gimbal_result_ = nullptr;
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& SetPitchAndYawResponse::_internal_gimbal_result() const {
+inline const ::mavsdk::rpc::gimbal::GimbalResult& ApplyGimbalStateResponse::_internal_gimbal_result() const {
   const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
   return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
       ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& SetPitchAndYawResponse::gimbal_result() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchAndYawResponse.gimbal_result)
+inline const ::mavsdk::rpc::gimbal::GimbalResult& ApplyGimbalStateResponse::gimbal_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.gimbal_result)
   return _internal_gimbal_result();
 }
-inline void SetPitchAndYawResponse::unsafe_arena_set_allocated_gimbal_result(
+inline void ApplyGimbalStateResponse::unsafe_arena_set_allocated_gimbal_result(
     ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
@@ -2803,9 +11809,9 @@ inline void SetPitchAndYawResponse::unsafe_arena_set_allocated_gimbal_result(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.SetPitchAndYawResponse.gimbal_result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.gimbal_result)
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchAndYawResponse::release_gimbal_result() {
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::release_gimbal_result() {
   
   ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
   _impl_.gimbal_result_ = nullptr;
@@ -2820,14 +11826,14 @@ inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchAndYawResponse::release_gimb
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchAndYawResponse::unsafe_arena_release_gimbal_result() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.SetPitchAndYawResponse.gimbal_result)
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::unsafe_arena_release_gimbal_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.gimbal_result)
   
   ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
   _impl_.gimbal_result_ = nullptr;
   return temp;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchAndYawResponse::_internal_mutable_gimbal_result() {
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::_internal_mutable_gimbal_result() {
   
   if (_impl_.gimbal_result_ == nullptr) {
     auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
@@ -2835,12 +11841,12 @@ inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchAndYawResponse::_internal_mu
   }
   return _impl_.gimbal_result_;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchAndYawResponse::mutable_gimbal_result() {
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::mutable_gimbal_result() {
   ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetPitchAndYawResponse.gimbal_result)
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.gimbal_result)
   return _msg;
 }
-inline void SetPitchAndYawResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+inline void ApplyGimbalStateResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.gimbal_result_;
@@ -2857,96 +11863,228 @@ inline void SetPitchAndYawResponse::set_allocated_gimbal_result(::mavsdk::rpc::g
     
   }
   _impl_.gimbal_result_ = gimbal_result;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.SetPitchAndYawResponse.gimbal_result)
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.gimbal_result)
 }
 
-// -------------------------------------------------------------------
-
-// SetPitchRateAndYawRateRequest
-
-// float pitch_rate_deg_s = 1;
-inline void SetPitchRateAndYawRateRequest::clear_pitch_rate_deg_s() {
-  _impl_.pitch_rate_deg_s_ = 0;
+// .mavsdk.rpc.gimbal.GimbalResult control_result = 2;
+inline bool ApplyGimbalStateResponse::_internal_has_control_result() const {
+  return this != internal_default_instance() && _impl_.control_result_ != nullptr;
 }
-inline float SetPitchRateAndYawRateRequest::_internal_pitch_rate_deg_s() const {
-  return _impl_.pitch_rate_deg_s_;
+inline bool ApplyGimbalStateResponse::has_control_result() const {
+  return _internal_has_control_result();
 }
-inline float SetPitchRateAndYawRateRequest::pitch_rate_deg_s() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest.pitch_rate_deg_s)
-  return _internal_pitch_rate_deg_s();
+inline void ApplyGimbalStateResponse::clear_control_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.control_result_ != nullptr) {
+    delete _impl_.control_result_;
+  }
+  _impl_.control_result_ = nullptr;
 }
-inline void SetPitchRateAndYawRateRequest::_internal_set_pitch_rate_deg_s(float value) {
+inline const ::mavsdk::rpc::gimbal::GimbalResult& ApplyGimbalStateResponse::_internal_control_result() const {
+  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.control_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
+      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& ApplyGimbalStateResponse::control_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.control_result)
+  return _internal_control_result();
+}
+inline void ApplyGimbalStateResponse::unsafe_arena_set_allocated_control_result(
+    ::mavsdk::rpc::gimbal::GimbalResult* control_result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.control_result_);
+  }
+  _impl_.control_result_ = control_result;
+  if (control_result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.control_result)
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::release_control_result() {
   
-  _impl_.pitch_rate_deg_s_ = value;
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.control_result_;
+  _impl_.control_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void SetPitchRateAndYawRateRequest::set_pitch_rate_deg_s(float value) {
-  _internal_set_pitch_rate_deg_s(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest.pitch_rate_deg_s)
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::unsafe_arena_release_control_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.control_result)
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.control_result_;
+  _impl_.control_result_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::_internal_mutable_control_result() {
+  
+  if (_impl_.control_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
+    _impl_.control_result_ = p;
+  }
+  return _impl_.control_result_;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::mutable_control_result() {
+  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_control_result();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.control_result)
+  return _msg;
+}
+inline void ApplyGimbalStateResponse::set_allocated_control_result(::mavsdk::rpc::gimbal::GimbalResult* control_result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.control_result_;
+  }
+  if (control_result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(control_result);
+    if (message_arena != submessage_arena) {
+      control_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, control_result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.control_result_ = control_result;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.control_result)
 }
 
-// float yaw_rate_deg_s = 2;
-inline void SetPitchRateAndYawRateRequest::clear_yaw_rate_deg_s() {
-  _impl_.yaw_rate_deg_s_ = 0;
+// .mavsdk.rpc.gimbal.GimbalResult mode_result = 3;
+inline bool ApplyGimbalStateResponse::_internal_has_mode_result() const {
+  return this != internal_default_instance() && _impl_.mode_result_ != nullptr;
 }
-inline float SetPitchRateAndYawRateRequest::_internal_yaw_rate_deg_s() const {
-  return _impl_.yaw_rate_deg_s_;
+inline bool ApplyGimbalStateResponse::has_mode_result() const {
+  return _internal_has_mode_result();
 }
-inline float SetPitchRateAndYawRateRequest::yaw_rate_deg_s() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest.yaw_rate_deg_s)
-  return _internal_yaw_rate_deg_s();
+inline void ApplyGimbalStateResponse::clear_mode_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.mode_result_ != nullptr) {
+    delete _impl_.mode_result_;
+  }
+  _impl_.mode_result_ = nullptr;
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& ApplyGimbalStateResponse::_internal_mode_result() const {
+  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.mode_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
+      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+}
+inline const ::mavsdk::rpc::gimbal::GimbalResult& ApplyGimbalStateResponse::mode_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.mode_result)
+  return _internal_mode_result();
+}
+inline void ApplyGimbalStateResponse::unsafe_arena_set_allocated_mode_result(
+    ::mavsdk::rpc::gimbal::GimbalResult* mode_result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.mode_result_);
+  }
+  _impl_.mode_result_ = mode_result;
+  if (mode_result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.mode_result)
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::release_mode_result() {
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.mode_result_;
+  _impl_.mode_result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::unsafe_arena_release_mode_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.mode_result)
+  
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.mode_result_;
+  _impl_.mode_result_ = nullptr;
+  return temp;
 }
-inline void SetPitchRateAndYawRateRequest::_internal_set_yaw_rate_deg_s(float value) {
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::_internal_mutable_mode_result() {
   
-  _impl_.yaw_rate_deg_s_ = value;
+  if (_impl_.mode_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
+    _impl_.mode_result_ = p;
+  }
+  return _impl_.mode_result_;
 }
-inline void SetPitchRateAndYawRateRequest::set_yaw_rate_deg_s(float value) {
-  _internal_set_yaw_rate_deg_s(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetPitchRateAndYawRateRequest.yaw_rate_deg_s)
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::mutable_mode_result() {
+  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_mode_result();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.mode_result)
+  return _msg;
+}
+inline void ApplyGimbalStateResponse::set_allocated_mode_result(::mavsdk::rpc::gimbal::GimbalResult* mode_result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.mode_result_;
+  }
+  if (mode_result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(mode_result);
+    if (message_arena != submessage_arena) {
+      mode_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, mode_result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.mode_result_ = mode_result;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.mode_result)
 }
 
-// -------------------------------------------------------------------
-
-// SetPitchRateAndYawRateResponse
-
-// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-inline bool SetPitchRateAndYawRateResponse::_internal_has_gimbal_result() const {
-  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+// .mavsdk.rpc.gimbal.GimbalResult target_result = 4;
+inline bool ApplyGimbalStateResponse::_internal_has_target_result() const {
+  return this != internal_default_instance() && _impl_.target_result_ != nullptr;
 }
-inline bool SetPitchRateAndYawRateResponse::has_gimbal_result() const {
-  return _internal_has_gimbal_result();
+inline bool ApplyGimbalStateResponse::has_target_result() const {
+  return _internal_has_target_result();
 }
-inline void SetPitchRateAndYawRateResponse::clear_gimbal_result() {
-  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
-    delete _impl_.gimbal_result_;
+inline void ApplyGimbalStateResponse::clear_target_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.target_result_ != nullptr) {
+    delete _impl_.target_result_;
   }
-  _impl_.gimbal_result_ = nullptr;
+  _impl_.target_result_ = nullptr;
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& SetPitchRateAndYawRateResponse::_internal_gimbal_result() const {
-  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
+inline const ::mavsdk::rpc::gimbal::GimbalResult& ApplyGimbalStateResponse::_internal_target_result() const {
+  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.target_result_;
   return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
       ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& SetPitchRateAndYawRateResponse::gimbal_result() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse.gimbal_result)
-  return _internal_gimbal_result();
+inline const ::mavsdk::rpc::gimbal::GimbalResult& ApplyGimbalStateResponse::target_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.target_result)
+  return _internal_target_result();
 }
-inline void SetPitchRateAndYawRateResponse::unsafe_arena_set_allocated_gimbal_result(
-    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+inline void ApplyGimbalStateResponse::unsafe_arena_set_allocated_target_result(
+    ::mavsdk::rpc::gimbal::GimbalResult* target_result) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.target_result_);
   }
-  _impl_.gimbal_result_ = gimbal_result;
-  if (gimbal_result) {
+  _impl_.target_result_ = target_result;
+  if (target_result) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse.gimbal_result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.target_result)
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchRateAndYawRateResponse::release_gimbal_result() {
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::release_target_result() {
   
-  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
-  _impl_.gimbal_result_ = nullptr;
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.target_result_;
+  _impl_.target_result_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -2958,585 +12096,910 @@ inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchRateAndYawRateResponse::rele
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchRateAndYawRateResponse::unsafe_arena_release_gimbal_result() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse.gimbal_result)
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::unsafe_arena_release_target_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.target_result)
   
-  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
-  _impl_.gimbal_result_ = nullptr;
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.target_result_;
+  _impl_.target_result_ = nullptr;
   return temp;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchRateAndYawRateResponse::_internal_mutable_gimbal_result() {
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::_internal_mutable_target_result() {
   
-  if (_impl_.gimbal_result_ == nullptr) {
+  if (_impl_.target_result_ == nullptr) {
     auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
-    _impl_.gimbal_result_ = p;
+    _impl_.target_result_ = p;
   }
-  return _impl_.gimbal_result_;
+  return _impl_.target_result_;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetPitchRateAndYawRateResponse::mutable_gimbal_result() {
-  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse.gimbal_result)
+inline ::mavsdk::rpc::gimbal::GimbalResult* ApplyGimbalStateResponse::mutable_target_result() {
+  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_target_result();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.target_result)
   return _msg;
 }
-inline void SetPitchRateAndYawRateResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
+inline void ApplyGimbalStateResponse::set_allocated_target_result(::mavsdk::rpc::gimbal::GimbalResult* target_result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.gimbal_result_;
+    delete _impl_.target_result_;
   }
-  if (gimbal_result) {
+  if (target_result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(target_result);
     if (message_arena != submessage_arena) {
-      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, gimbal_result, submessage_arena);
+      target_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, target_result, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.gimbal_result_ = gimbal_result;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.SetPitchRateAndYawRateResponse.gimbal_result)
+  _impl_.target_result_ = target_result;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ApplyGimbalStateResponse.target_result)
+}
+
+// -------------------------------------------------------------------
+
+// SetTracingRequest
+
+// bool enabled = 1;
+inline void SetTracingRequest::clear_enabled() {
+  _impl_.enabled_ = false;
+}
+inline bool SetTracingRequest::_internal_enabled() const {
+  return _impl_.enabled_;
+}
+inline bool SetTracingRequest::enabled() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetTracingRequest.enabled)
+  return _internal_enabled();
+}
+inline void SetTracingRequest::_internal_set_enabled(bool value) {
+  
+  _impl_.enabled_ = value;
+}
+inline void SetTracingRequest::set_enabled(bool value) {
+  _internal_set_enabled(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetTracingRequest.enabled)
+}
+
+// bool clear = 2;
+inline void SetTracingRequest::clear_clear() {
+  _impl_.clear_ = false;
+}
+inline bool SetTracingRequest::_internal_clear() const {
+  return _impl_.clear_;
+}
+inline bool SetTracingRequest::clear() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetTracingRequest.clear)
+  return _internal_clear();
+}
+inline void SetTracingRequest::_internal_set_clear(bool value) {
+  
+  _impl_.clear_ = value;
+}
+inline void SetTracingRequest::set_clear(bool value) {
+  _internal_set_clear(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetTracingRequest.clear)
+}
+
+// -------------------------------------------------------------------
+
+// SetTracingResponse
+
+// -------------------------------------------------------------------
+
+// GetTraceRequest
+
+// .mavsdk.rpc.gimbal.TraceFormat format = 1;
+inline void GetTraceRequest::clear_format() {
+  _impl_.format_ = 0;
+}
+inline ::mavsdk::rpc::gimbal::TraceFormat GetTraceRequest::_internal_format() const {
+  return static_cast< ::mavsdk::rpc::gimbal::TraceFormat >(_impl_.format_);
+}
+inline ::mavsdk::rpc::gimbal::TraceFormat GetTraceRequest::format() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetTraceRequest.format)
+  return _internal_format();
+}
+inline void GetTraceRequest::_internal_set_format(::mavsdk::rpc::gimbal::TraceFormat value) {
+  
+  _impl_.format_ = value;
+}
+inline void GetTraceRequest::set_format(::mavsdk::rpc::gimbal::TraceFormat value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetTraceRequest.format)
+}
+
+// bool clear = 2;
+inline void GetTraceRequest::clear_clear() {
+  _impl_.clear_ = false;
+}
+inline bool GetTraceRequest::_internal_clear() const {
+  return _impl_.clear_;
+}
+inline bool GetTraceRequest::clear() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetTraceRequest.clear)
+  return _internal_clear();
+}
+inline void GetTraceRequest::_internal_set_clear(bool value) {
+  
+  _impl_.clear_ = value;
+}
+inline void GetTraceRequest::set_clear(bool value) {
+  _internal_set_clear(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetTraceRequest.clear)
+}
+
+// -------------------------------------------------------------------
+
+// GetTraceResponse
+
+// bytes trace = 1;
+inline void GetTraceResponse::clear_trace() {
+  _impl_.trace_.ClearToEmpty();
+}
+inline const std::string& GetTraceResponse::trace() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetTraceResponse.trace)
+  return _internal_trace();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetTraceResponse::set_trace(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.trace_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetTraceResponse.trace)
+}
+inline std::string* GetTraceResponse::mutable_trace() {
+  std::string* _s = _internal_mutable_trace();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.GetTraceResponse.trace)
+  return _s;
+}
+inline const std::string& GetTraceResponse::_internal_trace() const {
+  return _impl_.trace_.Get();
+}
+inline void GetTraceResponse::_internal_set_trace(const std::string& value) {
+  
+  _impl_.trace_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetTraceResponse::_internal_mutable_trace() {
+  
+  return _impl_.trace_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetTraceResponse::release_trace() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.GetTraceResponse.trace)
+  return _impl_.trace_.Release();
+}
+inline void GetTraceResponse::set_allocated_trace(std::string* trace) {
+  if (trace != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.trace_.SetAllocated(trace, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.trace_.IsDefault()) {
+    _impl_.trace_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.GetTraceResponse.trace)
+}
+
+// uint64 spans = 2;
+inline void GetTraceResponse::clear_spans() {
+  _impl_.spans_ = uint64_t{0u};
+}
+inline uint64_t GetTraceResponse::_internal_spans() const {
+  return _impl_.spans_;
+}
+inline uint64_t GetTraceResponse::spans() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetTraceResponse.spans)
+  return _internal_spans();
+}
+inline void GetTraceResponse::_internal_set_spans(uint64_t value) {
+  
+  _impl_.spans_ = value;
+}
+inline void GetTraceResponse::set_spans(uint64_t value) {
+  _internal_set_spans(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetTraceResponse.spans)
+}
+
+// uint64 overwritten = 3;
+inline void GetTraceResponse::clear_overwritten() {
+  _impl_.overwritten_ = uint64_t{0u};
+}
+inline uint64_t GetTraceResponse::_internal_overwritten() const {
+  return _impl_.overwritten_;
+}
+inline uint64_t GetTraceResponse::overwritten() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.GetTraceResponse.overwritten)
+  return _internal_overwritten();
+}
+inline void GetTraceResponse::_internal_set_overwritten(uint64_t value) {
+  
+  _impl_.overwritten_ = value;
+}
+inline void GetTraceResponse::set_overwritten(uint64_t value) {
+  _internal_set_overwritten(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.GetTraceResponse.overwritten)
+}
+
+// -------------------------------------------------------------------
+
+// ControlStatus
+
+// .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
+inline void ControlStatus::clear_control_mode() {
+  _impl_.control_mode_ = 0;
+}
+inline ::mavsdk::rpc::gimbal::ControlMode ControlStatus::_internal_control_mode() const {
+  return static_cast< ::mavsdk::rpc::gimbal::ControlMode >(_impl_.control_mode_);
+}
+inline ::mavsdk::rpc::gimbal::ControlMode ControlStatus::control_mode() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlStatus.control_mode)
+  return _internal_control_mode();
+}
+inline void ControlStatus::_internal_set_control_mode(::mavsdk::rpc::gimbal::ControlMode value) {
+  
+  _impl_.control_mode_ = value;
+}
+inline void ControlStatus::set_control_mode(::mavsdk::rpc::gimbal::ControlMode value) {
+  _internal_set_control_mode(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ControlStatus.control_mode)
+}
+
+// int32 sysid_primary_control = 2;
+inline void ControlStatus::clear_sysid_primary_control() {
+  _impl_.sysid_primary_control_ = 0;
+}
+inline int32_t ControlStatus::_internal_sysid_primary_control() const {
+  return _impl_.sysid_primary_control_;
+}
+inline int32_t ControlStatus::sysid_primary_control() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlStatus.sysid_primary_control)
+  return _internal_sysid_primary_control();
+}
+inline void ControlStatus::_internal_set_sysid_primary_control(int32_t value) {
+  
+  _impl_.sysid_primary_control_ = value;
+}
+inline void ControlStatus::set_sysid_primary_control(int32_t value) {
+  _internal_set_sysid_primary_control(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ControlStatus.sysid_primary_control)
+}
+
+// int32 compid_primary_control = 3;
+inline void ControlStatus::clear_compid_primary_control() {
+  _impl_.compid_primary_control_ = 0;
+}
+inline int32_t ControlStatus::_internal_compid_primary_control() const {
+  return _impl_.compid_primary_control_;
+}
+inline int32_t ControlStatus::compid_primary_control() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlStatus.compid_primary_control)
+  return _internal_compid_primary_control();
+}
+inline void ControlStatus::_internal_set_compid_primary_control(int32_t value) {
+  
+  _impl_.compid_primary_control_ = value;
+}
+inline void ControlStatus::set_compid_primary_control(int32_t value) {
+  _internal_set_compid_primary_control(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ControlStatus.compid_primary_control)
+}
+
+// int32 sysid_secondary_control = 4;
+inline void ControlStatus::clear_sysid_secondary_control() {
+  _impl_.sysid_secondary_control_ = 0;
+}
+inline int32_t ControlStatus::_internal_sysid_secondary_control() const {
+  return _impl_.sysid_secondary_control_;
+}
+inline int32_t ControlStatus::sysid_secondary_control() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlStatus.sysid_secondary_control)
+  return _internal_sysid_secondary_control();
+}
+inline void ControlStatus::_internal_set_sysid_secondary_control(int32_t value) {
+  
+  _impl_.sysid_secondary_control_ = value;
+}
+inline void ControlStatus::set_sysid_secondary_control(int32_t value) {
+  _internal_set_sysid_secondary_control(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ControlStatus.sysid_secondary_control)
+}
+
+// int32 compid_secondary_control = 5;
+inline void ControlStatus::clear_compid_secondary_control() {
+  _impl_.compid_secondary_control_ = 0;
+}
+inline int32_t ControlStatus::_internal_compid_secondary_control() const {
+  return _impl_.compid_secondary_control_;
+}
+inline int32_t ControlStatus::compid_secondary_control() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlStatus.compid_secondary_control)
+  return _internal_compid_secondary_control();
+}
+inline void ControlStatus::_internal_set_compid_secondary_control(int32_t value) {
+  
+  _impl_.compid_secondary_control_ = value;
+}
+inline void ControlStatus::set_compid_secondary_control(int32_t value) {
+  _internal_set_compid_secondary_control(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ControlStatus.compid_secondary_control)
+}
+
+// -------------------------------------------------------------------
+
+// TelemetryRate
+
+// .mavsdk.rpc.gimbal.TelemetryStream stream = 1;
+inline void TelemetryRate::clear_stream() {
+  _impl_.stream_ = 0;
+}
+inline ::mavsdk::rpc::gimbal::TelemetryStream TelemetryRate::_internal_stream() const {
+  return static_cast< ::mavsdk::rpc::gimbal::TelemetryStream >(_impl_.stream_);
+}
+inline ::mavsdk::rpc::gimbal::TelemetryStream TelemetryRate::stream() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.TelemetryRate.stream)
+  return _internal_stream();
+}
+inline void TelemetryRate::_internal_set_stream(::mavsdk::rpc::gimbal::TelemetryStream value) {
+  
+  _impl_.stream_ = value;
+}
+inline void TelemetryRate::set_stream(::mavsdk::rpc::gimbal::TelemetryStream value) {
+  _internal_set_stream(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.TelemetryRate.stream)
 }
 
-// -------------------------------------------------------------------
-
-// SetModeRequest
-
-// .mavsdk.rpc.gimbal.GimbalMode gimbal_mode = 1;
-inline void SetModeRequest::clear_gimbal_mode() {
-  _impl_.gimbal_mode_ = 0;
+// double rate_hz = 2;
+inline void TelemetryRate::clear_rate_hz() {
+  _impl_.rate_hz_ = 0;
 }
-inline ::mavsdk::rpc::gimbal::GimbalMode SetModeRequest::_internal_gimbal_mode() const {
-  return static_cast< ::mavsdk::rpc::gimbal::GimbalMode >(_impl_.gimbal_mode_);
+inline double TelemetryRate::_internal_rate_hz() const {
+  return _impl_.rate_hz_;
 }
-inline ::mavsdk::rpc::gimbal::GimbalMode SetModeRequest::gimbal_mode() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetModeRequest.gimbal_mode)
-  return _internal_gimbal_mode();
+inline double TelemetryRate::rate_hz() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.TelemetryRate.rate_hz)
+  return _internal_rate_hz();
 }
-inline void SetModeRequest::_internal_set_gimbal_mode(::mavsdk::rpc::gimbal::GimbalMode value) {
+inline void TelemetryRate::_internal_set_rate_hz(double value) {
   
-  _impl_.gimbal_mode_ = value;
+  _impl_.rate_hz_ = value;
 }
-inline void SetModeRequest::set_gimbal_mode(::mavsdk::rpc::gimbal::GimbalMode value) {
-  _internal_set_gimbal_mode(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetModeRequest.gimbal_mode)
+inline void TelemetryRate::set_rate_hz(double value) {
+  _internal_set_rate_hz(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.TelemetryRate.rate_hz)
 }
 
 // -------------------------------------------------------------------
 
-// SetModeResponse
+// MavlinkFilter
 
-// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-inline bool SetModeResponse::_internal_has_gimbal_result() const {
-  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+// repeated uint32 message_ids = 1;
+inline int MavlinkFilter::_internal_message_ids_size() const {
+  return _impl_.message_ids_.size();
 }
-inline bool SetModeResponse::has_gimbal_result() const {
-  return _internal_has_gimbal_result();
+inline int MavlinkFilter::message_ids_size() const {
+  return _internal_message_ids_size();
 }
-inline void SetModeResponse::clear_gimbal_result() {
-  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  _impl_.gimbal_result_ = nullptr;
+inline void MavlinkFilter::clear_message_ids() {
+  _impl_.message_ids_.Clear();
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& SetModeResponse::_internal_gimbal_result() const {
-  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
-  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
-      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+inline uint32_t MavlinkFilter::_internal_message_ids(int index) const {
+  return _impl_.message_ids_.Get(index);
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& SetModeResponse::gimbal_result() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetModeResponse.gimbal_result)
-  return _internal_gimbal_result();
+inline uint32_t MavlinkFilter::message_ids(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.MavlinkFilter.message_ids)
+  return _internal_message_ids(index);
 }
-inline void SetModeResponse::unsafe_arena_set_allocated_gimbal_result(
-    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
-  }
-  _impl_.gimbal_result_ = gimbal_result;
-  if (gimbal_result) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.SetModeResponse.gimbal_result)
+inline void MavlinkFilter::set_message_ids(int index, uint32_t value) {
+  _impl_.message_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.MavlinkFilter.message_ids)
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetModeResponse::release_gimbal_result() {
-  
-  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
-  _impl_.gimbal_result_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline void MavlinkFilter::_internal_add_message_ids(uint32_t value) {
+  _impl_.message_ids_.Add(value);
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetModeResponse::unsafe_arena_release_gimbal_result() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.SetModeResponse.gimbal_result)
-  
-  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
-  _impl_.gimbal_result_ = nullptr;
-  return temp;
+inline void MavlinkFilter::add_message_ids(uint32_t value) {
+  _internal_add_message_ids(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.MavlinkFilter.message_ids)
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetModeResponse::_internal_mutable_gimbal_result() {
-  
-  if (_impl_.gimbal_result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
-    _impl_.gimbal_result_ = p;
-  }
-  return _impl_.gimbal_result_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+MavlinkFilter::_internal_message_ids() const {
+  return _impl_.message_ids_;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetModeResponse::mutable_gimbal_result() {
-  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetModeResponse.gimbal_result)
-  return _msg;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+MavlinkFilter::message_ids() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.MavlinkFilter.message_ids)
+  return _internal_message_ids();
 }
-inline void SetModeResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  if (gimbal_result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
-    if (message_arena != submessage_arena) {
-      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, gimbal_result, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.gimbal_result_ = gimbal_result;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.SetModeResponse.gimbal_result)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+MavlinkFilter::_internal_mutable_message_ids() {
+  return &_impl_.message_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+MavlinkFilter::mutable_message_ids() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.MavlinkFilter.message_ids)
+  return _internal_mutable_message_ids();
 }
 
 // -------------------------------------------------------------------
 
-// SetRoiLocationRequest
+// AttitudeBatch
 
-// double latitude_deg = 1;
-inline void SetRoiLocationRequest::clear_latitude_deg() {
-  _impl_.latitude_deg_ = 0;
+// uint64 base_timestamp_ms = 1;
+inline void AttitudeBatch::clear_base_timestamp_ms() {
+  _impl_.base_timestamp_ms_ = uint64_t{0u};
 }
-inline double SetRoiLocationRequest::_internal_latitude_deg() const {
-  return _impl_.latitude_deg_;
+inline uint64_t AttitudeBatch::_internal_base_timestamp_ms() const {
+  return _impl_.base_timestamp_ms_;
 }
-inline double SetRoiLocationRequest::latitude_deg() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetRoiLocationRequest.latitude_deg)
-  return _internal_latitude_deg();
+inline uint64_t AttitudeBatch::base_timestamp_ms() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.AttitudeBatch.base_timestamp_ms)
+  return _internal_base_timestamp_ms();
 }
-inline void SetRoiLocationRequest::_internal_set_latitude_deg(double value) {
+inline void AttitudeBatch::_internal_set_base_timestamp_ms(uint64_t value) {
   
-  _impl_.latitude_deg_ = value;
+  _impl_.base_timestamp_ms_ = value;
 }
-inline void SetRoiLocationRequest::set_latitude_deg(double value) {
-  _internal_set_latitude_deg(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetRoiLocationRequest.latitude_deg)
+inline void AttitudeBatch::set_base_timestamp_ms(uint64_t value) {
+  _internal_set_base_timestamp_ms(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.AttitudeBatch.base_timestamp_ms)
 }
 
-// double longitude_deg = 2;
-inline void SetRoiLocationRequest::clear_longitude_deg() {
-  _impl_.longitude_deg_ = 0;
+// repeated sint32 time_delta_ms = 2;
+inline int AttitudeBatch::_internal_time_delta_ms_size() const {
+  return _impl_.time_delta_ms_.size();
 }
-inline double SetRoiLocationRequest::_internal_longitude_deg() const {
-  return _impl_.longitude_deg_;
+inline int AttitudeBatch::time_delta_ms_size() const {
+  return _internal_time_delta_ms_size();
 }
-inline double SetRoiLocationRequest::longitude_deg() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetRoiLocationRequest.longitude_deg)
-  return _internal_longitude_deg();
+inline void AttitudeBatch::clear_time_delta_ms() {
+  _impl_.time_delta_ms_.Clear();
 }
-inline void SetRoiLocationRequest::_internal_set_longitude_deg(double value) {
-  
-  _impl_.longitude_deg_ = value;
+inline int32_t AttitudeBatch::_internal_time_delta_ms(int index) const {
+  return _impl_.time_delta_ms_.Get(index);
 }
-inline void SetRoiLocationRequest::set_longitude_deg(double value) {
-  _internal_set_longitude_deg(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetRoiLocationRequest.longitude_deg)
+inline int32_t AttitudeBatch::time_delta_ms(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.AttitudeBatch.time_delta_ms)
+  return _internal_time_delta_ms(index);
 }
-
-// float altitude_m = 3;
-inline void SetRoiLocationRequest::clear_altitude_m() {
-  _impl_.altitude_m_ = 0;
+inline void AttitudeBatch::set_time_delta_ms(int index, int32_t value) {
+  _impl_.time_delta_ms_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.AttitudeBatch.time_delta_ms)
 }
-inline float SetRoiLocationRequest::_internal_altitude_m() const {
-  return _impl_.altitude_m_;
+inline void AttitudeBatch::_internal_add_time_delta_ms(int32_t value) {
+  _impl_.time_delta_ms_.Add(value);
 }
-inline float SetRoiLocationRequest::altitude_m() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetRoiLocationRequest.altitude_m)
-  return _internal_altitude_m();
+inline void AttitudeBatch::add_time_delta_ms(int32_t value) {
+  _internal_add_time_delta_ms(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.AttitudeBatch.time_delta_ms)
 }
-inline void SetRoiLocationRequest::_internal_set_altitude_m(float value) {
-  
-  _impl_.altitude_m_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+AttitudeBatch::_internal_time_delta_ms() const {
+  return _impl_.time_delta_ms_;
 }
-inline void SetRoiLocationRequest::set_altitude_m(float value) {
-  _internal_set_altitude_m(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetRoiLocationRequest.altitude_m)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+AttitudeBatch::time_delta_ms() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.AttitudeBatch.time_delta_ms)
+  return _internal_time_delta_ms();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+AttitudeBatch::_internal_mutable_time_delta_ms() {
+  return &_impl_.time_delta_ms_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+AttitudeBatch::mutable_time_delta_ms() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.AttitudeBatch.time_delta_ms)
+  return _internal_mutable_time_delta_ms();
 }
 
-// -------------------------------------------------------------------
-
-// SetRoiLocationResponse
-
-// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-inline bool SetRoiLocationResponse::_internal_has_gimbal_result() const {
-  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+// repeated sint32 roll_cdeg = 3;
+inline int AttitudeBatch::_internal_roll_cdeg_size() const {
+  return _impl_.roll_cdeg_.size();
 }
-inline bool SetRoiLocationResponse::has_gimbal_result() const {
-  return _internal_has_gimbal_result();
+inline int AttitudeBatch::roll_cdeg_size() const {
+  return _internal_roll_cdeg_size();
 }
-inline void SetRoiLocationResponse::clear_gimbal_result() {
-  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  _impl_.gimbal_result_ = nullptr;
+inline void AttitudeBatch::clear_roll_cdeg() {
+  _impl_.roll_cdeg_.Clear();
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& SetRoiLocationResponse::_internal_gimbal_result() const {
-  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
-  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
-      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+inline int32_t AttitudeBatch::_internal_roll_cdeg(int index) const {
+  return _impl_.roll_cdeg_.Get(index);
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& SetRoiLocationResponse::gimbal_result() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetRoiLocationResponse.gimbal_result)
-  return _internal_gimbal_result();
+inline int32_t AttitudeBatch::roll_cdeg(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.AttitudeBatch.roll_cdeg)
+  return _internal_roll_cdeg(index);
 }
-inline void SetRoiLocationResponse::unsafe_arena_set_allocated_gimbal_result(
-    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
-  }
-  _impl_.gimbal_result_ = gimbal_result;
-  if (gimbal_result) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.SetRoiLocationResponse.gimbal_result)
+inline void AttitudeBatch::set_roll_cdeg(int index, int32_t value) {
+  _impl_.roll_cdeg_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.AttitudeBatch.roll_cdeg)
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetRoiLocationResponse::release_gimbal_result() {
-  
-  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
-  _impl_.gimbal_result_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline void AttitudeBatch::_internal_add_roll_cdeg(int32_t value) {
+  _impl_.roll_cdeg_.Add(value);
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetRoiLocationResponse::unsafe_arena_release_gimbal_result() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.SetRoiLocationResponse.gimbal_result)
-  
-  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
-  _impl_.gimbal_result_ = nullptr;
-  return temp;
+inline void AttitudeBatch::add_roll_cdeg(int32_t value) {
+  _internal_add_roll_cdeg(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.AttitudeBatch.roll_cdeg)
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetRoiLocationResponse::_internal_mutable_gimbal_result() {
-  
-  if (_impl_.gimbal_result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
-    _impl_.gimbal_result_ = p;
-  }
-  return _impl_.gimbal_result_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+AttitudeBatch::_internal_roll_cdeg() const {
+  return _impl_.roll_cdeg_;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* SetRoiLocationResponse::mutable_gimbal_result() {
-  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetRoiLocationResponse.gimbal_result)
-  return _msg;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+AttitudeBatch::roll_cdeg() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.AttitudeBatch.roll_cdeg)
+  return _internal_roll_cdeg();
 }
-inline void SetRoiLocationResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  if (gimbal_result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
-    if (message_arena != submessage_arena) {
-      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, gimbal_result, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.gimbal_result_ = gimbal_result;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.SetRoiLocationResponse.gimbal_result)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+AttitudeBatch::_internal_mutable_roll_cdeg() {
+  return &_impl_.roll_cdeg_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+AttitudeBatch::mutable_roll_cdeg() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.AttitudeBatch.roll_cdeg)
+  return _internal_mutable_roll_cdeg();
 }
 
-// -------------------------------------------------------------------
+// repeated sint32 pitch_cdeg = 4;
+inline int AttitudeBatch::_internal_pitch_cdeg_size() const {
+  return _impl_.pitch_cdeg_.size();
+}
+inline int AttitudeBatch::pitch_cdeg_size() const {
+  return _internal_pitch_cdeg_size();
+}
+inline void AttitudeBatch::clear_pitch_cdeg() {
+  _impl_.pitch_cdeg_.Clear();
+}
+inline int32_t AttitudeBatch::_internal_pitch_cdeg(int index) const {
+  return _impl_.pitch_cdeg_.Get(index);
+}
+inline int32_t AttitudeBatch::pitch_cdeg(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.AttitudeBatch.pitch_cdeg)
+  return _internal_pitch_cdeg(index);
+}
+inline void AttitudeBatch::set_pitch_cdeg(int index, int32_t value) {
+  _impl_.pitch_cdeg_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.AttitudeBatch.pitch_cdeg)
+}
+inline void AttitudeBatch::_internal_add_pitch_cdeg(int32_t value) {
+  _impl_.pitch_cdeg_.Add(value);
+}
+inline void AttitudeBatch::add_pitch_cdeg(int32_t value) {
+  _internal_add_pitch_cdeg(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.AttitudeBatch.pitch_cdeg)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+AttitudeBatch::_internal_pitch_cdeg() const {
+  return _impl_.pitch_cdeg_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+AttitudeBatch::pitch_cdeg() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.AttitudeBatch.pitch_cdeg)
+  return _internal_pitch_cdeg();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+AttitudeBatch::_internal_mutable_pitch_cdeg() {
+  return &_impl_.pitch_cdeg_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+AttitudeBatch::mutable_pitch_cdeg() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.AttitudeBatch.pitch_cdeg)
+  return _internal_mutable_pitch_cdeg();
+}
 
-// TakeControlRequest
+// repeated sint32 yaw_cdeg = 5;
+inline int AttitudeBatch::_internal_yaw_cdeg_size() const {
+  return _impl_.yaw_cdeg_.size();
+}
+inline int AttitudeBatch::yaw_cdeg_size() const {
+  return _internal_yaw_cdeg_size();
+}
+inline void AttitudeBatch::clear_yaw_cdeg() {
+  _impl_.yaw_cdeg_.Clear();
+}
+inline int32_t AttitudeBatch::_internal_yaw_cdeg(int index) const {
+  return _impl_.yaw_cdeg_.Get(index);
+}
+inline int32_t AttitudeBatch::yaw_cdeg(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.AttitudeBatch.yaw_cdeg)
+  return _internal_yaw_cdeg(index);
+}
+inline void AttitudeBatch::set_yaw_cdeg(int index, int32_t value) {
+  _impl_.yaw_cdeg_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.AttitudeBatch.yaw_cdeg)
+}
+inline void AttitudeBatch::_internal_add_yaw_cdeg(int32_t value) {
+  _impl_.yaw_cdeg_.Add(value);
+}
+inline void AttitudeBatch::add_yaw_cdeg(int32_t value) {
+  _internal_add_yaw_cdeg(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.gimbal.AttitudeBatch.yaw_cdeg)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+AttitudeBatch::_internal_yaw_cdeg() const {
+  return _impl_.yaw_cdeg_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+AttitudeBatch::yaw_cdeg() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.gimbal.AttitudeBatch.yaw_cdeg)
+  return _internal_yaw_cdeg();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+AttitudeBatch::_internal_mutable_yaw_cdeg() {
+  return &_impl_.yaw_cdeg_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+AttitudeBatch::mutable_yaw_cdeg() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.gimbal.AttitudeBatch.yaw_cdeg)
+  return _internal_mutable_yaw_cdeg();
+}
 
-// .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
-inline void TakeControlRequest::clear_control_mode() {
-  _impl_.control_mode_ = 0;
+// uint64 base_wall_time_ms = 6;
+inline void AttitudeBatch::clear_base_wall_time_ms() {
+  _impl_.base_wall_time_ms_ = uint64_t{0u};
 }
-inline ::mavsdk::rpc::gimbal::ControlMode TakeControlRequest::_internal_control_mode() const {
-  return static_cast< ::mavsdk::rpc::gimbal::ControlMode >(_impl_.control_mode_);
+inline uint64_t AttitudeBatch::_internal_base_wall_time_ms() const {
+  return _impl_.base_wall_time_ms_;
 }
-inline ::mavsdk::rpc::gimbal::ControlMode TakeControlRequest::control_mode() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.TakeControlRequest.control_mode)
-  return _internal_control_mode();
+inline uint64_t AttitudeBatch::base_wall_time_ms() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.AttitudeBatch.base_wall_time_ms)
+  return _internal_base_wall_time_ms();
 }
-inline void TakeControlRequest::_internal_set_control_mode(::mavsdk::rpc::gimbal::ControlMode value) {
+inline void AttitudeBatch::_internal_set_base_wall_time_ms(uint64_t value) {
   
-  _impl_.control_mode_ = value;
+  _impl_.base_wall_time_ms_ = value;
 }
-inline void TakeControlRequest::set_control_mode(::mavsdk::rpc::gimbal::ControlMode value) {
-  _internal_set_control_mode(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.TakeControlRequest.control_mode)
+inline void AttitudeBatch::set_base_wall_time_ms(uint64_t value) {
+  _internal_set_base_wall_time_ms(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.AttitudeBatch.base_wall_time_ms)
 }
 
 // -------------------------------------------------------------------
 
-// TakeControlResponse
+// Setpoint
 
-// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-inline bool TakeControlResponse::_internal_has_gimbal_result() const {
-  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+// uint64 sequence = 1;
+inline void Setpoint::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
 }
-inline bool TakeControlResponse::has_gimbal_result() const {
-  return _internal_has_gimbal_result();
+inline uint64_t Setpoint::_internal_sequence() const {
+  return _impl_.sequence_;
 }
-inline void TakeControlResponse::clear_gimbal_result() {
-  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  _impl_.gimbal_result_ = nullptr;
+inline uint64_t Setpoint::sequence() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.Setpoint.sequence)
+  return _internal_sequence();
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& TakeControlResponse::_internal_gimbal_result() const {
-  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
-  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
-      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+inline void Setpoint::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& TakeControlResponse::gimbal_result() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.TakeControlResponse.gimbal_result)
-  return _internal_gimbal_result();
+inline void Setpoint::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.Setpoint.sequence)
 }
-inline void TakeControlResponse::unsafe_arena_set_allocated_gimbal_result(
-    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
-  }
-  _impl_.gimbal_result_ = gimbal_result;
-  if (gimbal_result) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.TakeControlResponse.gimbal_result)
+
+// .mavsdk.rpc.gimbal.SetpointMode mode = 2;
+inline void Setpoint::clear_mode() {
+  _impl_.mode_ = 0;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* TakeControlResponse::release_gimbal_result() {
-  
-  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
-  _impl_.gimbal_result_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline ::mavsdk::rpc::gimbal::SetpointMode Setpoint::_internal_mode() const {
+  return static_cast< ::mavsdk::rpc::gimbal::SetpointMode >(_impl_.mode_);
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* TakeControlResponse::unsafe_arena_release_gimbal_result() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.TakeControlResponse.gimbal_result)
-  
-  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
-  _impl_.gimbal_result_ = nullptr;
-  return temp;
+inline ::mavsdk::rpc::gimbal::SetpointMode Setpoint::mode() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.Setpoint.mode)
+  return _internal_mode();
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* TakeControlResponse::_internal_mutable_gimbal_result() {
+inline void Setpoint::_internal_set_mode(::mavsdk::rpc::gimbal::SetpointMode value) {
   
-  if (_impl_.gimbal_result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
-    _impl_.gimbal_result_ = p;
-  }
-  return _impl_.gimbal_result_;
-}
-inline ::mavsdk::rpc::gimbal::GimbalResult* TakeControlResponse::mutable_gimbal_result() {
-  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.TakeControlResponse.gimbal_result)
-  return _msg;
+  _impl_.mode_ = value;
 }
-inline void TakeControlResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  if (gimbal_result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
-    if (message_arena != submessage_arena) {
-      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, gimbal_result, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.gimbal_result_ = gimbal_result;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.TakeControlResponse.gimbal_result)
+inline void Setpoint::set_mode(::mavsdk::rpc::gimbal::SetpointMode value) {
+  _internal_set_mode(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.Setpoint.mode)
 }
 
-// -------------------------------------------------------------------
-
-// ReleaseControlRequest
-
-// -------------------------------------------------------------------
+// float pitch_deg = 3;
+inline void Setpoint::clear_pitch_deg() {
+  _impl_.pitch_deg_ = 0;
+}
+inline float Setpoint::_internal_pitch_deg() const {
+  return _impl_.pitch_deg_;
+}
+inline float Setpoint::pitch_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.Setpoint.pitch_deg)
+  return _internal_pitch_deg();
+}
+inline void Setpoint::_internal_set_pitch_deg(float value) {
+  
+  _impl_.pitch_deg_ = value;
+}
+inline void Setpoint::set_pitch_deg(float value) {
+  _internal_set_pitch_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.Setpoint.pitch_deg)
+}
 
-// ReleaseControlResponse
+// float yaw_deg = 4;
+inline void Setpoint::clear_yaw_deg() {
+  _impl_.yaw_deg_ = 0;
+}
+inline float Setpoint::_internal_yaw_deg() const {
+  return _impl_.yaw_deg_;
+}
+inline float Setpoint::yaw_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.Setpoint.yaw_deg)
+  return _internal_yaw_deg();
+}
+inline void Setpoint::_internal_set_yaw_deg(float value) {
+  
+  _impl_.yaw_deg_ = value;
+}
+inline void Setpoint::set_yaw_deg(float value) {
+  _internal_set_yaw_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.Setpoint.yaw_deg)
+}
 
-// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 1;
-inline bool ReleaseControlResponse::_internal_has_gimbal_result() const {
-  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
+// float pitch_rate_deg_s = 5;
+inline void Setpoint::clear_pitch_rate_deg_s() {
+  _impl_.pitch_rate_deg_s_ = 0;
 }
-inline bool ReleaseControlResponse::has_gimbal_result() const {
-  return _internal_has_gimbal_result();
+inline float Setpoint::_internal_pitch_rate_deg_s() const {
+  return _impl_.pitch_rate_deg_s_;
 }
-inline void ReleaseControlResponse::clear_gimbal_result() {
-  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  _impl_.gimbal_result_ = nullptr;
+inline float Setpoint::pitch_rate_deg_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.Setpoint.pitch_rate_deg_s)
+  return _internal_pitch_rate_deg_s();
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& ReleaseControlResponse::_internal_gimbal_result() const {
-  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
-  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
-      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
+inline void Setpoint::_internal_set_pitch_rate_deg_s(float value) {
+  
+  _impl_.pitch_rate_deg_s_ = value;
 }
-inline const ::mavsdk::rpc::gimbal::GimbalResult& ReleaseControlResponse::gimbal_result() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ReleaseControlResponse.gimbal_result)
-  return _internal_gimbal_result();
+inline void Setpoint::set_pitch_rate_deg_s(float value) {
+  _internal_set_pitch_rate_deg_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.Setpoint.pitch_rate_deg_s)
 }
-inline void ReleaseControlResponse::unsafe_arena_set_allocated_gimbal_result(
-    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
-  }
-  _impl_.gimbal_result_ = gimbal_result;
-  if (gimbal_result) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ReleaseControlResponse.gimbal_result)
+
+// float yaw_rate_deg_s = 6;
+inline void Setpoint::clear_yaw_rate_deg_s() {
+  _impl_.yaw_rate_deg_s_ = 0;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* ReleaseControlResponse::release_gimbal_result() {
+inline float Setpoint::_internal_yaw_rate_deg_s() const {
+  return _impl_.yaw_rate_deg_s_;
+}
+inline float Setpoint::yaw_rate_deg_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.Setpoint.yaw_rate_deg_s)
+  return _internal_yaw_rate_deg_s();
+}
+inline void Setpoint::_internal_set_yaw_rate_deg_s(float value) {
   
-  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
-  _impl_.gimbal_result_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+  _impl_.yaw_rate_deg_s_ = value;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* ReleaseControlResponse::unsafe_arena_release_gimbal_result() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ReleaseControlResponse.gimbal_result)
+inline void Setpoint::set_yaw_rate_deg_s(float value) {
+  _internal_set_yaw_rate_deg_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.Setpoint.yaw_rate_deg_s)
+}
+
+// uint64 apply_time_ns = 7;
+inline void Setpoint::clear_apply_time_ns() {
+  _impl_.apply_time_ns_ = uint64_t{0u};
+}
+inline uint64_t Setpoint::_internal_apply_time_ns() const {
+  return _impl_.apply_time_ns_;
+}
+inline uint64_t Setpoint::apply_time_ns() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.Setpoint.apply_time_ns)
+  return _internal_apply_time_ns();
+}
+inline void Setpoint::_internal_set_apply_time_ns(uint64_t value) {
   
-  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
-  _impl_.gimbal_result_ = nullptr;
-  return temp;
+  _impl_.apply_time_ns_ = value;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* ReleaseControlResponse::_internal_mutable_gimbal_result() {
+inline void Setpoint::set_apply_time_ns(uint64_t value) {
+  _internal_set_apply_time_ns(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.Setpoint.apply_time_ns)
+}
+
+// bool jitter_buffered = 8;
+inline void Setpoint::clear_jitter_buffered() {
+  _impl_.jitter_buffered_ = false;
+}
+inline bool Setpoint::_internal_jitter_buffered() const {
+  return _impl_.jitter_buffered_;
+}
+inline bool Setpoint::jitter_buffered() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.Setpoint.jitter_buffered)
+  return _internal_jitter_buffered();
+}
+inline void Setpoint::_internal_set_jitter_buffered(bool value) {
   
-  if (_impl_.gimbal_result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
-    _impl_.gimbal_result_ = p;
-  }
-  return _impl_.gimbal_result_;
+  _impl_.jitter_buffered_ = value;
 }
-inline ::mavsdk::rpc::gimbal::GimbalResult* ReleaseControlResponse::mutable_gimbal_result() {
-  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ReleaseControlResponse.gimbal_result)
-  return _msg;
+inline void Setpoint::set_jitter_buffered(bool value) {
+  _internal_set_jitter_buffered(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.Setpoint.jitter_buffered)
 }
-inline void ReleaseControlResponse::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.gimbal_result_;
-  }
-  if (gimbal_result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
-    if (message_arena != submessage_arena) {
-      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, gimbal_result, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.gimbal_result_ = gimbal_result;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ReleaseControlResponse.gimbal_result)
+
+// uint64 sample_time_us = 9;
+inline void Setpoint::clear_sample_time_us() {
+  _impl_.sample_time_us_ = uint64_t{0u};
+}
+inline uint64_t Setpoint::_internal_sample_time_us() const {
+  return _impl_.sample_time_us_;
+}
+inline uint64_t Setpoint::sample_time_us() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.Setpoint.sample_time_us)
+  return _internal_sample_time_us();
+}
+inline void Setpoint::_internal_set_sample_time_us(uint64_t value) {
+  
+  _impl_.sample_time_us_ = value;
+}
+inline void Setpoint::set_sample_time_us(uint64_t value) {
+  _internal_set_sample_time_us(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.Setpoint.sample_time_us)
 }
 
 // -------------------------------------------------------------------
 
-// SubscribeControlRequest
-
-// -------------------------------------------------------------------
+// SetpointAck
 
-// ControlResponse
+// uint64 sequence = 1;
+inline void SetpointAck::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t SetpointAck::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t SetpointAck::sequence() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetpointAck.sequence)
+  return _internal_sequence();
+}
+inline void SetpointAck::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void SetpointAck::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.SetpointAck.sequence)
+}
 
-// .mavsdk.rpc.gimbal.ControlStatus control_status = 1;
-inline bool ControlResponse::_internal_has_control_status() const {
-  return this != internal_default_instance() && _impl_.control_status_ != nullptr;
+// .mavsdk.rpc.gimbal.GimbalResult gimbal_result = 2;
+inline bool SetpointAck::_internal_has_gimbal_result() const {
+  return this != internal_default_instance() && _impl_.gimbal_result_ != nullptr;
 }
-inline bool ControlResponse::has_control_status() const {
-  return _internal_has_control_status();
+inline bool SetpointAck::has_gimbal_result() const {
+  return _internal_has_gimbal_result();
 }
-inline void ControlResponse::clear_control_status() {
-  if (GetArenaForAllocation() == nullptr && _impl_.control_status_ != nullptr) {
-    delete _impl_.control_status_;
+inline void SetpointAck::clear_gimbal_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.gimbal_result_ != nullptr) {
+    delete _impl_.gimbal_result_;
   }
-  _impl_.control_status_ = nullptr;
+  _impl_.gimbal_result_ = nullptr;
 }
-inline const ::mavsdk::rpc::gimbal::ControlStatus& ControlResponse::_internal_control_status() const {
-  const ::mavsdk::rpc::gimbal::ControlStatus* p = _impl_.control_status_;
-  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::ControlStatus&>(
-      ::mavsdk::rpc::gimbal::_ControlStatus_default_instance_);
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetpointAck::_internal_gimbal_result() const {
+  const ::mavsdk::rpc::gimbal::GimbalResult* p = _impl_.gimbal_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::mavsdk::rpc::gimbal::GimbalResult&>(
+      ::mavsdk::rpc::gimbal::_GimbalResult_default_instance_);
 }
-inline const ::mavsdk::rpc::gimbal::ControlStatus& ControlResponse::control_status() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlResponse.control_status)
-  return _internal_control_status();
+inline const ::mavsdk::rpc::gimbal::GimbalResult& SetpointAck::gimbal_result() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.SetpointAck.gimbal_result)
+  return _internal_gimbal_result();
 }
-inline void ControlResponse::unsafe_arena_set_allocated_control_status(
-    ::mavsdk::rpc::gimbal::ControlStatus* control_status) {
+inline void SetpointAck::unsafe_arena_set_allocated_gimbal_result(
+    ::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.control_status_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gimbal_result_);
   }
-  _impl_.control_status_ = control_status;
-  if (control_status) {
+  _impl_.gimbal_result_ = gimbal_result;
+  if (gimbal_result) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.ControlResponse.control_status)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:mavsdk.rpc.gimbal.SetpointAck.gimbal_result)
 }
-inline ::mavsdk::rpc::gimbal::ControlStatus* ControlResponse::release_control_status() {
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetpointAck::release_gimbal_result() {
   
-  ::mavsdk::rpc::gimbal::ControlStatus* temp = _impl_.control_status_;
-  _impl_.control_status_ = nullptr;
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -3548,148 +13011,326 @@ inline ::mavsdk::rpc::gimbal::ControlStatus* ControlResponse::release_control_st
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::mavsdk::rpc::gimbal::ControlStatus* ControlResponse::unsafe_arena_release_control_status() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.ControlResponse.control_status)
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetpointAck::unsafe_arena_release_gimbal_result() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.SetpointAck.gimbal_result)
   
-  ::mavsdk::rpc::gimbal::ControlStatus* temp = _impl_.control_status_;
-  _impl_.control_status_ = nullptr;
+  ::mavsdk::rpc::gimbal::GimbalResult* temp = _impl_.gimbal_result_;
+  _impl_.gimbal_result_ = nullptr;
   return temp;
 }
-inline ::mavsdk::rpc::gimbal::ControlStatus* ControlResponse::_internal_mutable_control_status() {
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetpointAck::_internal_mutable_gimbal_result() {
   
-  if (_impl_.control_status_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::ControlStatus>(GetArenaForAllocation());
-    _impl_.control_status_ = p;
+  if (_impl_.gimbal_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::gimbal::GimbalResult>(GetArenaForAllocation());
+    _impl_.gimbal_result_ = p;
   }
-  return _impl_.control_status_;
+  return _impl_.gimbal_result_;
 }
-inline ::mavsdk::rpc::gimbal::ControlStatus* ControlResponse::mutable_control_status() {
-  ::mavsdk::rpc::gimbal::ControlStatus* _msg = _internal_mutable_control_status();
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.ControlResponse.control_status)
+inline ::mavsdk::rpc::gimbal::GimbalResult* SetpointAck::mutable_gimbal_result() {
+  ::mavsdk::rpc::gimbal::GimbalResult* _msg = _internal_mutable_gimbal_result();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.SetpointAck.gimbal_result)
   return _msg;
 }
-inline void ControlResponse::set_allocated_control_status(::mavsdk::rpc::gimbal::ControlStatus* control_status) {
+inline void SetpointAck::set_allocated_gimbal_result(::mavsdk::rpc::gimbal::GimbalResult* gimbal_result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.control_status_;
+    delete _impl_.gimbal_result_;
   }
-  if (control_status) {
+  if (gimbal_result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(control_status);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gimbal_result);
     if (message_arena != submessage_arena) {
-      control_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, control_status, submessage_arena);
+      gimbal_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gimbal_result, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.control_status_ = control_status;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.ControlResponse.control_status)
+  _impl_.gimbal_result_ = gimbal_result;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.SetpointAck.gimbal_result)
 }
 
 // -------------------------------------------------------------------
 
-// ControlStatus
+// ServoGains
 
-// .mavsdk.rpc.gimbal.ControlMode control_mode = 1;
-inline void ControlStatus::clear_control_mode() {
-  _impl_.control_mode_ = 0;
+// float kp = 1;
+inline void ServoGains::clear_kp() {
+  _impl_.kp_ = 0;
 }
-inline ::mavsdk::rpc::gimbal::ControlMode ControlStatus::_internal_control_mode() const {
-  return static_cast< ::mavsdk::rpc::gimbal::ControlMode >(_impl_.control_mode_);
+inline float ServoGains::_internal_kp() const {
+  return _impl_.kp_;
 }
-inline ::mavsdk::rpc::gimbal::ControlMode ControlStatus::control_mode() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlStatus.control_mode)
-  return _internal_control_mode();
+inline float ServoGains::kp() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ServoGains.kp)
+  return _internal_kp();
 }
-inline void ControlStatus::_internal_set_control_mode(::mavsdk::rpc::gimbal::ControlMode value) {
+inline void ServoGains::_internal_set_kp(float value) {
   
-  _impl_.control_mode_ = value;
+  _impl_.kp_ = value;
 }
-inline void ControlStatus::set_control_mode(::mavsdk::rpc::gimbal::ControlMode value) {
-  _internal_set_control_mode(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ControlStatus.control_mode)
+inline void ServoGains::set_kp(float value) {
+  _internal_set_kp(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ServoGains.kp)
 }
 
-// int32 sysid_primary_control = 2;
-inline void ControlStatus::clear_sysid_primary_control() {
-  _impl_.sysid_primary_control_ = 0;
+// float ki = 2;
+inline void ServoGains::clear_ki() {
+  _impl_.ki_ = 0;
 }
-inline int32_t ControlStatus::_internal_sysid_primary_control() const {
-  return _impl_.sysid_primary_control_;
+inline float ServoGains::_internal_ki() const {
+  return _impl_.ki_;
 }
-inline int32_t ControlStatus::sysid_primary_control() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlStatus.sysid_primary_control)
-  return _internal_sysid_primary_control();
+inline float ServoGains::ki() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ServoGains.ki)
+  return _internal_ki();
 }
-inline void ControlStatus::_internal_set_sysid_primary_control(int32_t value) {
+inline void ServoGains::_internal_set_ki(float value) {
   
-  _impl_.sysid_primary_control_ = value;
+  _impl_.ki_ = value;
 }
-inline void ControlStatus::set_sysid_primary_control(int32_t value) {
-  _internal_set_sysid_primary_control(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ControlStatus.sysid_primary_control)
+inline void ServoGains::set_ki(float value) {
+  _internal_set_ki(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ServoGains.ki)
 }
 
-// int32 compid_primary_control = 3;
-inline void ControlStatus::clear_compid_primary_control() {
-  _impl_.compid_primary_control_ = 0;
+// float kd = 3;
+inline void ServoGains::clear_kd() {
+  _impl_.kd_ = 0;
 }
-inline int32_t ControlStatus::_internal_compid_primary_control() const {
-  return _impl_.compid_primary_control_;
+inline float ServoGains::_internal_kd() const {
+  return _impl_.kd_;
 }
-inline int32_t ControlStatus::compid_primary_control() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlStatus.compid_primary_control)
-  return _internal_compid_primary_control();
+inline float ServoGains::kd() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ServoGains.kd)
+  return _internal_kd();
 }
-inline void ControlStatus::_internal_set_compid_primary_control(int32_t value) {
+inline void ServoGains::_internal_set_kd(float value) {
   
-  _impl_.compid_primary_control_ = value;
+  _impl_.kd_ = value;
 }
-inline void ControlStatus::set_compid_primary_control(int32_t value) {
-  _internal_set_compid_primary_control(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ControlStatus.compid_primary_control)
+inline void ServoGains::set_kd(float value) {
+  _internal_set_kd(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ServoGains.kd)
 }
 
-// int32 sysid_secondary_control = 4;
-inline void ControlStatus::clear_sysid_secondary_control() {
-  _impl_.sysid_secondary_control_ = 0;
+// float kff = 4;
+inline void ServoGains::clear_kff() {
+  _impl_.kff_ = 0;
 }
-inline int32_t ControlStatus::_internal_sysid_secondary_control() const {
-  return _impl_.sysid_secondary_control_;
+inline float ServoGains::_internal_kff() const {
+  return _impl_.kff_;
 }
-inline int32_t ControlStatus::sysid_secondary_control() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlStatus.sysid_secondary_control)
-  return _internal_sysid_secondary_control();
+inline float ServoGains::kff() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ServoGains.kff)
+  return _internal_kff();
 }
-inline void ControlStatus::_internal_set_sysid_secondary_control(int32_t value) {
+inline void ServoGains::_internal_set_kff(float value) {
   
-  _impl_.sysid_secondary_control_ = value;
+  _impl_.kff_ = value;
 }
-inline void ControlStatus::set_sysid_secondary_control(int32_t value) {
-  _internal_set_sysid_secondary_control(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ControlStatus.sysid_secondary_control)
+inline void ServoGains::set_kff(float value) {
+  _internal_set_kff(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ServoGains.kff)
 }
 
-// int32 compid_secondary_control = 5;
-inline void ControlStatus::clear_compid_secondary_control() {
-  _impl_.compid_secondary_control_ = 0;
+// float max_rate_deg_s = 5;
+inline void ServoGains::clear_max_rate_deg_s() {
+  _impl_.max_rate_deg_s_ = 0;
 }
-inline int32_t ControlStatus::_internal_compid_secondary_control() const {
-  return _impl_.compid_secondary_control_;
+inline float ServoGains::_internal_max_rate_deg_s() const {
+  return _impl_.max_rate_deg_s_;
 }
-inline int32_t ControlStatus::compid_secondary_control() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ControlStatus.compid_secondary_control)
-  return _internal_compid_secondary_control();
+inline float ServoGains::max_rate_deg_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.ServoGains.max_rate_deg_s)
+  return _internal_max_rate_deg_s();
 }
-inline void ControlStatus::_internal_set_compid_secondary_control(int32_t value) {
+inline void ServoGains::_internal_set_max_rate_deg_s(float value) {
   
-  _impl_.compid_secondary_control_ = value;
+  _impl_.max_rate_deg_s_ = value;
 }
-inline void ControlStatus::set_compid_secondary_control(int32_t value) {
-  _internal_set_compid_secondary_control(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ControlStatus.compid_secondary_control)
+inline void ServoGains::set_max_rate_deg_s(float value) {
+  _internal_set_max_rate_deg_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.ServoGains.max_rate_deg_s)
+}
+
+// -------------------------------------------------------------------
+
+// MotionProfile
+
+// .mavsdk.rpc.gimbal.ProfileShape shape = 1;
+inline void MotionProfile::clear_shape() {
+  _impl_.shape_ = 0;
+}
+inline ::mavsdk::rpc::gimbal::ProfileShape MotionProfile::_internal_shape() const {
+  return static_cast< ::mavsdk::rpc::gimbal::ProfileShape >(_impl_.shape_);
+}
+inline ::mavsdk::rpc::gimbal::ProfileShape MotionProfile::shape() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.MotionProfile.shape)
+  return _internal_shape();
+}
+inline void MotionProfile::_internal_set_shape(::mavsdk::rpc::gimbal::ProfileShape value) {
+  
+  _impl_.shape_ = value;
+}
+inline void MotionProfile::set_shape(::mavsdk::rpc::gimbal::ProfileShape value) {
+  _internal_set_shape(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.MotionProfile.shape)
+}
+
+// float max_velocity_deg_s = 2;
+inline void MotionProfile::clear_max_velocity_deg_s() {
+  _impl_.max_velocity_deg_s_ = 0;
+}
+inline float MotionProfile::_internal_max_velocity_deg_s() const {
+  return _impl_.max_velocity_deg_s_;
+}
+inline float MotionProfile::max_velocity_deg_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.MotionProfile.max_velocity_deg_s)
+  return _internal_max_velocity_deg_s();
+}
+inline void MotionProfile::_internal_set_max_velocity_deg_s(float value) {
+  
+  _impl_.max_velocity_deg_s_ = value;
+}
+inline void MotionProfile::set_max_velocity_deg_s(float value) {
+  _internal_set_max_velocity_deg_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.MotionProfile.max_velocity_deg_s)
+}
+
+// float max_acceleration_deg_s2 = 3;
+inline void MotionProfile::clear_max_acceleration_deg_s2() {
+  _impl_.max_acceleration_deg_s2_ = 0;
+}
+inline float MotionProfile::_internal_max_acceleration_deg_s2() const {
+  return _impl_.max_acceleration_deg_s2_;
+}
+inline float MotionProfile::max_acceleration_deg_s2() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.MotionProfile.max_acceleration_deg_s2)
+  return _internal_max_acceleration_deg_s2();
+}
+inline void MotionProfile::_internal_set_max_acceleration_deg_s2(float value) {
+  
+  _impl_.max_acceleration_deg_s2_ = value;
+}
+inline void MotionProfile::set_max_acceleration_deg_s2(float value) {
+  _internal_set_max_acceleration_deg_s2(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.MotionProfile.max_acceleration_deg_s2)
+}
+
+// float max_jerk_deg_s3 = 4;
+inline void MotionProfile::clear_max_jerk_deg_s3() {
+  _impl_.max_jerk_deg_s3_ = 0;
+}
+inline float MotionProfile::_internal_max_jerk_deg_s3() const {
+  return _impl_.max_jerk_deg_s3_;
+}
+inline float MotionProfile::max_jerk_deg_s3() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.MotionProfile.max_jerk_deg_s3)
+  return _internal_max_jerk_deg_s3();
+}
+inline void MotionProfile::_internal_set_max_jerk_deg_s3(float value) {
+  
+  _impl_.max_jerk_deg_s3_ = value;
+}
+inline void MotionProfile::set_max_jerk_deg_s3(float value) {
+  _internal_set_max_jerk_deg_s3(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.MotionProfile.max_jerk_deg_s3)
+}
+
+// float rate_hz = 5;
+inline void MotionProfile::clear_rate_hz() {
+  _impl_.rate_hz_ = 0;
+}
+inline float MotionProfile::_internal_rate_hz() const {
+  return _impl_.rate_hz_;
+}
+inline float MotionProfile::rate_hz() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.MotionProfile.rate_hz)
+  return _internal_rate_hz();
+}
+inline void MotionProfile::_internal_set_rate_hz(float value) {
+  
+  _impl_.rate_hz_ = value;
+}
+inline void MotionProfile::set_rate_hz(float value) {
+  _internal_set_rate_hz(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.MotionProfile.rate_hz)
+}
+
+// -------------------------------------------------------------------
+
+// Metric
+
+// string name = 1;
+inline void Metric::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Metric::name() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.Metric.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Metric::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.Metric.name)
+}
+inline std::string* Metric::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.gimbal.Metric.name)
+  return _s;
+}
+inline const std::string& Metric::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Metric::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Metric::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Metric::release_name() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.gimbal.Metric.name)
+  return _impl_.name_.Release();
+}
+inline void Metric::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.gimbal.Metric.name)
+}
+
+// double value = 2;
+inline void Metric::clear_value() {
+  _impl_.value_ = 0;
+}
+inline double Metric::_internal_value() const {
+  return _impl_.value_;
+}
+inline double Metric::value() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.gimbal.Metric.value)
+  return _internal_value();
+}
+inline void Metric::_internal_set_value(double value) {
+  
+  _impl_.value_ = value;
+}
+inline void Metric::set_value(double value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.gimbal.Metric.value)
 }
 
 // -------------------------------------------------------------------
@@ -3799,6 +13440,68 @@ inline void GimbalResult::set_allocated_result_str(std::string* result_str) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3823,6 +13526,26 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::mavsdk::rpc::gimbal::ControlMode>() {
   return ::mavsdk::rpc::gimbal::ControlMode_descriptor();
 }
+template <> struct is_proto_enum< ::mavsdk::rpc::gimbal::TelemetryStream> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::mavsdk::rpc::gimbal::TelemetryStream>() {
+  return ::mavsdk::rpc::gimbal::TelemetryStream_descriptor();
+}
+template <> struct is_proto_enum< ::mavsdk::rpc::gimbal::SetpointMode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::mavsdk::rpc::gimbal::SetpointMode>() {
+  return ::mavsdk::rpc::gimbal::SetpointMode_descriptor();
+}
+template <> struct is_proto_enum< ::mavsdk::rpc::gimbal::ProfileShape> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::mavsdk::rpc::gimbal::ProfileShape>() {
+  return ::mavsdk::rpc::gimbal::ProfileShape_descriptor();
+}
+template <> struct is_proto_enum< ::mavsdk::rpc::gimbal::TraceFormat> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::mavsdk::rpc::gimbal::TraceFormat>() {
+  return ::mavsdk::rpc::gimbal::TraceFormat_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -0,0 +1,213 @@
+#include "jitter_buffer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t transit_window = 64;
+
+int64_t to_us(std::chrono::steady_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+}
+
+bool same_output(const JitterBuffer::Sample &a, const JitterBuffer::Sample &b) {
+    return a.rate == b.rate && a.pitch == b.pitch && a.yaw == b.yaw;
+}
+
+}
+
+void JitterBuffer::Totals::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &out) {
+        out.push_back({"jitter.samples", static_cast<double>(samples.load())});
+        out.push_back({"jitter.late_samples", static_cast<double>(late_samples.load())});
+        out.push_back({"jitter.extrapolated", static_cast<double>(extrapolated.load())});
+        out.push_back({"jitter.underruns", static_cast<double>(underruns.load())});
+        out.push_back({"jitter.depth", static_cast<double>(depth.load())});
+        out.push_back({"jitter.delay_ms", static_cast<double>(delay_us.load()) / 1000.0});
+        out.push_back({"jitter.jitter_ms", static_cast<double>(jitter_us.load()) / 1000.0});
+        out.push_back({"jitter.active_buffers", static_cast<double>(active_buffers.load())});
+    });
+}
+
+JitterBuffer::JitterBuffer(Config config, Totals &totals, Output output)
+        : config{config}, totals{totals}, output{std::move(output)} {
+
+    delay_us = static_cast<double>(std::chrono::microseconds(this->config.min_delay).count());
+    totals.active_buffers++;
+    if (this->output) {
+        player = std::thread(&JitterBuffer::run, this);
+    }
+
+}
+
+JitterBuffer::~JitterBuffer() {
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeup.notify_all();
+    if (player.joinable()) {
+        player.join();
+    }
+    totals.active_buffers--;
+
+}
+
+void JitterBuffer::push(const Sample &sample, std::chrono::steady_clock::time_point arrival) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    totals.samples++;
+
+    const Sample *newest = !samples.empty() ? &samples.back() : played > 0 ? &previous : nullptr;
+    if (newest && newest->rate != sample.rate) {
+        reset();
+        newest = nullptr;
+    }
+    if (newest && sample.time_us <= newest->time_us) {
+        // Reordered, or already played past.
+        totals.late_samples++;
+        return;
+    }
+
+    // RFC 3550 style interarrival jitter, from the change in transit time.
+    auto transit = to_us(arrival) - static_cast<int64_t>(sample.time_us);
+    if (!transits.empty()) {
+        jitter_us += (std::abs(static_cast<double>(transit - last_transit_us)) - jitter_us) / 16.0;
+    }
+    last_transit_us = transit;
+    transits.push_back(transit);
+    if (transits.size() > transit_window) {
+        transits.pop_front();
+    }
+    std::vector<int64_t> sorted{transits.begin(), transits.end()};
+    std::sort(sorted.begin(), sorted.end());
+    base_transit_us = sorted.front();
+    auto quantile = static_cast<std::size_t>(config.transit_quantile * static_cast<double>(sorted.size() - 1) + 0.5);
+    spread_us = sorted[std::min(quantile, sorted.size() - 1)] - base_transit_us;
+
+    auto playout_us = to_us(arrival) - base_transit_us - static_cast<int64_t>(delay_us);
+    if (started && static_cast<int64_t>(sample.time_us) < playout_us) {
+        // Still the newest sample, so it is kept as the next target.
+        totals.late_samples++;
+    }
+    samples.push_back(sample);
+
+}
+
+void JitterBuffer::reset() {
+    samples.clear();
+    played = 0;
+    started = false;
+    underrun = false;
+    transits.clear();
+    spread_us = 0;
+    jitter_us = 0;
+    delay_us = static_cast<double>(std::chrono::microseconds(config.min_delay).count());
+}
+
+bool JitterBuffer::play(std::chrono::steady_clock::time_point now, Sample &out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return advance(now, out);
+}
+
+bool JitterBuffer::advance(std::chrono::steady_clock::time_point now, Sample &out) {
+
+    if (samples.empty() && played == 0) {
+        return false;
+    }
+
+    // Move part of the way towards the target each tick, so playout speeds
+    // up or slows down gently instead of jumping. Growing is faster than
+    // shrinking, since too short a delay is what causes underruns.
+    auto target = std::clamp(static_cast<double>(spread_us),
+                             static_cast<double>(std::chrono::microseconds(config.min_delay).count()),
+                             static_cast<double>(std::chrono::microseconds(config.max_delay).count()));
+    delay_us += (target - delay_us) / (target > delay_us ? 8.0 : 32.0);
+
+    auto playout_us = to_us(now) - base_transit_us - static_cast<int64_t>(delay_us);
+    while (!samples.empty() && static_cast<int64_t>(samples.front().time_us) <= playout_us) {
+        prior = previous;
+        previous = samples.front();
+        played = std::min<std::size_t>(played + 1, 2);
+        samples.pop_front();
+        started = true;
+    }
+
+    totals.depth = samples.size();
+    totals.delay_us = static_cast<uint64_t>(delay_us);
+    totals.jitter_us = static_cast<uint64_t>(jitter_us);
+
+    // Still filling up to the playout delay.
+    if (!started) {
+        return false;
+    }
+
+    out = previous;
+    auto since_previous = static_cast<double>(playout_us - static_cast<int64_t>(previous.time_us));
+
+    if (!samples.empty()) {
+        const auto &next = samples.front();
+        auto f = std::clamp(since_previous / static_cast<double>(next.time_us - previous.time_us), 0.0, 1.0);
+        out.pitch = static_cast<float>(previous.pitch + (next.pitch - previous.pitch) * f);
+        out.yaw = static_cast<float>(previous.yaw + (next.yaw - previous.yaw) * f);
+        underrun = false;
+    } else if (since_previous <= static_cast<double>(std::chrono::microseconds(config.max_extrapolation).count())) {
+        if (played == 2) {
+            auto f = since_previous / static_cast<double>(previous.time_us - prior.time_us);
+            out.pitch = static_cast<float>(previous.pitch + (previous.pitch - prior.pitch) * f);
+            out.yaw = static_cast<float>(previous.yaw + (previous.yaw - prior.yaw) * f);
+        }
+        totals.extrapolated++;
+    } else {
+        if (!underrun) {
+            underrun = true;
+            totals.underruns++;
+        }
+        if (out.rate) {
+            out.pitch = 0;
+            out.yaw = 0;
+        } else if (has_output && !last_output.rate) {
+            // Stay where extrapolation left off rather than snapping back.
+            out.pitch = last_output.pitch;
+            out.yaw = last_output.yaw;
+        }
+    }
+    out.time_us = static_cast<uint64_t>(playout_us);
+
+    if (has_output && same_output(out, last_output)) {
+        return false;
+    }
+    last_output = out;
+    has_output = true;
+    return true;
+
+}
+
+void JitterBuffer::run() {
+
+    auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / std::max(config.playout_rate_hz, 1.0)));
+    auto next = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (!stopping) {
+        if (wakeup.wait_until(lock, next, [this] { return stopping; })) {
+            break;
+        }
+        auto now = std::chrono::steady_clock::now();
+        next = std::max(next + period, now);
+
+        Sample out;
+        if (!advance(now, out)) {
+            continue;
+        }
+        lock.unlock();
+        output(out);
+        lock.lock();
+    }
+
+}
@@ -0,0 +1,116 @@
+#ifndef GIMBAL_MAVSDK_JITTER_BUFFER_H
+#define GIMBAL_MAVSDK_JITTER_BUFFER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "metrics.h"
+
+// Smooths a stream of setpoints that arrives in bursts.
+//
+// Samples are played out at a fixed rate, a playout delay behind the time
+// they were taken. The delay follows the spread of recent transit times
+// within configured bounds, so a steady link costs little latency. Between
+// samples the output is interpolated; across a gap it is extrapolated from
+// the last two samples for a short while, after which an angle is held and
+// a rate drops to zero.
+class JitterBuffer final {
+
+public:
+
+    struct Config {
+        std::chrono::milliseconds min_delay{20};
+        std::chrono::milliseconds max_delay{250};
+        double transit_quantile = 0.95; // Share of recent samples the delay should cover
+        std::chrono::milliseconds max_extrapolation{100};
+        double playout_rate_hz = 50;
+    };
+
+    struct Sample {
+        uint64_t time_us; // When the sample was taken, on the sender's clock
+        bool rate;        // pitch and yaw are rates rather than angles
+        float pitch;
+        float yaw;
+    };
+
+    using Output = std::function<void(const Sample &)>;
+
+    // Shared by all buffers of a service, exported as jitter.* metrics.
+    class Totals final {
+
+    public:
+
+        void register_metrics(MetricsRegistry &registry) const;
+
+    private:
+
+        friend class JitterBuffer;
+
+        std::atomic<uint64_t> samples{0};
+        std::atomic<uint64_t> late_samples{0};      // Arrived after their playout time
+        std::atomic<uint64_t> extrapolated{0};      // Output ticks past the newest sample
+        std::atomic<uint64_t> underruns{0};         // Gaps longer than max_extrapolation
+        std::atomic<uint64_t> depth{0};             // Samples ahead of playout, last buffer to play out
+        std::atomic<uint64_t> delay_us{0};
+        std::atomic<uint64_t> jitter_us{0};
+        std::atomic<uint64_t> active_buffers{0};
+
+    };
+
+    // output is called from the buffer's playout thread. Without one no
+    // thread is started, and the caller plays out with play().
+    JitterBuffer(Config config, Totals &totals, Output output = {});
+    ~JitterBuffer();
+
+    JitterBuffer(const JitterBuffer &) = delete;
+    JitterBuffer &operator=(const JitterBuffer &) = delete;
+
+    // A change between angles and rates starts over with an empty buffer.
+    void push(const Sample &sample, std::chrono::steady_clock::time_point arrival);
+
+    // The output at now. Returns false while there is none yet or it is the
+    // same as the last.
+    bool play(std::chrono::steady_clock::time_point now, Sample &out);
+
+private:
+
+    void reset();
+    bool advance(std::chrono::steady_clock::time_point now, Sample &out);
+    void run();
+
+    const Config config;
+    Totals &totals;
+    const Output output;
+
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    bool stopping{false};
+
+    std::deque<Sample> samples;
+    Sample previous{};           // Last sample played past
+    Sample prior{};              // The one before it, for the extrapolation slope
+    std::size_t played{0};       // How many of previous and prior are set
+    bool started{false};         // Playout has reached the first sample
+    bool underrun{false};
+    Sample last_output{};
+    bool has_output{false};
+
+    // Transit is arrival minus sample time, so it includes the clock offset.
+    std::deque<int64_t> transits;
+    int64_t base_transit_us{0};  // Smallest recent transit, taken as the delay-free path
+    int64_t spread_us{0};        // transit_quantile of recent transits above the base
+    int64_t last_transit_us{0};
+    double jitter_us{0};         // Exported only
+    double delay_us{0};
+
+    std::thread player;
+
+};
+
+#endif // GIMBAL_MAVSDK_JITTER_BUFFER_H
@@ -0,0 +1,153 @@
+#include "link_budgeter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+LinkBudgeter::LinkBudgeter(LinkMonitor &monitor, CommandScheduler &scheduler, Config config)
+        : monitor{monitor}, scheduler{scheduler}, config{config} {}
+
+LinkBudgeter::~LinkBudgeter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeup.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void LinkBudgeter::add_stream(Stream stream) {
+    std::lock_guard<std::mutex> lock(mutex);
+    double initial = stream.desired_hz;
+    streams.push_back({std::move(stream), initial, false});
+}
+
+void LinkBudgeter::start() {
+    worker = std::thread(&LinkBudgeter::run, this);
+}
+
+bool LinkBudgeter::set_desired_rate(const std::string &name, double rate_hz) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto &state : streams) {
+        if (state.stream.name != name) {
+            continue;
+        }
+        rate_hz = std::max(rate_hz, 0.0);
+        state.stream.desired_hz = rate_hz;
+        state.stream.min_hz = std::min(state.stream.min_hz, rate_hz);
+        state.current_hz = rate_hz;
+        state.applied = true;
+        return true;
+    }
+    return false;
+
+}
+
+void LinkBudgeter::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        std::lock_guard<std::mutex> lock(mutex);
+        samples.push_back({"budget.target_utilization", config.target_utilization});
+        samples.push_back({"budget.setpoint_limit_hz", setpoint_limit_hz});
+        for (const auto &state : streams) {
+            samples.push_back({"budget.stream." + state.stream.name + ".rate_hz", state.current_hz});
+            samples.push_back({"budget.stream." + state.stream.name + ".desired_hz", state.stream.desired_hz});
+        }
+    });
+}
+
+void LinkBudgeter::run() {
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    // Start from a known state: every stream at its desired rate.
+    for (auto &state : streams) {
+        set_rate(state, state.stream.desired_hz);
+    }
+    monitor.sample();
+
+    while (!wakeup.wait_for(lock, config.period, [this] { return stopping; })) {
+        rebalance();
+    }
+
+}
+
+void LinkBudgeter::rebalance() {
+
+    auto rates = monitor.sample();
+    double budget = monitor.capacity_bytes_per_s() * config.target_utilization;
+
+    // Incoming: the direction telemetry streams compete for.
+    double excess = rates.rx_bytes_per_s - budget;
+    if (excess > 0) {
+        for (auto it = streams.rbegin(); it != streams.rend() && excess > 0; ++it) {
+            double reducible = (it->current_hz - it->stream.min_hz) * static_cast<double>(it->stream.frame_bytes);
+            if (reducible <= 0) {
+                continue;
+            }
+            double cut = std::min(reducible, excess);
+            set_rate(*it, it->current_hz - cut / static_cast<double>(it->stream.frame_bytes));
+            excess -= cut;
+        }
+    } else {
+        double headroom = budget * config.restore_below - rates.rx_bytes_per_s;
+        for (auto &state : streams) {
+            if (headroom <= 0) {
+                break;
+            }
+            double missing = (state.stream.desired_hz - state.current_hz) * static_cast<double>(state.stream.frame_bytes);
+            if (missing <= 0) {
+                continue;
+            }
+            double added = std::min(missing, headroom);
+            set_rate(state, state.current_hz + added / static_cast<double>(state.stream.frame_bytes));
+            headroom -= added;
+        }
+    }
+
+    // Outgoing: setpoints get whatever the rest of the traffic leaves over.
+    double setpoint_frame_bytes = rates.tx_setpoint_frames_per_s > 0
+            ? rates.tx_setpoint_bytes_per_s / rates.tx_setpoint_frames_per_s
+            : static_cast<double>(config.setpoint_frame_bytes);
+    double available = budget - (rates.tx_bytes_per_s - rates.tx_setpoint_bytes_per_s);
+    double limit = std::clamp(available / setpoint_frame_bytes, config.min_setpoint_rate_hz, config.max_setpoint_rate_hz);
+
+    double new_limit = setpoint_limit_hz;
+    if (rates.tx_bytes_per_s > budget) {
+        new_limit = limit;
+    } else if (setpoint_limit_hz > 0) {
+        bool relaxed = rates.tx_bytes_per_s < budget * config.restore_below && limit >= config.max_setpoint_rate_hz;
+        new_limit = relaxed ? 0 : limit;
+    }
+
+    if (new_limit != setpoint_limit_hz) {
+        setpoint_limit_hz = new_limit;
+        scheduler.set_setpoint_rate_limit(new_limit);
+    }
+
+}
+
+void LinkBudgeter::set_rate(StreamState &state, double rate_hz) {
+
+    rate_hz = std::clamp(rate_hz, state.stream.min_hz, state.stream.desired_hz);
+
+    // Every change costs a SET_MESSAGE_INTERVAL round-trip on the same link, so
+    // ignore small adjustments unless they reach one of the bounds.
+    bool at_bound = rate_hz == state.stream.min_hz || rate_hz == state.stream.desired_hz;
+    double change = std::fabs(rate_hz - state.current_hz);
+    if (state.applied && (change == 0 || (!at_bound && change < state.current_hz * 0.1))) {
+        return;
+    }
+
+    if (!state.stream.apply(rate_hz)) {
+        std::cerr << "Failed to set " << state.stream.name << " rate to " << rate_hz << " Hz\n";
+        return;
+    }
+
+    state.current_hz = rate_hz;
+    state.applied = true;
+
+}
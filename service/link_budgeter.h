@@ -0,0 +1,91 @@
+#ifndef GIMBAL_MAVSDK_LINK_BUDGETER_H
+#define GIMBAL_MAVSDK_LINK_BUDGETER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "command_scheduler.h"
+#include "link_monitor.h"
+#include "metrics.h"
+
+// Keeps the serial link under a target utilization.
+//
+// Once per period the budgeter samples the link monitor and
+//  - sheds incoming telemetry by lowering MAVLink message intervals, least
+//    important stream first, and restores them when there is headroom;
+//  - caps the setpoint send rate to whatever the outgoing budget leaves after
+//    non-setpoint traffic, and lifts the cap when it is no longer needed.
+class LinkBudgeter final {
+
+public:
+
+    struct Config {
+        double target_utilization = 0.7;
+        double restore_below = 0.85;   // Fraction of the budget under which shed rates are restored
+        double min_setpoint_rate_hz = 2;
+        double max_setpoint_rate_hz = 50;
+        std::size_t setpoint_frame_bytes = 35; // Used until outgoing setpoints have been measured
+        std::chrono::milliseconds period{1000};
+    };
+
+    // An incoming stream whose message interval can be changed. apply is
+    // called from the budgeter thread with its state locked and must not
+    // block on the link.
+    struct Stream {
+        std::string name;
+        std::function<bool(double rate_hz)> apply;
+        double desired_hz;
+        double min_hz;
+        std::size_t frame_bytes; // On-wire size of one message
+    };
+
+    LinkBudgeter(LinkMonitor &monitor, CommandScheduler &scheduler, Config config);
+    ~LinkBudgeter();
+
+    LinkBudgeter(const LinkBudgeter &) = delete;
+    LinkBudgeter &operator=(const LinkBudgeter &) = delete;
+
+    // Streams must be added most important first, before start().
+    void add_stream(Stream stream);
+
+    void start();
+
+    // Records a rate the client has already applied to a stream. The rate
+    // becomes the stream's ceiling; 0 keeps the stream off. Returns false if
+    // the stream is not managed by the budgeter.
+    bool set_desired_rate(const std::string &name, double rate_hz);
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+private:
+
+    struct StreamState {
+        Stream stream;
+        double current_hz;
+        bool applied;
+    };
+
+    void run();
+    void rebalance();
+    void set_rate(StreamState &state, double rate_hz);
+
+    LinkMonitor &monitor;
+    CommandScheduler &scheduler;
+    const Config config;
+
+    mutable std::mutex mutex;
+    std::condition_variable wakeup;
+    bool stopping{false};
+    std::vector<StreamState> streams;
+    double setpoint_limit_hz{0};
+
+    std::thread worker;
+
+};
+
+#endif // GIMBAL_MAVSDK_LINK_BUDGETER_H
@@ -0,0 +1,138 @@
+#include "link_monitor.h"
+
+#include <algorithm>
+
+LinkMonitor::LinkMonitor(mavsdk::MavlinkPassthrough &passthrough, int baudrate)
+        : passthrough{passthrough}, baudrate{baudrate}, window_start{std::chrono::steady_clock::now()} {
+
+    passthrough.intercept_incoming_messages_async([this](mavlink_message_t &message) {
+        observe(Direction::Incoming, message);
+        return true;
+    });
+    passthrough.intercept_outgoing_messages_async([this](mavlink_message_t &message) {
+        observe(Direction::Outgoing, message);
+        return true;
+    });
+
+}
+
+LinkMonitor::~LinkMonitor() {
+    passthrough.intercept_incoming_messages_async(nullptr);
+    passthrough.intercept_outgoing_messages_async(nullptr);
+}
+
+LinkMonitor::ListenerId LinkMonitor::add_listener(Listener listener) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto id = next_listener_id++;
+    listeners.emplace_back(id, std::move(listener));
+    return id;
+}
+
+void LinkMonitor::remove_listener(ListenerId id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    listeners.erase(std::remove_if(listeners.begin(), listeners.end(),
+                                   [id](const auto &entry) { return entry.first == id; }),
+                    listeners.end());
+}
+
+void LinkMonitor::observe(Direction direction, const mavlink_message_t &message) {
+
+    auto bytes = wire_bytes(message);
+
+    if (direction == Direction::Incoming) {
+        rx_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    } else {
+        tx_bytes.fetch_add(bytes, std::memory_order_relaxed);
+        if (is_setpoint(message)) {
+            tx_setpoint_bytes.fetch_add(bytes, std::memory_order_relaxed);
+            tx_setpoint_frames.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto &entry : listeners) {
+        entry.second(direction, message);
+    }
+
+}
+
+LinkMonitor::Rates LinkMonitor::sample() {
+
+    auto now = std::chrono::steady_clock::now();
+    auto rx = rx_bytes.load(std::memory_order_relaxed);
+    auto tx = tx_bytes.load(std::memory_order_relaxed);
+    auto tx_setpoint = tx_setpoint_bytes.load(std::memory_order_relaxed);
+    auto tx_setpoint_count = tx_setpoint_frames.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    double elapsed = std::chrono::duration<double>(now - window_start).count();
+    if (elapsed <= 0) {
+        return rates;
+    }
+
+    rates.rx_bytes_per_s = static_cast<double>(rx - window_rx) / elapsed;
+    rates.tx_bytes_per_s = static_cast<double>(tx - window_tx) / elapsed;
+    rates.tx_setpoint_bytes_per_s = static_cast<double>(tx_setpoint - window_tx_setpoint) / elapsed;
+    rates.tx_setpoint_frames_per_s = static_cast<double>(tx_setpoint_count - window_tx_setpoint_frames) / elapsed;
+    rates.rx_utilization = rates.rx_bytes_per_s / capacity_bytes_per_s();
+    rates.tx_utilization = rates.tx_bytes_per_s / capacity_bytes_per_s();
+
+    window_start = now;
+    window_rx = rx;
+    window_tx = tx;
+    window_tx_setpoint = tx_setpoint;
+    window_tx_setpoint_frames = tx_setpoint_count;
+
+    return rates;
+
+}
+
+LinkMonitor::Rates LinkMonitor::last() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return rates;
+}
+
+void LinkMonitor::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        auto r = last();
+        samples.push_back({"link.rx_bytes_total", static_cast<double>(rx_bytes.load(std::memory_order_relaxed))});
+        samples.push_back({"link.tx_bytes_total", static_cast<double>(tx_bytes.load(std::memory_order_relaxed))});
+        samples.push_back({"link.rx_bytes_per_s", r.rx_bytes_per_s});
+        samples.push_back({"link.tx_bytes_per_s", r.tx_bytes_per_s});
+        samples.push_back({"link.tx_setpoint_bytes_per_s", r.tx_setpoint_bytes_per_s});
+        samples.push_back({"link.rx_utilization", r.rx_utilization});
+        samples.push_back({"link.tx_utilization", r.tx_utilization});
+    });
+}
+
+std::size_t LinkMonitor::wire_bytes(const mavlink_message_t &message) {
+
+    if (message.magic == MAVLINK_STX_MAVLINK1) {
+        // STX, len, seq, sysid, compid, msgid + checksum
+        return 8 + message.len;
+    }
+
+    std::size_t bytes = MAVLINK_NUM_NON_PAYLOAD_BYTES + message.len;
+    if (message.incompat_flags & MAVLINK_IFLAG_SIGNED) {
+        bytes += MAVLINK_SIGNATURE_BLOCK_LEN;
+    }
+    return bytes;
+
+}
+
+bool LinkMonitor::is_setpoint(const mavlink_message_t &message) {
+
+    switch (message.msgid) {
+        case MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_PITCHYAW:
+        case MAVLINK_MSG_ID_GIMBAL_MANAGER_SET_MANUAL_CONTROL:
+            return true;
+        case MAVLINK_MSG_ID_COMMAND_LONG: {
+            auto command = mavlink_msg_command_long_get_command(&message);
+            return command == MAV_CMD_DO_MOUNT_CONTROL || command == MAV_CMD_DO_GIMBAL_MANAGER_PITCHYAW;
+        }
+        default:
+            return false;
+    }
+
+}
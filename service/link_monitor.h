@@ -0,0 +1,92 @@
+#ifndef GIMBAL_MAVSDK_LINK_MONITOR_H
+#define GIMBAL_MAVSDK_LINK_MONITOR_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <mavsdk/plugins/mavlink_passthrough/mavlink_passthrough.h>
+#include "metrics.h"
+
+// Byte accounting for the serial MAVLink link.
+//
+// Installs the passthrough plugin's incoming and outgoing interceptors (the
+// plugin supports only one of each) and counts the on-wire size of every
+// frame. Other components that need to see raw frames register a listener
+// here instead of installing their own interceptor.
+class LinkMonitor final {
+
+public:
+
+    enum class Direction {
+        Incoming,
+        Outgoing
+    };
+
+    // Listeners run on MAVSDK's receive and send paths and must not block.
+    using Listener = std::function<void(Direction, const mavlink_message_t &)>;
+    using ListenerId = std::size_t;
+
+    struct Rates {
+        double rx_bytes_per_s;
+        double tx_bytes_per_s;
+        double tx_setpoint_bytes_per_s;
+        double tx_setpoint_frames_per_s;
+        double rx_utilization; // Fraction of the line rate, 8N1 framing included
+        double tx_utilization;
+    };
+
+    LinkMonitor(mavsdk::MavlinkPassthrough &passthrough, int baudrate);
+    ~LinkMonitor();
+
+    LinkMonitor(const LinkMonitor &) = delete;
+    LinkMonitor &operator=(const LinkMonitor &) = delete;
+
+    ListenerId add_listener(Listener listener);
+    void remove_listener(ListenerId id);
+
+    // Rates since the previous call.
+    Rates sample();
+
+    // Rates computed by the most recent sample().
+    Rates last() const;
+
+    // Payload bytes per second the line can carry in each direction.
+    double capacity_bytes_per_s() const { return baudrate / 10.0; }
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+    static std::size_t wire_bytes(const mavlink_message_t &message);
+
+    // Whether a frame carries a gimbal attitude or rate setpoint.
+    static bool is_setpoint(const mavlink_message_t &message);
+
+private:
+
+    void observe(Direction direction, const mavlink_message_t &message);
+
+    mavsdk::MavlinkPassthrough &passthrough;
+    const int baudrate;
+
+    std::atomic<uint64_t> rx_bytes{0};
+    std::atomic<uint64_t> tx_bytes{0};
+    std::atomic<uint64_t> tx_setpoint_bytes{0};
+    std::atomic<uint64_t> tx_setpoint_frames{0};
+
+    mutable std::mutex mutex;
+    std::vector<std::pair<ListenerId, Listener>> listeners;
+    ListenerId next_listener_id{0};
+    std::chrono::steady_clock::time_point window_start;
+    uint64_t window_rx{0};
+    uint64_t window_tx{0};
+    uint64_t window_tx_setpoint{0};
+    uint64_t window_tx_setpoint_frames{0};
+    Rates rates{};
+
+};
+
+#endif // GIMBAL_MAVSDK_LINK_MONITOR_H
@@ -0,0 +1,363 @@
+#ifndef GIMBAL_MAVSDK_LOOP_COROUTINE_H
+#define GIMBAL_MAVSDK_LOOP_COROUTINE_H
+
+#include <algorithm>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <grpcpp/alarm.h>
+#include <grpcpp/grpcpp.h>
+#include "event_loop.h"
+
+// Coroutines on the event loop, so a handler that waits on the client, the
+// gimbal or a timer reads as straight-line code instead of a chain of
+// callbacks, and still never blocks the loop thread.
+//
+// A handler returns LoopTask and co_awaits:
+// - on_queue(): a completion-queue operation, such as a stream read or write;
+// - LoopTimer::until(): a point in time;
+// - LoopEvent: another coroutine on the loop;
+// - on_loop(): a result delivered by a callback on another thread, such as a
+//   scheduler completion or a MAVSDK *_async() result;
+// - PendingResult: the same, for operations started earlier.
+// Each resumes the coroutine on the loop thread, so a coroutine's state is
+// only ever touched there.
+//
+// Keep co_await out of the right-hand side of && and ||: GCC 12 evaluates it
+// even when the left-hand side has decided the result.
+
+// A coroutine started on the loop and left to run. It runs until its first
+// co_await at once, and frees itself when it returns.
+class LoopTask final {
+
+public:
+
+    struct promise_type {
+        LoopTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+};
+
+// Starts an operation on the loop's completion queue with the awaiter as its
+// tag; co_await gives the operation's ok.
+template<typename Start>
+class QueueAwaiter final : public EventLoop::Operation {
+
+public:
+
+    explicit QueueAwaiter(Start start) : start{std::move(start)} {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        waiting = handle;
+        start(static_cast<EventLoop::Operation *>(this));
+    }
+
+    bool await_resume() const noexcept { return ok; }
+
+    void proceed(bool proceeded) override {
+        ok = proceeded;
+        waiting.resume();
+    }
+
+private:
+
+    Start start;
+    std::coroutine_handle<> waiting;
+    bool ok{false};
+
+};
+
+// start is called with the tag to pass to the operation.
+template<typename Start>
+QueueAwaiter<Start> on_queue(Start start) {
+    return QueueAwaiter<Start>{std::move(start)};
+}
+
+// Hands a callback to an operation that completes on another thread; the
+// result is posted back, and co_await gives it on the loop thread.
+template<typename Result>
+class PostedAwaiter final {
+
+public:
+
+    using Done = std::function<void(Result result)>;
+    using Start = std::function<void(Done done)>;
+
+    PostedAwaiter(EventLoop &loop, Start start) : loop{loop}, start{std::move(start)} {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        start([this, handle](Result posted) {
+            loop.post([this, handle, posted = std::move(posted)]() mutable {
+                result.emplace(std::move(posted));
+                handle.resume();
+            });
+        });
+    }
+
+    Result await_resume() { return std::move(*result); }
+
+private:
+
+    EventLoop &loop;
+    Start start;
+    std::optional<Result> result;
+
+};
+
+// start must call the callback exactly once.
+template<typename Result>
+PostedAwaiter<Result> on_loop(EventLoop &loop, typename PostedAwaiter<Result>::Start start) {
+    return PostedAwaiter<Result>{loop, std::move(start)};
+}
+
+// A result from another thread that is started before it is awaited, so
+// several can be in flight at once. The callback may outlive the awaiting
+// coroutine.
+template<typename Result>
+class PendingResult final {
+
+public:
+
+    explicit PendingResult(EventLoop &loop) : loop{loop}, state{std::make_shared<State>()} {}
+
+    // For the operation to call exactly once, from any thread.
+    std::function<void(Result result)> callback() {
+        return [&loop = loop, state = state](Result posted) {
+            loop.post([state, posted = std::move(posted)]() mutable {
+                state->result.emplace(std::move(posted));
+                if (state->waiting) {
+                    std::exchange(state->waiting, {}).resume();
+                }
+            });
+        };
+    }
+
+    auto operator co_await() {
+
+        struct Awaiter {
+            State &state;
+
+            bool await_ready() const noexcept { return state.result.has_value(); }
+            void await_suspend(std::coroutine_handle<> handle) { state.waiting = handle; }
+            Result await_resume() { return std::move(*state.result); }
+        };
+        return Awaiter{*state};
+
+    }
+
+private:
+
+    struct State {
+        std::optional<Result> result;
+        std::coroutine_handle<> waiting;
+    };
+
+    EventLoop &loop;
+    std::shared_ptr<State> state;
+
+};
+
+// A timer on the loop. One wait at a time; cancel() ends it early.
+class LoopTimer final : public EventLoop::Operation {
+
+public:
+
+    explicit LoopTimer(EventLoop &loop) : loop{loop} {}
+
+    LoopTimer(const LoopTimer &) = delete;
+    LoopTimer &operator=(const LoopTimer &) = delete;
+
+    // co_await gives false if the wait was cancelled.
+    auto until(std::chrono::steady_clock::time_point time) {
+
+        struct Awaiter {
+            LoopTimer &timer;
+            std::chrono::steady_clock::time_point time;
+
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                timer.waiting = handle;
+                auto wait = std::chrono::duration_cast<std::chrono::nanoseconds>(time - std::chrono::steady_clock::now());
+                timer.alarm.Set(timer.loop.queue(),
+                                gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                                             gpr_time_from_nanos(std::max<int64_t>(wait.count(), 0), GPR_TIMESPAN)),
+                                static_cast<EventLoop::Operation *>(&timer));
+            }
+
+            bool await_resume() const noexcept { return timer.fired; }
+        };
+        return Awaiter{*this, time};
+
+    }
+
+    // Loop thread only.
+    void cancel() {
+        if (waiting) {
+            alarm.Cancel();
+        }
+    }
+
+    void proceed(bool ok) override {
+        fired = ok;
+        std::exchange(waiting, {}).resume();
+    }
+
+private:
+
+    EventLoop &loop;
+    grpc::Alarm alarm;
+    std::coroutine_handle<> waiting;
+    bool fired{false};
+
+};
+
+// Wakes a coroutine waiting on the loop from another coroutine there. A
+// set() with nobody waiting is kept for the next wait. The waiter runs
+// inside set(), up to its next co_await.
+class LoopEvent final {
+
+public:
+
+    void set() {
+        if (waiting) {
+            std::exchange(waiting, {}).resume();
+        } else {
+            signalled = true;
+        }
+    }
+
+    auto operator co_await() {
+
+        struct Awaiter {
+            LoopEvent &event;
+
+            bool await_ready() const noexcept { return std::exchange(event.signalled, false); }
+            void await_suspend(std::coroutine_handle<> handle) { event.waiting = handle; }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{*this};
+
+    }
+
+private:
+
+    std::coroutine_handle<> waiting;
+    bool signalled{false};
+
+};
+
+// Serves one streaming method with a coroutine per call, like
+// EventLoop::UnaryCall does for unary ones. Stream is the gRPC async stream
+// type; Request is the single request of a server-streaming method, unused
+// otherwise.
+template<typename Request, typename Stream>
+class LoopStreamCall final : public EventLoop::Operation {
+
+public:
+
+    // Asks the server for the next call of the method, with tag.
+    using Requester = std::function<void(LoopStreamCall *call, void *tag)>;
+    using Handler = std::function<LoopTask(LoopStreamCall *call)>;
+
+    // Keeps one call of the method requested at all times.
+    static void listen(EventLoop &loop, Requester requester, Handler handler) {
+        auto call = new LoopStreamCall(loop, std::move(requester), std::move(handler));
+        call->context.AsyncNotifyWhenDone(static_cast<Operation *>(&call->done));
+        call->requester(call, static_cast<Operation *>(call));
+    }
+
+    EventLoop &loop;
+    grpc::ServerContext context;
+    Request request;
+    Stream stream{&context};
+
+    // Loop thread only. Whether the client has gone away.
+    bool cancelled() const { return done.arrived && context.IsCancelled(); }
+
+    // One read and one write can be outstanding at a time; co_await gives
+    // false once the stream is over.
+    template<typename Message>
+    auto read(Message &message) {
+        return on_queue([this, &message](void *tag) { stream.Read(&message, tag); });
+    }
+
+    template<typename Message>
+    auto write(const Message &message) {
+        return on_queue([this, &message](void *tag) { stream.Write(message, tag); });
+    }
+
+    // Loop thread only, once, with no read or write outstanding.
+    void finish(const grpc::Status &status) {
+        stream.Finish(status, static_cast<Operation *>(this));
+    }
+
+private:
+
+    class Done final : public Operation {
+
+    public:
+
+        explicit Done(LoopStreamCall &call) : call{call} {}
+
+        void proceed(bool) override {
+            arrived = true;
+            call.release();
+        }
+
+        bool arrived{false};
+
+    private:
+
+        LoopStreamCall &call;
+
+    };
+
+    LoopStreamCall(EventLoop &loop, Requester requester, Handler handler)
+            : loop{loop}, requester{std::move(requester)}, handler{std::move(handler)} {}
+
+    void proceed(bool ok) override {
+
+        if (!started) {
+            if (!ok) {
+                delete this;
+                return;
+            }
+            started = true;
+            listen(loop, requester, handler);
+            handler(this);
+            return;
+        }
+
+        finished = true;
+        release();
+
+    }
+
+    void release() {
+        if (finished && done.arrived) {
+            delete this;
+        }
+    }
+
+    const Requester requester;
+    const Handler handler;
+    Done done{*this};
+    bool started{false};
+    bool finished{false};
+
+};
+
+#endif // GIMBAL_MAVSDK_LOOP_COROUTINE_H
@@ -0,0 +1,45 @@
+#ifndef GIMBAL_MAVSDK_METRICS_H
+#define GIMBAL_MAVSDK_METRICS_H
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Registry of named counters and gauges exported through the GetMetrics RPC.
+//
+// Components do not push values; they register a collector which is invoked
+// on every snapshot and appends its current samples.
+class MetricsRegistry final {
+
+public:
+
+    struct Sample {
+        std::string name;
+        double value;
+    };
+
+    using Collector = std::function<void(std::vector<Sample> &)>;
+
+    void add_collector(Collector collector) {
+        std::lock_guard<std::mutex> lock(mutex);
+        collectors.push_back(std::move(collector));
+    }
+
+    std::vector<Sample> snapshot() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<Sample> samples;
+        for (const auto &collector : collectors) {
+            collector(samples);
+        }
+        return samples;
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::vector<Collector> collectors;
+
+};
+
+#endif // GIMBAL_MAVSDK_METRICS_H
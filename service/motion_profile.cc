@@ -0,0 +1,157 @@
+#include "motion_profile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+void MotionProfile::Totals::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &out) {
+        out.push_back({"profile.active_moves", static_cast<double>(active_moves.load())});
+        out.push_back({"profile.moves", static_cast<double>(moves.load())});
+        out.push_back({"profile.completed", static_cast<double>(completed.load())});
+        out.push_back({"profile.stopped", static_cast<double>(stopped.load())});
+        out.push_back({"profile.points", static_cast<double>(points.load())});
+        out.push_back({"profile.duration_last_ms", static_cast<double>(duration_last_ms.load())});
+        out.push_back({"profile.lateness_max_us", static_cast<double>(lateness_max_us.load())});
+    });
+}
+
+MotionProfile::MotionProfile(Shape shape, const Limits &limits, double distance) : length{std::max(distance, 0.0)} {
+
+    if (length == 0) {
+        return;
+    }
+
+    double v = limits.max_velocity;
+    double a = limits.max_acceleration;
+
+    if (shape == Shape::Trapezoid) {
+        // Reaching v and stopping again takes v^2 / a.
+        peak_velocity = std::min(v, std::sqrt(length * a));
+        peak_acceleration = a;
+        accel_s = peak_velocity / a;
+    } else {
+        jerk = limits.max_jerk;
+
+        // Reaching a velocity takes v / a + a / j, with a no higher than
+        // sqrt(v * j) when the ramps meet before the acceleration limit. The
+        // distance covered getting there and stopping is v times that.
+        auto ramp_s = [&](double velocity) {
+            double acceleration = std::min(a, std::sqrt(velocity * jerk));
+            return velocity / acceleration + acceleration / jerk;
+        };
+        peak_velocity = v;
+        if (v * ramp_s(v) > length) {
+            peak_velocity = std::cbrt(length * length * jerk / 4);
+            if (peak_velocity * jerk > a * a) {
+                double b = a * a / jerk;
+                peak_velocity = (-b + std::sqrt(b * b + 4 * length * a)) / 2;
+            }
+        }
+        peak_acceleration = std::min(a, std::sqrt(peak_velocity * jerk));
+        jerk_s = peak_acceleration / jerk;
+        accel_s = ramp_s(peak_velocity);
+    }
+
+    cruise_s = std::max(0.0, length / peak_velocity - accel_s);
+
+}
+
+MotionProfile::Point MotionProfile::ramp(double t) const {
+
+    if (jerk == 0) {
+        return {peak_acceleration * t * t / 2, peak_acceleration * t, peak_acceleration};
+    }
+
+    double j = jerk;
+    double a = peak_acceleration;
+    double constant_s = accel_s - 2 * jerk_s;
+
+    if (t <= jerk_s) {
+        return {j * t * t * t / 6, j * t * t / 2, j * t};
+    }
+
+    double v1 = j * jerk_s * jerk_s / 2;
+    double p1 = j * jerk_s * jerk_s * jerk_s / 6;
+    if (t <= jerk_s + constant_s) {
+        double tau = t - jerk_s;
+        return {p1 + v1 * tau + a * tau * tau / 2, v1 + a * tau, a};
+    }
+
+    double v2 = v1 + a * constant_s;
+    double p2 = p1 + v1 * constant_s + a * constant_s * constant_s / 2;
+    double tau = t - jerk_s - constant_s;
+    return {p2 + v2 * tau + a * tau * tau / 2 - j * tau * tau * tau / 6,
+            v2 + a * tau - j * tau * tau / 2,
+            a - j * tau};
+
+}
+
+MotionProfile::Point MotionProfile::at(double t) const {
+
+    if (t <= 0) {
+        return {0, 0, 0};
+    }
+    if (t >= duration()) {
+        return {length, 0, 0};
+    }
+
+    if (t < accel_s) {
+        return ramp(t);
+    }
+    if (t < accel_s + cruise_s) {
+        return {ramp(accel_s).position + peak_velocity * (t - accel_s), peak_velocity, 0};
+    }
+
+    // Deceleration mirrors acceleration.
+    auto mirrored = ramp(duration() - t);
+    return {length - mirrored.position, mirrored.velocity, -mirrored.acceleration};
+
+}
+
+MotionProfile::Stepper::Stepper(const MotionProfile &profile, double rate_hz, Totals &totals)
+        : profile{profile}, rate_hz{rate_hz}, totals{totals}, start{std::chrono::steady_clock::now()} {
+    totals.moves++;
+    totals.active_moves++;
+    totals.duration_last_ms = static_cast<uint64_t>(profile.duration() * 1000);
+}
+
+MotionProfile::Stepper::~Stepper() {
+    (finished ? totals.completed : totals.stopped)++;
+    totals.active_moves--;
+}
+
+std::chrono::steady_clock::time_point MotionProfile::Stepper::due() const {
+    double t = std::min(tick / rate_hz, profile.duration());
+    return start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(t));
+}
+
+MotionProfile::Point MotionProfile::Stepper::next() {
+
+    auto lateness_us = static_cast<uint64_t>(std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - due()).count(), 0));
+    auto lateness_max_us = totals.lateness_max_us.load();
+    while (lateness_us > lateness_max_us && !totals.lateness_max_us.compare_exchange_weak(lateness_max_us, lateness_us)) {
+    }
+    totals.points++;
+
+    double t = std::min(tick / rate_hz, profile.duration());
+    tick++;
+    finished = t >= profile.duration();
+    return profile.at(t);
+
+}
+
+bool MotionProfile::run(double rate_hz, Totals &totals, const Step &step) const {
+
+    Stepper stepper{*this, rate_hz, totals};
+    while (!stepper.done()) {
+        std::this_thread::sleep_until(stepper.due());
+        if (!step(stepper.next())) {
+            return false;
+        }
+    }
+    return true;
+
+}
@@ -0,0 +1,123 @@
+#ifndef GIMBAL_MAVSDK_MOTION_PROFILE_H
+#define GIMBAL_MAVSDK_MOTION_PROFILE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include "metrics.h"
+
+// Plans a rest-to-rest move over a distance within velocity, acceleration
+// and, for an S-curve, jerk limits, so that a large angle change is made
+// smoothly instead of at the gimbal's own slew rate.
+//
+// A trapezoid accelerates at the limit, cruises and decelerates. An S-curve
+// also ramps the acceleration at the jerk limit, which removes the jolt at
+// the start and end of each ramp. Short moves never reach the velocity
+// limit, or the acceleration limit, and take the fastest profile that fits.
+class MotionProfile final {
+
+public:
+
+    enum class Shape {
+        Trapezoid,
+        SCurve
+    };
+
+    struct Limits {
+        double max_velocity;     // Units per second
+        double max_acceleration; // Units per second squared
+        double max_jerk;         // Units per second cubed, S-curve only
+    };
+
+    struct Point {
+        double position;         // From 0 to the distance
+        double velocity;
+        double acceleration;
+    };
+
+    // Shared by all moves of a service, exported as profile.* metrics.
+    class Totals final {
+
+    public:
+
+        void register_metrics(MetricsRegistry &registry) const;
+
+    private:
+
+        friend class MotionProfile;
+
+        std::atomic<uint64_t> active_moves{0};
+        std::atomic<uint64_t> moves{0};
+        std::atomic<uint64_t> completed{0};
+        std::atomic<uint64_t> stopped{0};        // Ended early by the caller
+        std::atomic<uint64_t> points{0};
+        std::atomic<uint64_t> duration_last_ms{0};
+        std::atomic<uint64_t> lateness_max_us{0}; // Largest delay of a point past its time
+
+    };
+
+    // Walks through a move at a fixed rate, for callers that keep their own
+    // time. The profile must outlive it; a move destroyed before its last
+    // point counts as stopped.
+    class Stepper final {
+
+    public:
+
+        Stepper(const MotionProfile &profile, double rate_hz, Totals &totals);
+        ~Stepper();
+
+        Stepper(const Stepper &) = delete;
+        Stepper &operator=(const Stepper &) = delete;
+
+        // When the next point is due.
+        std::chrono::steady_clock::time_point due() const;
+
+        // The next point, taken at or after due().
+        Point next();
+
+        // Whether the last point has been taken.
+        bool done() const { return finished; }
+
+    private:
+
+        const MotionProfile &profile;
+        const double rate_hz;
+        Totals &totals;
+        const std::chrono::steady_clock::time_point start;
+        uint64_t tick{1};
+        bool finished{false};
+
+    };
+
+    // Called with each point; returning false stops the move.
+    using Step = std::function<bool(const Point &point)>;
+
+    // Limits must be positive; the jerk limit is ignored for a trapezoid.
+    MotionProfile(Shape shape, const Limits &limits, double distance);
+
+    double distance() const { return length; }
+    double duration() const { return 2 * accel_s + cruise_s; }
+
+    // Clamped to the start and end of the move.
+    Point at(double t) const;
+
+    // Steps through the move at rate_hz on the calling thread, ending with
+    // the final point. Returns false if step stopped it.
+    bool run(double rate_hz, Totals &totals, const Step &step) const;
+
+private:
+
+    Point ramp(double t) const; // Accelerating from rest, t within accel_s
+
+    double length;
+    double peak_velocity{0};
+    double peak_acceleration{0};
+    double jerk{0};         // 0 for a trapezoid
+    double jerk_s{0};       // Each jerk phase
+    double accel_s{0};      // Whole acceleration phase, and deceleration phase
+    double cruise_s{0};
+
+};
+
+#endif // GIMBAL_MAVSDK_MOTION_PROFILE_H
@@ -0,0 +1,68 @@
+#ifndef GIMBAL_MAVSDK_MPSC_QUEUE_H
+#define GIMBAL_MAVSDK_MPSC_QUEUE_H
+
+#include <atomic>
+#include <utility>
+
+// Unbounded queue for many producers and one consumer.
+//
+// A push is one atomic exchange and never waits for other producers or the
+// consumer. The consumer owns the tail and needs no atomic read-modify-write.
+// A pop can miss an element whose push has not finished linking it yet; the
+// producer finishes right after, so a consumer that sleeps must be woken by
+// producers after they push.
+template<typename T>
+class MpscQueue final {
+
+public:
+
+    MpscQueue() : head{new Node}, tail{head.load(std::memory_order_relaxed)} {}
+
+    ~MpscQueue() {
+        while (tail) {
+            auto next = tail->next.load(std::memory_order_relaxed);
+            delete tail;
+            tail = next;
+        }
+    }
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    // Any thread.
+    void push(T value) {
+        auto node = new Node{std::move(value)};
+        auto previous = head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_seq_cst);
+    }
+
+    // Consumer only.
+    bool pop(T &value) {
+        auto next = tail->next.load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+        value = std::move(next->value);
+        delete tail;
+        tail = next;
+        return true;
+    }
+
+    // Consumer only.
+    bool empty() const {
+        return tail->next.load(std::memory_order_seq_cst) == nullptr;
+    }
+
+private:
+
+    struct Node {
+        T value{};
+        std::atomic<Node *> next{nullptr};
+    };
+
+    std::atomic<Node *> head; // Newest node, swapped by producers
+    Node *tail;               // Already consumed; its successor is next
+
+};
+
+#endif // GIMBAL_MAVSDK_MPSC_QUEUE_H
@@ -0,0 +1,207 @@
+#include "passthrough_tunnel.h"
+
+#include <algorithm>
+
+namespace {
+
+void append_frame(std::string &batch, const uint8_t *frame, uint16_t length) {
+    batch.push_back(static_cast<char>(length & 0xff));
+    batch.push_back(static_cast<char>(length >> 8));
+    batch.append(reinterpret_cast<const char *>(frame), length);
+}
+
+}
+
+void PassthroughTunnel::Session::set_filter(std::vector<uint32_t> message_ids) {
+    std::sort(message_ids.begin(), message_ids.end());
+    std::lock_guard<std::mutex> lock(mutex);
+    filter = std::move(message_ids);
+}
+
+bool PassthroughTunnel::Session::next_batch(std::chrono::milliseconds timeout, std::string &frames, uint32_t &dropped_frames) {
+
+    frames.clear();
+    dropped_frames = 0;
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    if (!ready.wait_for(lock, timeout, [this] { return closed || !pending.empty(); })) {
+        return true;
+    }
+    if (closed) {
+        return false;
+    }
+
+    // Let a burst of frames share the message.
+    ready.wait_for(lock, config.batch_window, [this] {
+        return closed || pending.size() >= config.max_batch_bytes;
+    });
+
+    // Cut at a frame boundary, always taking at least one frame.
+    std::size_t cut = 0;
+    while (cut + 2 <= pending.size()) {
+        std::size_t length = static_cast<uint8_t>(pending[cut]) | static_cast<uint8_t>(pending[cut + 1]) << 8;
+        if (cut > 0 && cut + 2 + length > config.max_batch_bytes) {
+            break;
+        }
+        cut += 2 + length;
+    }
+
+    frames.assign(pending, 0, cut);
+    pending.erase(0, cut);
+    dropped_frames = dropped;
+    dropped = 0;
+
+    return true;
+
+}
+
+void PassthroughTunnel::Session::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+    }
+    ready.notify_all();
+}
+
+PassthroughTunnel::Session::Pushed PassthroughTunnel::Session::push(uint32_t message_id, const uint8_t *frame, uint16_t length) {
+
+    bool wake;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (closed || (!filter.empty() && !std::binary_search(filter.begin(), filter.end(), message_id))) {
+            return Pushed::Filtered;
+        }
+        if (pending.size() + 2 + length > config.max_pending_bytes) {
+            dropped++;
+            return Pushed::Dropped;
+        }
+
+        wake = pending.empty();
+        append_frame(pending, frame, length);
+        wake = wake || pending.size() >= config.max_batch_bytes;
+    }
+
+    if (wake) {
+        ready.notify_one();
+    }
+    return Pushed::Queued;
+
+}
+
+PassthroughTunnel::PassthroughTunnel(mavsdk::MavlinkPassthrough &passthrough, LinkMonitor &monitor, Config config)
+        : passthrough{passthrough}, monitor{monitor}, config{config} {
+
+    listener = monitor.add_listener([this](LinkMonitor::Direction direction, const mavlink_message_t &message) {
+        if (direction == LinkMonitor::Direction::Incoming) {
+            forward(message);
+        }
+    });
+
+}
+
+PassthroughTunnel::~PassthroughTunnel() {
+    monitor.remove_listener(listener);
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &session : sessions) {
+        session->close();
+    }
+}
+
+std::shared_ptr<PassthroughTunnel::Session> PassthroughTunnel::open() {
+    auto session = std::make_shared<Session>(config);
+    std::lock_guard<std::mutex> lock(mutex);
+    sessions.push_back(session);
+    return session;
+}
+
+void PassthroughTunnel::close(const std::shared_ptr<Session> &session) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        sessions.erase(std::remove(sessions.begin(), sessions.end(), session), sessions.end());
+    }
+    session->close();
+}
+
+uint32_t PassthroughTunnel::send(const std::string &frames) {
+
+    uint32_t rejected = 0;
+    std::size_t offset = 0;
+
+    while (offset + 2 <= frames.size()) {
+        std::size_t length = static_cast<uint8_t>(frames[offset]) | static_cast<uint8_t>(frames[offset + 1]) << 8;
+        offset += 2;
+        if (offset + length > frames.size()) {
+            // Truncated batch, nothing after this point can be framed.
+            rejected++;
+            break;
+        }
+
+        mavlink_message_t parse_buffer{};
+        mavlink_status_t parse_status{};
+        mavlink_message_t message{};
+        mavlink_status_t message_status{};
+        uint8_t framing = MAVLINK_FRAMING_INCOMPLETE;
+        for (std::size_t i = offset; i < offset + length && framing == MAVLINK_FRAMING_INCOMPLETE; i++) {
+            framing = mavlink_frame_char_buffer(&parse_buffer, &parse_status, static_cast<uint8_t>(frames[i]),
+                                                &message, &message_status);
+        }
+        offset += length;
+
+        // Clients speak as the service; a frame claiming another system or
+        // component, e.g. a ground station, is not passed on.
+        if (framing != MAVLINK_FRAMING_OK || message.sysid != passthrough.get_our_sysid()
+            || message.compid != passthrough.get_our_compid()
+            || passthrough.send_message(message) != mavsdk::MavlinkPassthrough::Result::Success) {
+            rejected++;
+            continue;
+        }
+        frames_sent.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    frames_rejected.fetch_add(rejected, std::memory_order_relaxed);
+    return rejected;
+
+}
+
+void PassthroughTunnel::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        std::size_t open_sessions;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            open_sessions = sessions.size();
+        }
+        samples.push_back({"tunnel.sessions", static_cast<double>(open_sessions)});
+        samples.push_back({"tunnel.frames_forwarded", static_cast<double>(frames_forwarded.load(std::memory_order_relaxed))});
+        samples.push_back({"tunnel.frames_dropped", static_cast<double>(frames_dropped.load(std::memory_order_relaxed))});
+        samples.push_back({"tunnel.frames_sent", static_cast<double>(frames_sent.load(std::memory_order_relaxed))});
+        samples.push_back({"tunnel.frames_rejected", static_cast<double>(frames_rejected.load(std::memory_order_relaxed))});
+    });
+}
+
+void PassthroughTunnel::forward(const mavlink_message_t &message) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (sessions.empty()) {
+        return;
+    }
+
+    uint8_t frame[MAVLINK_MAX_PACKET_LEN];
+    auto length = mavlink_msg_to_send_buffer(frame, &message);
+
+    for (auto &session : sessions) {
+        switch (session->push(message.msgid, frame, length)) {
+            case Session::Pushed::Queued:
+                frames_forwarded.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case Session::Pushed::Dropped:
+                frames_dropped.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case Session::Pushed::Filtered:
+                break;
+        }
+    }
+
+}
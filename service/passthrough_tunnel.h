@@ -0,0 +1,108 @@
+#ifndef GIMBAL_MAVSDK_PASSTHROUGH_TUNNEL_H
+#define GIMBAL_MAVSDK_PASSTHROUGH_TUNNEL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <mavsdk/plugins/mavlink_passthrough/mavlink_passthrough.h>
+#include "link_monitor.h"
+#include "metrics.h"
+
+// Raw MAVLink access for tunnel clients.
+//
+// Frames travel in batches: a byte string holding serialized frames, each
+// preceded by its length as a little-endian uint16. Incoming frames are fanned
+// out to every open session whose filter passes them; a session buffers them
+// until its client collects the next batch.
+class PassthroughTunnel final {
+
+public:
+
+    struct Config {
+        std::chrono::milliseconds batch_window{5}; // How long a batch waits for more frames after the first
+        std::size_t max_batch_bytes = 16 * 1024;
+        std::size_t max_pending_bytes = 64 * 1024; // Per session; frames beyond this are dropped
+    };
+
+    class Session final {
+
+    public:
+
+        explicit Session(const Config &config) : config{config} {}
+
+        // Message ids to pass, all messages if empty.
+        void set_filter(std::vector<uint32_t> message_ids);
+
+        // Waits up to timeout for a frame, then up to the batch window for
+        // more, and moves them into frames. frames is left empty on timeout.
+        // Returns false once the session is closed.
+        bool next_batch(std::chrono::milliseconds timeout, std::string &frames, uint32_t &dropped);
+
+        void close();
+
+        enum class Pushed {
+            Filtered,
+            Queued,
+            Dropped
+        };
+
+        // Queues one serialized frame, as the tunnel does for each incoming
+        // message.
+        Pushed push(uint32_t message_id, const uint8_t *frame, uint16_t length);
+
+    private:
+
+        const Config &config;
+
+        std::mutex mutex;
+        std::condition_variable ready;
+        std::vector<uint32_t> filter; // Sorted
+        std::string pending;
+        uint32_t dropped{0};
+        bool closed{false};
+
+    };
+
+    PassthroughTunnel(mavsdk::MavlinkPassthrough &passthrough, LinkMonitor &monitor, Config config);
+    ~PassthroughTunnel();
+
+    PassthroughTunnel(const PassthroughTunnel &) = delete;
+    PassthroughTunnel &operator=(const PassthroughTunnel &) = delete;
+
+    std::shared_ptr<Session> open();
+    void close(const std::shared_ptr<Session> &session);
+
+    // Sends a batch of frames to the vehicle unchanged. Frames must belong to
+    // a message known to MAVSDK's dialect so their checksum can be verified,
+    // and carry the service's own system and component id. Returns the
+    // number of frames that were rejected.
+    uint32_t send(const std::string &frames);
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+private:
+
+    void forward(const mavlink_message_t &message);
+
+    mavsdk::MavlinkPassthrough &passthrough;
+    LinkMonitor &monitor;
+    const Config config;
+    LinkMonitor::ListenerId listener;
+
+    mutable std::mutex mutex;
+    std::vector<std::shared_ptr<Session>> sessions;
+
+    std::atomic<uint64_t> frames_forwarded{0};
+    std::atomic<uint64_t> frames_dropped{0};
+    std::atomic<uint64_t> frames_sent{0};
+    std::atomic<uint64_t> frames_rejected{0};
+
+};
+
+#endif // GIMBAL_MAVSDK_PASSTHROUGH_TUNNEL_H
@@ -0,0 +1,27 @@
+#include "server_limits.h"
+
+#include <algorithm>
+#include <grpcpp/resource_quota.h>
+
+std::size_t ServerLimits::streams_per_client() const {
+    if (max_streams_per_client > 0) {
+        return max_streams_per_client;
+    }
+    return static_cast<std::size_t>(std::max(max_threads / 4, 1));
+}
+
+void ServerLimits::apply(grpc::ServerBuilder &builder) const {
+
+    grpc::ResourceQuota quota("gimbal_service");
+    quota.Resize(memory_bytes);
+    quota.SetMaxThreads(max_threads);
+    builder.SetResourceQuota(quota);
+
+    builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::NUM_CQS, completion_queues);
+    builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MIN_POLLERS, min_pollers);
+    builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MAX_POLLERS, max_pollers);
+
+    builder.SetMaxReceiveMessageSize(max_message_bytes);
+    builder.SetMaxSendMessageSize(max_message_bytes);
+
+}
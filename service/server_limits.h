@@ -0,0 +1,37 @@
+#ifndef GIMBAL_MAVSDK_SERVER_LIMITS_H
+#define GIMBAL_MAVSDK_SERVER_LIMITS_H
+
+#include <cstddef>
+#include <grpcpp/server_builder.h>
+
+// Resource caps for the gRPC server, sized for small companion boards.
+//
+// The sync server otherwise grows its thread pool and buffers with load, so
+// a burst of clients can exhaust memory. With these limits the server's
+// memory and thread use stay bounded no matter how many clients connect;
+// calls beyond them wait for a free thread instead.
+//
+// A long-lived stream on the sync server holds a handler thread for as long
+// as it is open, so by default one client can only open streams on a quarter
+// of them. MavlinkTunnel, StreamSetpoints and VisualServo each also run a
+// reader thread outside the quota, bounded by the same per-client limit and
+// exported as thread.stream_readers.
+struct ServerLimits {
+
+    std::size_t memory_bytes = 32 * 1024 * 1024; // Buffer memory across all connections
+    int max_threads = 16;                         // Handler threads, long-lived streams included
+    int completion_queues = 1;
+    int min_pollers = 1;
+    int max_pollers = 2;
+    int max_message_bytes = 1024 * 1024;
+    std::size_t max_calls_per_client = 4;         // Concurrent unary calls per client, see ClientLimiter
+    std::size_t max_streams_per_client = 0;       // Open streams per client, counted apart from calls; 0 for max_threads / 4
+    std::size_t max_held_per_client = 32;         // Setpoints waiting for their apply time, per client
+
+    std::size_t streams_per_client() const;
+
+    void apply(grpc::ServerBuilder &builder) const;
+
+};
+
+#endif // GIMBAL_MAVSDK_SERVER_LIMITS_H
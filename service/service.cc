@@ -6,12 +6,46 @@
 #include <memory>
 #include <iostream>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <atomic>
+#include <cmath>
+#include <optional>
 #include <mavsdk/mavsdk.h>
 #include <mavsdk/plugins/telemetry/telemetry.h>
 #include <mavsdk/plugins/gimbal/gimbal.h>
+#include <mavsdk/plugins/mavlink_passthrough/mavlink_passthrough.h>
 #include <future>
 #include <thread>
+#include <variant>
+#include <vector>
 #include "gimbal.grpc.pb.h"
+#include "admission_control.h"
+#include "attitude_batcher.h"
+#include "attitude_estimator.h"
+#include "attitude_history.h"
+#include "client_limiter.h"
+#include "command_pipeline.h"
+#include "command_scheduler.h"
+#include "control_state.h"
+#include "event_loop.h"
+#include "jitter_buffer.h"
+#include "link_budgeter.h"
+#include "link_monitor.h"
+#include "loop_coroutine.h"
+#include "metrics.h"
+#include "motion_profile.h"
+#include "passthrough_tunnel.h"
+#include "server_limits.h"
+#include "shm_channel.h"
+#include "thread_topology.h"
+#include "trace_interceptor.h"
+#include "tracer.h"
+#include "vehicle_clock.h"
+#include "visual_servo_loop.h"
 
 using grpc::Server;
 using grpc::ServerBuilder;
@@ -23,68 +57,1272 @@ using mavsdk::rpc::gimbal::SetModeResponse;
 using std::chrono::seconds;
 using std::this_thread::sleep_for;
 
+Status to_status(const CommandScheduler::Completion &completion, GimbalResult *result) {
+
+    switch (completion.outcome) {
+        case CommandScheduler::Outcome::Superseded:
+            result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_ERROR);
+            result->set_result_str("Superseded by a newer setpoint");
+            return { grpc::ABORTED, "Superseded by a newer setpoint" };
+        case CommandScheduler::Outcome::Rejected:
+            result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_ERROR);
+            result->set_result_str("Too many setpoints held for later");
+            return { grpc::RESOURCE_EXHAUSTED, "Too many setpoints held for later" };
+        case CommandScheduler::Outcome::Shutdown:
+            result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_ERROR);
+            result->set_result_str("Service is shutting down");
+            return { grpc::UNAVAILABLE, "Service is shutting down" };
+        case CommandScheduler::Outcome::Completed:
+            break;
+    }
+
+    if (completion.result != mavsdk::Gimbal::Result::Success) {
+        result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_ERROR);
+        return { grpc::UNKNOWN, "An unknown error occurred" };
+    }
+
+    result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_SUCCESS);
+    return Status::OK;
+
+}
+
+Status too_many_calls() {
+    return { grpc::RESOURCE_EXHAUSTED, "Too many concurrent calls from this client" };
+}
+
+Status too_many_streams() {
+    return { grpc::RESOURCE_EXHAUSTED, "Too many open streams from this client" };
+}
+
+// Held setpoints keep their place in the scheduler until their apply time,
+// so how far ahead they can be is bounded.
+constexpr std::chrono::seconds max_apply_ahead{5};
+
+Status apply_time_too_far() {
+    return { grpc::INVALID_ARGUMENT, "Apply time more than 5 s ahead" };
+}
+
+// Whether the call came in over the unix socket, i.e. from this machine.
+bool local_peer(const grpc::ServerContext &context) {
+    return context.peer().rfind("unix:", 0) == 0;
+}
+
+Status local_only() {
+    return { grpc::PERMISSION_DENIED, "Only served on the unix socket" };
+}
+
+// The hint goes in gRPC's pushback trailer, which a channel with a retry
+// policy honours by itself.
+Status link_saturated(grpc::ServerContext &context, std::chrono::milliseconds retry_after) {
+    auto retry_after_ms = std::to_string(retry_after.count());
+    context.AddTrailingMetadata("grpc-retry-pushback-ms", retry_after_ms);
+    return { grpc::RESOURCE_EXHAUSTED, "Command link saturated, retry after " + retry_after_ms + " ms" };
+}
+
+bool to_servo_gains(const mavsdk::rpc::gimbal::ServoGains &message, VisualServoLoop::Gains &gains) {
+
+    for (auto value : {message.kp(), message.ki(), message.kd(), message.kff(), message.max_rate_deg_s()}) {
+        if (!std::isfinite(value) || value < 0) {
+            return false;
+        }
+    }
+    if (message.max_rate_deg_s() <= 0) {
+        return false;
+    }
+
+    gains = {message.kp(), message.ki(), message.kd(), message.kff(), message.max_rate_deg_s()};
+    return true;
+
+}
+
+void from_servo_gains(const VisualServoLoop::Gains &gains, mavsdk::rpc::gimbal::ServoGains *message) {
+    message->set_kp(gains.kp);
+    message->set_ki(gains.ki);
+    message->set_kd(gains.kd);
+    message->set_kff(gains.kff);
+    message->set_max_rate_deg_s(gains.max_rate_deg_s);
+}
+
+bool to_gimbal_mode(mavsdk::rpc::gimbal::GimbalMode message, mavsdk::Gimbal::GimbalMode &mode) {
+
+    switch (message) {
+        case mavsdk::rpc::gimbal::GIMBAL_MODE_YAW_FOLLOW:
+            mode = mavsdk::Gimbal::GimbalMode::YawFollow;
+            return true;
+        case mavsdk::rpc::gimbal::GIMBAL_MODE_YAW_LOCK:
+            mode = mavsdk::Gimbal::GimbalMode::YawLock;
+            return true;
+        default:
+            return false;
+    }
+
+}
+
+// Primary unless secondary control is asked for.
+mavsdk::Gimbal::ControlMode to_control_mode(mavsdk::rpc::gimbal::ControlMode message) {
+    return message == mavsdk::rpc::gimbal::CONTROL_MODE_SECONDARY ? mavsdk::Gimbal::ControlMode::Secondary
+                                                                   : mavsdk::Gimbal::ControlMode::Primary;
+}
+
+// Checks every part of an ApplyGimbalState request before any is sent.
+Status check_gimbal_state(const mavsdk::rpc::gimbal::ApplyGimbalStateRequest &request, mavsdk::Gimbal::GimbalMode &mode) {
+
+    if (request.has_set_mode() && !to_gimbal_mode(request.set_mode().gimbal_mode(), mode)) {
+        return { grpc::INVALID_ARGUMENT, "Invalid argument" };
+    }
+    if (request.has_pitch_and_yaw() && request.pitch_and_yaw().has_profile()) {
+        return { grpc::INVALID_ARGUMENT, "Motion profiles are only supported by SetPitchAndYaw" };
+    }
+    if (request.has_roi_location()) {
+        const auto &roi = request.roi_location();
+        if (!(std::abs(roi.latitude_deg()) <= 90) || !(std::abs(roi.longitude_deg()) <= 180)
+            || !std::isfinite(roi.altitude_m())) {
+            return { grpc::INVALID_ARGUMENT, "ROI location out of range" };
+        }
+    }
+    return Status::OK;
+
+}
+
+// Each part of an ApplyGimbalState call once it has completed; empty for
+// parts not requested or not sent.
+struct GimbalStateCompletions {
+    std::optional<CommandScheduler::Completion> control;
+    std::optional<CommandScheduler::Completion> mode;
+    std::optional<CommandScheduler::Completion> target;
+};
+
+bool succeeded(const CommandScheduler::Completion &completion) {
+    return completion.outcome == CommandScheduler::Outcome::Completed && completion.result == mavsdk::Gimbal::Result::Success;
+}
+
+// Fills in the result of each part requested, with the first that failed
+// as the overall result. The call itself succeeds, as a failed status would
+// drop the response and the parts that did go through with it.
+Status to_status(const mavsdk::rpc::gimbal::ApplyGimbalStateRequest &request, const GimbalStateCompletions &completions,
+                 mavsdk::rpc::gimbal::ApplyGimbalStateResponse *response) {
+
+    bool failed = false;
+    auto report = [&](const std::optional<CommandScheduler::Completion> &completion, GimbalResult *result) {
+        if (!completion) {
+            result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_UNKNOWN);
+            result->set_result_str("Not sent: taking control failed");
+            return;
+        }
+        if (!to_status(*completion, result).ok() && !failed) {
+            failed = true;
+            response->mutable_gimbal_result()->CopyFrom(*result);
+        }
+    };
+
+    if (request.has_take_control()) {
+        report(completions.control, response->mutable_control_result());
+    }
+    if (request.has_set_mode()) {
+        report(completions.mode, response->mutable_mode_result());
+    }
+    if (request.target_case() != mavsdk::rpc::gimbal::ApplyGimbalStateRequest::TARGET_NOT_SET) {
+        report(completions.target, response->mutable_target_result());
+    }
+    if (!failed) {
+        response->mutable_gimbal_result()->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_SUCCESS);
+    }
+    return Status::OK;
+
+}
+
+// Feeds one message of a VisualServo stream to the loop.
+Status apply_servo_request(VisualServoLoop &loop, const mavsdk::rpc::gimbal::VisualServoRequest &request) {
+
+    if (request.has_gains()) {
+        VisualServoLoop::Gains gains;
+        if (!to_servo_gains(request.gains(), gains)) {
+            return { grpc::INVALID_ARGUMENT, "Gains must be finite and not negative, with a positive max rate" };
+        }
+        loop.set_gains(gains);
+    }
+
+    // A message with gains alone carries no measurement.
+    if (!request.target_lost() && request.horizontal_fov_deg() == 0 && request.vertical_fov_deg() == 0) {
+        return Status::OK;
+    }
+    if (!request.target_lost()
+        && (!std::isfinite(request.error_x()) || !std::isfinite(request.error_y())
+            || !(request.horizontal_fov_deg() > 0 && request.horizontal_fov_deg() < 180)
+            || !(request.vertical_fov_deg() > 0 && request.vertical_fov_deg() < 180))) {
+        return { grpc::INVALID_ARGUMENT, "Errors must be finite and fields of view between 0 and 180 degrees" };
+    }
+
+    auto captured_at = std::chrono::steady_clock::now();
+    if (request.capture_time_ns() > 0) {
+        captured_at = std::chrono::steady_clock::time_point{} + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::nanoseconds(request.capture_time_ns()));
+    }
+    loop.measure({request.error_x(), request.error_y(), request.horizontal_fov_deg(),
+                  request.vertical_fov_deg(), request.target_lost(), captured_at});
+    return Status::OK;
+
+}
+
+void from_servo_status(const VisualServoLoop::Status &loop_status, mavsdk::rpc::gimbal::VisualServoStatus *status) {
+    status->set_pitch_rate_deg_s(loop_status.pitch_rate_deg_s);
+    status->set_yaw_rate_deg_s(loop_status.yaw_rate_deg_s);
+    status->set_pitch_error_deg(loop_status.pitch_error_deg);
+    status->set_yaw_error_deg(loop_status.yaw_error_deg);
+    status->set_tracking(loop_status.tracking);
+    status->set_ticks(loop_status.ticks);
+    status->set_overruns(loop_status.overruns);
+    status->set_lateness_avg_us(loop_status.lateness_avg_us);
+    status->set_lateness_max_us(loop_status.lateness_max_us);
+    from_servo_gains(loop_status.gains, status->mutable_gains());
+}
+
+// Position of a method in the service, as gRPC numbers them.
+int method_index(const char *name) {
+    return mavsdk::rpc::gimbal::SetPitchAndYawRequest::descriptor()->file()
+            ->FindServiceByName("GimbalService")->FindMethodByName(name)->index();
+}
+
+bool to_motion_profile(const mavsdk::rpc::gimbal::MotionProfile &message, MotionProfile::Shape &shape,
+                       MotionProfile::Limits &limits, double &rate_hz) {
+
+    shape = message.shape() == mavsdk::rpc::gimbal::PROFILE_SHAPE_S_CURVE
+            ? MotionProfile::Shape::SCurve : MotionProfile::Shape::Trapezoid;
+    limits = {message.max_velocity_deg_s(), message.max_acceleration_deg_s2(), message.max_jerk_deg_s3()};
+    rate_hz = message.rate_hz() == 0 ? 50 : message.rate_hz();
+
+    auto positive = [](double value) { return std::isfinite(value) && value > 0; };
+    return positive(limits.max_velocity) && positive(limits.max_acceleration)
+           && (shape == MotionProfile::Shape::Trapezoid || positive(limits.max_jerk))
+           && rate_hz >= 1 && rate_hz <= 100;
+
+}
+
 class GremsyMAVSDK final : public Service {
 
 private:
     mavsdk::Gimbal gimbal;
     mavsdk::Telemetry telemetry;
+    mavsdk::MavlinkPassthrough passthrough;
+    MetricsRegistry metrics;
+    LinkMonitor link_monitor;
+    VehicleClock vehicle_clock;
+    CommandPipeline pipeline;
+    AttitudeEstimator estimator;
+    AttitudeHistory history;
+    CommandScheduler scheduler;
+    LinkBudgeter budgeter;
+    PassthroughTunnel tunnel;
+    ClientLimiter limiter;
+    AdmissionControl admission;
+    ControlState control;
+    JitterBuffer::Totals jitter_totals;
+    VisualServoLoop::Totals servo_totals;
+    MotionProfile::Totals profile_totals;
+    std::atomic<uint64_t> setpoint_generation{0}; // Bumped by every setpoint that interrupts a profiled move
+    std::atomic<int64_t> stream_readers{0}; // Reader threads of sync streams, outside the gRPC thread quota
+
+    // What the mount takes DO_MOUNT_CONTROL values as, after the last
+    // DO_MOUNT_CONFIGURE. Unknown while one is in flight or after SetMode.
+    enum class MountInput {
+        Unknown,
+        Angle,
+        Rate
+    };
+    std::atomic<MountInput> mount_input{MountInput::Angle}; // The mount's default
+    std::atomic<bool> yaw_lock{false};
+    ShmChannel shm;
+    EventLoop *loop{nullptr};
+    std::vector<std::function<void()>> listeners; // Request the first call of each method on the loop
+
+    // Bidirectional sync streams read on a thread of their own. It is not one
+    // of the server's, so it is counted here; the per-client stream limit is
+    // what bounds it.
+    template<typename Read>
+    std::thread start_reader(Read read) {
+        stream_readers++;
+        return std::thread([this, read = std::move(read)]() mutable {
+            read();
+            stream_readers--;
+        });
+    }
+
+    static std::function<bool(double)> stream_rate_setter(
+            void (mavsdk::Telemetry::*set_rate_async)(double, const mavsdk::Telemetry::ResultCallback),
+            mavsdk::Telemetry &telemetry, const std::string &name) {
+        return [&telemetry, set_rate_async, name](double rate_hz) {
+            (telemetry.*set_rate_async)(rate_hz, [name, rate_hz](mavsdk::Telemetry::Result result) {
+                if (result != mavsdk::Telemetry::Result::Success) {
+                    std::cerr << "Setting " << name << " rate to " << rate_hz << " Hz failed\n";
+                }
+            });
+            return true;
+        };
+    }
+
+    // Sends DO_MOUNT_CONTROL, first reconfiguring the mount with
+    // DO_MOUNT_CONFIGURE if it was last set up for the other kind of input.
+    // The control waits for that ack, so only a switch costs a round trip and
+    // setpoints still reach the mount in order.
+    void mount_control(MountInput input, const std::array<float, 7> &params, CommandScheduler::Done done) {
+
+        if (mount_input == input) {
+            pipeline.send(MAV_CMD_DO_MOUNT_CONTROL, params, std::move(done));
+            return;
+        }
+
+        // Roll, pitch and yaw input modes: 0 angle, 1 rate, 2 angle locked to north.
+        bool lock = yaw_lock;
+        float angle_yaw_input = lock ? 2.0f : 0.0f;
+        std::array<float, 7> configure{ static_cast<float>(MAV_MOUNT_MODE_MAVLINK_TARGETING), 0, 0, lock ? 1.0f : 0.0f, 0,
+                                        input == MountInput::Rate ? 1.0f : 0.0f,
+                                        input == MountInput::Rate ? 1.0f : angle_yaw_input };
+        mount_input = MountInput::Unknown;
+        pipeline.send(MAV_CMD_DO_MOUNT_CONFIGURE, configure,
+                      [this, input, params, done = std::move(done)](mavsdk::Gimbal::Result result) mutable {
+                          if (result != mavsdk::Gimbal::Result::Success) {
+                              done(result);
+                              return;
+                          }
+                          mount_input = input;
+                          pipeline.send(MAV_CMD_DO_MOUNT_CONTROL, params, std::move(done));
+                      });
+
+    }
+
+    // Sent as the same DO_MOUNT_CONTROL that Gimbal::set_pitch_and_yaw() uses,
+    // but pipelined instead of waiting for each ack in turn.
+    CommandScheduler::AsyncCommand pitch_and_yaw_command(float pitch_deg, float yaw_deg) {
+        std::array<float, 7> params{ pitch_deg, 0, yaw_deg, 0, 0, 0,
+                                     static_cast<float>(MAV_MOUNT_MODE_MAVLINK_TARGETING) };
+        return [this, params](CommandScheduler::Done done) {
+            estimator.command_angles(params[0], params[2]);
+            mount_control(MountInput::Angle, params, std::move(done));
+        };
+    }
+
+    // The cached control state is not trusted while these are in flight.
+    CommandScheduler::AsyncCommand take_control_command(mavsdk::Gimbal::ControlMode mode) {
+        return [this, mode](CommandScheduler::Done done) {
+            control.begin_change();
+            gimbal.take_control_async(mode, [this, done](mavsdk::Gimbal::Result result) {
+                control.end_change();
+                done(result);
+            });
+        };
+    }
+
+    CommandScheduler::AsyncCommand release_control_command() {
+        return [this](CommandScheduler::Done done) {
+            control.begin_change();
+            gimbal.release_control_async([this, done](mavsdk::Gimbal::Result result) {
+                control.end_change();
+                done(result);
+            });
+        };
+    }
+
+    // The next setpoint reconfigures the mount for the new mode's yaw lock.
+    CommandScheduler::AsyncCommand set_mode_command(mavsdk::Gimbal::GimbalMode mode) {
+        return [this, mode](CommandScheduler::Done done) {
+            gimbal.set_mode_async(mode, [this, mode, done](mavsdk::Gimbal::Result result) {
+                if (result == mavsdk::Gimbal::Result::Success) {
+                    yaw_lock = mode == mavsdk::Gimbal::GimbalMode::YawLock;
+                    mount_input = MountInput::Unknown;
+                }
+                done(result);
+            });
+        };
+    }
+
+    CommandScheduler::AsyncCommand roi_command(const mavsdk::rpc::gimbal::SetRoiLocationRequest &roi) {
+        return [this, latitude_deg = roi.latitude_deg(), longitude_deg = roi.longitude_deg(),
+                altitude_m = roi.altitude_m()](CommandScheduler::Done done) {
+            estimator.command_none();
+            gimbal.set_roi_location_async(latitude_deg, longitude_deg, altitude_m, std::move(done));
+        };
+    }
+
+    // Gimbal::set_pitch_rate_and_yaw_rate() is not supported with gimbal
+    // protocol v1, so rates go out as DO_MOUNT_CONTROL in rate input mode.
+    CommandScheduler::AsyncCommand rates_command(float pitch_rate_deg_s, float yaw_rate_deg_s) {
+        std::array<float, 7> params{ pitch_rate_deg_s, 0, yaw_rate_deg_s, 0, 0, 0,
+                                     static_cast<float>(MAV_MOUNT_MODE_MAVLINK_TARGETING) };
+        return [this, params](CommandScheduler::Done done) {
+            estimator.command_rates(params[0], params[2]);
+            mount_control(MountInput::Rate, params, std::move(done));
+        };
+    }
+
+    std::future<CommandScheduler::Completion> submit_pitch_and_yaw(float pitch_deg, float yaw_deg,
+                                                                   std::chrono::steady_clock::time_point apply_at = {}) {
+        setpoint_generation++;
+        return scheduler.submit_async(CommandScheduler::Priority::Setpoint, pitch_and_yaw_command(pitch_deg, yaw_deg), apply_at);
+    }
+
+    std::future<CommandScheduler::Completion> submit_pitch_rate_and_yaw_rate(float pitch_rate_deg_s, float yaw_rate_deg_s,
+                                                                             std::chrono::steady_clock::time_point apply_at = {}) {
+        setpoint_generation++;
+        return scheduler.submit_async(CommandScheduler::Priority::Setpoint, rates_command(pitch_rate_deg_s, yaw_rate_deg_s),
+                                      apply_at);
+    }
+
+    void submit_pitch_and_yaw(float pitch_deg, float yaw_deg, CommandScheduler::Callback done,
+                              std::chrono::steady_clock::time_point apply_at = {}) {
+        setpoint_generation++;
+        scheduler.submit_async(CommandScheduler::Priority::Setpoint, pitch_and_yaw_command(pitch_deg, yaw_deg), std::move(done),
+                               apply_at);
+    }
+
+    void submit_pitch_rate_and_yaw_rate(float pitch_rate_deg_s, float yaw_rate_deg_s, CommandScheduler::Callback done,
+                                        std::chrono::steady_clock::time_point apply_at = {}) {
+        setpoint_generation++;
+        scheduler.submit_async(CommandScheduler::Priority::Setpoint, rates_command(pitch_rate_deg_s, yaw_rate_deg_s),
+                               std::move(done), apply_at);
+    }
+
+    // The mode and the target of an ApplyGimbalState call, back to back.
+    // Each done is called if its part was requested.
+    void submit_mode_and_target(const mavsdk::rpc::gimbal::ApplyGimbalStateRequest &request, mavsdk::Gimbal::GimbalMode mode,
+                                CommandScheduler::Callback mode_done, CommandScheduler::Callback target_done) {
+
+        if (request.has_set_mode()) {
+            scheduler.submit_async(CommandScheduler::Priority::Control, set_mode_command(mode), std::move(mode_done));
+        }
+        if (request.has_pitch_and_yaw()) {
+            submit_pitch_and_yaw(request.pitch_and_yaw().pitch_deg(), request.pitch_and_yaw().yaw_deg(), std::move(target_done));
+        } else if (request.has_roi_location()) {
+            setpoint_generation++;
+            scheduler.submit_async(CommandScheduler::Priority::Setpoint, roi_command(request.roi_location()),
+                                   std::move(target_done));
+        }
+
+    }
+
+    // A profiled move, planned from where the gimbal was last sent.
+    struct Move {
+        float pitch_deg;
+        float yaw_deg;
+        float start_pitch;
+        float start_yaw;
+        double pitch_change;
+        double yaw_change;       // The short way round
+        double rate_hz;
+        uint64_t generation;     // Any other setpoint changes setpoint_generation
+        MotionProfile profile{ MotionProfile::Shape::Trapezoid, { 1, 1, 1 }, 0 };
+    };
+
+    Status plan_move(float pitch_deg, float yaw_deg, const mavsdk::rpc::gimbal::MotionProfile &profile, Move &move) {
+
+        MotionProfile::Shape shape;
+        MotionProfile::Limits limits;
+        if (!std::isfinite(pitch_deg) || !std::isfinite(yaw_deg) || !to_motion_profile(profile, shape, limits, move.rate_hz)) {
+            return { grpc::INVALID_ARGUMENT, "Angles must be finite and profile limits positive, with a rate of 1 to 100 Hz" };
+        }
+
+        if (!estimator.commanded_angles(move.start_pitch, move.start_yaw)) {
+            mavsdk::Telemetry::EulerAngle angle;
+            if (!estimator.predict(std::chrono::steady_clock::now(), angle)) {
+                return { grpc::FAILED_PRECONDITION, "No gimbal attitude to start the move from yet" };
+            }
+            move.start_pitch = angle.pitch_deg;
+            move.start_yaw = angle.yaw_deg;
+        }
+        move.pitch_deg = pitch_deg;
+        move.yaw_deg = yaw_deg;
+        move.pitch_change = pitch_deg - move.start_pitch;
+        move.yaw_change = std::remainder(yaw_deg - move.start_yaw, 360.0);
+        move.profile = MotionProfile{ shape, limits, std::hypot(move.pitch_change, move.yaw_change) };
+        move.generation = ++setpoint_generation;
+        return Status::OK;
+
+    }
+
+    // The setpoint for a point of the move. It does not count as
+    // interrupting the move.
+    CommandScheduler::AsyncCommand move_command(const Move &move, const MotionProfile::Point &point) {
+        if (point.position >= move.profile.distance()) {
+            return pitch_and_yaw_command(move.pitch_deg, move.yaw_deg);
+        }
+        double share = point.position / move.profile.distance();
+        return pitch_and_yaw_command(static_cast<float>(move.start_pitch + move.pitch_change * share),
+                                     static_cast<float>(std::remainder(move.start_yaw + move.yaw_change * share, 360.0)));
+    }
+
+    // Steps through the move on the calling thread.
+    Status move_pitch_and_yaw(::grpc::ServerContext *context, float pitch_deg, float yaw_deg,
+                              const mavsdk::rpc::gimbal::MotionProfile &profile, GimbalResult *result) {
+
+        Move move;
+        auto planned = plan_move(pitch_deg, yaw_deg, profile, move);
+        if (!planned.ok()) {
+            return planned;
+        }
+
+        std::future<CommandScheduler::Completion> last;
+        bool finished = move.profile.run(move.rate_hz, profile_totals, [&](const MotionProfile::Point &point) {
+            if (context->IsCancelled() || setpoint_generation != move.generation) {
+                return false;
+            }
+            last = scheduler.submit_async(CommandScheduler::Priority::Setpoint, move_command(move, point));
+            return true;
+        });
+
+        if (!finished) {
+            if (context->IsCancelled()) {
+                return { grpc::CANCELLED, "Move cancelled" };
+            }
+            return to_status({ CommandScheduler::Outcome::Superseded, mavsdk::Gimbal::Result::Unknown }, result);
+        }
+        return to_status(last.get(), result);
+
+    }
+
+    // Hands calls of a unary method to handler on the event loop instead of
+    // to the sync method.
+    template<typename Request, typename Response>
+    void serve_on_loop(const char *method, std::function<void(EventLoop::UnaryCall<Request, Response> *call)> handler) {
+        int index = method_index(method);
+        MarkMethodAsync(index);
+        listeners.push_back([this, index, handler] {
+            EventLoop::UnaryCall<Request, Response>::listen(*loop,
+                    [this, index](::grpc::ServerContext *context, Request *request,
+                                  ::grpc::ServerAsyncResponseWriter<Response> *responder, void *tag) {
+                        RequestAsyncUnary(index, context, request, responder, loop->queue(), loop->queue(), tag);
+                    }, handler);
+        });
+    }
+
+    // For sync methods that never wait, which can run on the loop as they are.
+    template<typename Request, typename Response>
+    void serve_on_loop(const char *method, Status (GremsyMAVSDK::*sync)(::grpc::ServerContext *, const Request *, Response *)) {
+        serve_on_loop<Request, Response>(method, [this, sync](EventLoop::UnaryCall<Request, Response> *call) {
+            call->finish((this->*sync)(&call->context, &call->request, &call->response));
+        });
+    }
+
+    // For handlers written as coroutines.
+    template<typename Request, typename Response>
+    void serve_on_loop(const char *method, LoopTask (GremsyMAVSDK::*handler)(EventLoop::UnaryCall<Request, Response> *call)) {
+        serve_on_loop<Request, Response>(method, [this, handler](EventLoop::UnaryCall<Request, Response> *call) {
+            (this->*handler)(call);
+        });
+    }
+
+    template<typename Request, typename Response>
+    void request_stream(int index, LoopStreamCall<Request, ::grpc::ServerAsyncWriter<Response>> *call, void *tag) {
+        RequestAsyncServerStreaming(index, &call->context, &call->request, &call->stream, loop->queue(), loop->queue(), tag);
+    }
+
+    template<typename Response, typename Request>
+    void request_stream(int index, LoopStreamCall<std::monostate, ::grpc::ServerAsyncReaderWriter<Response, Request>> *call,
+                        void *tag) {
+        RequestAsyncBidiStreaming(index, &call->context, &call->stream, loop->queue(), loop->queue(), tag);
+    }
+
+    // Hands calls of a streaming method to a coroutine on the event loop.
+    template<typename Request, typename Stream>
+    void serve_stream_on_loop(const char *method, LoopTask (GremsyMAVSDK::*handler)(LoopStreamCall<Request, Stream> *call)) {
+        int index = method_index(method);
+        MarkMethodAsync(index);
+        listeners.push_back([this, index, handler] {
+            LoopStreamCall<Request, Stream>::listen(*loop,
+                    [this, index](LoopStreamCall<Request, Stream> *call, void *tag) {
+                        request_stream(index, call, tag);
+                    },
+                    [this, handler](LoopStreamCall<Request, Stream> *call) {
+                        return (this->*handler)(call);
+                    });
+        });
+    }
+
+    // co_await gives the command's completion, on the loop. The command is
+    // submitted under traced.
+    PostedAwaiter<CommandScheduler::Completion> completed(CommandScheduler::Priority priority, CommandScheduler::Command command,
+                                                          Tracer::Context traced) {
+        return on_loop<CommandScheduler::Completion>(*loop, [this, priority, command, traced](auto done) {
+            Tracer::Scope submitting{ "handler", traced };
+            scheduler.submit(priority, command, std::move(done));
+        });
+    }
+
+    PostedAwaiter<CommandScheduler::Completion> completed(CommandScheduler::Priority priority,
+                                                          CommandScheduler::AsyncCommand command, Tracer::Context traced) {
+        return on_loop<CommandScheduler::Completion>(*loop, [this, priority, command, traced](auto done) {
+            Tracer::Scope submitting{ "handler", traced };
+            scheduler.submit_async(priority, command, std::move(done));
+        });
+    }
+
+    using SetPitchAndYawCall = EventLoop::UnaryCall<mavsdk::rpc::gimbal::SetPitchAndYawRequest,
+                                                    mavsdk::rpc::gimbal::SetPitchAndYawResponse>;
+    using SetPitchRateAndYawRateCall = EventLoop::UnaryCall<mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest,
+                                                            mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse>;
+    using SetModeCall = EventLoop::UnaryCall<mavsdk::rpc::gimbal::SetModeRequest, mavsdk::rpc::gimbal::SetModeResponse>;
+    using TakeControlCall = EventLoop::UnaryCall<mavsdk::rpc::gimbal::TakeControlRequest,
+                                                 mavsdk::rpc::gimbal::TakeControlResponse>;
+    using ReleaseControlCall = EventLoop::UnaryCall<mavsdk::rpc::gimbal::ReleaseControlRequest,
+                                                    mavsdk::rpc::gimbal::ReleaseControlResponse>;
+    using ApplyGimbalStateCall = EventLoop::UnaryCall<mavsdk::rpc::gimbal::ApplyGimbalStateRequest,
+                                                      mavsdk::rpc::gimbal::ApplyGimbalStateResponse>;
+    using AttitudeBatchCall = LoopStreamCall<mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest,
+                                             ::grpc::ServerAsyncWriter<mavsdk::rpc::gimbal::AttitudeBatch>>;
+    using SetpointStreamCall = LoopStreamCall<std::monostate,
+                                              ::grpc::ServerAsyncReaderWriter<mavsdk::rpc::gimbal::SetpointAck,
+                                                                              mavsdk::rpc::gimbal::Setpoint>>;
+    using VisualServoCall = LoopStreamCall<std::monostate,
+                                           ::grpc::ServerAsyncReaderWriter<mavsdk::rpc::gimbal::VisualServoStatus,
+                                                                           mavsdk::rpc::gimbal::VisualServoRequest>>;
+
+    // The loop's versions of the handlers below; each does what its sync
+    // counterpart does, waiting with co_await instead of blocking.
+
+    LoopTask set_pitch_and_yaw_on_loop(SetPitchAndYawCall *call) {
+
+        auto slot = limiter.acquire(call->context);
+        if (!slot) {
+            call->finish(too_many_calls());
+            co_return;
+        }
+        auto retry_after = admission.admit(CommandScheduler::Priority::Setpoint);
+        if (retry_after.count() > 0) {
+            call->finish(link_saturated(call->context, retry_after));
+            co_return;
+        }
+        auto result = call->response.mutable_gimbal_result();
+        auto traced = trace_of(call->context);
+
+        if (!call->request.has_profile()) {
+            setpoint_generation++;
+            auto completion = co_await completed(CommandScheduler::Priority::Setpoint,
+                                                  pitch_and_yaw_command(call->request.pitch_deg(), call->request.yaw_deg()),
+                                                  traced);
+            call->finish(to_status(completion, result));
+            co_return;
+        }
+
+        Move move;
+        auto planned = plan_move(call->request.pitch_deg(), call->request.yaw_deg(), call->request.profile(), move);
+        if (!planned.ok()) {
+            call->finish(planned);
+            co_return;
+        }
+
+        MotionProfile::Stepper stepper{ move.profile, move.rate_hz, profile_totals };
+        LoopTimer timer{ *loop };
+        while (true) {
+            bool due = co_await timer.until(stepper.due());
+            if (!due || call->cancelled()) {
+                call->finish({ grpc::CANCELLED, "Move cancelled" });
+                co_return;
+            }
+            if (setpoint_generation != move.generation) {
+                call->finish(to_status({ CommandScheduler::Outcome::Superseded, mavsdk::Gimbal::Result::Unknown }, result));
+                co_return;
+            }
+            auto command = move_command(move, stepper.next());
+            if (stepper.done()) {
+                auto completion = co_await completed(CommandScheduler::Priority::Setpoint, std::move(command), traced);
+                call->finish(to_status(completion, result));
+                co_return;
+            }
+            Tracer::Scope submitting{ "handler", traced };
+            scheduler.submit_async(CommandScheduler::Priority::Setpoint, std::move(command));
+        }
+
+    }
+
+    LoopTask set_pitch_rate_and_yaw_rate_on_loop(SetPitchRateAndYawRateCall *call) {
+
+        auto slot = limiter.acquire(call->context);
+        if (!slot) {
+            call->finish(too_many_calls());
+            co_return;
+        }
+        auto retry_after = admission.admit(CommandScheduler::Priority::Setpoint);
+        if (retry_after.count() > 0) {
+            call->finish(link_saturated(call->context, retry_after));
+            co_return;
+        }
+
+        setpoint_generation++;
+        auto completion = co_await completed(CommandScheduler::Priority::Setpoint,
+                                              rates_command(call->request.pitch_rate_deg_s(), call->request.yaw_rate_deg_s()),
+                                              trace_of(call->context));
+        call->finish(to_status(completion, call->response.mutable_gimbal_result()));
+
+    }
+
+    // Control commands go out through the plugin's async calls, so neither
+    // the loop nor the command sender waits for the gimbal's ack.
+    LoopTask set_mode_on_loop(SetModeCall *call) {
+
+        auto slot = limiter.acquire(call->context);
+        if (!slot) {
+            call->finish(too_many_calls());
+            co_return;
+        }
+
+        mavsdk::Gimbal::GimbalMode mode;
+        if (!to_gimbal_mode(call->request.gimbal_mode(), mode)) {
+            call->finish({ grpc::INVALID_ARGUMENT, "Invalid argument" });
+            co_return;
+        }
+
+        auto completion = co_await completed(CommandScheduler::Priority::Control, set_mode_command(mode), trace_of(call->context));
+        call->finish(to_status(completion, call->response.mutable_gimbal_result()));
+
+    }
+
+    LoopTask take_control_on_loop(TakeControlCall *call) {
+
+        auto slot = limiter.acquire(call->context);
+        if (!slot) {
+            call->finish(too_many_calls());
+            co_return;
+        }
+
+        std::cout << "take control" << std::endl;
+        auto result = call->response.mutable_gimbal_result();
+        auto control_mode = to_control_mode(call->request.control_mode());
+        if (control.holds(control_mode, call->request.force())) {
+            call->finish(to_status({ CommandScheduler::Outcome::Completed, mavsdk::Gimbal::Result::Success }, result));
+            co_return;
+        }
+        auto completion = co_await completed(CommandScheduler::Priority::Control,
+                                             take_control_command(control_mode), trace_of(call->context));
+        call->finish(to_status(completion, result));
+
+    }
+
+    LoopTask release_control_on_loop(ReleaseControlCall *call) {
+
+        auto slot = limiter.acquire(call->context);
+        if (!slot) {
+            call->finish(too_many_calls());
+            co_return;
+        }
+
+        auto result = call->response.mutable_gimbal_result();
+        if (control.holds(mavsdk::Gimbal::ControlMode::None, call->request.force())) {
+            call->finish(to_status({ CommandScheduler::Outcome::Completed, mavsdk::Gimbal::Result::Success }, result));
+            co_return;
+        }
+        auto completion = co_await completed(CommandScheduler::Priority::Control, release_control_command(),
+                                             trace_of(call->context));
+        call->finish(to_status(completion, result));
+
+    }
+
+    // The mode and the target are in flight together once control is held.
+    LoopTask apply_gimbal_state_on_loop(ApplyGimbalStateCall *call) {
+
+        auto slot = limiter.acquire(call->context);
+        if (!slot) {
+            call->finish(too_many_calls());
+            co_return;
+        }
+
+        const auto &request = call->request;
+        mavsdk::Gimbal::GimbalMode mode{};
+        auto valid = check_gimbal_state(request, mode);
+        if (!valid.ok()) {
+            call->finish(valid);
+            co_return;
+        }
+
+        auto traced = trace_of(call->context);
+        GimbalStateCompletions completions;
+        if (request.has_take_control()) {
+            auto control_mode = to_control_mode(request.take_control().control_mode());
+            if (control.holds(control_mode, request.take_control().force())) {
+                completions.control = { CommandScheduler::Outcome::Completed, mavsdk::Gimbal::Result::Success };
+            } else {
+                completions.control = co_await completed(CommandScheduler::Priority::Control, take_control_command(control_mode),
+                                                         traced);
+            }
+            if (!succeeded(*completions.control)) {
+                call->finish(to_status(request, completions, &call->response));
+                co_return;
+            }
+        }
+
+        PendingResult<CommandScheduler::Completion> mode_done{ *loop };
+        PendingResult<CommandScheduler::Completion> target_done{ *loop };
+        {
+            Tracer::Scope submitting{ "handler", traced };
+            submit_mode_and_target(request, mode, mode_done.callback(), target_done.callback());
+        }
+        if (request.has_set_mode()) {
+            completions.mode = co_await mode_done;
+        }
+        if (request.target_case() != mavsdk::rpc::gimbal::ApplyGimbalStateRequest::TARGET_NOT_SET) {
+            completions.target = co_await target_done;
+        }
+        call->finish(to_status(request, completions, &call->response));
+
+    }
+
+    LoopTask subscribe_attitude_batch_on_loop(AttitudeBatchCall *call) {
+
+        auto slot = limiter.acquire(call->context, ClientLimiter::Kind::Stream);
+        if (!slot) {
+            call->finish(too_many_streams());
+            co_return;
+        }
+
+        const auto &request = call->request;
+        auto window = std::chrono::milliseconds(request.batch_window_ms() > 0 ? request.batch_window_ms() : 100);
+        window = std::clamp(window, std::chrono::milliseconds(10), std::chrono::milliseconds(5000));
+
+        mavsdk::rpc::gimbal::AttitudeBatch batch;
+        LoopTimer timer{ *loop };
+
+        if (request.prediction_rate_hz() > 0) {
+            auto rate_hz = std::min<uint32_t>(request.prediction_rate_hz(), 1000);
+            auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(1.0 / rate_hz));
+            std::vector<mavsdk::Telemetry::EulerAngle> predicted;
+            mavsdk::Telemetry::EulerAngle angle;
+
+            auto next = std::chrono::steady_clock::now();
+            auto send_at = next + window;
+            while (!call->cancelled()) {
+                co_await timer.until(next);
+                if (estimator.predict(next, angle)) {
+                    predicted.push_back(angle);
+                }
+                next += period;
+                if (next < send_at) {
+                    continue;
+                }
+                send_at += window;
+                if (predicted.empty()) {
+                    continue;
+                }
+                AttitudeBatcher::encode(predicted, batch);
+                predicted.clear();
+                if (!co_await call->write(batch)) {
+                    break;
+                }
+                next = std::max(next, std::chrono::steady_clock::now());
+            }
+            call->finish(Status::OK);
+            co_return;
+        }
+
+        AttitudeBatcher batcher{ telemetry, vehicle_clock };
+
+        auto next = std::chrono::steady_clock::now() + window;
+        while (!call->cancelled()) {
+            co_await timer.until(next);
+            next += window;
+            if (batcher.take(batch) == 0) {
+                continue;
+            }
+            if (!co_await call->write(batch)) {
+                break;
+            }
+        }
+        call->finish(Status::OK);
+
+    }
+
+    // Shared by the coroutines reading and acking a setpoint stream.
+    struct SetpointStream {
+        struct Ack {
+            uint64_t sequence;
+            std::optional<CommandScheduler::Completion> completion; // Empty until the setpoint has completed
+            ClientLimiter::Slot held;                               // Taken by setpoints with an apply time
+        };
+
+        std::deque<std::shared_ptr<Ack>> pending; // Acked in order
+        std::vector<std::shared_ptr<Ack>> held;   // Setpoints with an apply time, acked when they are released
+        std::unique_ptr<JitterBuffer> jitter_buffer;
+        LoopEvent changed;
+        bool reading{true};
+        Status result;
+    };
+
+    LoopTask read_setpoints(SetpointStreamCall *call, std::shared_ptr<SetpointStream> stream) {
+
+        mavsdk::rpc::gimbal::Setpoint setpoint;
+        while (co_await call->read(setpoint)) {
+            auto ack = std::make_shared<SetpointStream::Ack>(SetpointStream::Ack{ setpoint.sequence(), std::nullopt, {} });
+
+            if (setpoint.jitter_buffered() && setpoint.apply_time_ns() == 0) {
+                buffer_setpoint(stream->jitter_buffer, setpoint);
+                ack->completion = { CommandScheduler::Outcome::Completed, mavsdk::Gimbal::Result::Success };
+                stream->pending.push_back(ack);
+                stream->changed.set();
+                continue;
+            }
+
+            std::chrono::steady_clock::time_point apply_at{};
+            if (setpoint.apply_time_ns() > 0) {
+                apply_at += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                        std::chrono::nanoseconds(setpoint.apply_time_ns()));
+                if (apply_at - std::chrono::steady_clock::now() > max_apply_ahead) {
+                    stream->result = apply_time_too_far();
+                    break;
+                }
+                ack->held = limiter.acquire(call->context, ClientLimiter::Kind::Held);
+                if (!ack->held) {
+                    ack->completion = { CommandScheduler::Outcome::Rejected, mavsdk::Gimbal::Result::Success };
+                    stream->pending.push_back(ack);
+                    stream->changed.set();
+                    continue;
+                }
+            }
+            auto done = [this, stream, ack](const CommandScheduler::Completion &completion) {
+                loop->post([stream, ack, completion] {
+                    ack->completion = completion;
+                    stream->changed.set();
+                });
+            };
+            Tracer::Scope submitting{ "handler", trace_of(call->context) };
+            if (setpoint.mode() == mavsdk::rpc::gimbal::SETPOINT_MODE_RATE) {
+                submit_pitch_rate_and_yaw_rate(setpoint.pitch_rate_deg_s(), setpoint.yaw_rate_deg_s(), done, apply_at);
+            } else {
+                submit_pitch_and_yaw(setpoint.pitch_deg(), setpoint.yaw_deg(), done, apply_at);
+            }
+            if (ack->held) {
+                stream->held.push_back(ack);
+            } else {
+                stream->pending.push_back(ack);
+            }
+        }
+
+        stream->reading = false;
+        stream->changed.set();
+
+    }
+
+    LoopTask stream_setpoints_on_loop(SetpointStreamCall *call) {
+
+        auto slot = limiter.acquire(call->context, ClientLimiter::Kind::Stream);
+        if (!slot) {
+            call->finish(too_many_streams());
+            co_return;
+        }
+
+        auto stream = std::make_shared<SetpointStream>();
+        read_setpoints(call, stream);
+
+        mavsdk::rpc::gimbal::SetpointAck ack;
+        std::vector<std::shared_ptr<SetpointStream::Ack>> released;
+        bool writable = true;
+        while (writable && !call->cancelled()) {
+            while (!stream->pending.empty() && stream->pending.front()->completion) {
+                released.push_back(std::move(stream->pending.front()));
+                stream->pending.pop_front();
+            }
+            auto still_held = std::partition(stream->held.begin(), stream->held.end(), [](const auto &entry) {
+                return !entry->completion;
+            });
+            std::move(still_held, stream->held.end(), std::back_inserter(released));
+            stream->held.erase(still_held, stream->held.end());
+
+            for (const auto &entry : released) {
+                if (entry->completion->outcome == CommandScheduler::Outcome::Superseded) {
+                    continue;
+                }
+                ack.Clear();
+                ack.set_sequence(entry->sequence);
+                to_status(*entry->completion, ack.mutable_gimbal_result());
+                if (!co_await call->write(ack)) {
+                    writable = false;
+                    break;
+                }
+            }
+            released.clear();
+
+            if (!stream->reading && stream->pending.empty() && stream->held.empty()) {
+                break;
+            }
+            if (writable) {
+                co_await stream->changed;
+            }
+        }
+
+        if (stream->reading) {
+            call->context.TryCancel();
+            while (stream->reading) {
+                co_await stream->changed;
+            }
+        }
+        call->finish(stream->result);
+
+    }
+
+    // Shared by the coroutines reading a VisualServo stream and writing its
+    // status.
+    struct ServoStream {
+        explicit ServoStream(GremsyMAVSDK &service)
+                : servo{ VisualServoLoop::Config{}, VisualServoLoop::Gains{}, service.servo_totals,
+                         [&service](float pitch_rate_deg_s, float yaw_rate_deg_s) {
+                             service.submit_pitch_rate_and_yaw_rate(pitch_rate_deg_s, yaw_rate_deg_s);
+                         } },
+                  timer{ *service.loop } {}
+
+        VisualServoLoop servo; // Stops the gimbal when the stream is over
+        LoopTimer timer;       // Between status messages
+        LoopEvent read;
+        bool reading{true};
+        Status result;
+    };
+
+    LoopTask read_servo_requests(VisualServoCall *call, std::shared_ptr<ServoStream> stream) {
+
+        mavsdk::rpc::gimbal::VisualServoRequest request;
+        while (co_await call->read(request)) {
+            stream->result = apply_servo_request(stream->servo, request);
+            if (!stream->result.ok()) {
+                break;
+            }
+        }
+
+        stream->reading = false;
+        stream->timer.cancel();
+        stream->read.set();
+
+    }
+
+    LoopTask visual_servo_on_loop(VisualServoCall *call) {
+
+        auto slot = limiter.acquire(call->context, ClientLimiter::Kind::Stream);
+        if (!slot) {
+            call->finish(too_many_streams());
+            co_return;
+        }
+
+        auto stream = std::make_shared<ServoStream>(*this);
+        read_servo_requests(call, stream);
+
+        mavsdk::rpc::gimbal::VisualServoStatus status;
+        while (stream->reading && !call->cancelled()) {
+            co_await stream->timer.until(std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+            if (!stream->reading) {
+                break;
+            }
+            from_servo_status(stream->servo.status(), &status);
+            if (!co_await call->write(status)) {
+                break;
+            }
+        }
+
+        if (stream->reading) {
+            call->context.TryCancel();
+            co_await stream->read;
+        }
+        call->finish(stream->result);
+
+    }
+
+    void buffer_setpoint(std::unique_ptr<JitterBuffer> &buffer, const mavsdk::rpc::gimbal::Setpoint &setpoint) {
+
+        auto arrival = std::chrono::steady_clock::now();
+
+        if (!buffer) {
+            buffer = std::make_unique<JitterBuffer>(JitterBuffer::Config{}, jitter_totals, [this](const JitterBuffer::Sample &sample) {
+                if (sample.rate) {
+                    submit_pitch_rate_and_yaw_rate(sample.pitch, sample.yaw);
+                } else {
+                    submit_pitch_and_yaw(sample.pitch, sample.yaw);
+                }
+            });
+        }
+
+        bool rate = setpoint.mode() == mavsdk::rpc::gimbal::SETPOINT_MODE_RATE;
+        auto time_us = setpoint.sample_time_us() > 0
+                ? setpoint.sample_time_us()
+                : static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                        arrival.time_since_epoch()).count());
+        buffer->push({time_us, rate,
+                      rate ? setpoint.pitch_rate_deg_s() : setpoint.pitch_deg(),
+                      rate ? setpoint.yaw_rate_deg_s() : setpoint.yaw_deg()}, arrival);
+
+    }
 
 public:
 
-    explicit GremsyMAVSDK(std::shared_ptr<mavsdk::System> mavsdkSys) : gimbal{ mavsdkSys }, telemetry{ mavsdkSys } {
-        telemetry.subscribe_camera_attitude_euler([](mavsdk::Telemetry::EulerAngle angle) {
-            std::cout << "Gimbal angle pitch: " << angle.pitch_deg << " deg, yaw: " << angle.yaw_deg << " yaw\n";
-        });
+    GremsyMAVSDK(std::shared_ptr<mavsdk::System> mavsdkSys, int baudrate, ThreadTopology &topology,
+                 const ServerLimits &limits)
+        : gimbal{ mavsdkSys }, telemetry{ mavsdkSys },
+        passthrough{ mavsdkSys }, link_monitor{ passthrough, baudrate },
+        vehicle_clock{ passthrough, link_monitor, VehicleClock::Config{} },
+        pipeline{ passthrough, link_monitor, CommandPipeline::Config{} },
+        estimator{ telemetry, vehicle_clock, AttitudeEstimator::Config{} },
+        history{ telemetry, vehicle_clock, AttitudeHistory::Config{} },
+        // Setpoints wait in the scheduler, newest first, while the pipeline
+        // is full, instead of blocking the dispatcher and the control
+        // commands behind it.
+        scheduler{ 4, 256, [this] { return pipeline.has_room(); } },
+        budgeter{ link_monitor, scheduler, LinkBudgeter::Config{} },
+        tunnel{ passthrough, link_monitor, PassthroughTunnel::Config{} },
+        limiter{ limits.max_calls_per_client, limits.streams_per_client(), limits.max_held_per_client },
+        admission{ scheduler, AdmissionControl::Config{} },
+        control{ gimbal, ControlState::Config{} },
+        shm{ telemetry, gimbal, vehicle_clock, ShmChannel::Config{}, [this](const ShmChannel::Setpoint &setpoint) {
+            if (setpoint.rate) {
+                submit_pitch_rate_and_yaw_rate(setpoint.pitch, setpoint.yaw, setpoint.apply_at);
+            } else {
+                submit_pitch_and_yaw(setpoint.pitch, setpoint.yaw, setpoint.apply_at);
+            }
+        } } {
+
+        // MAVSDK creates its receive and callback threads itself, so they are
+        // placed the first time they call in. The command sender is placed by
+        // running one command on it.
+        telemetry.subscribe_camera_attitude_euler([&topology](mavsdk::Telemetry::EulerAngle angle) {
+            thread_local bool adopted = false;
+            if (!adopted) {
+                adopted = true;
+                topology.adopt_io_thread("telemetry_callbacks");
+            }
+            std::cout << "Gimbal angle pitch: " << angle.pitch_deg << " deg, yaw: " << angle.yaw_deg << " yaw\n";
+        });
+
+        link_monitor.add_listener([&topology](LinkMonitor::Direction direction, const mavlink_message_t &) {
+            thread_local bool adopted = false;
+            if (!adopted && direction == LinkMonitor::Direction::Incoming) {
+                adopted = true;
+                topology.adopt_io_thread("mavlink_rx");
+            }
+        });
+        pipeline.on_room([this] { scheduler.wake(); });
+        scheduler.submit(CommandScheduler::Priority::Control, [&topology] {
+            topology.adopt_io_thread("command_sender");
+            return mavsdk::Gimbal::Result::Success;
+        });
+
+        // Most important first: camera attitude is shed last.
+        budgeter.add_stream({"camera_attitude",
+                             stream_rate_setter(&mavsdk::Telemetry::set_rate_camera_attitude_async, telemetry, "camera_attitude"),
+                             20, 2, 32});
+        budgeter.add_stream({"position",
+                             stream_rate_setter(&mavsdk::Telemetry::set_rate_position_async, telemetry, "position"),
+                             5, 1, 40});
+
+        scheduler.register_metrics(metrics);
+        link_monitor.register_metrics(metrics);
+        vehicle_clock.register_metrics(metrics);
+        pipeline.register_metrics(metrics);
+        budgeter.register_metrics(metrics);
+        tunnel.register_metrics(metrics);
+        topology.register_metrics(metrics);
+        limiter.register_metrics(metrics);
+        admission.register_metrics(metrics);
+        control.register_metrics(metrics);
+        estimator.register_metrics(metrics);
+        history.register_metrics(metrics);
+        jitter_totals.register_metrics(metrics);
+        servo_totals.register_metrics(metrics);
+        profile_totals.register_metrics(metrics);
+        shm.register_metrics(metrics);
+        Tracer::register_metrics(metrics);
+        metrics.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+            samples.push_back({"thread.stream_readers", static_cast<double>(stream_readers.load())});
+        });
+        budgeter.start();
+    }
+
+    ~GremsyMAVSDK() override = default;;
+
+    // Serves setpoints, control commands, ApplyGimbalState, the setpoint,
+    // servo and attitude batch streams and the calls that never wait on the
+    // gimbal from the loop; the rest stay on the sync server's threads. Call
+    // before the service is registered.
+    void serve_from(EventLoop &event_loop) {
+
+        loop = &event_loop;
+        loop->register_metrics(metrics);
+
+        serve_on_loop("SetPitchAndYaw", &GremsyMAVSDK::set_pitch_and_yaw_on_loop);
+        serve_on_loop("SetPitchRateAndYawRate", &GremsyMAVSDK::set_pitch_rate_and_yaw_rate_on_loop);
+        serve_on_loop("SetMode", &GremsyMAVSDK::set_mode_on_loop);
+        serve_on_loop("TakeControl", &GremsyMAVSDK::take_control_on_loop);
+        serve_on_loop("ReleaseControl", &GremsyMAVSDK::release_control_on_loop);
+        serve_on_loop("ApplyGimbalState", &GremsyMAVSDK::apply_gimbal_state_on_loop);
+        serve_stream_on_loop("SubscribeAttitudeBatch", &GremsyMAVSDK::subscribe_attitude_batch_on_loop);
+        serve_stream_on_loop("StreamSetpoints", &GremsyMAVSDK::stream_setpoints_on_loop);
+        serve_stream_on_loop("VisualServo", &GremsyMAVSDK::visual_servo_on_loop);
+        serve_on_loop("SyncClock", &GremsyMAVSDK::SyncClock);
+        serve_on_loop("PredictAttitude", &GremsyMAVSDK::PredictAttitude);
+        serve_on_loop("GetAttitudeAt", &GremsyMAVSDK::GetAttitudeAt);
+        serve_on_loop("GetAttitudesAt", &GremsyMAVSDK::GetAttitudesAt);
+        serve_on_loop("GetMetrics", &GremsyMAVSDK::GetMetrics);
+
     }
 
-    ~GremsyMAVSDK() override = default;;
+    // Call once the server has started.
+    void listen() {
+        for (auto &listener : listeners) {
+            listener();
+        }
+    }
 
     Status SetPitchAndYaw(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::SetPitchAndYawRequest *request,
                           ::mavsdk::rpc::gimbal::SetPitchAndYawResponse *response) override {
 
-        auto result = new GimbalResult();
-        mavsdk::Gimbal::Result exec_result = gimbal.set_pitch_and_yaw(request->pitch_deg(), request->yaw_deg());
+        Tracer::Scope handling{ "handler", trace_of(*context) };
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
+        auto retry_after = admission.admit(CommandScheduler::Priority::Setpoint);
+        if (retry_after.count() > 0) {
+            return link_saturated(*context, retry_after);
+        }
 
-        if (exec_result != mavsdk::Gimbal::Result::Success) {
-            result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_ERROR);
-            return { grpc::UNKNOWN, "An unknown error occurred" };
+        if (request->has_profile()) {
+            return move_pitch_and_yaw(context, request->pitch_deg(), request->yaw_deg(), request->profile(),
+                                      response->mutable_gimbal_result());
         }
 
-        result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_SUCCESS);
-        return Status::OK;
+        auto completion = submit_pitch_and_yaw(request->pitch_deg(), request->yaw_deg());
+
+        return to_status(completion.get(), response->mutable_gimbal_result());
 
     }
 
     Status SetPitchRateAndYawRate(::grpc::ServerContext *context,
                                   const ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest *request,
                                   ::mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse *response) override {
-        return Status(grpc::UNIMPLEMENTED, "Unimplemented");
+
+        Tracer::Scope handling{ "handler", trace_of(*context) };
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
+        auto retry_after = admission.admit(CommandScheduler::Priority::Setpoint);
+        if (retry_after.count() > 0) {
+            return link_saturated(*context, retry_after);
+        }
+
+        auto completion = submit_pitch_rate_and_yaw_rate(request->pitch_rate_deg_s(), request->yaw_rate_deg_s());
+
+        return to_status(completion.get(), response->mutable_gimbal_result());
+
     }
 
     Status SetMode(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::SetModeRequest *request,
                    ::mavsdk::rpc::gimbal::SetModeResponse *response) override {
 
-        auto result = new GimbalResult();
-        mavsdk::Gimbal::Result exec_result;
-
-        switch (request->gimbal_mode()) {
-            case mavsdk::rpc::gimbal::GIMBAL_MODE_YAW_FOLLOW:
-                exec_result = gimbal.set_mode(mavsdk::Gimbal::GimbalMode::YawFollow);
-            case mavsdk::rpc::gimbal::GIMBAL_MODE_YAW_LOCK:
-                exec_result = gimbal.set_mode(mavsdk::Gimbal::GimbalMode::YawLock);
-            case mavsdk::rpc::gimbal::GimbalMode_INT_MIN_SENTINEL_DO_NOT_USE_:
-            case mavsdk::rpc::gimbal::GimbalMode_INT_MAX_SENTINEL_DO_NOT_USE_:
-                return { grpc::INVALID_ARGUMENT, "Invalid argument" };
+        Tracer::Scope handling{ "handler", trace_of(*context) };
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
         }
 
-        if (exec_result != mavsdk::Gimbal::Result::Success) {
-            result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_ERROR);
-            return { grpc::UNKNOWN, "An unknown error occurred" };
+        mavsdk::Gimbal::GimbalMode mode;
+        if (!to_gimbal_mode(request->gimbal_mode(), mode)) {
+            return { grpc::INVALID_ARGUMENT, "Invalid argument" };
         }
 
-        result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_SUCCESS);
-        response->set_allocated_gimbal_result(result);
-        return Status::OK;
+        auto completion = scheduler.submit_async(CommandScheduler::Priority::Control, set_mode_command(mode));
+
+        return to_status(completion.get(), response->mutable_gimbal_result());
 
     }
 
@@ -96,35 +1334,90 @@ public:
     Status TakeControl(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::TakeControlRequest *request,
                        ::mavsdk::rpc::gimbal::TakeControlResponse *response) override {
 
-        std::cout << "take control" << std::endl;
-        auto exec_result = gimbal.take_control(mavsdk::Gimbal::ControlMode::Primary);
-
-        auto result = new GimbalResult();
-        response->set_allocated_gimbal_result(result);
+        Tracer::Scope handling{ "handler", trace_of(*context) };
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
 
-        if (exec_result != mavsdk::Gimbal::Result::Success) {
-            result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_ERROR);
-            return { grpc::UNKNOWN, "An unknown error occurred" };
+        std::cout << "take control" << std::endl;
+        auto control_mode = to_control_mode(request->control_mode());
+        if (control.holds(control_mode, request->force())) {
+            return to_status({ CommandScheduler::Outcome::Completed, mavsdk::Gimbal::Result::Success },
+                             response->mutable_gimbal_result());
         }
-        result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_SUCCESS);
-        return Status::OK;
+        auto completion = scheduler.submit_async(CommandScheduler::Priority::Control, take_control_command(control_mode));
+
+        return to_status(completion.get(), response->mutable_gimbal_result());
 
     }
 
     Status ReleaseControl(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::ReleaseControlRequest *request,
                           ::mavsdk::rpc::gimbal::ReleaseControlResponse *response) override {
 
-        auto exec_result = gimbal.release_control();
+        Tracer::Scope handling{ "handler", trace_of(*context) };
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
+
+        if (control.holds(mavsdk::Gimbal::ControlMode::None, request->force())) {
+            return to_status({ CommandScheduler::Outcome::Completed, mavsdk::Gimbal::Result::Success },
+                             response->mutable_gimbal_result());
+        }
+        auto completion = scheduler.submit_async(CommandScheduler::Priority::Control, release_control_command());
 
-        auto result = new GimbalResult();
-        response->set_allocated_gimbal_result(result);
+        return to_status(completion.get(), response->mutable_gimbal_result());
 
-        if (exec_result != mavsdk::Gimbal::Result::Success) {
-            result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_ERROR);
-            return { grpc::UNKNOWN, "An unknown error occurred" };
+    }
+
+    // Control first, as nothing else is sent without it; then the mode and
+    // the target back to back, waiting for both acks together. The gimbal
+    // cannot undo a part, so each part's result is reported.
+    Status ApplyGimbalState(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::ApplyGimbalStateRequest *request,
+                            ::mavsdk::rpc::gimbal::ApplyGimbalStateResponse *response) override {
+
+        Tracer::Scope handling{ "handler", trace_of(*context) };
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
+
+        mavsdk::Gimbal::GimbalMode mode{};
+        auto valid = check_gimbal_state(*request, mode);
+        if (!valid.ok()) {
+            return valid;
+        }
+
+        GimbalStateCompletions completions;
+        if (request->has_take_control()) {
+            auto control_mode = to_control_mode(request->take_control().control_mode());
+            if (control.holds(control_mode, request->take_control().force())) {
+                completions.control = { CommandScheduler::Outcome::Completed, mavsdk::Gimbal::Result::Success };
+            } else {
+                completions.control = scheduler.submit_async(CommandScheduler::Priority::Control,
+                                                             take_control_command(control_mode)).get();
+            }
+            if (!succeeded(*completions.control)) {
+                return to_status(*request, completions, response);
+            }
+        }
+
+        std::promise<CommandScheduler::Completion> mode_done;
+        std::promise<CommandScheduler::Completion> target_done;
+        auto mode_completion = mode_done.get_future();
+        auto target_completion = target_done.get_future();
+        submit_mode_and_target(*request, mode,
+                               [&mode_done](CommandScheduler::Completion completion) { mode_done.set_value(completion); },
+                               [&target_done](CommandScheduler::Completion completion) { target_done.set_value(completion); });
+        if (request->has_set_mode()) {
+            completions.mode = mode_completion.get();
+        }
+        if (request->target_case() != mavsdk::rpc::gimbal::ApplyGimbalStateRequest::TARGET_NOT_SET) {
+            completions.target = target_completion.get();
         }
-        result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_SUCCESS);
-        return Status::OK;
+
+        return to_status(*request, completions, response);
 
     }
 
@@ -134,28 +1427,637 @@ public:
         return Status(grpc::UNIMPLEMENTED, "Unimplemented");
     }
 
+    Status SetTelemetryRates(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::SetTelemetryRatesRequest *request,
+                             ::mavsdk::rpc::gimbal::SetTelemetryRatesResponse *response) override {
+
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
+
+        auto result = response->mutable_gimbal_result();
+
+        for (const auto &rate : request->rates()) {
+            if (rate.rate_hz() < 0) {
+                return { grpc::INVALID_ARGUMENT, "Rate must not be negative" };
+            }
+        }
+
+        for (const auto &rate : request->rates()) {
+            std::string name;
+            mavsdk::Telemetry::Result exec_result;
+
+            switch (rate.stream()) {
+                case mavsdk::rpc::gimbal::TELEMETRY_STREAM_CAMERA_ATTITUDE:
+                    name = "camera_attitude";
+                    exec_result = telemetry.set_rate_camera_attitude(rate.rate_hz());
+                    break;
+                case mavsdk::rpc::gimbal::TELEMETRY_STREAM_POSITION:
+                    name = "position";
+                    exec_result = telemetry.set_rate_position(rate.rate_hz());
+                    break;
+                case mavsdk::rpc::gimbal::TELEMETRY_STREAM_ATTITUDE:
+                    name = "attitude";
+                    exec_result = telemetry.set_rate_attitude_euler(rate.rate_hz());
+                    break;
+                case mavsdk::rpc::gimbal::TELEMETRY_STREAM_VELOCITY_NED:
+                    name = "velocity_ned";
+                    exec_result = telemetry.set_rate_velocity_ned(rate.rate_hz());
+                    break;
+                case mavsdk::rpc::gimbal::TELEMETRY_STREAM_GPS_INFO:
+                    name = "gps_info";
+                    exec_result = telemetry.set_rate_gps_info(rate.rate_hz());
+                    break;
+                case mavsdk::rpc::gimbal::TELEMETRY_STREAM_BATTERY:
+                    name = "battery";
+                    exec_result = telemetry.set_rate_battery(rate.rate_hz());
+                    break;
+                case mavsdk::rpc::gimbal::TELEMETRY_STREAM_RC_STATUS:
+                    name = "rc_status";
+                    exec_result = telemetry.set_rate_rc_status(rate.rate_hz());
+                    break;
+                case mavsdk::rpc::gimbal::TELEMETRY_STREAM_IMU:
+                    name = "imu";
+                    exec_result = telemetry.set_rate_imu(rate.rate_hz());
+                    break;
+                default:
+                    return { grpc::INVALID_ARGUMENT, "Invalid argument" };
+            }
+
+            if (exec_result != mavsdk::Telemetry::Result::Success) {
+                result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_ERROR);
+                result->set_result_str("Setting " + name + " rate failed");
+                return { grpc::UNKNOWN, "An unknown error occurred" };
+            }
+
+            // Keep the budgeter from raising the rate above what the client asked for.
+            budgeter.set_desired_rate(name, rate.rate_hz());
+        }
+
+        result->set_result(mavsdk::rpc::gimbal::GimbalResult_Result_RESULT_SUCCESS);
+        return Status::OK;
+
+    }
+
+    Status MavlinkTunnel(::grpc::ServerContext *context,
+                         ::grpc::ServerReaderWriter<::mavsdk::rpc::gimbal::MavlinkTunnelResponse,
+                                 ::mavsdk::rpc::gimbal::MavlinkTunnelRequest> *stream) override {
+
+        // Raw frames can arm, terminate or reconfigure the vehicle.
+        if (!local_peer(*context)) {
+            return local_only();
+        }
+        auto slot = limiter.acquire(*context, ClientLimiter::Kind::Stream);
+        if (!slot) {
+            return too_many_streams();
+        }
+
+        auto session = tunnel.open();
+        std::atomic<uint32_t> rejected{0};
+
+        // The client half-closing its side ends the tunnel.
+        auto reader = start_reader([this, stream, &session, &rejected] {
+            mavsdk::rpc::gimbal::MavlinkTunnelRequest request;
+            while (stream->Read(&request)) {
+                if (request.has_filter()) {
+                    const auto &ids = request.filter().message_ids();
+                    session->set_filter({ ids.begin(), ids.end() });
+                }
+                rejected += tunnel.send(request.frames());
+            }
+            session->close();
+        });
+
+        mavsdk::rpc::gimbal::MavlinkTunnelResponse response;
+        std::string frames;
+        uint32_t dropped;
+        while (!context->IsCancelled() && session->next_batch(std::chrono::milliseconds(100), frames, dropped)) {
+            auto rejected_frames = rejected.exchange(0);
+            if (frames.empty() && dropped == 0 && rejected_frames == 0) {
+                continue;
+            }
+            response.set_frames(std::move(frames));
+            response.set_dropped_frames(dropped);
+            response.set_rejected_frames(rejected_frames);
+            if (!stream->Write(response)) {
+                break;
+            }
+        }
+
+        tunnel.close(session);
+        context->TryCancel();
+        reader.join();
+
+        return Status::OK;
+
+    }
+
+    Status SubscribeAttitudeBatch(::grpc::ServerContext *context,
+                                  const ::mavsdk::rpc::gimbal::SubscribeAttitudeBatchRequest *request,
+                                  ::grpc::ServerWriter<::mavsdk::rpc::gimbal::AttitudeBatch> *writer) override {
+
+        auto slot = limiter.acquire(*context, ClientLimiter::Kind::Stream);
+        if (!slot) {
+            return too_many_streams();
+        }
+
+        auto window = std::chrono::milliseconds(request->batch_window_ms() > 0 ? request->batch_window_ms() : 100);
+        window = std::clamp(window, std::chrono::milliseconds(10), std::chrono::milliseconds(5000));
+
+        mavsdk::rpc::gimbal::AttitudeBatch batch;
+
+        if (request->prediction_rate_hz() > 0) {
+            auto rate_hz = std::min<uint32_t>(request->prediction_rate_hz(), 1000);
+            auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(1.0 / rate_hz));
+            std::vector<mavsdk::Telemetry::EulerAngle> predicted;
+            mavsdk::Telemetry::EulerAngle angle;
+
+            auto next = std::chrono::steady_clock::now();
+            auto send_at = next + window;
+            while (!context->IsCancelled()) {
+                std::this_thread::sleep_until(next);
+                if (estimator.predict(next, angle)) {
+                    predicted.push_back(angle);
+                }
+                next += period;
+                if (next < send_at) {
+                    continue;
+                }
+                send_at += window;
+                if (predicted.empty()) {
+                    continue;
+                }
+                AttitudeBatcher::encode(predicted, batch);
+                predicted.clear();
+                if (!writer->Write(batch)) {
+                    break;
+                }
+                // Skip ticks missed while a slow client held up the write.
+                next = std::max(next, std::chrono::steady_clock::now());
+            }
+            return Status::OK;
+        }
+
+        AttitudeBatcher batcher{ telemetry, vehicle_clock };
+
+        auto next = std::chrono::steady_clock::now() + window;
+        while (!context->IsCancelled()) {
+            std::this_thread::sleep_until(next);
+            next += window;
+            if (batcher.take(batch) == 0) {
+                continue;
+            }
+            if (!writer->Write(batch)) {
+                break;
+            }
+        }
+
+        return Status::OK;
+
+    }
+
+    Status StreamSetpoints(::grpc::ServerContext *context,
+                           ::grpc::ServerReaderWriter<::mavsdk::rpc::gimbal::SetpointAck,
+                                   ::mavsdk::rpc::gimbal::Setpoint> *stream) override {
+
+        auto slot = limiter.acquire(*context, ClientLimiter::Kind::Stream);
+        if (!slot) {
+            return too_many_streams();
+        }
+
+        struct Pending {
+            uint64_t sequence;
+            std::future<CommandScheduler::Completion> completion;
+            ClientLimiter::Slot held; // Taken by setpoints with an apply time
+        };
+
+        std::mutex mutex;
+        std::condition_variable ready;
+        std::deque<Pending> pending;
+        std::vector<Pending> held; // Setpoints with an apply time, acked when they are released
+        bool reading = true;
+        Status result = Status::OK;
+        std::unique_ptr<JitterBuffer> jitter_buffer; // Created on the first buffered setpoint
+        auto traced = trace_of(*context);
+
+        // Acked at once, in order with the other setpoints.
+        auto settled = [&](uint64_t sequence, CommandScheduler::Outcome outcome) {
+            std::promise<CommandScheduler::Completion> completion;
+            completion.set_value({outcome, mavsdk::Gimbal::Result::Success});
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                pending.push_back({sequence, completion.get_future(), {}});
+            }
+            ready.notify_one();
+        };
+
+        // Setpoints are submitted as they arrive; acks are written in order
+        // as they complete. Held setpoints are acked on their own so they do
+        // not stall the acks of setpoints sent after them.
+        auto reader = start_reader([&] {
+            mavsdk::rpc::gimbal::Setpoint setpoint;
+            Status invalid = Status::OK;
+            while (invalid.ok() && stream->Read(&setpoint)) {
+                if (setpoint.jitter_buffered() && setpoint.apply_time_ns() == 0) {
+                    buffer_setpoint(jitter_buffer, setpoint);
+                    settled(setpoint.sequence(), CommandScheduler::Outcome::Completed);
+                    continue;
+                }
+
+                std::chrono::steady_clock::time_point apply_at{};
+                ClientLimiter::Slot held_slot;
+                if (setpoint.apply_time_ns() > 0) {
+                    apply_at += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                            std::chrono::nanoseconds(setpoint.apply_time_ns()));
+                    if (apply_at - std::chrono::steady_clock::now() > max_apply_ahead) {
+                        invalid = apply_time_too_far();
+                        break;
+                    }
+                    held_slot = limiter.acquire(*context, ClientLimiter::Kind::Held);
+                    if (!held_slot) {
+                        settled(setpoint.sequence(), CommandScheduler::Outcome::Rejected);
+                        continue;
+                    }
+                }
+                Tracer::Scope submitting{ "handler", traced };
+                auto completion = setpoint.mode() == mavsdk::rpc::gimbal::SETPOINT_MODE_RATE
+                        ? submit_pitch_rate_and_yaw_rate(setpoint.pitch_rate_deg_s(), setpoint.yaw_rate_deg_s(), apply_at)
+                        : submit_pitch_and_yaw(setpoint.pitch_deg(), setpoint.yaw_deg(), apply_at);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (held_slot) {
+                        held.push_back({setpoint.sequence(), std::move(completion), std::move(held_slot)});
+                    } else {
+                        pending.push_back({setpoint.sequence(), std::move(completion), {}});
+                    }
+                }
+                ready.notify_one();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                reading = false;
+                result = invalid;
+            }
+            ready.notify_one();
+        });
+
+        mavsdk::rpc::gimbal::SetpointAck ack;
+        auto write_ack = [&](uint64_t sequence, const CommandScheduler::Completion &result) {
+            if (result.outcome == CommandScheduler::Outcome::Superseded) {
+                return true;
+            }
+            ack.Clear();
+            ack.set_sequence(sequence);
+            to_status(result, ack.mutable_gimbal_result());
+            return stream->Write(ack);
+        };
+
+        bool writable = true;
+        while (writable && !context->IsCancelled()) {
+            std::unique_lock<std::mutex> lock(mutex);
+            // Held setpoints are polled, their acks are not time critical.
+            // Once the client has half-closed, only they are left to wait for.
+            ready.wait_for(lock, std::chrono::milliseconds(10), [&] {
+                return !pending.empty() || (!reading && held.empty());
+            });
+
+            std::vector<Pending> released;
+            auto still_held = std::partition(held.begin(), held.end(), [](Pending &entry) {
+                return entry.completion.wait_for(std::chrono::seconds(0)) == std::future_status::timeout;
+            });
+            std::move(still_held, held.end(), std::back_inserter(released));
+            held.erase(still_held, held.end());
+
+            if (pending.empty() && released.empty()) {
+                if (!reading && held.empty()) {
+                    break;
+                }
+                continue;
+            }
+            if (!pending.empty()) {
+                released.push_back(std::move(pending.front()));
+                pending.pop_front();
+            }
+            lock.unlock();
+
+            for (auto &entry : released) {
+                writable = writable && write_ack(entry.sequence, entry.completion.get());
+            }
+        }
+
+        bool still_reading;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            still_reading = reading;
+        }
+        if (still_reading) {
+            context->TryCancel();
+        }
+        reader.join();
+
+        return result;
+
+    }
+
+    Status SyncClock(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::SyncClockRequest *request,
+                     ::mavsdk::rpc::gimbal::SyncClockResponse *response) override {
+
+        // Taken first, so waiting for a slot counts as server time rather
+        // than as network delay.
+        auto received = std::chrono::steady_clock::now();
+
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
+
+        auto to_ns = [](std::chrono::steady_clock::time_point time) {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    time.time_since_epoch()).count());
+        };
+        response->set_client_send_time_ns(request->client_send_time_ns());
+        response->set_server_receive_time_ns(to_ns(received));
+        response->set_server_send_time_ns(to_ns(std::chrono::steady_clock::now()));
+        return Status::OK;
+
+    }
+
+    Status PredictAttitude(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::PredictAttitudeRequest *request,
+                           ::mavsdk::rpc::gimbal::PredictAttitudeResponse *response) override {
+
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
+
+        auto at = std::chrono::steady_clock::now();
+        if (request->time_ns() > 0) {
+            at = std::chrono::steady_clock::time_point{} + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::nanoseconds(request->time_ns()));
+        }
+
+        mavsdk::Telemetry::EulerAngle angle;
+        if (!estimator.predict(at, angle)) {
+            return { grpc::UNAVAILABLE, "No camera attitude received yet" };
+        }
+        response->set_roll_deg(angle.roll_deg);
+        response->set_pitch_deg(angle.pitch_deg);
+        response->set_yaw_deg(angle.yaw_deg);
+        response->set_timestamp_us(angle.timestamp_us);
+        return Status::OK;
+
+    }
+
+    Status GetAttitudeAt(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::GetAttitudeAtRequest *request,
+                         ::mavsdk::rpc::gimbal::GetAttitudeAtResponse *response) override {
+
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
+
+        mavsdk::Telemetry::Quaternion attitude;
+        if (!history.lookup(request->time_ns(), attitude)) {
+            return { grpc::NOT_FOUND, "No attitude recorded for that time" };
+        }
+        auto angle = AttitudeHistory::to_euler(attitude);
+        response->set_roll_deg(angle.roll_deg);
+        response->set_pitch_deg(angle.pitch_deg);
+        response->set_yaw_deg(angle.yaw_deg);
+        response->set_q_w(attitude.w);
+        response->set_q_x(attitude.x);
+        response->set_q_y(attitude.y);
+        response->set_q_z(attitude.z);
+        return Status::OK;
+
+    }
+
+    Status GetAttitudesAt(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::GetAttitudesAtRequest *request,
+                          ::mavsdk::rpc::gimbal::GetAttitudesAtResponse *response) override {
+
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
+
+        auto count = request->time_ns_size();
+        if (count > 16384) {
+            return { grpc::INVALID_ARGUMENT, "At most 16384 times per call" };
+        }
+
+        // Each column is sized once and filled in place.
+        response->mutable_found()->Resize(count, false);
+        for (auto *column : {response->mutable_roll_deg(), response->mutable_pitch_deg(), response->mutable_yaw_deg(),
+                             response->mutable_q_w(), response->mutable_q_x(), response->mutable_q_y(),
+                             response->mutable_q_z()}) {
+            column->Resize(count, 0);
+        }
+        history.lookup(request->time_ns().data(), static_cast<std::size_t>(count),
+                       { response->mutable_found()->mutable_data(), response->mutable_q_w()->mutable_data(),
+                         response->mutable_q_x()->mutable_data(), response->mutable_q_y()->mutable_data(),
+                         response->mutable_q_z()->mutable_data() });
+
+        for (int i = 0; i < count; i++) {
+            if (!response->found(i)) {
+                continue;
+            }
+            auto angle = AttitudeHistory::to_euler({ response->q_w(i), response->q_x(i), response->q_y(i),
+                                                     response->q_z(i), 0 });
+            response->set_roll_deg(i, angle.roll_deg);
+            response->set_pitch_deg(i, angle.pitch_deg);
+            response->set_yaw_deg(i, angle.yaw_deg);
+        }
+        return Status::OK;
+
+    }
+
+    Status VisualServo(::grpc::ServerContext *context,
+                       ::grpc::ServerReaderWriter<::mavsdk::rpc::gimbal::VisualServoStatus,
+                               ::mavsdk::rpc::gimbal::VisualServoRequest> *stream) override {
+
+        auto slot = limiter.acquire(*context, ClientLimiter::Kind::Stream);
+        if (!slot) {
+            return too_many_streams();
+        }
+
+        // Stops the gimbal when it goes out of scope.
+        VisualServoLoop loop{ VisualServoLoop::Config{}, VisualServoLoop::Gains{}, servo_totals,
+                              [this](float pitch_rate_deg_s, float yaw_rate_deg_s) {
+                                  submit_pitch_rate_and_yaw_rate(pitch_rate_deg_s, yaw_rate_deg_s);
+                              } };
+
+        std::mutex mutex;
+        std::condition_variable finished;
+        bool reading = true;
+        Status result = Status::OK;
+
+        auto reader = start_reader([&] {
+            mavsdk::rpc::gimbal::VisualServoRequest request;
+            Status invalid = Status::OK;
+            while (invalid.ok() && stream->Read(&request)) {
+                invalid = apply_servo_request(loop, request);
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                reading = false;
+                result = invalid;
+            }
+            finished.notify_one();
+        });
+
+        mavsdk::rpc::gimbal::VisualServoStatus status;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!context->IsCancelled()) {
+            if (finished.wait_for(lock, std::chrono::milliseconds(100), [&] { return !reading; })) {
+                break;
+            }
+            lock.unlock();
+
+            from_servo_status(loop.status(), &status);
+            bool written = stream->Write(status);
+
+            lock.lock();
+            if (!written) {
+                break;
+            }
+        }
+        bool still_reading = reading;
+        lock.unlock();
+
+        if (still_reading) {
+            context->TryCancel();
+        }
+        reader.join();
+
+        return result;
+
+    }
+
+    Status SetTracing(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::SetTracingRequest *request,
+                      ::mavsdk::rpc::gimbal::SetTracingResponse *response) override {
+
+        // Tracing costs every call, and a trace shows what others sent.
+        if (!local_peer(*context)) {
+            return local_only();
+        }
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
+
+        if (request->clear()) {
+            Tracer::clear();
+        }
+        Tracer::enable(request->enabled());
+        return Status::OK;
+
+    }
+
+    Status GetTrace(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::GetTraceRequest *request,
+                    ::mavsdk::rpc::gimbal::GetTraceResponse *response) override {
+
+        if (!local_peer(*context)) {
+            return local_only();
+        }
+        auto slot = limiter.acquire(*context);
+        if (!slot) {
+            return too_many_calls();
+        }
+
+        auto stats = Tracer::stats();
+        switch (request->format()) {
+            case mavsdk::rpc::gimbal::TRACE_FORMAT_CHROME_JSON:
+                response->set_trace(Tracer::chrome_json());
+                break;
+            case mavsdk::rpc::gimbal::TRACE_FORMAT_PERFETTO:
+                response->set_trace(Tracer::perfetto_proto());
+                break;
+            default:
+                return { grpc::INVALID_ARGUMENT, "Unknown trace format" };
+        }
+        response->set_spans(stats.spans);
+        response->set_overwritten(stats.overwritten);
+        if (request->clear()) {
+            Tracer::clear();
+        }
+        return Status::OK;
+
+    }
+
+    Status GetMetrics(::grpc::ServerContext *context, const ::mavsdk::rpc::gimbal::GetMetricsRequest *request,
+                      ::mavsdk::rpc::gimbal::GetMetricsResponse *response) override {
+
+        for (const auto &sample : metrics.snapshot()) {
+            auto metric = response->add_metrics();
+            metric->set_name(sample.name);
+            metric->set_value(sample.value);
+        }
+        return Status::OK;
+
+    }
+
 };
 
-void RunServer(std::shared_ptr<mavsdk::System> mavsdkSys) {
+void RunServer(std::shared_ptr<mavsdk::System> mavsdkSys, int baudrate, const ThreadTopology::Config &topology_config,
+               const std::string &unix_socket, ServerLimits limits, bool event_loop, bool trace) {
 
     std::string server_address{"localhost:11520"};
-    GremsyMAVSDK service(mavsdkSys);
+    if (event_loop) {
+        // What is left on the sync server is occasional; one poller will do.
+        limits.max_pollers = 1;
+    }
+    ThreadTopology topology{ topology_config };
+    GremsyMAVSDK service(mavsdkSys, baudrate, topology, limits);
+
+    // Keep the gRPC threads off the I/O cores.
+    topology.enter_grpc();
 
     // Build server
     ServerBuilder builder;
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    // Clients on the same machine skip the TCP stack through the socket.
+    if (!unix_socket.empty()) {
+        builder.AddListeningPort("unix:" + unix_socket, grpc::InsecureServerCredentials());
+    }
+    // Calls are only intercepted while tracing is on, see SetTracing.
+    std::vector<std::unique_ptr<grpc::experimental::ServerInterceptorFactoryInterface>> interceptors;
+    interceptors.push_back(std::make_unique<TraceInterceptorFactory>());
+    builder.experimental().SetInterceptorCreators(std::move(interceptors));
+    Tracer::enable(trace);
+    std::unique_ptr<EventLoop> loop;
+    if (event_loop) {
+        loop = std::make_unique<EventLoop>(builder);
+        service.serve_from(*loop);
+    }
     builder.RegisterService(&service);
+    limits.apply(builder);
     std::unique_ptr<Server> server{builder.BuildAndStart()};
+    if (!server) {
+        std::cerr << "Starting the server failed\n";
+        return;
+    }
+    if (loop) {
+        service.listen();
+        loop->start();
+    }
 
     // Run server
     std::cout << "Server listening on " << server_address << std::endl;
+    if (!unix_socket.empty()) {
+        std::cout << "Server listening on unix:" << unix_socket << std::endl;
+    }
     server->Wait();
 
 }
 
-void parse_commandline(int argc, char **argv, char *&uart_name, int &baudrate) {
+void parse_commandline(int argc, char **argv, char *&uart_name, int &baudrate, ThreadTopology::Config &topology,
+                       std::string &unix_socket, ServerLimits &limits, bool &event_loop, bool &trace) {
     // string for command line usage
-    const char *commandline_usage = "usage: mavlink_serial -d <devicename> -b <baudrate>";
+    const char *commandline_usage = "usage: mavlink_serial -d <devicename> -b <baudrate> "
+                                    "[--io-cpus <cpus>] [--io-priority <1-99>] [--grpc-cpus <cpus>] "
+                                    "[--socket <path, empty for none>] [--max-calls-per-client <n>] "
+                                    "[--max-streams-per-client <n>] [--event-loop] [--trace]";
 
     // Read input arguments
     for (int i = 1; i < argc; i++) { // argv[0] is "mavlink"
@@ -187,6 +2089,62 @@ void parse_commandline(int argc, char **argv, char *&uart_name, int &baudrate) {
                 throw EXIT_FAILURE;
             }
         }
+
+        // CPUs for the MAVLink I/O threads or the gRPC threads, e.g. 2,3 or 2-3
+        if (strcmp(argv[i], "--io-cpus") == 0 || strcmp(argv[i], "--grpc-cpus") == 0) {
+            auto &placement = strcmp(argv[i], "--io-cpus") == 0 ? topology.io : topology.grpc;
+            if (argc > i + 1) {
+                placement.cpus = ThreadTopology::parse_cpu_list(argv[i + 1]);
+            }
+            if (placement.cpus.empty()) {
+                printf("%s\n",commandline_usage);
+                throw EXIT_FAILURE;
+            }
+        }
+
+        // SCHED_FIFO priority for the MAVLink I/O threads
+        if (strcmp(argv[i], "--io-priority") == 0) {
+            if (argc > i + 1) {
+                topology.io.fifo_priority = atoi(argv[i + 1]);
+
+            } else {
+                printf("%s\n",commandline_usage);
+                throw EXIT_FAILURE;
+            }
+        }
+
+        // Unix domain socket for clients on the same machine
+        if (strcmp(argv[i], "--socket") == 0) {
+            if (argc > i + 1) {
+                unix_socket = argv[i + 1];
+
+            } else {
+                printf("%s\n",commandline_usage);
+                throw EXIT_FAILURE;
+            }
+        }
+
+        // Concurrent unary calls and open streams allowed per client
+        if (strcmp(argv[i], "--max-calls-per-client") == 0 || strcmp(argv[i], "--max-streams-per-client") == 0) {
+            auto &limit = strcmp(argv[i], "--max-calls-per-client") == 0 ? limits.max_calls_per_client
+                                                                         : limits.max_streams_per_client;
+            int value = argc > i + 1 ? atoi(argv[i + 1]) : 0;
+            if (value <= 0) {
+                printf("%s\n",commandline_usage);
+                throw EXIT_FAILURE;
+            }
+            limit = static_cast<std::size_t>(value);
+        }
+
+        // Serve the frequent calls from one thread, for single-core boards
+        if (strcmp(argv[i], "--event-loop") == 0) {
+            event_loop = true;
+        }
+
+        // Trace calls from the start instead of from the first SetTracing
+        if (strcmp(argv[i], "--trace") == 0) {
+            trace = true;
+        }
     }
     // end: for each input argument
 
@@ -235,8 +2193,13 @@ int main(int argc, char** argv) {
     char *uart_name = (char*)"/dev/ttyACM0";
 #endif
     int baudrate = 57600;
+    ThreadTopology::Config topology;
+    std::string unix_socket = "/tmp/gimbal_mavsdk.sock";
+    ServerLimits limits;
+    bool event_loop = false;
+    bool trace = false;
 
-    parse_commandline(argc, argv, uart_name, baudrate);
+    parse_commandline(argc, argv, uart_name, baudrate, topology, unix_socket, limits, event_loop, trace);
 
     mavsdk::Mavsdk mavsdk;
     std::string device = uart_name;
@@ -249,7 +2212,7 @@ int main(int argc, char** argv) {
         return 1;
     }
 
-    RunServer(mavsdkSystem);
+    RunServer(mavsdkSystem, baudrate, topology, unix_socket, limits, event_loop, trace);
 
     return 0;
 
@@ -0,0 +1,164 @@
+#include "shm_channel.h"
+
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+uint64_t now_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+}
+
+ShmChannel::ShmChannel(mavsdk::Telemetry &telemetry, mavsdk::Gimbal &gimbal, const VehicleClock &clock, Config config,
+                       SetpointHandler handler)
+        : telemetry{telemetry}, gimbal{gimbal}, config{std::move(config)}, handler{std::move(handler)} {
+
+    // Clients still mapping a segment from a previous run keep it until
+    // they let go; new clients get a fresh one.
+    const auto &name = this->config.name;
+    shm_unlink(name.c_str());
+    auto fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+    if (fd < 0) {
+        std::cerr << "Shared memory channel " << name << " unavailable: " << std::strerror(errno) << "\n";
+        return;
+    }
+    void *mapped = MAP_FAILED;
+    if (ftruncate(fd, sizeof(ShmSegment)) == 0) {
+        mapped = mmap(nullptr, sizeof(ShmSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (mapped == MAP_FAILED) {
+        std::cerr << "Shared memory channel " << name << " unavailable: " << std::strerror(errno) << "\n";
+        close(fd);
+        shm_unlink(name.c_str());
+        return;
+    }
+    close(fd);
+
+    segment = new (mapped) ShmSegment();
+    segment->version = ShmSegment::layout_version;
+    segment->heartbeat_ns.store(now_ns(), std::memory_order_relaxed);
+
+    // Each subscription's callbacks come from one thread, which makes it the
+    // seqlock's single writer.
+    attitude_handle = telemetry.subscribe_camera_attitude_euler([this, &clock](mavsdk::Telemetry::EulerAngle angle) {
+        auto measured = clock.measured_at(angle.timestamp_us, std::chrono::steady_clock::now());
+        segment->attitude.store({static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         measured.time_since_epoch()).count()),
+                                 angle.roll_deg, angle.pitch_deg, angle.yaw_deg});
+        attitudes++;
+    });
+    control_handle = gimbal.subscribe_control([this](mavsdk::Gimbal::ControlStatus status) {
+        segment->control.store({static_cast<int32_t>(status.control_mode),
+                                status.sysid_primary_control, status.compid_primary_control,
+                                status.sysid_secondary_control, status.compid_secondary_control});
+        controls++;
+    });
+
+    segment->magic.store(ShmSegment::magic_value, std::memory_order_release);
+    consumer = std::thread(&ShmChannel::run, this);
+
+}
+
+ShmChannel::~ShmChannel() {
+
+    if (!segment) {
+        return;
+    }
+
+    telemetry.unsubscribe_camera_attitude_euler(attitude_handle);
+    gimbal.unsubscribe_control(control_handle);
+
+    stopping = true;
+    segment->doorbell.fetch_add(1);
+    shm_futex_wake(segment->doorbell);
+    consumer.join();
+
+    segment->magic.store(0, std::memory_order_release);
+    munmap(segment, sizeof(ShmSegment));
+    shm_unlink(config.name.c_str());
+
+}
+
+ShmChannel::Stats ShmChannel::stats() const {
+    return {attitudes.load(), controls.load(), setpoints.load(), pings.load(), wakeups.load()};
+}
+
+void ShmChannel::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        auto s = stats();
+        samples.push_back({"shm.active", active() ? 1.0 : 0.0});
+        samples.push_back({"shm.attitudes", static_cast<double>(s.attitudes)});
+        samples.push_back({"shm.controls", static_cast<double>(s.controls)});
+        samples.push_back({"shm.setpoints", static_cast<double>(s.setpoints)});
+        samples.push_back({"shm.pings", static_cast<double>(s.pings)});
+        samples.push_back({"shm.wakeups", static_cast<double>(s.wakeups)});
+    });
+}
+
+void ShmChannel::run() {
+
+    timespec timeout{};
+    timeout.tv_sec = static_cast<time_t>(config.heartbeat.count() / 1000);
+    timeout.tv_nsec = static_cast<long>(config.heartbeat.count() % 1000) * 1000000;
+
+    while (!stopping) {
+        drain();
+        segment->heartbeat_ns.store(now_ns(), std::memory_order_relaxed);
+
+        // See ShmGimbalClient::push() for the other half.
+        segment->consumer_sleeping.store(1, std::memory_order_seq_cst);
+        auto doorbell = segment->doorbell.load(std::memory_order_seq_cst);
+        if (segment->head.load(std::memory_order_seq_cst) == segment->tail.load(std::memory_order_relaxed)
+            && !stopping) {
+            shm_futex_wait(segment->doorbell, doorbell, &timeout);
+            if (segment->doorbell.load(std::memory_order_relaxed) != doorbell) {
+                wakeups++;
+            }
+        }
+        segment->consumer_sleeping.store(0, std::memory_order_relaxed);
+    }
+
+}
+
+void ShmChannel::drain() {
+
+    auto tail = segment->tail.load(std::memory_order_relaxed);
+    auto head = segment->head.load(std::memory_order_acquire);
+
+    // The producer is another process; a head it corrupted must not keep
+    // this thread busy.
+    if (head - tail > ShmSegment::ring_capacity) {
+        segment->tail.store(head, std::memory_order_release);
+        return;
+    }
+
+    for (; tail != head; tail++) {
+        auto setpoint = segment->setpoints[tail % ShmSegment::ring_capacity];
+        switch (setpoint.kind) {
+            case ShmSetpointKind::Ping:
+                pings++;
+                break;
+            case ShmSetpointKind::Angles:
+            case ShmSetpointKind::Rates:
+                if (!std::isfinite(setpoint.pitch) || !std::isfinite(setpoint.yaw)) {
+                    break;
+                }
+                handler({setpoint.kind == ShmSetpointKind::Rates, setpoint.pitch, setpoint.yaw,
+                         std::chrono::steady_clock::time_point{std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                 std::chrono::nanoseconds(setpoint.apply_time_ns))}});
+                setpoints++;
+                break;
+        }
+        segment->tail.store(tail + 1, std::memory_order_release);
+    }
+
+}
@@ -0,0 +1,89 @@
+#ifndef GIMBAL_MAVSDK_SHM_CHANNEL_H
+#define GIMBAL_MAVSDK_SHM_CHANNEL_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <mavsdk/plugins/gimbal/gimbal.h>
+#include <mavsdk/plugins/telemetry/telemetry.h>
+#include "metrics.h"
+#include "shm_layout.h"
+#include "vehicle_clock.h"
+
+// Serves the shared-memory segment described in shm_layout.h, next to the
+// gRPC service, for processes on the same machine.
+//
+// Camera attitude and control state are published as they arrive. A
+// consumer thread drains the setpoint ring and hands each setpoint on; it
+// sleeps on the ring's futex while the ring is empty, so an idle channel
+// costs one wakeup per heartbeat.
+class ShmChannel final {
+
+public:
+
+    struct Config {
+        std::string name = shm_default_name;      // shm_open() name
+        std::chrono::milliseconds heartbeat{100}; // How often the segment is marked alive
+    };
+
+    struct Setpoint {
+        bool rate;
+        float pitch;
+        float yaw;
+        std::chrono::steady_clock::time_point apply_at; // Zero to apply at once
+    };
+
+    struct Stats {
+        uint64_t attitudes;
+        uint64_t controls;
+        uint64_t setpoints;
+        uint64_t pings;
+        uint64_t wakeups; // Consumer woken by a producer rather than its heartbeat
+    };
+
+    using SetpointHandler = std::function<void(const Setpoint &setpoint)>;
+
+    // Without a segment, e.g. because shared memory is unavailable, the
+    // channel logs why and stays idle.
+    ShmChannel(mavsdk::Telemetry &telemetry, mavsdk::Gimbal &gimbal, const VehicleClock &clock, Config config,
+               SetpointHandler handler);
+    ~ShmChannel();
+
+    ShmChannel(const ShmChannel &) = delete;
+    ShmChannel &operator=(const ShmChannel &) = delete;
+
+    bool active() const { return segment != nullptr; }
+
+    Stats stats() const;
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+private:
+
+    void run();
+    void drain();
+
+    mavsdk::Telemetry &telemetry;
+    mavsdk::Gimbal &gimbal;
+    const Config config;
+    const SetpointHandler handler;
+
+    ShmSegment *segment{nullptr};
+    mavsdk::Telemetry::CameraAttitudeEulerHandle attitude_handle;
+    mavsdk::Gimbal::ControlHandle control_handle;
+
+    std::atomic<bool> stopping{false};
+    std::atomic<uint64_t> attitudes{0};
+    std::atomic<uint64_t> controls{0};
+    std::atomic<uint64_t> setpoints{0};
+    std::atomic<uint64_t> pings{0};
+    std::atomic<uint64_t> wakeups{0};
+
+    std::thread consumer;
+
+};
+
+#endif // GIMBAL_MAVSDK_SHM_CHANNEL_H
@@ -0,0 +1,179 @@
+#include "attitude_history.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+
+namespace {
+
+using Quaternion = mavsdk::Telemetry::Quaternion;
+
+constexpr uint64_t ms = 1000000;
+
+// Rotation by yaw degrees about the vertical axis.
+Quaternion yawed(double yaw_deg) {
+    auto half = yaw_deg * M_PI / 360.0;
+    Quaternion q;
+    q.w = static_cast<float>(std::cos(half));
+    q.z = static_cast<float>(std::sin(half));
+    return q;
+}
+
+Quaternion negated(Quaternion q) {
+    q.w = -q.w;
+    q.x = -q.x;
+    q.y = -q.y;
+    q.z = -q.z;
+    return q;
+}
+
+AttitudeHistory::Config config(std::size_t capacity = 16) {
+    AttitudeHistory::Config config;
+    config.capacity = capacity;
+    config.max_gap = std::chrono::milliseconds(100);
+    return config;
+}
+
+}
+
+TEST(AttitudeHistoryTest, FindsSamplesAtTheirOwnTime) {
+
+    AttitudeHistory history{config()};
+    history.add(10 * ms, yawed(10));
+    history.add(20 * ms, yawed(20));
+
+    Quaternion q;
+    ASSERT_TRUE(history.lookup(20 * ms, q));
+    EXPECT_NEAR(AttitudeHistory::to_euler(q).yaw_deg, 20, 1e-3);
+
+}
+
+TEST(AttitudeHistoryTest, SlerpsBetweenSamples) {
+
+    AttitudeHistory history{config()};
+    history.add(0, yawed(0));
+    history.add(40 * ms, yawed(90));
+
+    Quaternion q;
+    ASSERT_TRUE(history.lookup(10 * ms, q));
+    EXPECT_NEAR(AttitudeHistory::to_euler(q).yaw_deg, 22.5, 1e-3);
+    ASSERT_TRUE(history.lookup(20 * ms, q));
+    EXPECT_NEAR(AttitudeHistory::to_euler(q).yaw_deg, 45, 1e-3);
+    EXPECT_NEAR(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z, 1, 1e-6);
+
+}
+
+TEST(AttitudeHistoryTest, SlerpsAlongTheShorterArc) {
+
+    // -q is the same attitude as q; the long way round would pass through
+    // a yaw of 180 degrees.
+    AttitudeHistory history{config()};
+    history.add(0, yawed(-10));
+    history.add(20 * ms, negated(yawed(10)));
+
+    Quaternion q;
+    ASSERT_TRUE(history.lookup(10 * ms, q));
+    EXPECT_NEAR(AttitudeHistory::to_euler(q).yaw_deg, 0, 1e-3);
+
+}
+
+TEST(AttitudeHistoryTest, BlendsNearlyParallelSamples) {
+
+    AttitudeHistory history{config()};
+    history.add(0, yawed(1));
+    history.add(20 * ms, yawed(1.1));
+
+    Quaternion q;
+    ASSERT_TRUE(history.lookup(10 * ms, q));
+    EXPECT_NEAR(AttitudeHistory::to_euler(q).yaw_deg, 1.05, 1e-3);
+
+}
+
+TEST(AttitudeHistoryTest, TimesOutsideTheHistoryOrInAGapAreNotFound) {
+
+    AttitudeHistory history{config()};
+    history.add(100 * ms, yawed(0));
+    history.add(150 * ms, yawed(0));
+    history.add(300 * ms, yawed(0));
+
+    Quaternion q;
+    EXPECT_FALSE(history.lookup(99 * ms, q));
+    EXPECT_FALSE(history.lookup(301 * ms, q));
+    EXPECT_TRUE(history.lookup(120 * ms, q));
+
+    // Longer than the 100 ms max_gap.
+    EXPECT_FALSE(history.lookup(200 * ms, q));
+
+}
+
+TEST(AttitudeHistoryTest, IgnoresSamplesThatAreNotNewer) {
+
+    AttitudeHistory history{config()};
+    history.add(20 * ms, yawed(20));
+    history.add(20 * ms, yawed(50));
+    history.add(10 * ms, yawed(10));
+
+    Quaternion q;
+    EXPECT_FALSE(history.lookup(10 * ms, q));
+    ASSERT_TRUE(history.lookup(20 * ms, q));
+    EXPECT_NEAR(AttitudeHistory::to_euler(q).yaw_deg, 20, 1e-3);
+
+}
+
+TEST(AttitudeHistoryTest, OldestSamplesAreOverwritten) {
+
+    // Rounded up to 4.
+    AttitudeHistory history{config(3)};
+    for (uint64_t i = 1; i <= 6; i++) {
+        history.add(i * 10 * ms, yawed(static_cast<double>(i)));
+    }
+
+    Quaternion q;
+    EXPECT_FALSE(history.lookup(20 * ms, q));
+    ASSERT_TRUE(history.lookup(30 * ms, q));
+    EXPECT_NEAR(AttitudeHistory::to_euler(q).yaw_deg, 3, 1e-3);
+    ASSERT_TRUE(history.lookup(55 * ms, q));
+    EXPECT_NEAR(AttitudeHistory::to_euler(q).yaw_deg, 5.5, 1e-3);
+
+}
+
+TEST(AttitudeHistoryTest, LooksUpManyTimesAtOnce) {
+
+    AttitudeHistory history{config()};
+    for (uint64_t i = 0; i < 10; i++) {
+        history.add(i * 10 * ms, yawed(static_cast<double>(i * 10)));
+    }
+
+    // Out of order on purpose, and one time past the newest sample.
+    uint64_t times[] = {5 * ms, 45 * ms, 15 * ms, 95 * ms, 90 * ms};
+    bool found[5];
+    float w[5], x[5], y[5], z[5];
+    EXPECT_EQ(history.lookup(times, 5, {found, w, x, y, z}), 4u);
+
+    double expected[] = {5, 45, 15, 0, 90};
+    for (std::size_t i = 0; i < 5; i++) {
+        EXPECT_EQ(found[i], i != 3) << i;
+        if (found[i]) {
+            Quaternion q{w[i], x[i], y[i], z[i]};
+            EXPECT_NEAR(AttitudeHistory::to_euler(q).yaw_deg, expected[i], 1e-3) << i;
+        } else {
+            EXPECT_EQ(w[i], 0);
+        }
+    }
+
+}
+
+TEST(AttitudeHistoryTest, ConvertsToEulerAngles) {
+
+    // 30 degrees of pitch.
+    Quaternion q;
+    q.w = static_cast<float>(std::cos(M_PI / 12));
+    q.y = static_cast<float>(std::sin(M_PI / 12));
+    q.timestamp_us = 42;
+
+    auto angle = AttitudeHistory::to_euler(q);
+    EXPECT_NEAR(angle.roll_deg, 0, 1e-3);
+    EXPECT_NEAR(angle.pitch_deg, 30, 1e-3);
+    EXPECT_NEAR(angle.yaw_deg, 0, 1e-3);
+    EXPECT_EQ(angle.timestamp_us, 42u);
+
+}
@@ -0,0 +1,274 @@
+#include "command_scheduler.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace {
+
+using Result = mavsdk::Gimbal::Result;
+using Outcome = CommandScheduler::Outcome;
+using Priority = CommandScheduler::Priority;
+
+// Commands that note their name when they run.
+class Log final {
+
+public:
+
+    CommandScheduler::Command command(std::string name) {
+        return [this, name] {
+            std::lock_guard<std::mutex> lock(mutex);
+            names.push_back(name);
+            return Result::Success;
+        };
+    }
+
+    std::vector<std::string> ran() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return names;
+    }
+
+private:
+
+    std::mutex mutex;
+    std::vector<std::string> names;
+
+};
+
+// A control command that keeps the dispatcher busy until opened, so that
+// what is submitted meanwhile is queued together.
+class Gate final {
+
+public:
+
+    explicit Gate(CommandScheduler &scheduler) {
+        done = scheduler.submit(Priority::Control, [this] {
+            started.set_value();
+            opened.get_future().wait();
+            return Result::Success;
+        });
+        started.get_future().wait();
+    }
+
+    void open() {
+        opened.set_value();
+        EXPECT_EQ(done.get().outcome, Outcome::Completed);
+    }
+
+private:
+
+    std::promise<void> started;
+    std::promise<void> opened;
+    std::future<CommandScheduler::Completion> done;
+
+};
+
+}
+
+TEST(CommandSchedulerTest, RunsCommandsAndReportsTheirResult) {
+
+    CommandScheduler scheduler;
+
+    auto done = scheduler.submit(Priority::Setpoint, [] { return Result::Timeout; });
+    auto completion = done.get();
+    EXPECT_EQ(completion.outcome, Outcome::Completed);
+    EXPECT_EQ(completion.result, Result::Timeout);
+
+}
+
+TEST(CommandSchedulerTest, ControlGoesAheadOfQueuedSetpoints) {
+
+    Log log;
+    CommandScheduler scheduler;
+    Gate gate{scheduler};
+
+    auto first = scheduler.submit(Priority::Setpoint, log.command("setpoint 1"));
+    auto second = scheduler.submit(Priority::Setpoint, log.command("setpoint 2"));
+    auto control = scheduler.submit(Priority::Control, log.command("control"));
+    gate.open();
+
+    EXPECT_EQ(first.get().outcome, Outcome::Completed);
+    EXPECT_EQ(second.get().outcome, Outcome::Completed);
+    EXPECT_EQ(control.get().outcome, Outcome::Completed);
+    EXPECT_EQ(log.ran(), (std::vector<std::string>{"control", "setpoint 1", "setpoint 2"}));
+    EXPECT_EQ(scheduler.stats().preemptions, 1u);
+
+}
+
+TEST(CommandSchedulerTest, ControlCommandsKeepTheirOrder) {
+
+    Log log;
+    CommandScheduler scheduler;
+    Gate gate{scheduler};
+
+    auto first = scheduler.submit(Priority::Control, log.command("control 1"));
+    auto second = scheduler.submit(Priority::Control, log.command("control 2"));
+    gate.open();
+
+    first.get();
+    second.get();
+    EXPECT_EQ(log.ran(), (std::vector<std::string>{"control 1", "control 2"}));
+
+}
+
+TEST(CommandSchedulerTest, FullSetpointQueueSupersedesTheOldest) {
+
+    Log log;
+    CommandScheduler scheduler{2};
+    Gate gate{scheduler};
+
+    auto first = scheduler.submit(Priority::Setpoint, log.command("setpoint 1"));
+    auto second = scheduler.submit(Priority::Setpoint, log.command("setpoint 2"));
+    auto third = scheduler.submit(Priority::Setpoint, log.command("setpoint 3"));
+    gate.open();
+
+    EXPECT_EQ(first.get().outcome, Outcome::Superseded);
+    EXPECT_EQ(second.get().outcome, Outcome::Completed);
+    EXPECT_EQ(third.get().outcome, Outcome::Completed);
+    EXPECT_EQ(log.ran(), (std::vector<std::string>{"setpoint 2", "setpoint 3"}));
+    EXPECT_EQ(scheduler.stats().setpoints_superseded, 1u);
+
+}
+
+TEST(CommandSchedulerTest, SetpointsHeldBackByTheLinkSendOnlyTheNewest) {
+
+    Log log;
+    std::atomic<bool> ready{false};
+    CommandScheduler scheduler{4, 256, [&ready] { return ready.load(); }};
+
+    auto first = scheduler.submit(Priority::Setpoint, log.command("setpoint 1"));
+    auto second = scheduler.submit(Priority::Setpoint, log.command("setpoint 2"));
+
+    // Control commands are not held back.
+    auto control = scheduler.submit(Priority::Control, log.command("control"));
+    EXPECT_EQ(control.get().outcome, Outcome::Completed);
+
+    while (scheduler.stats().setpoint_waits == 0) {
+        std::this_thread::yield();
+    }
+    ready = true;
+    scheduler.wake();
+
+    EXPECT_EQ(first.get().outcome, Outcome::Superseded);
+    EXPECT_EQ(second.get().outcome, Outcome::Completed);
+    EXPECT_EQ(log.ran(), (std::vector<std::string>{"control", "setpoint 2"}));
+
+}
+
+TEST(CommandSchedulerTest, HeldSetpointsRunInApplyTimeOrder) {
+
+    Log log;
+    CommandScheduler scheduler;
+
+    auto now = std::chrono::steady_clock::now();
+    std::vector<std::pair<std::chrono::steady_clock::time_point, std::future<CommandScheduler::Completion>>> held;
+    for (auto [name, delay] : {std::pair{"third", 60}, std::pair{"first", 20}, std::pair{"second", 40}}) {
+        auto apply_at = now + std::chrono::milliseconds(delay);
+        auto command = [&log, name = std::string(name), apply_at] {
+            EXPECT_GE(std::chrono::steady_clock::now(), apply_at) << name;
+            return log.command(name)();
+        };
+        held.emplace_back(apply_at, scheduler.submit(Priority::Setpoint, command, apply_at));
+    }
+
+    // Held setpoints are not waiting on the link yet.
+    EXPECT_EQ(scheduler.load().backlog, 0u);
+
+    for (auto &[apply_at, done] : held) {
+        EXPECT_EQ(done.get().outcome, Outcome::Completed);
+    }
+    EXPECT_EQ(log.ran(), (std::vector<std::string>{"first", "second", "third"}));
+    EXPECT_EQ(scheduler.stats().setpoints_held, 3u);
+
+}
+
+TEST(CommandSchedulerTest, PastApplyTimeRunsRightAway) {
+
+    CommandScheduler scheduler;
+
+    auto apply_at = std::chrono::steady_clock::now() - std::chrono::milliseconds(1);
+    auto done = scheduler.submit(Priority::Setpoint, [] { return Result::Success; }, apply_at);
+    EXPECT_EQ(done.get().outcome, Outcome::Completed);
+    EXPECT_EQ(scheduler.stats().setpoints_late, 1u);
+    EXPECT_EQ(scheduler.stats().setpoints_held, 0u);
+
+}
+
+TEST(CommandSchedulerTest, HeldSetpointsBeyondCapacityAreRejected) {
+
+    auto scheduler = std::make_unique<CommandScheduler>(4, 2);
+
+    auto apply_at = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    auto first = scheduler->submit(Priority::Setpoint, [] { return Result::Success; }, apply_at);
+    auto second = scheduler->submit(Priority::Setpoint, [] { return Result::Success; }, apply_at);
+    auto third = scheduler->submit(Priority::Setpoint, [] { return Result::Success; }, apply_at);
+
+    EXPECT_EQ(third.get().outcome, Outcome::Rejected);
+    EXPECT_EQ(scheduler->stats().setpoints_rejected, 1u);
+
+    // Those still held when the scheduler stops never run.
+    scheduler.reset();
+    EXPECT_EQ(first.get().outcome, Outcome::Shutdown);
+    EXPECT_EQ(second.get().outcome, Outcome::Shutdown);
+
+}
+
+TEST(CommandSchedulerTest, AsyncCommandsCompleteThroughTheirCallback) {
+
+    CommandScheduler scheduler;
+
+    CommandScheduler::Done finish;
+    std::promise<void> sent;
+    auto done = scheduler.submit_async(Priority::Control, [&finish, &sent](CommandScheduler::Done command_done) {
+        finish = std::move(command_done);
+        sent.set_value();
+    });
+    sent.get_future().wait();
+
+    // The dispatcher is free again while the command is on the link.
+    EXPECT_EQ(scheduler.submit(Priority::Control, [] { return Result::Success; }).get().outcome,
+              Outcome::Completed);
+    EXPECT_EQ(scheduler.load().backlog, 1u);
+
+    finish(Result::Error);
+    auto completion = done.get();
+    EXPECT_EQ(completion.outcome, Outcome::Completed);
+    EXPECT_EQ(completion.result, Result::Error);
+    EXPECT_EQ(scheduler.load().backlog, 0u);
+
+}
+
+TEST(CommandSchedulerTest, QueuedCommandsCompleteOnShutdown) {
+
+    std::promise<void> started;
+    std::promise<void> opened;
+    std::thread opener;
+    std::future<CommandScheduler::Completion> queued;
+    {
+        CommandScheduler scheduler;
+        auto running = scheduler.submit(Priority::Control, [&started, &opened] {
+            started.set_value();
+            opened.get_future().wait();
+            return Result::Success;
+        });
+        started.get_future().wait();
+        queued = scheduler.submit(Priority::Setpoint, [] { return Result::Success; });
+
+        // Opened once the destructor has asked the dispatcher to stop.
+        opener = std::thread([&opened] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            opened.set_value();
+        });
+    }
+    opener.join();
+
+    EXPECT_EQ(queued.get().outcome, Outcome::Shutdown);
+
+}
@@ -0,0 +1,175 @@
+#include "jitter_buffer.h"
+
+#include <chrono>
+#include <string>
+#include <gtest/gtest.h>
+
+namespace {
+
+using Sample = JitterBuffer::Sample;
+
+// Samples are sent at their own time and arrive 5 ms later, unless a test
+// says otherwise. With the default 20 ms minimum delay, playout at local
+// time ms is at sender time ms - 25.
+const std::chrono::steady_clock::time_point start{std::chrono::seconds(1000)};
+
+std::chrono::steady_clock::time_point at(int ms) {
+    return start + std::chrono::milliseconds(ms);
+}
+
+Sample angle(int ms, float pitch, float yaw = 0) {
+    return {static_cast<uint64_t>(ms) * 1000, false, pitch, yaw};
+}
+
+Sample rate(int ms, float pitch, float yaw = 0) {
+    return {static_cast<uint64_t>(ms) * 1000, true, pitch, yaw};
+}
+
+double metric(const JitterBuffer::Totals &totals, const std::string &name) {
+    MetricsRegistry registry;
+    totals.register_metrics(registry);
+    for (const auto &sample : registry.snapshot()) {
+        if (sample.name == name) {
+            return sample.value;
+        }
+    }
+    ADD_FAILURE() << "no metric " << name;
+    return 0;
+}
+
+}
+
+TEST(JitterBufferTest, WaitsForThePlayoutDelay) {
+
+    JitterBuffer::Totals totals;
+    JitterBuffer buffer{{}, totals};
+    buffer.push(angle(0, 10), at(5));
+
+    Sample out;
+    EXPECT_FALSE(buffer.play(at(20), out));
+    ASSERT_TRUE(buffer.play(at(25), out));
+    EXPECT_FALSE(out.rate);
+    EXPECT_FLOAT_EQ(out.pitch, 10);
+    EXPECT_EQ(out.time_us, 0u);
+
+}
+
+TEST(JitterBufferTest, InterpolatesBetweenSamples) {
+
+    JitterBuffer::Totals totals;
+    JitterBuffer buffer{{}, totals};
+    for (int ms = 0; ms <= 40; ms += 20) {
+        buffer.push(angle(ms, static_cast<float>(ms), static_cast<float>(-ms)), at(ms + 5));
+    }
+
+    Sample out;
+    ASSERT_TRUE(buffer.play(at(35), out));
+    EXPECT_FLOAT_EQ(out.pitch, 10);
+    EXPECT_FLOAT_EQ(out.yaw, -10);
+    ASSERT_TRUE(buffer.play(at(55), out));
+    EXPECT_FLOAT_EQ(out.pitch, 30);
+    EXPECT_FLOAT_EQ(out.yaw, -30);
+    EXPECT_EQ(metric(totals, "jitter.depth"), 1);
+
+}
+
+TEST(JitterBufferTest, ExtrapolatesAcrossAShortGapThenHoldsAnAngle) {
+
+    JitterBuffer::Totals totals;
+    JitterBuffer buffer{{}, totals};
+    buffer.push(angle(0, 0), at(5));
+    buffer.push(angle(20, 20), at(25));
+
+    // 30 ms past the newest sample, within the 100 ms allowed.
+    Sample out;
+    ASSERT_TRUE(buffer.play(at(75), out));
+    EXPECT_FLOAT_EQ(out.pitch, 50);
+    EXPECT_EQ(metric(totals, "jitter.extrapolated"), 1);
+
+    // Past it the angle stays where extrapolation left off, which is no
+    // new output.
+    EXPECT_FALSE(buffer.play(at(200), out));
+    EXPECT_FLOAT_EQ(out.pitch, 50);
+    EXPECT_EQ(metric(totals, "jitter.underruns"), 1);
+
+}
+
+TEST(JitterBufferTest, RateDropsToZeroAfterAGap) {
+
+    JitterBuffer::Totals totals;
+    JitterBuffer buffer{{}, totals};
+    buffer.push(rate(0, 5, -5), at(5));
+    buffer.push(rate(20, 5, -5), at(25));
+
+    Sample out;
+    ASSERT_TRUE(buffer.play(at(45), out));
+    EXPECT_TRUE(out.rate);
+    EXPECT_FLOAT_EQ(out.pitch, 5);
+
+    ASSERT_TRUE(buffer.play(at(200), out));
+    EXPECT_TRUE(out.rate);
+    EXPECT_FLOAT_EQ(out.pitch, 0);
+    EXPECT_FLOAT_EQ(out.yaw, 0);
+    EXPECT_EQ(metric(totals, "jitter.underruns"), 1);
+
+}
+
+TEST(JitterBufferTest, ReorderedSamplesAreDropped) {
+
+    JitterBuffer::Totals totals;
+    JitterBuffer buffer{{}, totals};
+    buffer.push(angle(0, 0), at(5));
+    buffer.push(angle(40, 40), at(45));
+    buffer.push(angle(20, 100), at(46));
+
+    Sample out;
+    ASSERT_TRUE(buffer.play(at(45), out));
+    EXPECT_FLOAT_EQ(out.pitch, 20);
+    EXPECT_EQ(metric(totals, "jitter.samples"), 3);
+    EXPECT_EQ(metric(totals, "jitter.late_samples"), 1);
+
+}
+
+TEST(JitterBufferTest, ChangingBetweenAnglesAndRatesStartsOver) {
+
+    JitterBuffer::Totals totals;
+    JitterBuffer buffer{{}, totals};
+    buffer.push(angle(0, 30), at(5));
+    buffer.push(angle(20, 30), at(25));
+    buffer.push(rate(40, 2), at(45));
+
+    Sample out;
+    EXPECT_FALSE(buffer.play(at(45), out));
+    ASSERT_TRUE(buffer.play(at(65), out));
+    EXPECT_TRUE(out.rate);
+    EXPECT_FLOAT_EQ(out.pitch, 2);
+
+}
+
+TEST(JitterBufferTest, DelayFollowsTheTransitSpreadWithinBounds) {
+
+    JitterBuffer::Totals totals;
+    JitterBuffer buffer{{}, totals};
+
+    // Every other sample takes 40 ms longer.
+    for (int ms = 0; ms < 400; ms += 20) {
+        buffer.push(angle(ms, 0), at(ms + 5 + (ms % 40 == 0 ? 0 : 40)));
+    }
+    Sample out;
+    for (int tick = 0; tick < 200; tick++) {
+        buffer.play(at(400), out);
+    }
+    EXPECT_NEAR(metric(totals, "jitter.delay_ms"), 40, 1);
+
+    JitterBuffer::Config config;
+    config.max_delay = std::chrono::milliseconds(100);
+    JitterBuffer bounded{config, totals};
+    for (int ms = 0; ms < 400; ms += 20) {
+        bounded.push(angle(ms, 0), at(ms + 5 + (ms % 40 == 0 ? 0 : 300)));
+    }
+    for (int tick = 0; tick < 200; tick++) {
+        bounded.play(at(400), out);
+    }
+    EXPECT_NEAR(metric(totals, "jitter.delay_ms"), 100, 1);
+
+}
@@ -0,0 +1,209 @@
+#include "motion_profile.h"
+
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <gtest/gtest.h>
+
+namespace {
+
+using Shape = MotionProfile::Shape;
+
+constexpr double tolerance = 1e-6;
+
+double metric(const MotionProfile::Totals &totals, const std::string &name) {
+    MetricsRegistry registry;
+    totals.register_metrics(registry);
+    for (const auto &sample : registry.snapshot()) {
+        if (sample.name == name) {
+            return sample.value;
+        }
+    }
+    ADD_FAILURE() << "no metric " << name;
+    return 0;
+}
+
+// Walks the profile in small steps, checking it starts and ends at rest,
+// stays within the limits and has no jumps.
+void expect_within_limits(const MotionProfile &profile, const MotionProfile::Limits &limits, Shape shape) {
+
+    constexpr int steps = 10000;
+    auto dt = profile.duration() / steps;
+
+    auto previous = profile.at(0);
+    EXPECT_EQ(previous.position, 0);
+    EXPECT_EQ(previous.velocity, 0);
+
+    for (int i = 1; i <= steps; i++) {
+        auto point = profile.at(i * dt);
+        ASSERT_GE(point.position, previous.position - tolerance) << "t = " << i * dt;
+        ASSERT_LE(point.position - previous.position, limits.max_velocity * dt + tolerance) << "t = " << i * dt;
+        ASSERT_GE(point.velocity, -tolerance) << "t = " << i * dt;
+        ASSERT_LE(point.velocity, limits.max_velocity + tolerance) << "t = " << i * dt;
+        ASSERT_LE(std::abs(point.acceleration), limits.max_acceleration + tolerance) << "t = " << i * dt;
+        ASSERT_LE(std::abs(point.velocity - previous.velocity), limits.max_acceleration * dt + tolerance)
+                << "t = " << i * dt;
+        if (shape == Shape::SCurve) {
+            ASSERT_LE(std::abs(point.acceleration - previous.acceleration), limits.max_jerk * dt + tolerance)
+                    << "t = " << i * dt;
+        }
+        previous = point;
+    }
+
+    EXPECT_NEAR(previous.position, profile.distance(), tolerance);
+    EXPECT_NEAR(previous.velocity, 0, tolerance);
+
+}
+
+}
+
+TEST(MotionProfileTest, TrapezoidAcceleratesCruisesAndDecelerates) {
+
+    MotionProfile profile{Shape::Trapezoid, {10, 20, 0}, 100};
+
+    // 0.5 s to reach 10 covering 2.5, and the same to stop.
+    EXPECT_NEAR(profile.duration(), 10.5, tolerance);
+
+    auto accelerating = profile.at(0.25);
+    EXPECT_NEAR(accelerating.position, 0.625, tolerance);
+    EXPECT_NEAR(accelerating.velocity, 5, tolerance);
+    EXPECT_NEAR(accelerating.acceleration, 20, tolerance);
+
+    auto cruising = profile.at(5);
+    EXPECT_NEAR(cruising.position, 47.5, tolerance);
+    EXPECT_NEAR(cruising.velocity, 10, tolerance);
+    EXPECT_NEAR(cruising.acceleration, 0, tolerance);
+
+    auto decelerating = profile.at(10.25);
+    EXPECT_NEAR(decelerating.position, 100 - 0.625, tolerance);
+    EXPECT_NEAR(decelerating.velocity, 5, tolerance);
+    EXPECT_NEAR(decelerating.acceleration, -20, tolerance);
+
+}
+
+TEST(MotionProfileTest, ShortTrapezoidNeverCruises) {
+
+    MotionProfile profile{Shape::Trapezoid, {10, 20, 0}, 1};
+
+    EXPECT_NEAR(profile.duration(), 2 * std::sqrt(1.0 / 20), tolerance);
+    auto middle = profile.at(profile.duration() / 2);
+    EXPECT_NEAR(middle.position, 0.5, tolerance);
+    EXPECT_NEAR(middle.velocity, std::sqrt(20.0), tolerance);
+
+}
+
+TEST(MotionProfileTest, StaysWithinItsLimits) {
+
+    MotionProfile::Limits limits{30, 60, 240};
+    for (auto shape : {Shape::Trapezoid, Shape::SCurve}) {
+        // An S-curve reaches the velocity limit, only the acceleration
+        // limit, and neither.
+        for (double distance : {90.0, 20.0, 0.5}) {
+            SCOPED_TRACE(testing::Message() << (shape == Shape::SCurve ? "S-curve" : "trapezoid")
+                                            << " over " << distance);
+            MotionProfile profile{shape, limits, distance};
+            expect_within_limits(profile, limits, shape);
+        }
+    }
+
+}
+
+TEST(MotionProfileTest, SCurveReachesTheLimitsItHasRoomFor) {
+
+    MotionProfile::Limits limits{30, 60, 240};
+
+    MotionProfile cruising{Shape::SCurve, limits, 90};
+    EXPECT_NEAR(cruising.at(cruising.duration() / 2).velocity, 30, tolerance);
+
+    // 0.25 s of jerk reaches 60, the acceleration limit.
+    MotionProfile accelerating{Shape::SCurve, limits, 20};
+    EXPECT_NEAR(accelerating.at(0.25).acceleration, 60, tolerance);
+    EXPECT_LT(accelerating.at(accelerating.duration() / 2).velocity, 30);
+
+    MotionProfile jerking{Shape::SCurve, limits, 0.5};
+    for (int i = 0; i <= 100; i++) {
+        EXPECT_LT(jerking.at(jerking.duration() * i / 100).acceleration, 60);
+    }
+
+}
+
+TEST(MotionProfileTest, SCurveIsSymmetric) {
+
+    MotionProfile profile{Shape::SCurve, {30, 60, 240}, 45};
+
+    for (int i = 0; i <= 20; i++) {
+        auto t = profile.duration() * i / 20;
+        auto forward = profile.at(t);
+        auto backward = profile.at(profile.duration() - t);
+        EXPECT_NEAR(forward.position + backward.position, 45, tolerance) << "t = " << t;
+        EXPECT_NEAR(forward.velocity, backward.velocity, tolerance) << "t = " << t;
+    }
+
+}
+
+TEST(MotionProfileTest, NoDistanceIsNoMove) {
+
+    for (double distance : {0.0, -5.0}) {
+        MotionProfile profile{Shape::SCurve, {30, 60, 240}, distance};
+        EXPECT_EQ(profile.distance(), 0);
+        EXPECT_EQ(profile.duration(), 0);
+        EXPECT_EQ(profile.at(1).position, 0);
+    }
+
+}
+
+TEST(MotionProfileTest, StepperWalksTheMoveAtItsRate) {
+
+    MotionProfile::Totals totals;
+    MotionProfile profile{Shape::Trapezoid, {10, 20, 0}, 1};
+    {
+        MotionProfile::Stepper stepper{profile, 100, totals};
+        auto first_due = stepper.due();
+
+        int points = 0;
+        double position = 0;
+        while (!stepper.done()) {
+            auto point = stepper.next();
+            EXPECT_GE(point.position, position);
+            position = point.position;
+            points++;
+        }
+        EXPECT_EQ(points, static_cast<int>(std::ceil(profile.duration() * 100)));
+        EXPECT_EQ(position, 1);
+        EXPECT_GT(stepper.due(), first_due);
+        EXPECT_EQ(metric(totals, "profile.active_moves"), 1);
+    }
+
+    EXPECT_EQ(metric(totals, "profile.active_moves"), 0);
+    EXPECT_EQ(metric(totals, "profile.completed"), 1);
+
+    {
+        MotionProfile::Stepper stepper{profile, 100, totals};
+        stepper.next();
+    }
+    EXPECT_EQ(metric(totals, "profile.moves"), 2);
+    EXPECT_EQ(metric(totals, "profile.stopped"), 1);
+
+}
+
+TEST(MotionProfileTest, RunEndsAtTheDistanceOrWhenStopped) {
+
+    MotionProfile::Totals totals;
+    MotionProfile profile{Shape::SCurve, {30, 60, 240}, 0.05};
+
+    MotionProfile::Point last{};
+    EXPECT_TRUE(profile.run(500, totals, [&last](const MotionProfile::Point &point) {
+        last = point;
+        return true;
+    }));
+    EXPECT_NEAR(last.position, 0.05, tolerance);
+
+    int steps = 0;
+    EXPECT_FALSE(profile.run(500, totals, [&steps](const MotionProfile::Point &) {
+        return ++steps < 3;
+    }));
+    EXPECT_EQ(steps, 3);
+    EXPECT_EQ(metric(totals, "profile.completed"), 1);
+    EXPECT_EQ(metric(totals, "profile.stopped"), 1);
+
+}
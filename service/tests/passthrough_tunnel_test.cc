@@ -0,0 +1,133 @@
+#include "passthrough_tunnel.h"
+
+#include <chrono>
+#include <string>
+#include <gtest/gtest.h>
+
+namespace {
+
+using Session = PassthroughTunnel::Session;
+using Pushed = Session::Pushed;
+
+constexpr std::chrono::milliseconds no_wait{0};
+
+Pushed push(Session &session, uint32_t message_id, const std::string &frame) {
+    return session.push(message_id, reinterpret_cast<const uint8_t *>(frame.data()),
+                        static_cast<uint16_t>(frame.size()));
+}
+
+std::string framed(const std::string &frame) {
+    std::string batch;
+    batch.push_back(static_cast<char>(frame.size() & 0xff));
+    batch.push_back(static_cast<char>(frame.size() >> 8));
+    return batch + frame;
+}
+
+PassthroughTunnel::Config config(std::size_t max_batch_bytes, std::size_t max_pending_bytes) {
+    PassthroughTunnel::Config config;
+    config.batch_window = std::chrono::milliseconds(1);
+    config.max_batch_bytes = max_batch_bytes;
+    config.max_pending_bytes = max_pending_bytes;
+    return config;
+}
+
+}
+
+TEST(PassthroughTunnelTest, FramesArePrefixedWithTheirLittleEndianLength) {
+
+    auto tunnel_config = config(1024, 4096);
+    Session session{tunnel_config};
+    std::string long_frame(300, 'x');
+
+    EXPECT_EQ(push(session, 0, "abc"), Pushed::Queued);
+    EXPECT_EQ(push(session, 0, long_frame), Pushed::Queued);
+
+    std::string frames;
+    uint32_t dropped;
+    ASSERT_TRUE(session.next_batch(no_wait, frames, dropped));
+    EXPECT_EQ(frames, framed("abc") + framed(long_frame));
+    EXPECT_EQ(static_cast<uint8_t>(frames[5]), 300 & 0xff);
+    EXPECT_EQ(static_cast<uint8_t>(frames[6]), 300 >> 8);
+    EXPECT_EQ(dropped, 0u);
+
+}
+
+TEST(PassthroughTunnelTest, FilterPassesOnlyListedMessages) {
+
+    auto tunnel_config = config(1024, 4096);
+    Session session{tunnel_config};
+    session.set_filter({33, 0});
+
+    EXPECT_EQ(push(session, 0, "heartbeat"), Pushed::Queued);
+    EXPECT_EQ(push(session, 30, "attitude"), Pushed::Filtered);
+    EXPECT_EQ(push(session, 33, "position"), Pushed::Queued);
+
+    std::string frames;
+    uint32_t dropped;
+    ASSERT_TRUE(session.next_batch(no_wait, frames, dropped));
+    EXPECT_EQ(frames, framed("heartbeat") + framed("position"));
+
+}
+
+TEST(PassthroughTunnelTest, BatchesAreCutAtAFrameBoundary) {
+
+    auto tunnel_config = config(10, 4096);
+    Session session{tunnel_config};
+    std::string oversized(20, 'x');
+
+    push(session, 0, "aaaa");
+    push(session, 0, "bbbb");
+    push(session, 0, oversized);
+
+    std::string frames;
+    uint32_t dropped;
+    ASSERT_TRUE(session.next_batch(no_wait, frames, dropped));
+    EXPECT_EQ(frames, framed("aaaa"));
+    ASSERT_TRUE(session.next_batch(no_wait, frames, dropped));
+    EXPECT_EQ(frames, framed("bbbb"));
+
+    // A frame larger than a batch still goes, on its own.
+    ASSERT_TRUE(session.next_batch(no_wait, frames, dropped));
+    EXPECT_EQ(frames, framed(oversized));
+
+}
+
+TEST(PassthroughTunnelTest, FramesBeyondThePendingLimitAreDroppedAndCounted) {
+
+    auto tunnel_config = config(1024, 21);
+    Session session{tunnel_config};
+
+    EXPECT_EQ(push(session, 0, "aaaa"), Pushed::Queued);
+    EXPECT_EQ(push(session, 0, "bbbb"), Pushed::Queued);
+    EXPECT_EQ(push(session, 0, "cccc"), Pushed::Queued);
+    EXPECT_EQ(push(session, 0, "dddd"), Pushed::Dropped);
+    EXPECT_EQ(push(session, 0, "e"), Pushed::Queued);
+
+    std::string frames;
+    uint32_t dropped;
+    ASSERT_TRUE(session.next_batch(no_wait, frames, dropped));
+    EXPECT_EQ(frames, framed("aaaa") + framed("bbbb") + framed("cccc") + framed("e"));
+    EXPECT_EQ(dropped, 1u);
+
+    // The count is reported once.
+    push(session, 0, "ffff");
+    ASSERT_TRUE(session.next_batch(no_wait, frames, dropped));
+    EXPECT_EQ(dropped, 0u);
+
+}
+
+TEST(PassthroughTunnelTest, EmptyOnTimeoutAndFalseOnceClosed) {
+
+    auto tunnel_config = config(1024, 4096);
+    Session session{tunnel_config};
+
+    std::string frames = "stale";
+    uint32_t dropped;
+    EXPECT_TRUE(session.next_batch(std::chrono::milliseconds(1), frames, dropped));
+    EXPECT_TRUE(frames.empty());
+
+    session.close();
+    EXPECT_EQ(push(session, 0, "abc"), Pushed::Filtered);
+    EXPECT_FALSE(session.next_batch(std::chrono::milliseconds(1), frames, dropped));
+
+}
@@ -0,0 +1,51 @@
+#include "tracer.h"
+
+#include <gtest/gtest.h>
+
+TEST(TracerTest, ParsesHexTraceIds) {
+
+    EXPECT_EQ(Tracer::parse_trace_id("1f", false), 0x1fu);
+    EXPECT_EQ(Tracer::parse_trace_id("0x1F", false), 0x1fu);
+    EXPECT_EQ(Tracer::parse_trace_id("0XaBc", false), 0xabcu);
+    EXPECT_EQ(Tracer::parse_trace_id("ffffffffffffffff", false), 0xffffffffffffffffu);
+
+}
+
+TEST(TracerTest, RejectsMalformedHexTraceIds) {
+
+    EXPECT_EQ(Tracer::parse_trace_id("", false), 0u);
+    EXPECT_EQ(Tracer::parse_trace_id("0x", false), 0u);
+    EXPECT_EQ(Tracer::parse_trace_id("1ffffffffffffffff", false), 0u);
+    EXPECT_EQ(Tracer::parse_trace_id("12g4", false), 0u);
+    EXPECT_EQ(Tracer::parse_trace_id("-1", false), 0u);
+    EXPECT_EQ(Tracer::parse_trace_id(" 1f", false), 0u);
+
+}
+
+TEST(TracerTest, TakesTheLowHalfOfATraceparentTraceId) {
+
+    EXPECT_EQ(Tracer::parse_trace_id("00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01", true),
+              0xa3ce929d0e0e4736u);
+
+    // Later versions may append fields.
+    EXPECT_EQ(Tracer::parse_trace_id("01-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01-extra", true),
+              0xa3ce929d0e0e4736u);
+
+}
+
+TEST(TracerTest, RejectsMalformedTraceparents) {
+
+    // Too short.
+    EXPECT_EQ(Tracer::parse_trace_id("00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7", true), 0u);
+
+    // Fields in the wrong places.
+    EXPECT_EQ(Tracer::parse_trace_id("004bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01-", true), 0u);
+    EXPECT_EQ(Tracer::parse_trace_id("00-4bf92f3577b34da6a3ce929d0e0e47360-0f067aa0ba902b7-01", true), 0u);
+
+    // Not hex.
+    EXPECT_EQ(Tracer::parse_trace_id("00-4bf92f3577b34da6a3ce929d0e0e473z-00f067aa0ba902b7-01", true), 0u);
+
+    // A plain id is not a traceparent.
+    EXPECT_EQ(Tracer::parse_trace_id("1f", true), 0u);
+
+}
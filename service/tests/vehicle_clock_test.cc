@@ -0,0 +1,98 @@
+#include "vehicle_clock.h"
+
+#include <deque>
+#include <gtest/gtest.h>
+
+namespace {
+
+using Answer = VehicleClock::Answer;
+
+constexpr int64_t ms = 1000000;
+constexpr int64_t s = 1000 * ms;
+
+// Far enough from zero that the fit has to keep its sums small.
+constexpr int64_t boot = 1000000 * s;
+
+double offset_at(const VehicleClock::Line &line, int64_t local_ns) {
+    return line.offset_ns + line.slope * static_cast<double>(local_ns - line.local_ns);
+}
+
+}
+
+TEST(VehicleClockTest, FitsAConstantOffset) {
+
+    std::deque<Answer> answers;
+    for (int64_t i = 0; i < 10; i++) {
+        answers.push_back({boot + i * s, 3 * s, 2 * ms});
+    }
+
+    auto line = VehicleClock::fit(answers, 2.0);
+    EXPECT_DOUBLE_EQ(offset_at(line, boot), 3 * s);
+    EXPECT_DOUBLE_EQ(line.slope, 0);
+    EXPECT_DOUBLE_EQ(line.residual_ns, 0);
+    EXPECT_EQ(line.min_rtt_ns, 2 * ms);
+
+}
+
+TEST(VehicleClockTest, FollowsDrift) {
+
+    // The vehicle clock runs 20 ppm fast.
+    std::deque<Answer> answers;
+    for (int64_t i = 0; i < 32; i++) {
+        auto local = boot + i * s;
+        answers.push_back({local, -5 * s + i * 20000, 2 * ms});
+    }
+
+    auto line = VehicleClock::fit(answers, 2.0);
+    EXPECT_NEAR(line.slope, 20e-6, 1e-9);
+    EXPECT_NEAR(offset_at(line, boot), -5 * s, 1);
+    EXPECT_NEAR(offset_at(line, boot + 31 * s), -5 * s + 31 * 20000, 1);
+    EXPECT_LT(line.residual_ns, 1);
+
+}
+
+TEST(VehicleClockTest, IgnoresAnswersWithALongRoundTrip) {
+
+    // A slow answer is skewed by however the delay split between the two
+    // directions.
+    std::deque<Answer> answers;
+    for (int64_t i = 0; i < 8; i++) {
+        answers.push_back({boot + i * s, 7 * ms, 1 * ms});
+    }
+    answers.push_back({boot + 8 * s, 11 * ms, 10 * ms});
+    answers.push_back({boot + 9 * s, 7 * ms + 100000, 2 * ms});
+
+    auto line = VehicleClock::fit(answers, 2.0);
+    EXPECT_EQ(line.min_rtt_ns, 1 * ms);
+    EXPECT_LT(offset_at(line, boot + 9 * s), 7 * ms + 100000);
+    EXPECT_GT(offset_at(line, boot + 9 * s), 7 * ms);
+    EXPECT_LT(line.residual_ns, 100000);
+
+    // Within the tolerance, the slow answer pulls the fit.
+    auto tolerant = VehicleClock::fit(answers, 20.0);
+    EXPECT_GT(offset_at(tolerant, boot + 8 * s), offset_at(line, boot + 8 * s) + 100000);
+
+}
+
+TEST(VehicleClockTest, ClampsTheSlopeToPlausibleDrift) {
+
+    std::deque<Answer> answers;
+    for (int64_t i = 0; i < 4; i++) {
+        answers.push_back({boot + i * s, i * 10 * ms, 2 * ms});
+    }
+
+    auto line = VehicleClock::fit(answers, 2.0);
+    EXPECT_DOUBLE_EQ(line.slope, 500e-6);
+
+}
+
+TEST(VehicleClockTest, OneAnswerGivesItsOffset) {
+
+    std::deque<Answer> answers{{boot, -42 * ms, 3 * ms}};
+
+    auto line = VehicleClock::fit(answers, 2.0);
+    EXPECT_EQ(line.local_ns, boot);
+    EXPECT_DOUBLE_EQ(line.offset_ns, -42 * ms);
+    EXPECT_DOUBLE_EQ(line.slope, 0);
+
+}
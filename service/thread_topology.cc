@@ -0,0 +1,162 @@
+#include "thread_topology.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+long current_tid() {
+#ifdef __linux__
+    return static_cast<long>(syscall(SYS_gettid));
+#else
+    return 0;
+#endif
+}
+
+// Nanoseconds spent waiting on a run queue and number of timeslices run.
+bool read_schedstat(long tid, uint64_t &wait_ns, uint64_t &timeslices) {
+    std::ifstream schedstat("/proc/self/task/" + std::to_string(tid) + "/schedstat");
+    uint64_t run_ns;
+    return static_cast<bool>(schedstat >> run_ns >> wait_ns >> timeslices);
+}
+
+#ifdef __linux__
+// Number of threads in the process.
+long count_threads() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("Threads:", 0) == 0) {
+            return std::stol(line.substr(8));
+        }
+    }
+    return 0;
+}
+#endif
+
+}
+
+void ThreadTopology::adopt_io_thread(const std::string &name) {
+
+    apply(config.io, name);
+
+    Tracked tracked{name, current_tid(), 0, 0};
+    read_schedstat(tracked.tid, tracked.last_wait_ns, tracked.last_timeslices);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    threads.push_back(std::move(tracked));
+
+}
+
+void ThreadTopology::enter_grpc() {
+    apply(config.grpc, "grpc");
+}
+
+void ThreadTopology::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+
+#ifdef __linux__
+        // Totals over every thread of the service, MAVSDK's included, to
+        // compare serving modes by the cost of a call.
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) == 0) {
+            auto to_us = [](const timeval &time) {
+                return static_cast<double>(time.tv_sec) * 1e6 + static_cast<double>(time.tv_usec);
+            };
+            samples.push_back({"thread.process_cpu_us", to_us(usage.ru_utime) + to_us(usage.ru_stime)});
+            samples.push_back({"thread.process_voluntary_switches", static_cast<double>(usage.ru_nvcsw)});
+            samples.push_back({"thread.process_involuntary_switches", static_cast<double>(usage.ru_nivcsw)});
+        }
+        samples.push_back({"thread.process_threads", static_cast<double>(count_threads())});
+#endif
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto &thread : threads) {
+            uint64_t wait_ns, timeslices;
+            if (!read_schedstat(thread.tid, wait_ns, timeslices)) {
+                continue;
+            }
+
+            // Average wait per wakeup since the previous snapshot.
+            uint64_t woken = timeslices - thread.last_timeslices;
+            double average_us = woken > 0 ? static_cast<double>(wait_ns - thread.last_wait_ns) / woken / 1000.0 : 0;
+            thread.last_wait_ns = wait_ns;
+            thread.last_timeslices = timeslices;
+
+            samples.push_back({"thread." + thread.name + ".sched_wait_us_total", static_cast<double>(wait_ns) / 1000.0});
+            samples.push_back({"thread." + thread.name + ".sched_wait_avg_us", average_us});
+        }
+
+    });
+}
+
+std::vector<int> ThreadTopology::parse_cpu_list(const std::string &list) {
+
+    std::vector<int> cpus;
+    std::stringstream stream(list);
+    std::string range;
+
+    while (std::getline(stream, range, ',')) {
+        int first, last;
+        char dash;
+        std::stringstream parser(range);
+        if (!(parser >> first)) {
+            return {};
+        }
+        last = first;
+        if (parser >> dash && (dash != '-' || !(parser >> last))) {
+            return {};
+        }
+        if (first < 0 || last < first) {
+            return {};
+        }
+        for (int cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+
+    return cpus;
+
+}
+
+void ThreadTopology::apply(const Placement &placement, const std::string &name) {
+
+#ifdef __linux__
+    if (!placement.cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : placement.cpus) {
+            CPU_SET(cpu, &set);
+        }
+        int error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        if (error != 0) {
+            std::cerr << "Failed to pin " << name << " thread: " << strerror(error) << "\n";
+        }
+    }
+
+    if (placement.fifo_priority > 0) {
+        sched_param param{};
+        param.sched_priority = placement.fifo_priority;
+        int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (error != 0) {
+            // Usually EPERM: the service needs CAP_SYS_NICE or an rtprio limit.
+            std::cerr << "Failed to set SCHED_FIFO for " << name << " thread: " << strerror(error) << "\n";
+        }
+    }
+#else
+    if (!placement.cpus.empty() || placement.fifo_priority > 0) {
+        std::cerr << "Thread placement is not supported on this platform, ignoring it for " << name << "\n";
+    }
+#endif
+
+}
@@ -0,0 +1,70 @@
+#ifndef GIMBAL_MAVSDK_THREAD_TOPOLOGY_H
+#define GIMBAL_MAVSDK_THREAD_TOPOLOGY_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "metrics.h"
+
+// Where the latency-critical threads run.
+//
+// The MAVLink I/O path (the command sender, MAVSDK's receive thread and the
+// MAVSDK callback thread that hands telemetry to gRPC streams) can be pinned
+// to dedicated CPUs and run under SCHED_FIFO, while gRPC threads are kept on
+// other CPUs. Threads the service does not create itself are adopted the
+// first time they call into it.
+//
+// For every adopted thread the time it spent runnable but waiting for a CPU
+// is read from /proc and exported as its scheduling latency.
+class ThreadTopology final {
+
+public:
+
+    struct Placement {
+        std::vector<int> cpus; // Empty leaves the affinity unchanged
+        int fifo_priority = 0; // 1-99 to run under SCHED_FIFO, 0 to keep the default policy
+    };
+
+    struct Config {
+        Placement io;
+        Placement grpc;
+    };
+
+    explicit ThreadTopology(Config config) : config{std::move(config)} {}
+
+    ThreadTopology(const ThreadTopology &) = delete;
+    ThreadTopology &operator=(const ThreadTopology &) = delete;
+
+    // Applies the I/O placement to the calling thread and tracks it under name.
+    void adopt_io_thread(const std::string &name);
+
+    // Applies the gRPC placement to the calling thread. Threads it creates
+    // afterwards, such as the gRPC server's, inherit the placement.
+    void enter_grpc();
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+    // Parses a CPU list such as "2,3" or "4-7". Returns an empty list on error.
+    static std::vector<int> parse_cpu_list(const std::string &list);
+
+private:
+
+    struct Tracked {
+        std::string name;
+        long tid;
+        uint64_t last_wait_ns;
+        uint64_t last_timeslices;
+    };
+
+    static void apply(const Placement &placement, const std::string &name);
+
+    const Config config;
+
+    mutable std::mutex mutex;
+    mutable std::vector<Tracked> threads;
+
+};
+
+#endif // GIMBAL_MAVSDK_THREAD_TOPOLOGY_H
@@ -0,0 +1,100 @@
+#include "trace_interceptor.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+constexpr char trace_id_key[] = "x-trace-id";
+constexpr char traceparent_key[] = "traceparent";
+
+using Metadata = std::multimap<grpc::string_ref, grpc::string_ref>;
+
+uint64_t find_trace_id(const Metadata &metadata, const char *key, bool traceparent) {
+    auto found = metadata.find(key);
+    if (found == metadata.end()) {
+        return 0;
+    }
+    return Tracer::parse_trace_id(std::string(found->second.data(), found->second.size()), traceparent);
+}
+
+class TraceInterceptor final : public grpc::experimental::Interceptor {
+
+public:
+
+    explicit TraceInterceptor(const char *method) : method{method} {}
+
+    ~TraceInterceptor() override {
+        // Calls that end without a status, e.g. when cancelled.
+        if (!finished) {
+            Tracer::record(method, traced, started, Tracer::Clock::now());
+        }
+    }
+
+    void Intercept(grpc::experimental::InterceptorBatchMethods *methods) override {
+
+        using Hook = grpc::experimental::InterceptionHookPoints;
+
+        if (methods->QueryInterceptionHookPoint(Hook::POST_RECV_INITIAL_METADATA)) {
+            started = Tracer::Clock::now();
+            auto &metadata = *methods->GetRecvInitialMetadata();
+            auto trace = find_trace_id(metadata, trace_id_key, false);
+            if (trace == 0) {
+                trace = find_trace_id(metadata, traceparent_key, true);
+            }
+            if (trace == 0) {
+                trace = Tracer::new_trace();
+            }
+            traced = {trace, Tracer::new_track()};
+
+            // Handlers read the id back from the metadata, which refers to
+            // the text kept here for the rest of the call.
+            char hex[17];
+            snprintf(hex, sizeof(hex), "%016" PRIx64, trace);
+            trace_id = hex;
+            metadata.erase(trace_id_key);
+            metadata.emplace(trace_id_key, trace_id);
+        }
+        if (methods->QueryInterceptionHookPoint(Hook::PRE_SEND_INITIAL_METADATA)) {
+            methods->GetSendInitialMetadata()->emplace(trace_id_key, trace_id);
+        }
+        if (methods->QueryInterceptionHookPoint(Hook::POST_RECV_MESSAGE) && !received) {
+            received = true;
+            Tracer::record("grpc.receive", traced, started, Tracer::Clock::now());
+        }
+        if (methods->QueryInterceptionHookPoint(Hook::PRE_SEND_STATUS)) {
+            finished = true;
+            Tracer::record(method, traced, started, Tracer::Clock::now());
+        }
+        methods->Proceed();
+
+    }
+
+private:
+
+    const char *method; // Static in the generated service code
+    Tracer::Context traced{};
+    std::string trace_id;
+    Tracer::Clock::time_point started{};
+    bool received{false};
+    bool finished{false};
+
+};
+
+}
+
+grpc::experimental::Interceptor *TraceInterceptorFactory::CreateServerInterceptor(
+        grpc::experimental::ServerRpcInfo *info) {
+    if (!Tracer::enabled()) {
+        return nullptr;
+    }
+    return new TraceInterceptor(info->method());
+}
+
+Tracer::Context trace_of(const grpc::ServerContext &context) {
+    if (!Tracer::enabled()) {
+        return {};
+    }
+    return {find_trace_id(context.client_metadata(), trace_id_key, false), 0};
+}
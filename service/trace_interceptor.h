@@ -0,0 +1,25 @@
+#ifndef GIMBAL_MAVSDK_TRACE_INTERCEPTOR_H
+#define GIMBAL_MAVSDK_TRACE_INTERCEPTOR_H
+
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/server_interceptor.h>
+#include "tracer.h"
+
+// Starts a trace for every call while tracing is on. The trace id comes from
+// the call's x-trace-id or traceparent metadata, or is made up, and is left
+// in x-trace-id for the handler and sent back to the client. The call's
+// receipt and its whole length go on a track of its own.
+//
+// While tracing is off no interceptor is created for a call.
+class TraceInterceptorFactory final : public grpc::experimental::ServerInterceptorFactoryInterface {
+
+public:
+
+    grpc::experimental::Interceptor *CreateServerInterceptor(grpc::experimental::ServerRpcInfo *info) override;
+
+};
+
+// The context a handler traces a call under; empty unless the call is traced.
+Tracer::Context trace_of(const grpc::ServerContext &context);
+
+#endif // GIMBAL_MAVSDK_TRACE_INTERCEPTOR_H
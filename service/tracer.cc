@@ -0,0 +1,536 @@
+#include "tracer.h"
+
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+std::atomic<bool> Tracer::on{false};
+thread_local Tracer::Context Tracer::current_context{};
+
+// One thread's spans. Only the owning thread writes; an export reads
+// alongside it, seqlock style: begun moves before a slot is written and head
+// after, so a reader can tell which of the slots it copied may have changed
+// under it.
+struct Tracer::Ring {
+
+    struct Slot {
+        std::atomic<const char *> name;
+        std::atomic<uint64_t> trace;
+        std::atomic<uint64_t> track;
+        std::atomic<int64_t> start_ns;
+        std::atomic<int64_t> end_ns;
+    };
+
+    static constexpr uint64_t capacity = 4096;
+
+    void push(const char *name, uint64_t trace, uint64_t track, Clock::time_point start, Clock::time_point end) {
+
+        auto index = head.load(std::memory_order_relaxed);
+        begun.store(index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        auto &slot = slots[index % capacity];
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.trace.store(trace, std::memory_order_relaxed);
+        slot.track.store(track, std::memory_order_relaxed);
+        slot.start_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count(),
+                            std::memory_order_relaxed);
+        slot.end_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(end.time_since_epoch()).count(),
+                          std::memory_order_relaxed);
+        head.store(index + 1, std::memory_order_release);
+
+    }
+
+    std::array<Slot, capacity> slots{};
+    std::atomic<uint64_t> begun{0};
+    std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> cleared{0}; // Spans before this index were dropped by clear()
+    std::atomic<bool> retired{false}; // The thread has exited
+    long tid{0};
+    std::string thread_name;
+
+};
+
+namespace {
+
+// Rings of threads that have exited are kept for their spans, up to this
+// many; gRPC starts and stops threads as load changes.
+constexpr std::size_t max_retired_rings = 32;
+
+std::mutex rings_mutex;
+std::deque<std::shared_ptr<Tracer::Ring>> rings;
+
+std::atomic<uint64_t> next_trace{0};
+std::atomic<uint64_t> next_track{1};
+
+struct Event {
+    const char *name;
+    uint64_t trace;
+    uint64_t track; // 0 for a thread span
+    int64_t start_ns;
+    int64_t end_ns;
+    std::size_t thread; // Index into the exported rings
+};
+
+struct Thread {
+    long tid;
+    std::string name;
+};
+
+std::vector<std::shared_ptr<Tracer::Ring>> all_rings() {
+    std::lock_guard<std::mutex> lock(rings_mutex);
+    return {rings.begin(), rings.end()};
+}
+
+void collect(std::vector<Event> &events, std::vector<Thread> &threads) {
+
+    auto held = all_rings();
+    for (std::size_t t = 0; t < held.size(); t++) {
+        auto &ring = *held[t];
+        threads.push_back({ring.tid, ring.thread_name});
+
+        auto end = ring.head.load(std::memory_order_acquire);
+        auto first = std::max(end > Tracer::Ring::capacity ? end - Tracer::Ring::capacity : 0,
+                              ring.cleared.load(std::memory_order_acquire));
+        auto copied = events.size();
+        for (auto index = first; index < end; index++) {
+            auto &slot = ring.slots[index % Tracer::Ring::capacity];
+            events.push_back({slot.name.load(std::memory_order_relaxed), slot.trace.load(std::memory_order_relaxed),
+                              slot.track.load(std::memory_order_relaxed), slot.start_ns.load(std::memory_order_relaxed),
+                              slot.end_ns.load(std::memory_order_relaxed), t});
+        }
+
+        // A write under way, or finished since, may have replaced the oldest
+        // slots copied; they are left out.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        auto writing = ring.begun.load(std::memory_order_relaxed);
+        auto valid = writing > Tracer::Ring::capacity ? writing - Tracer::Ring::capacity : 0;
+        if (valid > first) {
+            auto stale = static_cast<std::ptrdiff_t>(std::min(valid, end) - first);
+            events.erase(events.begin() + static_cast<std::ptrdiff_t>(copied),
+                         events.begin() + static_cast<std::ptrdiff_t>(copied) + stale);
+        }
+    }
+
+}
+
+// Both formats are written as begin and end marks in time order. At equal
+// times ends go first, outer spans begin first and inner ones end first, so
+// that spans sharing a timestamp still nest.
+struct Mark {
+    int64_t time_ns;
+    bool begin;
+    const Event *event;
+};
+
+std::vector<Mark> in_time_order(const std::vector<Event> &events) {
+
+    std::vector<Mark> marks;
+    marks.reserve(events.size() * 2);
+    for (const auto &event : events) {
+        marks.push_back({event.start_ns, true, &event});
+        marks.push_back({event.end_ns, false, &event});
+    }
+    std::stable_sort(marks.begin(), marks.end(), [](const Mark &a, const Mark &b) {
+        if (a.time_ns != b.time_ns) {
+            return a.time_ns < b.time_ns;
+        }
+        if (a.begin != b.begin) {
+            return !a.begin;
+        }
+        auto a_length = a.event->end_ns - a.event->start_ns;
+        auto b_length = b.event->end_ns - b.event->start_ns;
+        return a.begin ? a_length > b_length : a_length < b_length;
+    });
+    return marks;
+
+}
+
+// Zero-length spans would end before they begin.
+void give_length(std::vector<Event> &events) {
+    for (auto &event : events) {
+        event.end_ns = std::max(event.end_ns, event.start_ns + 1);
+    }
+}
+
+void append_json_string(std::string &out, const char *value) {
+
+    out += '"';
+    for (const char *c = value; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            out += '\\';
+            out += *c;
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(*c));
+            out += escaped;
+        } else {
+            out += *c;
+        }
+    }
+    out += '"';
+
+}
+
+// The subset of the protobuf wire format a Perfetto trace needs.
+void put_varint(std::string &out, uint64_t value) {
+    while (value >= 0x80) {
+        out += static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+void put_uint(std::string &out, uint32_t field, uint64_t value) {
+    put_varint(out, field << 3);
+    put_varint(out, value);
+}
+
+void put_bytes(std::string &out, uint32_t field, const std::string &value) {
+    put_varint(out, (field << 3) | 2);
+    put_varint(out, value.size());
+    out += value;
+}
+
+// Field numbers from perfetto/protos/perfetto/trace.
+namespace perfetto {
+
+constexpr uint32_t trace_packet = 1;            // Trace
+
+constexpr uint32_t packet_timestamp = 8;        // TracePacket
+constexpr uint32_t packet_sequence_id = 10;
+constexpr uint32_t packet_track_event = 11;
+constexpr uint32_t packet_sequence_flags = 13;
+constexpr uint32_t packet_track_descriptor = 60;
+
+constexpr uint32_t event_debug_annotations = 4; // TrackEvent
+constexpr uint32_t event_type = 9;
+constexpr uint32_t event_track_uuid = 11;
+constexpr uint32_t event_name = 23;
+
+constexpr uint32_t annotation_uint_value = 3;   // DebugAnnotation
+constexpr uint32_t annotation_name = 10;
+
+constexpr uint32_t track_uuid = 1;              // TrackDescriptor
+constexpr uint32_t track_name = 2;
+constexpr uint32_t track_process = 3;
+constexpr uint32_t track_thread = 4;
+constexpr uint32_t track_parent_uuid = 5;
+
+constexpr uint32_t process_pid = 1;            // ProcessDescriptor
+constexpr uint32_t process_name = 6;
+
+constexpr uint32_t thread_pid = 1;             // ThreadDescriptor
+constexpr uint32_t thread_tid = 2;
+constexpr uint32_t thread_name = 5;
+
+constexpr uint64_t slice_begin = 1;
+constexpr uint64_t slice_end = 2;
+constexpr uint64_t incremental_state_cleared = 1;
+
+constexpr uint32_t sequence_id = 1;
+
+// Track uuids, apart from the process's.
+constexpr uint64_t process_uuid = 1;
+constexpr uint64_t thread_uuid_base = 1ull << 32;
+constexpr uint64_t track_uuid_base = 1ull << 48;
+
+}
+
+void put_packet(std::string &out, const std::string &packet) {
+    put_bytes(out, perfetto::trace_packet, packet);
+}
+
+}
+
+Tracer::Ring &Tracer::ring() {
+
+    // Registers the thread's ring on its first span, and retires it when
+    // the thread exits.
+    struct Owner {
+        Owner() : ring{std::make_shared<Ring>()} {
+            ring->tid = static_cast<long>(syscall(SYS_gettid));
+            char name[16] = {};
+            pthread_getname_np(pthread_self(), name, sizeof(name));
+            ring->thread_name = name;
+
+            std::lock_guard<std::mutex> lock(rings_mutex);
+            auto retired = static_cast<std::size_t>(std::count_if(rings.begin(), rings.end(), [](const auto &held) {
+                return held->retired.load(std::memory_order_relaxed);
+            }));
+            if (retired >= max_retired_rings) {
+                rings.erase(std::find_if(rings.begin(), rings.end(), [](const auto &held) {
+                    return held->retired.load(std::memory_order_relaxed);
+                }));
+            }
+            rings.push_back(ring);
+        }
+
+        ~Owner() {
+            ring->retired = true;
+        }
+
+        std::shared_ptr<Ring> ring;
+    };
+
+    thread_local Owner owner;
+    return *owner.ring;
+
+}
+
+void Tracer::Span::start(const char *span_name, uint64_t span_trace) {
+    if (span_trace == 0) {
+        return;
+    }
+    name = span_name;
+    trace = span_trace;
+    started = Clock::now();
+}
+
+void Tracer::Span::finish() {
+    ring().push(name, trace, 0, started, Clock::now());
+}
+
+void Tracer::enable(bool enabled) {
+    on.store(enabled, std::memory_order_relaxed);
+}
+
+uint64_t Tracer::new_trace() {
+
+    // splitmix64 over a counter, so ids from separate runs rarely collide.
+    static const uint64_t seed = static_cast<uint64_t>(Clock::now().time_since_epoch().count());
+    uint64_t z = seed + 0x9e3779b97f4a7c15ull * (next_trace.fetch_add(1, std::memory_order_relaxed) + 1);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    z ^= z >> 31;
+    return z != 0 ? z : 1;
+
+}
+
+uint64_t Tracer::new_track() {
+    return next_track.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Tracer::record(const char *name, Context context, Clock::time_point start, Clock::time_point end) {
+    if (!enabled() || context.trace == 0 || context.track == 0) {
+        return;
+    }
+    ring().push(name, context.trace, context.track, start, end);
+}
+
+uint64_t Tracer::parse_trace_id(const std::string &value, bool traceparent) {
+
+    // traceparent is version-traceid-parentid-flags with a 128-bit trace id;
+    // its low 64 bits are used.
+    std::string hex = value;
+    if (traceparent) {
+        if (value.size() < 55 || value[2] != '-' || value[35] != '-') {
+            return 0;
+        }
+        hex = value.substr(19, 16);
+    } else if (hex.rfind("0x", 0) == 0 || hex.rfind("0X", 0) == 0) {
+        hex = hex.substr(2);
+    }
+    if (hex.empty() || hex.size() > 16) {
+        return 0;
+    }
+
+    uint64_t id = 0;
+    for (char c : hex) {
+        int digit;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        } else {
+            return 0;
+        }
+        id = (id << 4) | static_cast<uint64_t>(digit);
+    }
+    return id;
+
+}
+
+Tracer::Stats Tracer::stats() {
+
+    Stats stats{};
+    for (const auto &ring : all_rings()) {
+        auto head = ring->head.load(std::memory_order_acquire);
+        auto first = std::max(head > Ring::capacity ? head - Ring::capacity : 0,
+                              ring->cleared.load(std::memory_order_acquire));
+        stats.spans += head - std::min(first, head);
+        stats.overwritten += head > Ring::capacity ? head - Ring::capacity : 0;
+        stats.threads++;
+    }
+    return stats;
+
+}
+
+void Tracer::register_metrics(MetricsRegistry &registry) {
+    registry.add_collector([](std::vector<MetricsRegistry::Sample> &samples) {
+        auto s = stats();
+        samples.push_back({"trace.enabled", enabled() ? 1.0 : 0.0});
+        samples.push_back({"trace.spans", static_cast<double>(s.spans)});
+        samples.push_back({"trace.overwritten", static_cast<double>(s.overwritten)});
+        samples.push_back({"trace.threads", static_cast<double>(s.threads)});
+    });
+}
+
+std::string Tracer::chrome_json() {
+
+    std::vector<Event> events;
+    std::vector<Thread> threads;
+    collect(events, threads);
+    give_length(events);
+
+    auto pid = static_cast<long>(getpid());
+    std::string out;
+    out.reserve(events.size() * 160 + 256);
+    out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    char line[256];
+    bool first = true;
+    auto separate = [&out, &first] {
+        if (!first) {
+            out += ",\n";
+        }
+        first = false;
+    };
+
+    for (const auto &thread : threads) {
+        separate();
+        snprintf(line, sizeof(line), R"({"ph":"M","name":"thread_name","pid":%ld,"tid":%ld,"args":{"name":)",
+                 pid, thread.tid);
+        out += line;
+        append_json_string(out, thread.name.c_str());
+        out += "}}";
+    }
+
+    // Thread spans as complete events; track spans as async begin and end
+    // pairs, one async track per id.
+    for (const auto &mark : in_time_order(events)) {
+        const auto &event = *mark.event;
+        if (event.track == 0 && !mark.begin) {
+            continue;
+        }
+        separate();
+        out += R"({"name":)";
+        append_json_string(out, event.name);
+        if (event.track == 0) {
+            snprintf(line, sizeof(line),
+                     R"(,"cat":"gimbal","ph":"X","pid":%ld,"tid":%ld,"ts":%.3f,"dur":%.3f,"args":{"trace_id":"%016)"
+                     PRIx64 R"("}})",
+                     pid, threads[event.thread].tid, static_cast<double>(event.start_ns) / 1e3,
+                     static_cast<double>(event.end_ns - event.start_ns) / 1e3, event.trace);
+        } else {
+            snprintf(line, sizeof(line),
+                     R"(,"cat":"gimbal","ph":"%s","id":"0x%)" PRIx64 R"(","pid":%ld,"tid":%ld,"ts":%.3f,)"
+                     R"("args":{"trace_id":"%016)" PRIx64 R"("}})",
+                     mark.begin ? "b" : "e", event.track, pid, threads[event.thread].tid,
+                     static_cast<double>(mark.time_ns) / 1e3, event.trace);
+        }
+        out += line;
+    }
+
+    out += "\n]}\n";
+    return out;
+
+}
+
+std::string Tracer::perfetto_proto() {
+
+    std::vector<Event> events;
+    std::vector<Thread> threads;
+    collect(events, threads);
+    give_length(events);
+
+    auto pid = static_cast<uint64_t>(getpid());
+    std::string out;
+    out.reserve(events.size() * 96 + 1024);
+
+    // Descriptors first: the process, its threads and a track per call or
+    // command, named after its trace id so the tracks of a call sort together.
+    {
+        std::string process;
+        put_uint(process, perfetto::process_pid, pid);
+        put_bytes(process, perfetto::process_name, "gimbal_mavsdk");
+        std::string track;
+        put_uint(track, perfetto::track_uuid, perfetto::process_uuid);
+        put_bytes(track, perfetto::track_process, process);
+        std::string packet;
+        put_uint(packet, perfetto::packet_sequence_id, perfetto::sequence_id);
+        put_uint(packet, perfetto::packet_sequence_flags, perfetto::incremental_state_cleared);
+        put_bytes(packet, perfetto::packet_track_descriptor, track);
+        put_packet(out, packet);
+    }
+    for (std::size_t t = 0; t < threads.size(); t++) {
+        std::string thread;
+        put_uint(thread, perfetto::thread_pid, pid);
+        put_uint(thread, perfetto::thread_tid, static_cast<uint64_t>(threads[t].tid));
+        put_bytes(thread, perfetto::thread_name, threads[t].name);
+        std::string track;
+        put_uint(track, perfetto::track_uuid, perfetto::thread_uuid_base + t);
+        put_uint(track, perfetto::track_parent_uuid, perfetto::process_uuid);
+        put_bytes(track, perfetto::track_thread, thread);
+        std::string packet;
+        put_uint(packet, perfetto::packet_sequence_id, perfetto::sequence_id);
+        put_bytes(packet, perfetto::packet_track_descriptor, track);
+        put_packet(out, packet);
+    }
+    std::vector<uint64_t> described;
+    for (const auto &event : events) {
+        if (event.track == 0 || std::find(described.begin(), described.end(), event.track) != described.end()) {
+            continue;
+        }
+        described.push_back(event.track);
+        char name[40];
+        snprintf(name, sizeof(name), "trace %016" PRIx64, event.trace);
+        std::string track;
+        put_uint(track, perfetto::track_uuid, perfetto::track_uuid_base + event.track);
+        put_uint(track, perfetto::track_parent_uuid, perfetto::process_uuid);
+        put_bytes(track, perfetto::track_name, name);
+        std::string packet;
+        put_uint(packet, perfetto::packet_sequence_id, perfetto::sequence_id);
+        put_bytes(packet, perfetto::packet_track_descriptor, track);
+        put_packet(out, packet);
+    }
+
+    for (const auto &mark : in_time_order(events)) {
+        const auto &event = *mark.event;
+        std::string track_event;
+        put_uint(track_event, perfetto::event_type, mark.begin ? perfetto::slice_begin : perfetto::slice_end);
+        put_uint(track_event, perfetto::event_track_uuid,
+                 event.track == 0 ? perfetto::thread_uuid_base + event.thread : perfetto::track_uuid_base + event.track);
+        if (mark.begin) {
+            put_bytes(track_event, perfetto::event_name, event.name);
+            std::string annotation;
+            put_bytes(annotation, perfetto::annotation_name, "trace_id");
+            put_uint(annotation, perfetto::annotation_uint_value, event.trace);
+            put_bytes(track_event, perfetto::event_debug_annotations, annotation);
+        }
+        std::string packet;
+        put_uint(packet, perfetto::packet_timestamp, static_cast<uint64_t>(mark.time_ns));
+        put_uint(packet, perfetto::packet_sequence_id, perfetto::sequence_id);
+        put_bytes(packet, perfetto::packet_track_event, track_event);
+        put_packet(out, packet);
+    }
+
+    return out;
+
+}
+
+void Tracer::clear() {
+    for (const auto &ring : all_rings()) {
+        ring->cleared.store(ring->head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+}
@@ -0,0 +1,155 @@
+#ifndef GIMBAL_MAVSDK_TRACER_H
+#define GIMBAL_MAVSDK_TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "metrics.h"
+
+// Timeline of individual calls across threads, for chasing latency spikes.
+//
+// Each call carries a trace id from its metadata. A thread working for a call
+// makes it current with a Scope, and what it hands on to other threads (the
+// command scheduler, the pipeline, the estimator) takes the current one along.
+// Spans are kept per thread in a ring that only that thread writes, so
+// recording takes no lock; when a ring is full the oldest spans go.
+//
+// Two kinds of span are kept: a thread span covers work done on the thread
+// that records it, and nests like a call stack; a track span covers waiting
+// that starts and ends on different threads, such as a command's queueing or
+// its ack, and is kept on a track of its own per call or command.
+//
+// While tracing is off, every entry point costs one relaxed load and a
+// branch. The trace can be exported at any time as Chrome trace JSON or as a
+// Perfetto protobuf trace; both open in ui.perfetto.dev.
+class Tracer final {
+
+public:
+
+    using Clock = std::chrono::steady_clock;
+
+    // What a thread is working for; track is set while running a command.
+    struct Context {
+        uint64_t trace;
+        uint64_t track;
+    };
+
+    // Records a thread span from construction to destruction, for the
+    // current trace.
+    class Span final {
+
+    public:
+
+        explicit Span(const char *name) {
+            if (enabled()) {
+                start(name, current_context.trace);
+            }
+        }
+
+        ~Span() {
+            if (name) {
+                finish();
+            }
+        }
+
+        Span(const Span &) = delete;
+        Span &operator=(const Span &) = delete;
+
+    private:
+
+        friend class Tracer;
+
+        Span() = default;
+
+        void start(const char *span_name, uint64_t span_trace);
+        void finish();
+
+        const char *name{nullptr}; // Set while recording
+        uint64_t trace{0};
+        Clock::time_point started{};
+
+    };
+
+    // Makes context current for the calling thread and records its lifetime
+    // as a thread span. Must not be held across a co_await.
+    class Scope final {
+
+    public:
+
+        Scope(const char *name, Context context) {
+            if (enabled() && context.trace != 0) {
+                previous = current_context;
+                current_context = context;
+                span.start(name, context.trace);
+            }
+        }
+
+        ~Scope() {
+            if (span.name) {
+                span.finish();
+                current_context = previous;
+            }
+        }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+
+        Span span;
+        Context previous{};
+
+    };
+
+    static bool enabled() { return on.load(std::memory_order_relaxed); }
+    static void enable(bool enabled);
+
+    // The calling thread's context, empty outside a Scope.
+    static Context current() { return current_context; }
+
+    // A fresh trace id, for calls that did not bring one.
+    static uint64_t new_trace();
+
+    // A fresh track for a call or a command.
+    static uint64_t new_track();
+
+    // Records a span on context's track; ignored without one, or while
+    // tracing is off, so calls that straddle turning it off leave nothing.
+    static void record(const char *name, Context context, Clock::time_point start, Clock::time_point end);
+
+    // The trace id in an x-trace-id value (hex) or a W3C traceparent, 0 if
+    // there is none.
+    static uint64_t parse_trace_id(const std::string &value, bool traceparent);
+
+    struct Stats {
+        uint64_t spans;       // Spans held
+        uint64_t overwritten; // Spans lost to full rings
+        uint64_t threads;     // Rings, one per thread that recorded
+    };
+
+    static Stats stats();
+
+    static void register_metrics(MetricsRegistry &registry);
+
+    // A thread's spans, defined in tracer.cc.
+    struct Ring;
+
+    // Everything held, oldest first. Safe while recording goes on; spans
+    // overwritten during the export are left out.
+    static std::string chrome_json();
+    static std::string perfetto_proto();
+
+    // Drops everything held.
+    static void clear();
+
+private:
+
+    static Ring &ring();
+
+    static std::atomic<bool> on;
+    static thread_local Context current_context;
+
+};
+
+#endif // GIMBAL_MAVSDK_TRACER_H
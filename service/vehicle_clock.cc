@@ -0,0 +1,246 @@
+#include "vehicle_clock.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Oscillators are specified to tens of ppm; a steeper fit is noise.
+constexpr double max_drift = 500e-6;
+
+// An answer this far from the fit means the vehicle's clock jumped.
+constexpr int64_t max_jump_ns = 1000000000;
+
+// Samples measured longer than this before they arrived are taken to be on
+// another time base.
+constexpr auto max_latency = std::chrono::seconds(1);
+
+constexpr std::size_t max_outstanding = 4;
+
+int64_t local_now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}
+
+VehicleClock::VehicleClock(mavsdk::MavlinkPassthrough &passthrough, LinkMonitor &monitor, Config config)
+        : passthrough{passthrough}, monitor{monitor}, config{config} {
+
+    listener = monitor.add_listener([this](LinkMonitor::Direction direction, const mavlink_message_t &message) {
+        if (direction == LinkMonitor::Direction::Incoming && message.msgid == MAVLINK_MSG_ID_TIMESYNC) {
+            on_timesync(message);
+        }
+    });
+    requester = std::thread(&VehicleClock::run, this);
+
+}
+
+VehicleClock::~VehicleClock() {
+
+    monitor.remove_listener(listener);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeup.notify_all();
+    requester.join();
+
+}
+
+std::chrono::steady_clock::time_point VehicleClock::measured_at(uint64_t vehicle_us,
+                                                                std::chrono::steady_clock::time_point arrival) const {
+
+    if (vehicle_us == 0) {
+        return arrival;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!synced) {
+        return arrival;
+    }
+
+    // vehicle = local + offset + slope * (local - fit_local), solved for local.
+    auto vehicle_ns = static_cast<double>(vehicle_us) * 1000.0;
+    auto local_ns = (vehicle_ns - fit_offset_ns + fit_slope * static_cast<double>(fit_local_ns)) / (1.0 + fit_slope);
+    std::chrono::steady_clock::time_point measured{std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::nanoseconds(std::llround(local_ns)))};
+
+    if (measured > arrival || arrival - measured > max_latency) {
+        return arrival;
+    }
+    return measured;
+
+}
+
+std::chrono::system_clock::time_point VehicleClock::to_wall(std::chrono::steady_clock::time_point time) {
+    return std::chrono::system_clock::now() + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            time - std::chrono::steady_clock::now());
+}
+
+VehicleClock::Stats VehicleClock::stats() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    Stats snapshot = counters;
+    snapshot.synced = synced;
+    if (synced) {
+        auto offset_ns = fit_offset_ns + fit_slope * static_cast<double>(local_now_ns() - fit_local_ns);
+        snapshot.offset_us = std::llround(offset_ns / 1000.0);
+        snapshot.drift_ppm = fit_slope * 1e6;
+    }
+    return snapshot;
+
+}
+
+void VehicleClock::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &samples) {
+        auto s = stats();
+        samples.push_back({"timesync.requests", static_cast<double>(s.requests)});
+        samples.push_back({"timesync.answers", static_cast<double>(s.answers)});
+        samples.push_back({"timesync.resets", static_cast<double>(s.resets)});
+        samples.push_back({"timesync.synced", s.synced ? 1.0 : 0.0});
+        samples.push_back({"timesync.offset_us", static_cast<double>(s.offset_us)});
+        samples.push_back({"timesync.drift_ppm", s.drift_ppm});
+        samples.push_back({"timesync.rtt_last_us", static_cast<double>(s.rtt_last_us)});
+        samples.push_back({"timesync.rtt_min_us", static_cast<double>(s.rtt_min_us)});
+        samples.push_back({"timesync.residual_us", s.residual_us});
+    });
+}
+
+void VehicleClock::on_timesync(const mavlink_message_t &message) {
+
+    auto now_ns = local_now_ns();
+
+    mavlink_timesync_t timesync;
+    mavlink_msg_timesync_decode(&message, &timesync);
+
+    // Requests are answered by MAVSDK; only answers from the autopilot to our
+    // own requests are used.
+    if (timesync.tc1 == 0 || message.sysid != passthrough.get_target_sysid()
+        || message.compid != passthrough.get_target_compid()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto request = std::find(outstanding.begin(), outstanding.end(), timesync.ts1);
+    if (request == outstanding.end()) {
+        return;
+    }
+    outstanding.erase(request);
+
+    auto rtt_ns = now_ns - timesync.ts1;
+    if (rtt_ns < 0) {
+        return;
+    }
+    Answer answer{timesync.ts1 + rtt_ns / 2, 0, rtt_ns};
+    answer.offset_ns = timesync.tc1 - answer.local_ns;
+
+    counters.answers++;
+    counters.rtt_last_us = static_cast<uint64_t>(rtt_ns / 1000);
+
+    if (synced) {
+        auto expected = fit_offset_ns + fit_slope * static_cast<double>(answer.local_ns - fit_local_ns);
+        if (std::abs(static_cast<double>(answer.offset_ns) - expected) > static_cast<double>(max_jump_ns)) {
+            answers.clear();
+            synced = false;
+            counters.resets++;
+        }
+    }
+
+    answers.push_back(answer);
+    while (answers.size() > config.window) {
+        answers.pop_front();
+    }
+    refit();
+
+}
+
+VehicleClock::Line VehicleClock::fit(const std::deque<Answer> &answers, double rtt_tolerance) {
+
+    auto min_rtt = std::min_element(answers.begin(), answers.end(), [](const Answer &a, const Answer &b) {
+        return a.rtt_ns < b.rtt_ns;
+    })->rtt_ns;
+    auto max_rtt = static_cast<double>(min_rtt) * rtt_tolerance;
+
+    // Least squares on values relative to the newest answer, which keeps
+    // the sums well within double precision.
+    const auto &reference = answers.back();
+    double n = 0, sum_x = 0, sum_y = 0, sum_xx = 0, sum_xy = 0;
+    for (const auto &answer : answers) {
+        if (static_cast<double>(answer.rtt_ns) > max_rtt) {
+            continue;
+        }
+        auto x = static_cast<double>(answer.local_ns - reference.local_ns);
+        auto y = static_cast<double>(answer.offset_ns - reference.offset_ns);
+        n++;
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+    }
+
+    auto mean_x = sum_x / n;
+    auto mean_y = sum_y / n;
+    auto variance = sum_xx / n - mean_x * mean_x;
+    auto slope = variance > 0 ? (sum_xy / n - mean_x * mean_y) / variance : 0.0;
+
+    Line line{};
+    line.local_ns = reference.local_ns + std::llround(mean_x);
+    line.offset_ns = static_cast<double>(reference.offset_ns) + mean_y;
+    line.slope = std::clamp(slope, -max_drift, max_drift);
+    line.min_rtt_ns = min_rtt;
+
+    double squares = 0;
+    for (const auto &answer : answers) {
+        if (static_cast<double>(answer.rtt_ns) > max_rtt) {
+            continue;
+        }
+        auto expected = line.offset_ns + line.slope * static_cast<double>(answer.local_ns - line.local_ns);
+        auto residual = static_cast<double>(answer.offset_ns) - expected;
+        squares += residual * residual;
+    }
+    line.residual_ns = std::sqrt(squares / n);
+    return line;
+
+}
+
+void VehicleClock::refit() {
+
+    auto line = fit(answers, config.rtt_tolerance);
+    fit_local_ns = line.local_ns;
+    fit_offset_ns = line.offset_ns;
+    fit_slope = line.slope;
+    synced = true;
+
+    counters.residual_us = line.residual_ns / 1000.0;
+    counters.rtt_min_us = static_cast<uint64_t>(line.min_rtt_ns / 1000);
+
+}
+
+void VehicleClock::run() {
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (!stopping) {
+        auto ts1 = local_now_ns();
+        outstanding.push_back(ts1);
+        while (outstanding.size() > max_outstanding) {
+            outstanding.pop_front();
+        }
+        counters.requests++;
+
+        // Sending passes through the link monitor's listeners, ours included.
+        lock.unlock();
+        mavlink_message_t message;
+        mavlink_msg_timesync_pack(passthrough.get_our_sysid(), passthrough.get_our_compid(), &message, 0, ts1,
+                                  passthrough.get_target_sysid(), passthrough.get_target_compid());
+        passthrough.send_message(message);
+        lock.lock();
+
+        wakeup.wait_for(lock, config.interval, [this] { return stopping; });
+    }
+
+}
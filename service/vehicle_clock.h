@@ -0,0 +1,115 @@
+#ifndef GIMBAL_MAVSDK_VEHICLE_CLOCK_H
+#define GIMBAL_MAVSDK_VEHICLE_CLOCK_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <mavsdk/plugins/mavlink_passthrough/mavlink_passthrough.h>
+#include "link_monitor.h"
+#include "metrics.h"
+
+// Maps the vehicle's boot time to the companion's monotonic clock.
+//
+// TIMESYNC requests go out periodically; each answer gives one estimate of
+// the offset between the clocks. Only answers with a round trip close to the
+// shortest recent one are used, and a line is fitted through them so the
+// estimate also follows the drift between the two oscillators. Telemetry
+// timestamps mapped through it tell when a sample was measured rather than
+// when it came off the serial link.
+class VehicleClock final {
+
+public:
+
+    struct Config {
+        std::chrono::milliseconds interval{1000}; // Between TIMESYNC requests
+        std::size_t window = 32;                   // Answers kept for the fit
+        double rtt_tolerance = 2.0;                // Answers within this multiple of the shortest round trip are used
+    };
+
+    struct Stats {
+        uint64_t requests;
+        uint64_t answers;
+        uint64_t resets;           // The vehicle's clock jumped, e.g. after a reboot
+        bool synced;
+        int64_t offset_us;         // Vehicle boot time minus companion monotonic time, now
+        double drift_ppm;          // How much faster the vehicle clock runs
+        uint64_t rtt_last_us;
+        uint64_t rtt_min_us;       // Shortest round trip in the window
+        double residual_us;        // RMS distance of the used answers from the fit
+    };
+
+    struct Answer {
+        int64_t local_ns;  // Midpoint of the round trip
+        int64_t offset_ns; // Vehicle minus local
+        int64_t rtt_ns;
+    };
+
+    // offset(local) = offset_ns + slope * (local - local_ns)
+    struct Line {
+        int64_t local_ns;
+        double offset_ns;
+        double slope;      // How much faster the vehicle clock runs
+        int64_t min_rtt_ns;
+        double residual_ns; // RMS distance of the used answers from the line
+    };
+
+    VehicleClock(mavsdk::MavlinkPassthrough &passthrough, LinkMonitor &monitor, Config config);
+    ~VehicleClock();
+
+    VehicleClock(const VehicleClock &) = delete;
+    VehicleClock &operator=(const VehicleClock &) = delete;
+
+    // When a sample stamped with the vehicle's boot time in microseconds was
+    // measured, on the companion's monotonic clock. arrival is returned while
+    // unsynced, and for stamps that cannot be right for a sample that arrived
+    // then.
+    std::chrono::steady_clock::time_point measured_at(uint64_t vehicle_us,
+                                                      std::chrono::steady_clock::time_point arrival) const;
+
+    // Companion wall clock time of a monotonic time point.
+    static std::chrono::system_clock::time_point to_wall(std::chrono::steady_clock::time_point time);
+
+    Stats stats() const;
+
+    void register_metrics(MetricsRegistry &registry) const;
+
+    // Least squares through the answers with a round trip within
+    // rtt_tolerance of the shortest one, the slope clamped to what an
+    // oscillator can drift. answers must not be empty.
+    static Line fit(const std::deque<Answer> &answers, double rtt_tolerance);
+
+private:
+
+    void on_timesync(const mavlink_message_t &message);
+    void refit();
+    void run();
+
+    mavsdk::MavlinkPassthrough &passthrough;
+    LinkMonitor &monitor;
+    const Config config;
+    LinkMonitor::ListenerId listener;
+
+    mutable std::mutex mutex;
+    std::condition_variable wakeup;
+    bool stopping{false};
+
+    std::deque<int64_t> outstanding; // ts1 of requests not yet answered
+    std::deque<Answer> answers;
+
+    // offset(local) = fit_offset_ns + fit_slope * (local - fit_local_ns)
+    bool synced{false};
+    int64_t fit_local_ns{0};
+    double fit_offset_ns{0};
+    double fit_slope{0};
+
+    Stats counters{};
+
+    std::thread requester;
+
+};
+
+#endif // GIMBAL_MAVSDK_VEHICLE_CLOCK_H
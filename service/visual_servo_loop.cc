@@ -0,0 +1,240 @@
+#include "visual_servo_loop.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr double degrees_per_radian = 180.0 / M_PI;
+
+double seconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double>(duration).count();
+}
+
+// Angle off the optical axis of a point at offset (a share of the half
+// image) in an image spanning fov_deg.
+float offset_to_degrees(float offset, float fov_deg) {
+    auto half_fov = static_cast<double>(fov_deg) / degrees_per_radian / 2.0;
+    return static_cast<float>(std::atan(std::clamp(offset, -1.0f, 1.0f) * std::tan(half_fov)) * degrees_per_radian);
+}
+
+}
+
+void VisualServoLoop::Totals::register_metrics(MetricsRegistry &registry) const {
+    registry.add_collector([this](std::vector<MetricsRegistry::Sample> &out) {
+        out.push_back({"servo.active_loops", static_cast<double>(active_loops.load())});
+        out.push_back({"servo.measurements", static_cast<double>(measurements.load())});
+        out.push_back({"servo.ticks", static_cast<double>(ticks.load())});
+        out.push_back({"servo.stale_ticks", static_cast<double>(stale_ticks.load())});
+        out.push_back({"servo.overruns", static_cast<double>(overruns.load())});
+        out.push_back({"servo.lateness_last_us", static_cast<double>(lateness_last_us.load())});
+        out.push_back({"servo.lateness_max_us", static_cast<double>(lateness_max_us.load())});
+        out.push_back({"servo.compute_last_us", static_cast<double>(compute_last_us.load())});
+    });
+}
+
+VisualServoLoop::VisualServoLoop(Config config, Gains gains, Totals &totals, RateCommand command)
+        : config{config}, totals{totals}, command{std::move(command)}, gains{gains} {
+
+    totals.active_loops++;
+    loop = std::thread(&VisualServoLoop::run, this);
+
+}
+
+VisualServoLoop::~VisualServoLoop() {
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeup.notify_all();
+    loop.join();
+
+    // The gimbal must not keep turning once nobody is steering it.
+    if (pitch.command != 0 || yaw.command != 0) {
+        command(0, 0);
+    }
+    totals.active_loops--;
+
+}
+
+void VisualServoLoop::measure(const Measurement &measurement) {
+
+    auto now = std::chrono::steady_clock::now();
+    auto captured = std::min(measurement.captured_at, now);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    totals.measurements++;
+
+    target_lost = measurement.target_lost;
+    if (target_lost || (measured && captured <= captured_at)) {
+        return;
+    }
+
+    auto since_previous = measured ? seconds(captured - captured_at) : 0.0;
+    update(pitch, -offset_to_degrees(measurement.error_y, measurement.vertical_fov_deg),
+           captured, since_previous, &Mark::pitch_moved, &Mark::pitch_command);
+    update(yaw, offset_to_degrees(measurement.error_x, measurement.horizontal_fov_deg),
+           captured, since_previous, &Mark::yaw_moved, &Mark::yaw_command);
+    captured_at = captured;
+    measured = true;
+
+}
+
+void VisualServoLoop::set_gains(const Gains &new_gains) {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    gains = new_gains;
+
+    // Keep the integral term within what the new gains can command.
+    for (auto axis : {&pitch, &yaw}) {
+        auto limit = gains.ki > 0 ? gains.max_rate_deg_s / gains.ki : 0.0f;
+        axis->integral = std::clamp(axis->integral, -limit, limit);
+    }
+
+}
+
+VisualServoLoop::Status VisualServoLoop::status() const {
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return {pitch.command, yaw.command, pitch.error, yaw.error, tracking, ticks, overruns,
+            ticks > 0 ? lateness_total_us / static_cast<double>(ticks) : 0.0, lateness_max_us, gains};
+
+}
+
+double VisualServoLoop::moved_at(std::chrono::steady_clock::time_point time, double Mark::*moved, float Mark::*rate) const {
+
+    if (marks.empty()) {
+        return 0;
+    }
+    // Latest tick at or before time; the command it issued held until time.
+    auto after = std::upper_bound(marks.begin(), marks.end(), time, [](std::chrono::steady_clock::time_point t, const Mark &mark) {
+        return t < mark.time;
+    });
+    if (after == marks.begin()) {
+        return marks.front().*moved;
+    }
+    const auto &mark = *(after - 1);
+    return mark.*moved + mark.*rate * seconds(time - mark.time);
+
+}
+
+void VisualServoLoop::update(Axis &axis, float measured_deg, std::chrono::steady_clock::time_point captured,
+                         double since_previous_s, double Mark::*moved, float Mark::*rate) {
+
+    auto moved_at_capture = moved_at(captured, moved, rate);
+
+    // The target's own angular rate is what the error changed by plus what
+    // the gimbal turned in between.
+    if (since_previous_s > 0) {
+        auto error_rate = (measured_deg - axis.measured_deg) / since_previous_s;
+        auto target_rate = error_rate + (moved_at_capture - axis.moved_at_capture) / since_previous_s;
+        axis.error_rate += static_cast<float>(config.rate_smoothing * (error_rate - axis.error_rate));
+        axis.target_rate += static_cast<float>(config.rate_smoothing * (target_rate - axis.target_rate));
+    }
+    axis.measured_deg = measured_deg;
+    axis.moved_at_capture = moved_at_capture;
+
+}
+
+float VisualServoLoop::control(Axis &axis, double dt_s) {
+
+    auto output = gains.kp * axis.error + gains.ki * axis.integral + gains.kd * axis.error_rate
+                  + gains.kff * axis.target_rate;
+
+    // Integrate only while that does not push a saturated output further.
+    if (std::abs(output) < gains.max_rate_deg_s || output * axis.error < 0) {
+        auto limit = gains.ki > 0 ? gains.max_rate_deg_s / gains.ki : 0.0f;
+        axis.integral = std::clamp(axis.integral + static_cast<float>(axis.error * dt_s), -limit, limit);
+    }
+
+    axis.command = std::clamp(output, -gains.max_rate_deg_s, gains.max_rate_deg_s);
+    return axis.command;
+
+}
+
+bool VisualServoLoop::tick(std::chrono::steady_clock::time_point now, double dt_s) {
+
+    ticks++;
+    totals.ticks++;
+
+    pitch.moved += pitch.command * dt_s;
+    yaw.moved += yaw.command * dt_s;
+
+    bool fresh = measured && !target_lost && now - captured_at <= config.max_age;
+    bool send;
+    if (fresh) {
+        // The error now is the measured one less what the gimbal turned
+        // since the image was captured.
+        pitch.error = static_cast<float>(pitch.measured_deg - (pitch.moved - pitch.moved_at_capture));
+        yaw.error = static_cast<float>(yaw.measured_deg - (yaw.moved - yaw.moved_at_capture));
+        control(pitch, dt_s);
+        control(yaw, dt_s);
+        send = true;
+    } else {
+        totals.stale_ticks++;
+        send = pitch.command != 0 || yaw.command != 0;
+        measured = false; // Rates start over with the next measurement
+        for (auto axis : {&pitch, &yaw}) {
+            axis->command = 0;
+            axis->integral = 0;
+            axis->error_rate = 0;
+            axis->target_rate = 0;
+        }
+    }
+    tracking = fresh;
+
+    marks.push_back({now, pitch.moved, yaw.moved, pitch.command, yaw.command});
+    while (marks.size() > 1 && now - marks[1].time > config.max_age) {
+        marks.pop_front();
+    }
+    return send;
+
+}
+
+void VisualServoLoop::run() {
+
+    auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / config.rate_hz));
+    auto next = std::chrono::steady_clock::now();
+    auto last = next;
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (!stopping) {
+        if (wakeup.wait_until(lock, next, [this] { return stopping; })) {
+            break;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        auto lateness = now - next;
+        auto lateness_us = std::chrono::duration_cast<std::chrono::microseconds>(lateness).count();
+        lateness_total_us += static_cast<double>(lateness_us);
+        lateness_max_us = std::max(lateness_max_us, static_cast<double>(lateness_us));
+        totals.lateness_last_us = static_cast<uint64_t>(lateness_us);
+        if (static_cast<uint64_t>(lateness_us) > totals.lateness_max_us) {
+            totals.lateness_max_us = static_cast<uint64_t>(lateness_us);
+        }
+        // Ticks missed while this thread was held up are skipped, not made up.
+        if (lateness > period) {
+            overruns++;
+            totals.overruns++;
+            next = now;
+        }
+        next += period;
+
+        bool send = tick(now, seconds(now - last));
+        last = now;
+        auto pitch_rate = pitch.command;
+        auto yaw_rate = yaw.command;
+
+        if (send) {
+            lock.unlock();
+            command(pitch_rate, yaw_rate);
+            lock.lock();
+        }
+        totals.compute_last_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - now).count());
+    }
+
+}
@@ -0,0 +1,155 @@
+#ifndef GIMBAL_MAVSDK_VISUAL_SERVO_LOOP_H
+#define GIMBAL_MAVSDK_VISUAL_SERVO_LOOP_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "metrics.h"
+
+// Keeps a target centered in the camera image by commanding gimbal rates.
+//
+// Measurements give the target's offset from the image center as a share of
+// the half image. They are turned into angles with the field of view and
+// aged to each tick by the motion commanded since the image was captured,
+// so the loop runs at its own fixed rate whatever the measurement rate. The
+// output is PID on the angle error plus the target's estimated angular rate
+// as feed-forward. Without a fresh measurement the gimbal is stopped.
+class VisualServoLoop final {
+
+public:
+
+    struct Config {
+        double rate_hz = 50;                     // Loop rate
+        std::chrono::milliseconds max_age{300};  // Older measurements stop the gimbal
+        double rate_smoothing = 0.3;             // Weight of the newest error and target rate derivative
+    };
+
+    // The same gains apply to both axes.
+    struct Gains {
+        float kp = 2.0f;                // deg/s per degree of error
+        float ki = 0.2f;                // deg/s per degree second of error
+        float kd = 0.05f;               // deg/s per deg/s of error change
+        float kff = 1.0f;               // Share of the target's angular rate fed forward
+        float max_rate_deg_s = 60.0f;   // Commanded rates are clamped to this
+    };
+
+    struct Measurement {
+        float error_x;            // -1 at the left edge, 1 at the right edge
+        float error_y;            // -1 at the top edge, 1 at the bottom edge
+        float horizontal_fov_deg;
+        float vertical_fov_deg;
+        bool target_lost;
+        std::chrono::steady_clock::time_point captured_at;
+    };
+
+    struct Status {
+        float pitch_rate_deg_s;   // Latest command
+        float yaw_rate_deg_s;
+        float pitch_error_deg;    // Latest error, aged to the tick
+        float yaw_error_deg;
+        bool tracking;            // A fresh measurement drove the latest tick
+        uint64_t ticks;
+        uint64_t overruns;        // Ticks that started more than a period late
+        double lateness_avg_us;   // Mean start delay of ticks
+        double lateness_max_us;
+        Gains gains;
+    };
+
+    using RateCommand = std::function<void(float pitch_rate_deg_s, float yaw_rate_deg_s)>;
+
+    // Shared by all loops of a service, exported as servo.* metrics.
+    class Totals final {
+
+    public:
+
+        void register_metrics(MetricsRegistry &registry) const;
+
+    private:
+
+        friend class VisualServoLoop;
+
+        std::atomic<uint64_t> active_loops{0};
+        std::atomic<uint64_t> measurements{0};
+        std::atomic<uint64_t> ticks{0};
+        std::atomic<uint64_t> stale_ticks{0};     // Ticks without a fresh measurement
+        std::atomic<uint64_t> overruns{0};
+        std::atomic<uint64_t> lateness_last_us{0};
+        std::atomic<uint64_t> lateness_max_us{0};
+        std::atomic<uint64_t> compute_last_us{0}; // From waking up to the command being handed on
+
+    };
+
+    // command is called from the loop's thread and must not block.
+    VisualServoLoop(Config config, Gains gains, Totals &totals, RateCommand command);
+    ~VisualServoLoop();
+
+    VisualServoLoop(const VisualServoLoop &) = delete;
+    VisualServoLoop &operator=(const VisualServoLoop &) = delete;
+
+    void measure(const Measurement &measurement);
+    void set_gains(const Gains &gains);
+
+    Status status() const;
+
+private:
+
+    struct Axis {
+        float measured_deg{0};     // Error in the latest measurement
+        double moved_at_capture{0}; // moved when that image was captured
+        double moved{0};           // Integral of the commanded rate, degrees
+        float error_rate{0};       // Smoothed, deg/s
+        float target_rate{0};      // Smoothed angular rate of the target, deg/s
+        float integral{0};
+        float command{0};
+        float error{0};            // Aged to the latest tick
+    };
+
+    // Where the loop had turned the gimbal by each recent tick, and the
+    // rates it commanded from then on.
+    struct Mark {
+        std::chrono::steady_clock::time_point time;
+        double pitch_moved;
+        double yaw_moved;
+        float pitch_command;
+        float yaw_command;
+    };
+
+    double moved_at(std::chrono::steady_clock::time_point time, double Mark::*moved, float Mark::*rate) const;
+    void update(Axis &axis, float measured_deg, std::chrono::steady_clock::time_point captured,
+                double since_previous_s, double Mark::*moved, float Mark::*rate);
+    float control(Axis &axis, double dt_s);
+    bool tick(std::chrono::steady_clock::time_point now, double dt_s); // Whether to send the command
+    void run();
+
+    const Config config;
+    Totals &totals;
+    const RateCommand command;
+
+    mutable std::mutex mutex;
+    std::condition_variable wakeup;
+    bool stopping{false};
+
+    Gains gains;
+    Axis pitch;
+    Axis yaw;
+    bool measured{false};
+    bool target_lost{false};
+    bool tracking{false};
+    std::chrono::steady_clock::time_point captured_at{};
+    std::deque<Mark> marks;
+
+    uint64_t ticks{0};
+    uint64_t overruns{0};
+    double lateness_total_us{0};
+    double lateness_max_us{0};
+
+    std::thread loop;
+
+};
+
+#endif // GIMBAL_MAVSDK_VISUAL_SERVO_LOOP_H
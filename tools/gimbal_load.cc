@@ -0,0 +1,308 @@
+//
+// Load generator for the gimbal service.
+//
+// Runs the same unary call against each target in turn and reports latency
+// percentiles, so the transports can be compared side by side, e.g.
+//
+//   gimbal_load --target unix:/tmp/gimbal_mavsdk.sock --target localhost:11520 --rate 100
+//
+// SyncClock and PredictAttitude are answered without touching the MAVLink
+// link, so what is measured is the gRPC and transport overhead;
+// set_pitch_rate sends zero-rate setpoints all the way to the gimbal, and
+// take_control a control command that waits for the gimbal's ack. For
+// gRPC targets the service's own cost is read from its metrics around each
+// run: context switches per call and CPU time per 1000 calls, over all of
+// its threads, to compare e.g. the threaded and --event-loop modes. A target
+// shm:<name> uses the shared-memory channel instead: sync_clock becomes a
+// ping through the setpoint ring, answered once the service has consumed it,
+// and predict_attitude a read of the published attitude. Only one process
+// or thread can send on the ring, so shm pings need --threads 1.
+//
+
+#include <grpcpp/grpcpp.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "gimbal.grpc.pb.h"
+#include "shm_client.h"
+
+namespace {
+
+struct Options {
+    std::vector<std::string> targets;
+    std::string rpc = "sync_clock";
+    int calls = 5000;  // Per thread and target
+    int warmup = 200;  // Calls before measuring, per thread
+    int threads = 1;
+    double rate_hz = 0; // Per thread; 0 for back to back
+};
+
+// One per thread, as separate tracker processes would have.
+struct Caller {
+    std::unique_ptr<mavsdk::rpc::gimbal::GimbalService::Stub> stub;
+    std::unique_ptr<ShmGimbalClient> shm;
+    std::string id; // x-client-id, so the service limits each caller on its own
+};
+
+struct Result {
+    std::vector<uint64_t> latencies_ns;
+    uint64_t failed{0};
+    double elapsed_s{0};
+    bool costed{false};        // Whether the service reported its cost
+    double switches{0};        // Service context switches during the run
+    double cpu_us{0};          // Service CPU time during the run
+};
+
+// The service's process totals, if it exports them.
+bool read_cost(mavsdk::rpc::gimbal::GimbalService::Stub &stub, double &switches, double &cpu_us) {
+
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(2));
+    mavsdk::rpc::gimbal::GetMetricsRequest request;
+    mavsdk::rpc::gimbal::GetMetricsResponse response;
+    if (!stub.GetMetrics(&context, request, &response).ok()) {
+        return false;
+    }
+
+    int found = 0;
+    switches = 0;
+    for (const auto &metric : response.metrics()) {
+        if (metric.name() == "thread.process_voluntary_switches" || metric.name() == "thread.process_involuntary_switches") {
+            switches += metric.value();
+            found++;
+        } else if (metric.name() == "thread.process_cpu_us") {
+            cpu_us = metric.value();
+            found++;
+        }
+    }
+    return found == 3;
+
+}
+
+const char *usage = "usage: gimbal_load [--target <address>]... [--rpc sync_clock|predict_attitude|set_pitch_rate|take_control] "
+                    "[--calls <n>] [--warmup <n>] [--threads <n>] [--rate <hz>]";
+
+bool parse(int argc, char **argv, Options &options) {
+
+    // Every option takes a value.
+    if (argc % 2 == 0) {
+        return false;
+    }
+    for (int i = 1; i < argc; i += 2) {
+        const char *name = argv[i];
+        const char *value = argv[i + 1];
+        if (strcmp(name, "--target") == 0) {
+            options.targets.emplace_back(value);
+        } else if (strcmp(name, "--rpc") == 0) {
+            options.rpc = value;
+        } else if (strcmp(name, "--calls") == 0) {
+            options.calls = atoi(value);
+        } else if (strcmp(name, "--warmup") == 0) {
+            options.warmup = atoi(value);
+        } else if (strcmp(name, "--threads") == 0) {
+            options.threads = atoi(value);
+        } else if (strcmp(name, "--rate") == 0) {
+            options.rate_hz = atof(value);
+        } else {
+            return false;
+        }
+    }
+
+    if (options.targets.empty()) {
+        options.targets = {std::string("shm:") + shm_default_name, "unix:/tmp/gimbal_mavsdk.sock", "localhost:11520"};
+    }
+    return (options.rpc == "sync_clock" || options.rpc == "predict_attitude" || options.rpc == "set_pitch_rate"
+            || options.rpc == "take_control")
+           && options.calls > 0 && options.warmup >= 0 && options.threads > 0 && options.rate_hz >= 0;
+
+}
+
+bool call(Caller &caller, const std::string &rpc) {
+
+    if (caller.shm) {
+        if (rpc == "predict_attitude") {
+            ShmGimbalClient::Attitude attitude;
+            caller.shm->attitude(attitude);
+            return caller.shm->connected();
+        }
+        auto ticket = caller.shm->ping();
+        if (ticket == 0) {
+            return false;
+        }
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (!caller.shm->consumed(ticket)) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto &stub = *caller.stub;
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(2));
+    context.AddMetadata("x-client-id", caller.id);
+
+    if (rpc == "sync_clock") {
+        mavsdk::rpc::gimbal::SyncClockRequest request;
+        mavsdk::rpc::gimbal::SyncClockResponse response;
+        request.set_client_send_time_ns(1);
+        return stub.SyncClock(&context, request, &response).ok();
+    }
+
+    if (rpc == "set_pitch_rate") {
+        mavsdk::rpc::gimbal::SetPitchRateAndYawRateRequest request;
+        mavsdk::rpc::gimbal::SetPitchRateAndYawRateResponse response;
+        return stub.SetPitchRateAndYawRate(&context, request, &response).ok();
+    }
+
+    if (rpc == "take_control") {
+        mavsdk::rpc::gimbal::TakeControlRequest request;
+        mavsdk::rpc::gimbal::TakeControlResponse response;
+        request.set_control_mode(mavsdk::rpc::gimbal::CONTROL_MODE_PRIMARY);
+        return stub.TakeControl(&context, request, &response).ok();
+    }
+
+    // Without camera attitude yet the server answers UNAVAILABLE, which
+    // still makes a full round trip.
+    mavsdk::rpc::gimbal::PredictAttitudeRequest request;
+    mavsdk::rpc::gimbal::PredictAttitudeResponse response;
+    auto status = stub.PredictAttitude(&context, request, &response);
+    return status.ok() || status.error_code() == grpc::UNAVAILABLE;
+
+}
+
+Result run(const std::string &target, const Options &options) {
+
+    Result result;
+    std::vector<std::vector<uint64_t>> latencies(options.threads);
+    std::atomic<uint64_t> failed{0};
+
+    std::vector<Caller> callers(options.threads);
+    for (auto &caller : callers) {
+        caller.id = "gimbal_load." + std::to_string(getpid()) + "." + std::to_string(&caller - callers.data());
+        if (target.rfind("shm:", 0) == 0) {
+            caller.shm = std::make_unique<ShmGimbalClient>(target.substr(4));
+        } else {
+            grpc::ChannelArguments arguments;
+            arguments.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+            caller.stub = mavsdk::rpc::gimbal::GimbalService::NewStub(
+                    grpc::CreateCustomChannel(target, grpc::InsecureChannelCredentials(), arguments));
+        }
+        for (int i = 0; i < options.warmup; i++) {
+            call(caller, options.rpc);
+        }
+    }
+
+    auto period = options.rate_hz > 0
+            ? std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / options.rate_hz))
+            : std::chrono::steady_clock::duration::zero();
+
+    double switches_before = 0;
+    double cpu_us_before = 0;
+    bool costed = callers[0].stub && read_cost(*callers[0].stub, switches_before, cpu_us_before);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < options.threads; t++) {
+        threads.emplace_back([&, t] {
+            auto &caller = callers[t];
+            auto &measured = latencies[t];
+            measured.reserve(options.calls);
+            auto next = std::chrono::steady_clock::now();
+            for (int i = 0; i < options.calls; i++) {
+                if (period.count() > 0) {
+                    std::this_thread::sleep_until(next);
+                    next += period;
+                }
+                auto sent = std::chrono::steady_clock::now();
+                if (!call(caller, options.rpc)) {
+                    failed++;
+                    continue;
+                }
+                measured.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - sent).count()));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    result.elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (costed && read_cost(*callers[0].stub, result.switches, result.cpu_us)) {
+        result.costed = true;
+        result.switches -= switches_before;
+        result.cpu_us -= cpu_us_before;
+    }
+
+    for (auto &measured : latencies) {
+        result.latencies_ns.insert(result.latencies_ns.end(), measured.begin(), measured.end());
+    }
+    std::sort(result.latencies_ns.begin(), result.latencies_ns.end());
+    result.failed = failed;
+    return result;
+
+}
+
+double percentile_us(const std::vector<uint64_t> &sorted_ns, double fraction) {
+    if (sorted_ns.empty()) {
+        return 0;
+    }
+    auto index = static_cast<std::size_t>(fraction * static_cast<double>(sorted_ns.size() - 1) + 0.5);
+    return static_cast<double>(sorted_ns[index]) / 1000.0;
+}
+
+}
+
+int main(int argc, char **argv) {
+
+    Options options;
+    if (!parse(argc, argv, options)) {
+        printf("%s\n", usage);
+        return EXIT_FAILURE;
+    }
+
+    printf("%s, %d thread(s) x %d calls", options.rpc.c_str(), options.threads, options.calls);
+    if (options.rate_hz > 0) {
+        printf(" at %g Hz each\n", options.rate_hz);
+    } else {
+        printf(" back to back\n");
+    }
+    printf("%-32s %10s %8s %8s %8s %8s %8s %8s %8s %8s %9s\n",
+           "target", "calls/s", "failed", "min_us", "p50_us", "p90_us", "p99_us", "p999_us", "max_us",
+           "cs/call", "cpu_ms/1k");
+
+    for (const auto &target : options.targets) {
+        auto result = run(target, options);
+        const auto &sorted = result.latencies_ns;
+        printf("%-32s %10.0f %8lu %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f",
+               target.c_str(),
+               static_cast<double>(sorted.size()) / result.elapsed_s,
+               static_cast<unsigned long>(result.failed),
+               percentile_us(sorted, 0.0),
+               percentile_us(sorted, 0.5),
+               percentile_us(sorted, 0.9),
+               percentile_us(sorted, 0.99),
+               percentile_us(sorted, 0.999),
+               percentile_us(sorted, 1.0));
+
+        // The metrics calls themselves are a rounding error next to the run.
+        auto calls = static_cast<double>(options.calls) * options.threads;
+        if (result.costed) {
+            printf(" %8.2f %9.1f\n", result.switches / calls, result.cpu_us / calls);
+        } else {
+            printf(" %8s %9s\n", "-", "-");
+        }
+    }
+
+    return 0;
+
+}
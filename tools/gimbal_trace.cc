@@ -0,0 +1,124 @@
+//
+// Turns the gimbal service's call tracing on or off and exports the trace,
+// e.g. around a run that shows latency spikes:
+//
+//   gimbal_trace --start --clear
+//   ...
+//   gimbal_trace --stop --format perfetto --out gimbal.pftrace
+//
+// Both formats open in ui.perfetto.dev; Chrome JSON also in chrome://tracing.
+// Calls sent with an x-trace-id header are traced under that id, so a
+// client's own logs can point into the trace. The service only takes these
+// calls over its unix socket.
+//
+
+#include <grpcpp/grpcpp.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "gimbal.grpc.pb.h"
+
+namespace {
+
+struct Options {
+    std::string target = "unix:/tmp/gimbal_mavsdk.sock"; // The service only serves tracing there
+    bool start = false;
+    bool stop = false;
+    bool clear = false;
+    std::string format = "chrome";
+    std::string out; // Nothing is exported without it
+};
+
+const char *usage = "usage: gimbal_trace [--target <address>] [--start | --stop] [--clear] "
+                    "[--format chrome|perfetto] [--out <file>]";
+
+bool parse(int argc, char **argv, Options &options) {
+
+    for (int i = 1; i < argc; i++) {
+        const char *name = argv[i];
+        if (strcmp(name, "--start") == 0) {
+            options.start = true;
+        } else if (strcmp(name, "--stop") == 0) {
+            options.stop = true;
+        } else if (strcmp(name, "--clear") == 0) {
+            options.clear = true;
+        } else if (i + 1 < argc && strcmp(name, "--target") == 0) {
+            options.target = argv[++i];
+        } else if (i + 1 < argc && strcmp(name, "--format") == 0) {
+            options.format = argv[++i];
+        } else if (i + 1 < argc && strcmp(name, "--out") == 0) {
+            options.out = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return !(options.start && options.stop) && (options.format == "chrome" || options.format == "perfetto")
+           && (options.start || options.stop || options.clear || !options.out.empty());
+
+}
+
+bool failed(const char *call, const grpc::Status &status) {
+    if (status.ok()) {
+        return false;
+    }
+    fprintf(stderr, "%s failed: %s\n", call, status.error_message().c_str());
+    return true;
+}
+
+}
+
+int main(int argc, char **argv) {
+
+    Options options;
+    if (!parse(argc, argv, options)) {
+        printf("%s\n", usage);
+        return EXIT_FAILURE;
+    }
+
+    auto stub = mavsdk::rpc::gimbal::GimbalService::NewStub(
+            grpc::CreateChannel(options.target, grpc::InsecureChannelCredentials()));
+
+    // Export before stopping, so the stop itself is not in the trace; clear
+    // after exporting, so nothing is dropped unseen.
+    if (!options.out.empty()) {
+        grpc::ClientContext context;
+        context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(10));
+        mavsdk::rpc::gimbal::GetTraceRequest request;
+        mavsdk::rpc::gimbal::GetTraceResponse response;
+        request.set_format(options.format == "perfetto" ? mavsdk::rpc::gimbal::TRACE_FORMAT_PERFETTO
+                                                        : mavsdk::rpc::gimbal::TRACE_FORMAT_CHROME_JSON);
+        request.set_clear(options.clear);
+        if (failed("GetTrace", stub->GetTrace(&context, request, &response))) {
+            return EXIT_FAILURE;
+        }
+
+        FILE *file = fopen(options.out.c_str(), "wb");
+        if (!file || fwrite(response.trace().data(), 1, response.trace().size(), file) != response.trace().size()) {
+            fprintf(stderr, "Writing %s failed\n", options.out.c_str());
+            if (file) {
+                fclose(file);
+            }
+            return EXIT_FAILURE;
+        }
+        fclose(file);
+        printf("%s: %lu spans, %lu overwritten\n", options.out.c_str(), static_cast<unsigned long>(response.spans()),
+               static_cast<unsigned long>(response.overwritten()));
+    }
+
+    if (options.start || options.stop || (options.clear && options.out.empty())) {
+        grpc::ClientContext context;
+        context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(2));
+        mavsdk::rpc::gimbal::SetTracingRequest request;
+        mavsdk::rpc::gimbal::SetTracingResponse response;
+        request.set_enabled(!options.stop && (options.start || options.clear));
+        request.set_clear(options.clear && options.out.empty());
+        if (failed("SetTracing", stub->SetTracing(&context, request, &response))) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return 0;
+
+}